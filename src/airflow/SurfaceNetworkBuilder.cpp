@@ -14,14 +14,167 @@
 #include "../model/Surface_Impl.hpp"
 #include "../model/SubSurface.hpp"
 #include "../model/SubSurface_Impl.hpp"
+#include "../model/Model_Impl.hpp"
+
+#include "SurfaceNetworkTracker.hpp"
 
 #include "../utilities/plot/ProgressBar.hpp"
 
+#include <utilities/idd/IddEnums.hxx>
+
 #include <thread>
 
 namespace openstudio {
 namespace airflow {
 
+  namespace detail {
+
+    SurfaceNetworkWatcher::SurfaceNetworkWatcher(SurfaceNetworkTracker& tracker, const model::ModelObject& object)
+      : m_tracker(tracker), m_iddObjectType(object.iddObjectType()), m_handle(object.handle()) {
+      auto impl = object.getImpl<model::detail::ModelObject_Impl>();
+      impl->onChange.connect<SurfaceNetworkWatcher, &SurfaceNetworkWatcher::change>(this);
+      impl->onRemoveFromWorkspace.connect<SurfaceNetworkWatcher, &SurfaceNetworkWatcher::remove>(this);
+    }
+
+    void SurfaceNetworkWatcher::change() {
+      m_tracker.markChanged(m_iddObjectType, m_handle);
+    }
+
+    void SurfaceNetworkWatcher::remove(const Handle& /*handle*/) {
+      m_tracker.markChanged(m_iddObjectType, m_handle);
+    }
+
+    SurfaceNetworkTracker::SurfaceNetworkTracker(model::Model& model) : m_model(model.getImpl<model::detail::Model_Impl>()) {
+      model.getImpl<model::detail::Model_Impl>()->addWorkspaceObject.connect<SurfaceNetworkTracker, &SurfaceNetworkTracker::objectAdded>(this);
+    }
+
+    bool SurfaceNetworkTracker::isTracking(const model::Model& model) const {
+      return !m_model.expired() && (m_model.lock() == model.getImpl<model::detail::Model_Impl>());
+    }
+
+    void SurfaceNetworkTracker::objectAdded(const WorkspaceObject& /*object*/, const openstudio::IddObjectType& type,
+                                            const openstudio::UUID& handle) {
+      markChanged(type, handle);
+    }
+
+    void SurfaceNetworkTracker::markChanged(const IddObjectType& type, const Handle& handle) {
+      if (type == IddObjectType::OS_Surface) {
+        m_changedSurfaces.insert(handle);
+      } else if (type == IddObjectType::OS_SubSurface) {
+        m_changedSubSurfaces.insert(handle);
+      } else if (type == IddObjectType::OS_Space) {
+        m_changedSpaces.insert(handle);
+      }
+    }
+
+    void SurfaceNetworkTracker::watch(const model::ModelObject& object) {
+      auto [it, inserted] = m_watchers.try_emplace(object.handle());
+      if (inserted) {
+        it->second = std::make_unique<SurfaceNetworkWatcher>(*this, object);
+      }
+    }
+
+    void SurfaceNetworkTracker::record(const model::Surface& surface, bool linked) {
+      SurfaceRecord& record = m_surfaces[surface.handle()];
+      record = SurfaceRecord();
+      record.linked = linked;
+      watch(surface);
+      if (boost::optional<model::Space> space = surface.space()) {
+        record.space = space->handle();
+        m_spaceSurfaces[record.space].insert(surface.handle());
+        watch(space.get());
+      }
+      if (boost::optional<model::Surface> adjacentSurface = surface.adjacentSurface()) {
+        record.adjacentSurface = adjacentSurface->handle();
+      }
+      for (const model::SubSurface& subSurface : surface.subSurfaces()) {
+        m_subSurfaceParents[subSurface.handle()] = surface.handle();
+        watch(subSurface);
+      }
+    }
+
+    bool SurfaceNetworkTracker::forget(const Handle& surface) {
+      auto it = m_surfaces.find(surface);
+      if (it == m_surfaces.end()) {
+        return false;
+      }
+      bool linked = it->second.linked;
+      if (!it->second.space.isNull()) {
+        m_spaceSurfaces[it->second.space].erase(surface);
+      }
+      m_surfaces.erase(it);
+      return linked;
+    }
+
+    std::vector<Handle> SurfaceNetworkTracker::takeChangedSurfaces(const model::Model& model) {
+      HandleSet result = std::move(m_changedSurfaces);
+      m_changedSurfaces.clear();
+
+      for (const Handle& handle : m_changedSubSurfaces) {
+        auto it = m_subSurfaceParents.find(handle);
+        if (it != m_subSurfaceParents.end()) {
+          result.insert(it->second);
+        }
+        boost::optional<model::SubSurface> subSurface = model.getModelObject<model::SubSurface>(handle);
+        if (!subSurface) {
+          m_watchers.erase(handle);
+          m_subSurfaceParents.erase(handle);
+          continue;
+        }
+        if (boost::optional<model::Surface> surface = subSurface->surface()) {
+          result.insert(surface->handle());
+        }
+      }
+      m_changedSubSurfaces.clear();
+
+      for (const Handle& handle : m_changedSpaces) {
+        auto it = m_spaceSurfaces.find(handle);
+        if (it != m_spaceSurfaces.end()) {
+          result.insert(it->second.begin(), it->second.end());
+        }
+        boost::optional<model::Space> space = model.getModelObject<model::Space>(handle);
+        if (!space) {
+          m_watchers.erase(handle);
+          m_spaceSurfaces.erase(handle);
+          continue;
+        }
+        for (const model::Surface& surface : space->surfaces()) {
+          result.insert(surface.handle());
+        }
+      }
+      m_changedSpaces.clear();
+
+      // An interior pair is linked from one of its surfaces only, so both surfaces of a pair, as it was or as it is now, are walked again
+      std::vector<Handle> toVisit(result.begin(), result.end());
+      while (!toVisit.empty()) {
+        Handle handle = toVisit.back();
+        toVisit.pop_back();
+        std::vector<Handle> paired;
+        auto it = m_surfaces.find(handle);
+        if (it != m_surfaces.end() && it->second.adjacentSurface) {
+          paired.push_back(it->second.adjacentSurface.get());
+        }
+        boost::optional<model::Surface> surface = model.getModelObject<model::Surface>(handle);
+        if (surface) {
+          if (boost::optional<model::Surface> adjacentSurface = surface->adjacentSurface()) {
+            paired.push_back(adjacentSurface->handle());
+          }
+        } else {
+          m_watchers.erase(handle);
+        }
+        for (const Handle& other : paired) {
+          if (result.insert(other).second) {
+            toVisit.push_back(other);
+          }
+        }
+      }
+
+      return {result.begin(), result.end()};
+    }
+
+  }  // namespace detail
+
+
   SurfaceNetworkBuilder::SurfaceNetworkBuilder(ProgressBar* progressBar) : m_progressBar(progressBar) {
     m_logSink.setLogLevel(Info);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.model\\.SurfaceNetworkBuilder"));
@@ -29,6 +182,8 @@ namespace airflow {
     m_progressBar = nullptr;
   }
 
+  SurfaceNetworkBuilder::~SurfaceNetworkBuilder() = default;
+
   void SurfaceNetworkBuilder::progress() {
     if (m_progressBar) {
       m_progressBar->setValue(m_progressBar->value() + 1);
@@ -71,116 +226,167 @@ namespace airflow {
     return true;
   }
 
-  bool SurfaceNetworkBuilder::build(model::Model& model) {
-    bool first = true;
-    bool nowarnings = true;
-    std::vector<openstudio::Handle> used;
-
-    m_logSink.setThreadId(std::this_thread::get_id());
-    m_logSink.resetStringStream();
-
-    std::vector<model::Surface> surfaces = model.getConcreteModelObjects<model::Surface>();
-
-    initProgress(surfaces.size(), "Processing surfaces for network creation");
+  void SurfaceNetworkBuilder::unlinkSurface(const Handle& surface) {
+    LOG(Info, "Surface '" << openstudio::toString(surface) << "' is unlinked");
+  }
 
-    for (const model::Surface& surface : surfaces) {
-      if (!first) {
-        progress();
+  bool SurfaceNetworkBuilder::buildSurface(const model::Surface& surface, HandleSet& used, bool& linked) {
+    linked = false;
+    std::string bc = surface.outsideBoundaryCondition();
+    if (bc == "Outdoors") {
+      // Get the associated thermal zone
+      boost::optional<openstudio::model::Space> space = surface.space();
+      if (!space) {
+        LOG(Warn, "Unattached surface '" << openstudio::toString(surface.handle()) << "'");
+        return false;
       }
-      first = false;
-      std::string bc = surface.outsideBoundaryCondition();
-      if (bc == "Outdoors") {
-        // Get the associated thermal zone
-        boost::optional<openstudio::model::Space> space = surface.space();
-        if (!space) {
-          LOG(Warn, "Unattached surface '" << openstudio::toString(surface.handle()) << "'");
-          nowarnings = false;
-          continue;
-        }
-        boost::optional<openstudio::model::ThermalZone> thermalZone = space->thermalZone();
-        if (!thermalZone) {
-          LOG(Warn, "Unzoned space '" << openstudio::toString(space->handle()) << "'");
-          nowarnings = false;
-          continue;
-        }
-        // If we made it to here, then the exterior surface is good.
-        linkExteriorSurface(thermalZone.get(), space.get(), surface);
-        for (const model::SubSurface& subSurface : surface.subSurfaces()) {
-          linkExteriorSubSurface(thermalZone.get(), space.get(), surface, subSurface);
-        }
-      } else if ((std::find(used.begin(), used.end(), surface.handle()) == used.end()) && (bc == "Surface")) {
-        // Get the associated thermal zone
-        boost::optional<openstudio::model::Space> space = surface.space();
-        if (!space) {
-          LOG(Warn, "Unattached surface '" << openstudio::toString(surface.handle()) << "'");
+      boost::optional<openstudio::model::ThermalZone> thermalZone = space->thermalZone();
+      if (!thermalZone) {
+        LOG(Warn, "Unzoned space '" << openstudio::toString(space->handle()) << "'");
+        return false;
+      }
+      // If we made it to here, then the exterior surface is good.
+      linkExteriorSurface(thermalZone.get(), space.get(), surface);
+      linked = true;
+      for (const model::SubSurface& subSurface : surface.subSurfaces()) {
+        linkExteriorSubSurface(thermalZone.get(), space.get(), surface, subSurface);
+      }
+    } else if ((used.find(surface.handle()) == used.end()) && (bc == "Surface")) {
+      // Get the associated thermal zone
+      boost::optional<openstudio::model::Space> space = surface.space();
+      if (!space) {
+        LOG(Warn, "Unattached surface '" << openstudio::toString(surface.handle()) << "'");
+        return false;
+      }
+      boost::optional<openstudio::model::ThermalZone> thermalZone = space->thermalZone();
+      if (!thermalZone) {
+        LOG(Warn, "Unzoned space '" << openstudio::toString(space->handle()) << "'");
+        return false;
+      }
+      boost::optional<openstudio::model::Surface> adjacentSurface = surface.adjacentSurface();
+      if (!adjacentSurface) {
+        LOG(Error, "Unable to find adjacent surface for surface '" << openstudio::toString(surface.handle()) << "'");
+        return false;
+      }
+      boost::optional<openstudio::model::Space> adjacentSpace = adjacentSurface->space();
+      if (!adjacentSpace) {
+        LOG(Error, "Unattached adjacent surface '" << openstudio::toString(adjacentSurface->handle()) << "'");
+        return false;
+      }
+      boost::optional<openstudio::model::ThermalZone> adjacentZone = adjacentSpace->thermalZone();
+      if (!thermalZone) {
+        LOG(Warn, "Unzoned adjacent space '" << openstudio::toString(adjacentSpace->handle()) << "'");
+        return false;
+      }
+      bool nowarnings = true;
+      // We could punt the checking of subsurfaces until later, but it is best to get this out of the way now
+      for (const model::SubSurface& subSurface : surface.subSurfaces()) {
+        boost::optional<model::SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface();
+        if (!adjacentSubSurface) {
+          LOG(Warn, "Unable to find adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "'");
           nowarnings = false;
           continue;
         }
-        boost::optional<openstudio::model::ThermalZone> thermalZone = space->thermalZone();
-        if (!thermalZone) {
-          LOG(Warn, "Unzoned space '" << openstudio::toString(space->handle()) << "'");
+        if (adjacentSubSurface->surface() != adjacentSurface) {
+          LOG(Warn,
+              "Adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "' is not attached to the expected surface");
           nowarnings = false;
           continue;
         }
-        boost::optional<openstudio::model::Surface> adjacentSurface = surface.adjacentSurface();
-        if (!adjacentSurface) {
-          LOG(Error, "Unable to find adjacent surface for surface '" << openstudio::toString(surface.handle()) << "'");
+      }
+      // Ok, now we a surface, a space, a zone, an adjacent surface, an adjacent space, and an adjacent zone. Finally.
+      used.insert(adjacentSurface->handle());
+      if (thermalZone == adjacentZone) {
+        return nowarnings;
+      }
+      // Now have a surface that is fully connected and separates two zones so it can be linked
+      linkInteriorSurface(thermalZone.get(), space.get(), surface, adjacentSurface.get(), adjacentSpace.get(), adjacentZone.get());
+      linked = true;
+      // Link subsurfaces
+      for (const model::SubSurface& subSurface : surface.subSurfaces()) {
+        // Now we need to check the connections as we did with the surface
+        boost::optional<model::SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface();
+        if (!adjacentSubSurface) {
+          LOG(Warn, "Unable to find adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "'");
           nowarnings = false;
           continue;
         }
-        boost::optional<openstudio::model::Space> adjacentSpace = adjacentSurface->space();
-        if (!adjacentSpace) {
-          LOG(Error, "Unattached adjacent surface '" << openstudio::toString(adjacentSurface->handle()) << "'");
+        if (adjacentSubSurface->surface() != adjacentSurface) {
+          LOG(Warn,
+              "Adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "' is not attached to the expected surface");
           nowarnings = false;
           continue;
         }
-        boost::optional<openstudio::model::ThermalZone> adjacentZone = adjacentSpace->thermalZone();
-        if (!thermalZone) {
-          LOG(Warn, "Unzoned adjacent space '" << openstudio::toString(adjacentSpace->handle()) << "'");
-          nowarnings = false;
-          continue;
+        // If we made it here, then the subsurface is fully connected and can be linked
+        linkInteriorSubSurface(thermalZone.get(), space.get(), surface, subSurface, adjacentSubSurface.get(), adjacentSurface.get(),
+                               adjacentSpace.get(), adjacentZone.get());
+      }
+      return nowarnings;
+    }
+    return true;
+  }
+
+  bool SurfaceNetworkBuilder::build(model::Model& model) {
+    bool first = true;
+    bool nowarnings = true;
+    HandleSet used;
+
+    m_logSink.setThreadId(std::this_thread::get_id());
+    m_logSink.resetStringStream();
+
+    if (m_incremental && m_tracker && m_tracker->isTracking(model)) {
+      // Only walk the surfaces that changed since the last build, after removing their links
+      std::vector<Handle> handles = m_tracker->takeChangedSurfaces(model);
+
+      initProgress(handles.size(), "Processing changed surfaces for network update");
+
+      for (const Handle& handle : handles) {
+        if (m_tracker->forget(handle)) {
+          unlinkSurface(handle);
         }
-        // We could punt the checking of subsurfaces until later, but it is best to get this out of the way now
-        for (const model::SubSurface& subSurface : surface.subSurfaces()) {
-          boost::optional<model::SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface();
-          if (!adjacentSubSurface) {
-            LOG(Warn, "Unable to find adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "'");
-            nowarnings = false;
-            continue;
-          }
-          if (adjacentSubSurface->surface() != adjacentSurface) {
-            LOG(Warn,
-                "Adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "' is not attached to the expected surface");
-            nowarnings = false;
-            continue;
-          }
+      }
+      for (const Handle& handle : handles) {
+        if (!first) {
+          progress();
         }
-        // Ok, now we a surface, a space, a zone, an adjacent surface, an adjacent space, and an adjacent zone. Finally.
-        used.push_back(adjacentSurface->handle());
-        if (thermalZone == adjacentZone) {
+        first = false;
+        boost::optional<model::Surface> surface = model.getModelObject<model::Surface>(handle);
+        if (!surface) {
           continue;
         }
-        // Now have a surface that is fully connected and separates two zones so it can be linked
-        linkInteriorSurface(thermalZone.get(), space.get(), surface, adjacentSurface.get(), adjacentSpace.get(), adjacentZone.get());
-        // Link subsurfaces
-        for (const model::SubSurface& subSurface : surface.subSurfaces()) {
-          // Now we need to check the connections as we did with the surface
-          boost::optional<model::SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface();
-          if (!adjacentSubSurface) {
-            LOG(Warn, "Unable to find adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "'");
-            nowarnings = false;
-            continue;
-          }
-          if (adjacentSubSurface->surface() != adjacentSurface) {
-            LOG(Warn,
-                "Adjacent subsurface for subsurface of '" << openstudio::toString(surface.handle()) << "' is not attached to the expected surface");
-            nowarnings = false;
-            continue;
-          }
-          // If we made it here, then the subsurface is fully connected and can be linked
-          linkInteriorSubSurface(thermalZone.get(), space.get(), surface, subSurface, adjacentSubSurface.get(), adjacentSurface.get(),
-                                 adjacentSpace.get(), adjacentZone.get());
+        bool linked = false;
+        if (!buildSurface(surface.get(), used, linked)) {
+          nowarnings = false;
         }
+        m_tracker->record(surface.get(), linked);
+      }
+      if (!handles.empty()) {
+        progress();
+      }
+      return nowarnings;
+    }
+
+    if (m_incremental) {
+      m_tracker = std::make_unique<detail::SurfaceNetworkTracker>(model);
+    } else {
+      m_tracker.reset();
+    }
+
+    std::vector<model::Surface> surfaces = model.getConcreteModelObjects<model::Surface>();
+
+    initProgress(surfaces.size(), "Processing surfaces for network creation");
+
+    for (const model::Surface& surface : surfaces) {
+      if (!first) {
+        progress();
+      }
+      first = false;
+      bool linked = false;
+      if (!buildSurface(surface, used, linked)) {
+        nowarnings = false;
+      }
+      if (m_tracker) {
+        m_tracker->record(surface, linked);
       }
     }
     if (!surfaces.empty()) {
@@ -225,5 +431,14 @@ namespace airflow {
     m_progressBar = progressBar;
   }
 
+  bool SurfaceNetworkBuilder::incremental() const {
+    return m_incremental;
+  }
+
+  void SurfaceNetworkBuilder::setIncremental(bool incremental) {
+    m_incremental = incremental;
+    m_tracker.reset();
+  }
+
 }  // namespace airflow
 }  // namespace openstudio
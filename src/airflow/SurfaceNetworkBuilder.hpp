@@ -6,12 +6,14 @@
 #ifndef AIRFLOW_SURFACENETWORKBUILDER_HPP
 #define AIRFLOW_SURFACENETWORKBUILDER_HPP
 
+#include <memory>
 #include <vector>
 
 #include "AirflowAPI.hpp"
 
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/idf/Handle.hpp"
 
 namespace openstudio {
 
@@ -26,6 +28,10 @@ namespace model {
 
 namespace airflow {
 
+  namespace detail {
+    class SurfaceNetworkTracker;
+  }
+
   /** SurfaceNetworkBuilder objects walk the OpenStudio model as a network of surfaces.
  *
  *  The SurfaceNetworkBuilder object walks the OpenStudio model as a network of surface,
@@ -33,6 +39,9 @@ namespace airflow {
  *  once for each exterior surface or subsurface. The intended usage is to subclass for a
  *  specific application.
  *
+ *  In incremental mode, the builder records which surfaces it linked and watches the model for changes, so that
+ *  rebuilding the network after an edit only walks the surfaces that the edit affected.
+ *
  */
   class AIRFLOW_API SurfaceNetworkBuilder
   {
@@ -42,7 +51,10 @@ namespace airflow {
     /** Construct a new object. */
     explicit SurfaceNetworkBuilder(ProgressBar* progressBar = nullptr);
     /** Destroy the translator.*/
-    virtual ~SurfaceNetworkBuilder() = default;
+    virtual ~SurfaceNetworkBuilder();
+
+    SurfaceNetworkBuilder(const SurfaceNetworkBuilder&) = delete;
+    SurfaceNetworkBuilder& operator=(const SurfaceNetworkBuilder&) = delete;
 
     //@}
     /** @name Network Construction Functions */
@@ -60,6 +72,16 @@ namespace airflow {
     /** Sets the progress bar to be updated by the object. */
     void setProgressBar(ProgressBar* progressBar);
 
+    /** Returns true if build only walks the surfaces that changed since the previous build of the same model. */
+    bool incremental() const;
+
+    /** Sets the incremental mode. In incremental mode, the first build walks the whole model and watches its surfaces, subsurfaces
+     *  and spaces. The following builds of the same model only walk the surfaces that were added, removed or modified (geometry,
+     *  boundary condition, adjacent surface, construction, space or subsurfaces) or whose space changed thermal zone since then,
+     *  along with the surfaces they are or were paired with. Surfaces that were linked are unlinked with unlinkSurface before they
+     *  are walked again. Changing the mode, or building another model, forgets what was recorded. */
+    void setIncremental(bool incremental);
+
     //@}
     /** @name Miscellaneous Functions */
     //@{
@@ -90,9 +112,19 @@ namespace airflow {
                                         model::SubSurface adjacentSubSurface, model::Surface adjacentSurface, model::Space adjacentSpace,
                                         model::ThermalZone adjacentZone);
 
+    /** Called in incremental mode for a surface that was linked by a previous build (by linkExteriorSurface, or as the first
+     *  surface of linkInteriorSurface) before it is walked again, or once it has been removed from the model. The links made for
+     *  the surface and its subsurfaces should be removed. */
+    virtual void unlinkSurface(const Handle& surface);
+
    private:
+    // Walks one surface, linked is set to true if linkExteriorSurface or linkInteriorSurface was called
+    bool buildSurface(const model::Surface& surface, HandleSet& used, bool& linked);
+
     ProgressBar* m_progressBar;
     StringStreamLogSink m_logSink;
+    bool m_incremental = false;
+    std::unique_ptr<detail::SurfaceNetworkTracker> m_tracker;
 
     REGISTER_LOGGER("openstudio.airflow.SurfaceNetworkBuilder");
   };
@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef AIRFLOW_SURFACENETWORKTRACKER_HPP
+#define AIRFLOW_SURFACENETWORKTRACKER_HPP
+
+#include "../model/Model.hpp"
+#include "../model/Surface.hpp"
+
+#include "../nano/nano_signal_slot.hpp"
+
+#include "../utilities/idf/Handle.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+namespace airflow {
+  namespace detail {
+
+    class SurfaceNetworkTracker;
+
+    /** Reports the changes and the removal of one surface, subsurface or space to a SurfaceNetworkTracker */
+    class SurfaceNetworkWatcher : public Nano::Observer
+    {
+     public:
+      SurfaceNetworkWatcher(SurfaceNetworkTracker& tracker, const model::ModelObject& object);
+
+      void change();
+      void remove(const Handle& handle);
+
+     private:
+      SurfaceNetworkTracker& m_tracker;
+      IddObjectType m_iddObjectType;
+      Handle m_handle;
+    };
+
+    /** Records the surfaces walked by the last build of a SurfaceNetworkBuilder in incremental mode, and collects the changes made to
+     *  the model since then. */
+    class SurfaceNetworkTracker : public Nano::Observer
+    {
+     public:
+      explicit SurfaceNetworkTracker(model::Model& model);
+
+      /** Returns true if the changes of model are the ones being collected */
+      bool isTracking(const model::Model& model) const;
+
+      void objectAdded(const WorkspaceObject& object, const openstudio::IddObjectType& type, const openstudio::UUID& handle);
+
+      void markChanged(const IddObjectType& type, const Handle& handle);
+
+      /** Records that surface was walked, linked is true if it was linked. The surface, its subsurfaces and its space are watched */
+      void record(const model::Surface& surface, bool linked);
+
+      /** Forgets what was recorded for surface, returns true if it was linked */
+      bool forget(const Handle& surface);
+
+      /** Returns the surfaces affected by the changes since the last call (some may have been removed from model), and clears the
+       *  changes. Both surfaces of any interior pair, as recorded or as in the model, are included. */
+      std::vector<Handle> takeChangedSurfaces(const model::Model& model);
+
+     private:
+      struct SurfaceRecord
+      {
+        bool linked = false;
+        Handle space;
+        boost::optional<Handle> adjacentSurface;
+      };
+
+      void watch(const model::ModelObject& object);
+
+      std::weak_ptr<model::detail::Model_Impl> m_model;
+
+      std::map<Handle, SurfaceRecord> m_surfaces;
+      std::map<Handle, HandleSet> m_spaceSurfaces;
+      std::map<Handle, Handle> m_subSurfaceParents;
+      std::map<Handle, std::unique_ptr<SurfaceNetworkWatcher>> m_watchers;
+
+      HandleSet m_changedSurfaces;
+      HandleSet m_changedSubSurfaces;
+      HandleSet m_changedSpaces;
+    };
+
+  }  // namespace detail
+}  // namespace airflow
+}  // namespace openstudio
+
+#endif  // AIRFLOW_SURFACENETWORKTRACKER_HPP
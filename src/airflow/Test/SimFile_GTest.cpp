@@ -0,0 +1,82 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+TEST_F(AirflowFixture, SimFile_Columns) {
+  // The results simread would write for 2 paths (listed out of order) and 2 nodes (ambient and one zone) at 3 times
+  openstudio::path simPath = openstudio::toPath("./SimFile_Columns.sim");
+  {
+    openstudio::filesystem::ofstream lfr(openstudio::toPath("./SimFile_Columns.lfr"));
+    lfr << "day\ttime\tP#\tdP\tF0\tF1\n";
+    openstudio::filesystem::ofstream nfr(openstudio::toPath("./SimFile_Columns.nfr"));
+    nfr << "day\ttime\tZ#\tT\tP\tD\n";
+    for (int t = 0; t < 3; ++t) {
+      for (int nr : {7, 3}) {
+        lfr << "1/1\t0" << t << ":00:00\t" << nr << '\t' << 0.5 * nr << '\t' << nr + t << '\t' << -0.25 * t << '\n';
+      }
+      for (int nr = 0; nr < 2; ++nr) {
+        // No density for the ambient node
+        nfr << "1/1\t0" << t << ":00:00\t" << nr << '\t' << 293.15 + t << '\t' << 10.0 * nr << '\t' << (nr == 0 ? "" : "1.2") << '\n';
+      }
+    }
+  }
+
+  openstudio::contam::SimFile sim(simPath);
+
+  ASSERT_EQ(3u, sim.fileDateTimes().size());
+  EXPECT_EQ(2u, sim.dateTimes().size());
+
+  // Columns are in order of first appearance
+  ASSERT_EQ(2u, sim.pathNumbers().size());
+  EXPECT_EQ(7, sim.pathNumbers()[0]);
+  EXPECT_EQ(3, sim.pathNumbers()[1]);
+  ASSERT_EQ(2u, sim.F0Columns().numberOfColumns());
+  ASSERT_EQ(3u, sim.F0Columns().numberOfRows());
+  std::span<const double> f0 = sim.F0Columns().column(1);
+  EXPECT_DOUBLE_EQ(3.0, f0[0]);
+  EXPECT_DOUBLE_EQ(4.0, f0[1]);
+  EXPECT_DOUBLE_EQ(5.0, f0[2]);
+
+  std::vector<std::vector<double>> dP = sim.dP();
+  ASSERT_EQ(2u, dP.size());
+  ASSERT_EQ(3u, dP[0].size());
+  EXPECT_DOUBLE_EQ(3.5, dP[0][2]);
+  EXPECT_DOUBLE_EQ(1.5, dP[1][2]);
+
+  ASSERT_EQ(2u, sim.nodeNumbers().size());
+  EXPECT_DOUBLE_EQ(0.0, sim.DColumns().column(0)[1]);
+  EXPECT_DOUBLE_EQ(1.2, sim.DColumns().column(1)[1]);
+  boost::optional<openstudio::TimeSeries> temperature = sim.nodeTemperature(1);
+  ASSERT_TRUE(temperature);
+  EXPECT_DOUBLE_EQ(293.65, temperature->values()[0]);
+
+  // Total flow is F0 + F1 averaged over each interval
+  std::vector<boost::optional<openstudio::TimeSeries>> flows = sim.pathFlows({3, 5, 7});
+  ASSERT_EQ(3u, flows.size());
+  ASSERT_TRUE(flows[0]);
+  EXPECT_FALSE(flows[1]);
+  ASSERT_TRUE(flows[2]);
+  ASSERT_EQ(2u, flows[0]->values().size());
+  EXPECT_DOUBLE_EQ(0.5 * ((3.0 + 0.0) + (4.0 - 0.25)), flows[0]->values()[0]);
+  EXPECT_DOUBLE_EQ(0.5 * ((4.0 - 0.25) + (5.0 - 0.5)), flows[0]->values()[1]);
+  EXPECT_DOUBLE_EQ(0.5 * ((8.0 - 0.25) + (9.0 - 0.5)), flows[2]->values()[1]);
+  EXPECT_EQ(sim.dateTimes(), flows[0]->dateTimes());
+
+  for (int nr : {3, 7}) {
+    boost::optional<openstudio::TimeSeries> flow = sim.pathFlow(nr);
+    ASSERT_TRUE(flow);
+    EXPECT_EQ(flows[nr == 3 ? 0 : 2]->values().size(), flow->values().size());
+    for (unsigned i = 0; i < flow->values().size(); ++i) {
+      EXPECT_DOUBLE_EQ(flows[nr == 3 ? 0 : 2]->values()[i], flow->values()[i]);
+    }
+  }
+  EXPECT_FALSE(sim.pathFlow(5));
+}
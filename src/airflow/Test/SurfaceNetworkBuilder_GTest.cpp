@@ -13,7 +13,9 @@
 #include "../../model/Space_Impl.hpp"
 #include "../../model/SpaceType.hpp"
 #include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
 #include "../../model/SubSurface.hpp"
+#include "../../model/Construction.hpp"
 #include "../../model/ThermalZone.hpp"
 #include "../../model/ThermalZone_Impl.hpp"
 #include "../../osversion/VersionTranslator.hpp"
@@ -107,3 +109,92 @@ TEST_F(AirflowFixture, SurfaceNetworkBuilder_DemoModel_2014) {
   EXPECT_EQ(3, counter.interiorSubSurface);
   EXPECT_EQ(28, counter.exteriorSubSurface);
 }
+
+class IncrementalSurfaceCounter : public SurfaceCounter
+{
+ public:
+  IncrementalSurfaceCounter() {
+    setIncremental(true);
+  }
+
+  virtual void clear() override {
+    SurfaceCounter::clear();
+    unlinked = 0;
+  }
+
+  int unlinked = 0;
+
+ protected:
+  virtual void unlinkSurface(const openstudio::Handle& /*surface*/) override {
+    unlinked++;
+  }
+};
+
+TEST_F(AirflowFixture, SurfaceNetworkBuilder_Incremental) {
+  openstudio::path modelPath = (resourcesPath() / openstudio::toPath("contam") / openstudio::toPath("CONTAMTemplate.osm"));
+  openstudio::osversion::VersionTranslator vt;
+  boost::optional<openstudio::model::Model> optionalModel = vt.loadModel(modelPath);
+  ASSERT_TRUE(optionalModel);
+  openstudio::model::Model model = optionalModel.get();
+
+  boost::optional<openstudio::model::Model> demoModel = buildDemoModel2014(model);
+  ASSERT_TRUE(demoModel);
+
+  IncrementalSurfaceCounter counter;
+  EXPECT_TRUE(counter.incremental());
+  counter.clear();
+
+  // The first build walks everything
+  EXPECT_TRUE(counter.build(demoModel.get()));
+  EXPECT_EQ(5, counter.interiorSurface);
+  EXPECT_EQ(12, counter.exteriorSurface);
+  EXPECT_EQ(3, counter.interiorSubSurface);
+  EXPECT_EQ(28, counter.exteriorSubSurface);
+  EXPECT_EQ(0, counter.unlinked);
+
+  // Nothing changed
+  counter.clear();
+  EXPECT_TRUE(counter.build(demoModel.get()));
+  EXPECT_EQ(0, counter.interiorSurface + counter.exteriorSurface + counter.interiorSubSurface + counter.exteriorSubSurface);
+  EXPECT_EQ(0, counter.unlinked);
+
+  boost::optional<openstudio::model::Surface> exteriorSurface;
+  boost::optional<openstudio::model::Surface> interiorSurface;
+  for (const auto& surface : demoModel->getConcreteModelObjects<openstudio::model::Surface>()) {
+    if (!exteriorSurface && surface.outsideBoundaryCondition() == "Outdoors" && !surface.subSurfaces().empty()) {
+      exteriorSurface = surface;
+    } else if (!interiorSurface && surface.adjacentSurface()
+               && surface.space()->thermalZone() != surface.adjacentSurface()->space()->thermalZone()) {
+      interiorSurface = surface;
+    }
+  }
+  ASSERT_TRUE(exteriorSurface);
+  ASSERT_TRUE(interiorSurface);
+
+  // A new construction on an exterior surface only relinks that surface and its subsurfaces
+  openstudio::model::Construction construction(demoModel.get());
+  EXPECT_TRUE(exteriorSurface->setConstruction(construction));
+  counter.clear();
+  EXPECT_TRUE(counter.build(demoModel.get()));
+  EXPECT_EQ(0, counter.interiorSurface);
+  EXPECT_EQ(1, counter.exteriorSurface);
+  EXPECT_EQ(0, counter.interiorSubSurface);
+  EXPECT_EQ(static_cast<int>(exteriorSurface->subSurfaces().size()), counter.exteriorSubSurface);
+  EXPECT_EQ(1, counter.unlinked);
+
+  // Interior pairs are linked once, whichever surface of the pair changed
+  EXPECT_TRUE(interiorSurface->adjacentSurface()->setConstruction(construction));
+  counter.clear();
+  EXPECT_TRUE(counter.build(demoModel.get()));
+  EXPECT_EQ(1, counter.interiorSurface);
+  EXPECT_EQ(0, counter.exteriorSurface);
+  EXPECT_EQ(0, counter.exteriorSubSurface);
+  EXPECT_EQ(1, counter.unlinked);
+
+  // A removed surface is only unlinked
+  exteriorSurface->remove();
+  counter.clear();
+  EXPECT_TRUE(counter.build(demoModel.get()));
+  EXPECT_EQ(0, counter.interiorSurface + counter.exteriorSurface + counter.interiorSubSurface + counter.exteriorSubSurface);
+  EXPECT_EQ(1, counter.unlinked);
+}
@@ -0,0 +1,105 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../SurfaceNetworkBuilder.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
+#include "../../model/SubSurface.hpp"
+#include "../../model/ThermalZone.hpp"
+#include "../../model/Construction.hpp"
+
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace openstudio;
+
+// Counts the links, so that the default logging of the links is not what is being measured
+class LinkCounter : public airflow::SurfaceNetworkBuilder
+{
+ public:
+  int links = 0;
+
+ protected:
+  virtual bool linkExteriorSurface(model::ThermalZone /*zone*/, model::Space /*space*/, model::Surface /*surface*/) override {
+    links++;
+    return true;
+  }
+  virtual bool linkExteriorSubSurface(model::ThermalZone /*zone*/, model::Space /*space*/, model::Surface /*surface*/,
+                                      model::SubSurface /*subSurface*/) override {
+    links++;
+    return true;
+  }
+  virtual bool linkInteriorSurface(model::ThermalZone /*zone*/, model::Space /*space*/, model::Surface /*surface*/,
+                                   model::Surface /*adjacentSurface*/, model::Space /*adjacentSpace*/, model::ThermalZone /*adjacentZone*/) override {
+    links++;
+    return true;
+  }
+  virtual bool linkInteriorSubSurface(model::ThermalZone /*zone*/, model::Space /*space*/, model::Surface /*surface*/,
+                                      model::SubSurface /*subSurface*/, model::SubSurface /*adjacentSubSurface*/, model::Surface /*adjacentSurface*/,
+                                      model::Space /*adjacentSpace*/, model::ThermalZone /*adjacentZone*/) override {
+    links++;
+    return true;
+  }
+  virtual void unlinkSurface(const Handle& /*surface*/) override {
+    links--;
+  }
+};
+
+// A single story grid of nSpaces 3m x 3m x 3m spaces, one zone per space, with matched interior walls
+static model::Model gridModel(int nSpaces) {
+  model::Model model;
+  const int nPerRow = std::max(1, static_cast<int>(std::sqrt(nSpaces)));
+  const double s = 3.0;
+  std::vector<model::Space> spaces;
+  for (int i = 0; i < nSpaces; ++i) {
+    const double x = s * (i % nPerRow);
+    const double y = s * (i / nPerRow);
+    std::vector<Point3d> floorPrint{{x, y + s, 0}, {x + s, y + s, 0}, {x + s, y, 0}, {x, y, 0}};
+    boost::optional<model::Space> space = model::Space::fromFloorPrint(floorPrint, s, model);
+    model::ThermalZone zone(model);
+    space->setThermalZone(zone);
+    spaces.push_back(space.get());
+  }
+  model::matchSurfaces(spaces);
+  return model;
+}
+
+// Each iteration changes the construction of one exterior surface, then rebuilds the network: state.range(1) is 0 for a full build,
+// 1 for an incremental build
+static void BM_SurfaceNetworkBuilder_Rebuild(benchmark::State& state) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  model::Model model = gridModel(static_cast<int>(state.range(0)));
+  std::vector<model::Surface> exteriorSurfaces;
+  for (const auto& surface : model.getConcreteModelObjects<model::Surface>()) {
+    if (surface.outsideBoundaryCondition() == "Outdoors") {
+      exteriorSurfaces.push_back(surface);
+    }
+  }
+  std::vector<model::Construction> constructions{model::Construction(model), model::Construction(model)};
+
+  LinkCounter builder;
+  builder.setIncremental(state.range(1) != 0);
+  builder.build(model);
+
+  size_t i = 0;
+  for (auto _ : state) {
+    exteriorSurfaces[i % exteriorSurfaces.size()].setConstruction(constructions[i % 2]);
+    ++i;
+    benchmark::DoNotOptimize(builder.build(model));
+  }
+}
+
+BENCHMARK(BM_SurfaceNetworkBuilder_Rebuild)->Unit(benchmark::kMillisecond)->ArgsProduct({{100, 1000}, {0, 1}});
@@ -5,19 +5,222 @@
 
 #include "SimFile.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <string_view>
+
 namespace openstudio {
 namespace contam {
 
-  int indexOf(const std::vector<int>& list, int target) {
-    for (size_t i = 0; i < list.size(); ++i) {
-      if (list[i] == target) {
-        return i;
+  namespace {
+
+    // A results file written by simread (.lfr for the paths, .nfr for the nodes): after a header line, each tab delimited line gives the
+    // day, time, number and three values for one path or node at one time
+    struct ResultsTable
+    {
+      // One entry per distinct time
+      std::vector<std::string> day;
+      std::vector<std::string> time;
+      // The path or node numbers, in order of first appearance
+      std::vector<int> numbers;
+      std::unordered_map<int, size_t> index;
+      std::array<SimFileColumns, 3> values;
+    };
+
+    struct ResultsFormat
+    {
+      const char* fileType;
+      const char* numberName;
+      std::array<const char*, 3> valueNames;
+      // Number of columns, and an alternate number of columns that is also accepted
+      size_t ncols;
+      size_t altNcols;
+      // The ambient node (number 0) may have no density
+      bool lastValueOptionalForAmbient;
+    };
+
+    constexpr ResultsFormat lfrFormat{"LFR", "link number", {"pressure difference", "flow 0", "flow 1"}, 6, 6, false};
+    constexpr ResultsFormat nfrFormat{"NFR", "node number", {"temperature", "pressure", "density"}, 6, 8, true};
+
+    size_t countColumns(std::string_view line) {
+      return static_cast<size_t>(std::count(line.begin(), line.end(), '\t')) + 1;
+    }
+
+    // Parses a whole field, like std::stoi/std::stod leading whitespace is skipped and trailing characters are ignored
+    bool parseField(std::string_view field, int& value) {
+      if (field.empty()) {
+        return false;
+      }
+      // Fields are followed by a tab or a line break in the file buffer, so strtol stops at the end of the field
+      char* end = nullptr;
+      errno = 0;
+      long result = std::strtol(field.data(), &end, 10);
+      if (end == field.data() || end > field.data() + field.size() || errno == ERANGE || result < std::numeric_limits<int>::min()
+          || result > std::numeric_limits<int>::max()) {
+        return false;
+      }
+      value = static_cast<int>(result);
+      return true;
+    }
+
+    bool parseField(std::string_view field, double& value) {
+      if (field.empty()) {
+        return false;
+      }
+      char* end = nullptr;
+      double result = std::strtod(field.data(), &end);
+      if (end == field.data() || end > field.data() + field.size()) {
+        return false;
+      }
+      value = result;
+      return true;
+    }
+
+    bool readResults(const std::string& fileName, const ResultsFormat& format, ResultsTable& table) {
+      openstudio::filesystem::ifstream file(openstudio::toPath(fileName), std::ios_base::binary);
+      if (!file.is_open()) {
+        LOG_FREE(Error, "openstudio.contam.SimFile", "Failed to open " << format.fileType << " file '" << fileName << "'");
+        return false;
+      }
+      // Read everything at once, lines are then split in place
+      std::string buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      file.close();
+
+      size_t pos = 0;
+      auto nextLine = [&buffer, &pos]() {
+        size_t eol = buffer.find('\n', pos);
+        if (eol == std::string::npos) {
+          eol = buffer.size();
+        }
+        std::string_view line(buffer.data() + pos, eol - pos);
+        pos = std::min(eol + 1, buffer.size());
+        if (!line.empty() && line.back() == '\r') {
+          line.remove_suffix(1);
+        }
+        return line;
+      };
+
+      // Read the header
+      std::string_view header = nextLine();
+      if (header.empty()) {
+        LOG_FREE(Error, "openstudio.contam.SimFile", "No data in " << format.fileType << " file '" << fileName << "'");
+        return false;
+      }
+      size_t ncols = countColumns(header);
+      if (ncols != format.ncols && ncols != format.altNcols) {
+        LOG_FREE(Error, "openstudio.contam.SimFile",
+                 format.fileType << " file has " << ncols << " columns, not the expected " << format.ncols);
+        return false;
+      }
+
+      // Read the data, row by row: the values are moved to the columns once the number of times is known
+      std::vector<size_t> rowTime;
+      std::vector<size_t> rowColumn;
+      std::vector<double> rowValues;
+      std::array<std::string_view, 8> fields;
+      while (pos < buffer.size()) {
+        std::string_view line = nextLine();
+        if (line.empty()) {
+          continue;
+        }
+        size_t nfields = 0;
+        size_t start = 0;
+        while (true) {
+          size_t tab = line.find('\t', start);
+          if (nfields < fields.size()) {
+            fields[nfields] = line.substr(start, tab == std::string_view::npos ? std::string_view::npos : tab - start);
+          }
+          ++nfields;
+          if (tab == std::string_view::npos) {
+            break;
+          }
+          start = tab + 1;
+        }
+        if (nfields != format.ncols && nfields != format.altNcols) {
+          LOG_FREE(Error, "openstudio.contam.SimFile",
+                   format.fileType << " data line has " << nfields << " columns, not the expected " << format.ncols);
+          return false;
+        }
+
+        if (table.time.empty() || table.time.back() != fields[1]) {
+          table.day.emplace_back(fields[0]);
+          table.time.emplace_back(fields[1]);
+        }
+
+        int nr = 0;
+        if (!parseField(fields[2], nr)) {
+          LOG_FREE(Error, "openstudio.contam.SimFile", "Invalid " << format.numberName << " '" << fields[2] << "'");
+          return false;
+        }
+        auto [it, inserted] = table.index.try_emplace(nr, table.numbers.size());
+        if (inserted) {
+          table.numbers.push_back(nr);
+        }
+
+        for (size_t i = 0; i < 3; ++i) {
+          double value = 0.0;
+          if (!parseField(fields[3 + i], value)) {
+            if (format.lastValueOptionalForAmbient && i == 2 && nr == 0) {
+              value = 0.0;
+            } else {
+              LOG_FREE(Error, "openstudio.contam.SimFile", "Invalid " << format.valueNames[i] << " '" << fields[3 + i] << "'");
+              return false;
+            }
+          }
+          rowValues.push_back(value);
+        }
+        rowTime.push_back(table.time.size() - 1);
+        rowColumn.push_back(it->second);
+      }
+
+      for (auto& values : table.values) {
+        values = SimFileColumns(table.numbers.size(), table.time.size());
       }
+      for (size_t row = 0; row < rowTime.size(); ++row) {
+        for (size_t i = 0; i < 3; ++i) {
+          table.values[i].column(rowColumn[row])[rowTime[row]] = rowValues[3 * row + i];
+        }
+      }
+      return true;
+    }
+
+    // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data, dateTimes are the file date times
+    // and intervalDateTimes the result of SimFile::dateTimes
+    openstudio::TimeSeries convertData(const std::vector<openstudio::DateTime>& dateTimes, const std::vector<openstudio::DateTime>& intervalDateTimes,
+                                       std::span<const double> inputValues, const std::string& units) {
+      if (dateTimes.size() == 1)  // Account for steady simulation results
+      {
+        return openstudio::TimeSeries(dateTimes, createVector(std::vector<double>(inputValues.begin(), inputValues.end())), units);
+      }
+      Vector values(intervalDateTimes.size());
+      for (size_t i = 1; i < dateTimes.size(); i++) {
+        values[i - 1] = 0.5 * (inputValues[i - 1] + inputValues[i]);
+      }
+      return openstudio::TimeSeries(intervalDateTimes, values, units);
+    }
+
+  }  // namespace
+
+  SimFileColumns::SimFileColumns(size_t numberOfColumns, size_t numberOfRows)
+    : m_numberOfColumns(numberOfColumns), m_numberOfRows(numberOfRows), m_values(numberOfColumns * numberOfRows, 0.0) {}
+
+  std::vector<std::vector<double>> SimFileColumns::toVectors() const {
+    std::vector<std::vector<double>> result;
+    result.reserve(m_numberOfColumns);
+    for (size_t i = 0; i < m_numberOfColumns; ++i) {
+      std::span<const double> values = column(i);
+      result.emplace_back(values.begin(), values.end());
     }
-    return -1;
+    return result;
   }
 
   SimFile::SimFile(openstudio::path path) {
@@ -60,116 +263,26 @@ namespace contam {
   }
 
   void SimFile::clearLfr() {
-    m_dP.clear();
-    m_F0.clear();
-    m_F1.clear();
+    m_pathNr.clear();
+    m_pathIndex.clear();
+    m_dP = SimFileColumns();
+    m_F0 = SimFileColumns();
+    m_F1 = SimFileColumns();
   }
 
   bool SimFile::readLfr(const std::string& fileName) {
     clearLfr();
-    std::vector<std::string> day;
-    std::vector<std::string> time;
-    openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-    if (!file.is_open()) {
-      LOG(Error, "Failed to open LFR file '" << fileName << "'");
-      return false;
-    }
-    std::map<int, int> nrMap;
-    // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
-      LOG(Error, "No data in LFR file '" << fileName << "'");
+    ResultsTable table;
+    if (!readResults(fileName, lfrFormat, table)) {
       return false;
     }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
-    unsigned ncols = 6;
-    if (row.size() != ncols) {
-      LOG(Error, "LFR file has " << row.size() << " columns, not the expected " << ncols);
-      return false;
-    }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols) {
-        clearLfr();
-        LOG(Error, "LFR data line has " << row.size() << " columns, not the expected " << ncols);
-        return false;
-      }
-      if (!time.empty()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
-        }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
-
-      int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid link number '" << row[2] << "'");
-        return false;
-      }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_dP.resize(sz + 1);
-        m_F0.resize(sz + 1);
-        m_F1.resize(sz + 1);
-      }
-      double dP = 0;
-      try {
-        dP = std::stod(row[3]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid pressure difference '" << row[3] << "'");
-        return false;
-      }
-
-      double F0 = 0;
-      try {
-        F0 = std::stod(row[4]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid flow 0 '" << row[4] << "'");
-        return false;
-      }
-
-      double F1 = 0;
-      try {
-        F1 = std::stod(row[5]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid flow 1 '" << row[5] << "'");
-        return false;
-      }
-
-      m_dP[nrMap[nr]].push_back(dP);
-      m_F0[nrMap[nr]].push_back(F0);
-      m_F1[nrMap[nr]].push_back(F1);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
-    }
-    m_pathNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_pathNr[nrMap[keys[i]]] = keys[i];
-    }
-    file.close();
+    m_pathNr = std::move(table.numbers);
+    m_pathIndex = std::move(table.index);
+    m_dP = std::move(table.values[0]);
+    m_F0 = std::move(table.values[1]);
+    m_F1 = std::move(table.values[2]);
     // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
-    if (!computeDateTimes(day, time)) {
+    if (!computeDateTimes(table.day, table.time)) {
       clearLfr();
       m_dateTimes.clear();
       LOG(Error, "Failed to compute date and time objects from LFR input");
@@ -179,213 +292,131 @@ namespace contam {
   }
 
   void SimFile::clearNfr() {
-    m_T.clear();
-    m_P.clear();
-    m_D.clear();
+    m_nodeNr.clear();
+    m_nodeIndex.clear();
+    m_T = SimFileColumns();
+    m_P = SimFileColumns();
+    m_D = SimFileColumns();
   }
 
   bool SimFile::readNfr(const std::string& fileName) {
     clearNfr();
-    std::vector<std::string> day;
-    std::vector<std::string> time;
-    openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-    if (file.is_open()) {
-      LOG(Error, "Failed to open NFR file '" << fileName << "'");
-      return false;
-    }
-
-    std::map<int, int> nrMap;
-    // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
-      LOG(Error, "No data in LFR file '" << fileName << "'");
+    ResultsTable table;
+    if (!readResults(fileName, nfrFormat, table)) {
       return false;
     }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
-    unsigned ncols = 6;
-    if (row.size() != ncols && row.size() != ncols + 2) {
-      LOG(Error, "NFR file has " << row.size() << " columns, not the expected " << ncols);
-      return false;
-    }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols && row.size() != ncols + 2) {
-        clearNfr();
-        LOG(Error, "NFR data line has " << row.size() << " columns, not the expected " << ncols);
-        return false;
-      }
-      if (!time.empty()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
-        }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
-
-      int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid node number '" << row[2] << "'");
-        return false;
-      }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_T.resize(sz + 1);
-        m_P.resize(sz + 1);
-        m_D.resize(sz + 1);
-      }
-      double T = 0;
-      try {
-        T = std::stod(row[3]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid temperature '" << row[3] << "'");
-        return false;
-      }
-
-      double P = 0;
-      try {
-        P = std::stod(row[4]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid pressure '" << row[4] << "'");
-        return false;
-      }
-
-      double D = 0;
-      try {
-        D = std::stod(row[5]);
-      } catch (const std::exception&) {
-        if (nr == 0) {
-          D = 0.0;
-        } else {
-          clearNfr();
-          LOG(Error, "Invalid density '" << row[5] << "'");
-          return false;
-        }
-      }
-      m_T[nrMap[nr]].push_back(T);
-      m_P[nrMap[nr]].push_back(P);
-      m_D[nrMap[nr]].push_back(D);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
-    }
-    m_nodeNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_nodeNr[nrMap[keys[i]]] = keys[i];
-    }
-    file.close();
+    m_nodeNr = std::move(table.numbers);
+    m_nodeIndex = std::move(table.index);
+    m_T = std::move(table.values[0]);
+    m_P = std::move(table.values[1]);
+    m_D = std::move(table.values[2]);
     // Something should probably be done here to make sure that the times here match up with what we
     // already have. For now, if nothing is known about the dates, then try to compute it
     if (m_dateTimes.empty()) {
-      if (!computeDateTimes(day, time)) {
-        clearLfr();
+      if (!computeDateTimes(table.day, table.time)) {
+        clearNfr();
         m_dateTimes.clear();
         LOG(Error, "Failed to compute date and time objects from NFR input");
         return false;
       }
+    } else if (table.time.size() != m_dateTimes.size()) {
+      clearNfr();
+      LOG(Error, "NFR file has " << table.time.size() << " times, not the " << m_dateTimes.size() << " times of the LFR file");
+      return false;
     }
     return true;
   }
 
-  static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes, std::vector<double> inputValues, std::string units) {
-    // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
-    std::vector<openstudio::DateTime> dateTimes;
-    std::vector<double> values;
-    if (inputDateTimes.size() == 1)  // Account for steady simulation results
-    {
-      return openstudio::TimeSeries(inputDateTimes, createVector(inputValues), units);
+  boost::optional<size_t> SimFile::pathIndex(int nr) const {
+    auto it = m_pathIndex.find(nr);
+    if (it == m_pathIndex.end()) {
+      return boost::none;
     }
-    for (unsigned i = 1; i < inputDateTimes.size(); i++) {
-      dateTimes.push_back(inputDateTimes[i]);
-      values.push_back(0.5 * (inputValues[i - 1] + inputValues[i]));
+    return it->second;
+  }
+
+  boost::optional<size_t> SimFile::nodeIndex(int nr) const {
+    auto it = m_nodeIndex.find(nr);
+    if (it == m_nodeIndex.end()) {
+      return boost::none;
     }
-    return openstudio::TimeSeries(dateTimes, createVector(values), units);
+    return it->second;
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
+    boost::optional<size_t> index = pathIndex(nr);
+    if (!index) {
       return {};
     }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_dP[index], "Pa");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(m_dateTimes, dateTimes(), m_dP.column(*index), "Pa");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
+    boost::optional<size_t> index = pathIndex(nr);
+    if (!index) {
       return {};
     }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_F0[index], "kg/s");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(m_dateTimes, dateTimes(), m_F0.column(*index), "kg/s");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
+    boost::optional<size_t> index = pathIndex(nr);
+    if (!index) {
       return {};
     }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_F1[index], "kg/s");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(m_dateTimes, dateTimes(), m_F1.column(*index), "kg/s");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const {
-    int index = indexOf(m_pathNr, nr);
-    if (index == -1) {
-      return {};
-    }
+    std::vector<boost::optional<openstudio::TimeSeries>> flows = pathFlows({nr});
+    return flows.front();
+  }
+
+  std::vector<boost::optional<openstudio::TimeSeries>> SimFile::pathFlows(const std::vector<int>& nrs) const {
+    std::vector<boost::optional<openstudio::TimeSeries>> result;
+    result.reserve(nrs.size());
+    // The interval date times and the buffer for the total flow are shared by all the paths
+    const std::vector<openstudio::DateTime> intervalDateTimes = dateTimes();
     std::vector<double> flow(m_dateTimes.size());
-    for (unsigned i = 0; i < m_dateTimes.size(); i++) {
-      flow[i] = m_F0[index][i] + m_F1[index][i];
+    for (int nr : nrs) {
+      boost::optional<size_t> index = pathIndex(nr);
+      if (!index) {
+        result.emplace_back();
+        continue;
+      }
+      std::span<const double> f0 = m_F0.column(*index);
+      std::span<const double> f1 = m_F1.column(*index);
+      for (size_t i = 0; i < flow.size(); i++) {
+        flow[i] = f0[i] + f1[i];
+      }
+      // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
+      result.emplace_back(convertData(m_dateTimes, intervalDateTimes, flow, "kg/s"));
     }
-    // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
-    openstudio::TimeSeries series = convertData(m_dateTimes, flow, "kg/s");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return result;
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
-    if (index == -1) {
+    boost::optional<size_t> index = nodeIndex(nr);
+    if (!index) {
       return {};
     }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_T[index], "K");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(m_dateTimes, dateTimes(), m_T.column(*index), "K");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
-    if (index == -1) {
+    boost::optional<size_t> index = nodeIndex(nr);
+    if (!index) {
       return {};
     }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_P[index], "Pa");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(m_dateTimes, dateTimes(), m_P.column(*index), "Pa");
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
-    if (index == -1) {
+    boost::optional<size_t> index = nodeIndex(nr);
+    if (!index) {
       return {};
     }
-    openstudio::TimeSeries series = convertData(m_dateTimes, m_D[index], "kg/m^3");
-    return boost::optional<openstudio::TimeSeries>(series);
+    return convertData(m_dateTimes, dateTimes(), m_D.column(*index), "kg/m^3");
   }
 
   std::vector<openstudio::DateTime> SimFile::dateTimes() const {
@@ -13,9 +13,45 @@
 
 #include "../AirflowAPI.hpp"
 
+#include <span>
+#include <unordered_map>
+#include <vector>
+
 namespace openstudio {
 namespace contam {
 
+  /** Results for one quantity of a CONTAM results file (e.g. the pressure differences across all airflow paths). The values are stored
+   *  column by column in a single buffer, column i holding the numberOfRows() values for the i-th path (or node) of the file. */
+  class AIRFLOW_API SimFileColumns
+  {
+   public:
+    SimFileColumns() = default;
+    SimFileColumns(size_t numberOfColumns, size_t numberOfRows);
+
+    size_t numberOfColumns() const {
+      return m_numberOfColumns;
+    }
+    size_t numberOfRows() const {
+      return m_numberOfRows;
+    }
+
+    /** View of the values of a column, valid as long as this object is */
+    std::span<const double> column(size_t i) const {
+      return {m_values.data() + i * m_numberOfRows, m_numberOfRows};
+    }
+    std::span<double> column(size_t i) {
+      return {m_values.data() + i * m_numberOfRows, m_numberOfRows};
+    }
+
+    /** Copy of the values, one vector per column */
+    std::vector<std::vector<double>> toVectors() const;
+
+   private:
+    size_t m_numberOfColumns = 0;
+    size_t m_numberOfRows = 0;
+    std::vector<double> m_values;
+  };
+
   class AIRFLOW_API SimFile
   {
    public:
@@ -23,21 +59,50 @@ namespace contam {
 
     // These are provided for advanced use
     std::vector<std::vector<double>> dP() const {
-      return m_dP;
+      return m_dP.toVectors();
     }
     std::vector<std::vector<double>> F0() const {
-      return m_F0;
+      return m_F0.toVectors();
     }
     std::vector<std::vector<double>> F1() const {
-      return m_F1;
+      return m_F1.toVectors();
     }
     std::vector<std::vector<double>> T() const {
-      return m_T;
+      return m_T.toVectors();
     }
     std::vector<std::vector<double>> P() const {
-      return m_P;
+      return m_P.toVectors();
     }
     std::vector<std::vector<double>> D() const {
+      return m_D.toVectors();
+    }
+
+    /** The CONTAM path numbers, in the order of the columns of the path results */
+    const std::vector<int>& pathNumbers() const {
+      return m_pathNr;
+    }
+    /** The CONTAM node numbers, in the order of the columns of the node results */
+    const std::vector<int>& nodeNumbers() const {
+      return m_nodeNr;
+    }
+
+    // Same as above without copies, there is one row per file date and time
+    const SimFileColumns& dPColumns() const {
+      return m_dP;
+    }
+    const SimFileColumns& F0Columns() const {
+      return m_F0;
+    }
+    const SimFileColumns& F1Columns() const {
+      return m_F1;
+    }
+    const SimFileColumns& TColumns() const {
+      return m_T;
+    }
+    const SimFileColumns& PColumns() const {
+      return m_P;
+    }
+    const SimFileColumns& DColumns() const {
       return m_D;
     }
 
@@ -49,6 +114,8 @@ namespace contam {
     boost::optional<openstudio::TimeSeries> nodeTemperature(int nr) const;
     boost::optional<openstudio::TimeSeries> nodePressure(int nr) const;
     boost::optional<openstudio::TimeSeries> nodeDensity(int nr) const;
+    /** Same as calling pathFlow for each of the path numbers, the result is empty for paths that are not in the file */
+    std::vector<boost::optional<openstudio::TimeSeries>> pathFlows(const std::vector<int>& nrs) const;
     /** Returns a vector of DateTime objects that give the EnergyPlus-style
    *  end of interval times. These are not the actual times in the SIM file */
     std::vector<openstudio::DateTime> dateTimes() const;
@@ -67,14 +134,19 @@ namespace contam {
     bool readNfr(const std::string& fileName);
     bool computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time);
 
+    boost::optional<size_t> pathIndex(int nr) const;
+    boost::optional<size_t> nodeIndex(int nr) const;
+
     std::vector<int> m_pathNr;  // the CONTAM path index
-    std::vector<std::vector<double>> m_dP;
-    std::vector<std::vector<double>> m_F0;
-    std::vector<std::vector<double>> m_F1;
+    std::unordered_map<int, size_t> m_pathIndex;
+    SimFileColumns m_dP;
+    SimFileColumns m_F0;
+    SimFileColumns m_F1;
     std::vector<int> m_nodeNr;  // the CONTAM node index
-    std::vector<std::vector<double>> m_T;
-    std::vector<std::vector<double>> m_P;
-    std::vector<std::vector<double>> m_D;
+    std::unordered_map<int, size_t> m_nodeIndex;
+    SimFileColumns m_T;
+    SimFileColumns m_P;
+    SimFileColumns m_D;
     std::vector<openstudio::DateTime> m_dateTimes;
 
     bool m_hasLfr;
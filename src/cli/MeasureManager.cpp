@@ -28,8 +28,10 @@
 #include <pugixml.hpp>
 
 #include <utility>  // make_pair
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <csignal>
 #include <cstdio>
 
@@ -130,7 +132,38 @@ MeasureManager::MeasureManager(ScriptEngineInstance& t_rubyEngine, ScriptEngineI
 // {
 // }
 
+void MeasureManager::setEngineRunner(EngineRunner engineRunner) {
+  m_engineRunner = std::move(engineRunner);
+}
+
+void MeasureManager::runOnEngine(MeasureLanguage measureLanguage, const std::function<void()>& fun) {
+  if (m_engineRunner) {
+    m_engineRunner(measureLanguage, fun);
+  } else {
+    fun();
+  }
+}
+
+void MeasureManager::setInfoCacheDirectory(const openstudio::path& cacheDir) {
+  if (cacheDir.empty()) {
+    m_infoCache.reset();
+  } else {
+    m_infoCache = measure::MeasureInfoCache(cacheDir);
+  }
+}
+
+openstudio::path MeasureManager::defaultInfoCacheDirectory() {
+  return openstudio::filesystem::home_path() / "OpenStudio/MeasureInfoCache";
+}
+
+std::recursive_mutex& MeasureManager::pathMutex(const openstudio::path& p) {
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pathMutexes[p];
+}
+
 Json::Value MeasureManager::internalState() const {
+  const std::lock_guard<std::mutex> lock(m_mutex);
+
   Json::Value result(Json::objectValue);
 
   Json::Value osms(Json::arrayValue);
@@ -178,6 +211,7 @@ Json::Value MeasureManager::internalState() const {
 }
 
 size_t MeasureManager::clearMeasureInfoForOsmorIdfPath(const openstudio::path& osmOrIdfPath) {
+  const std::lock_guard<std::mutex> lock(m_mutex);
   size_t totalRemoved = 0;
   for (auto& [key, value] : m_measures) {
     totalRemoved += value.measureInfos.erase(osmOrIdfPath);
@@ -186,10 +220,14 @@ size_t MeasureManager::clearMeasureInfoForOsmorIdfPath(const openstudio::path& o
 }
 
 boost::optional<OSMInfo> MeasureManager::getModel(const openstudio::path& osmPath, bool force_reload) {
+  const std::lock_guard<std::recursive_mutex> pathLock(pathMutex(osmPath));
 
   if (!openstudio::filesystem::is_regular_file(osmPath)) {
     fmt::print("Model '{}' does not exist\n", osmPath.generic_string());
-    m_osms.erase(osmPath);
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_osms.erase(osmPath);
+    }
     clearMeasureInfoForOsmorIdfPath(osmPath);
     return boost::none;
   }
@@ -198,6 +236,7 @@ boost::optional<OSMInfo> MeasureManager::getModel(const openstudio::path& osmPat
   current.checksum = openstudio::checksum(osmPath);
 
   if (!force_reload) {
+    const std::lock_guard<std::mutex> lock(m_mutex);
     auto it = m_osms.find(osmPath);
     if (it != m_osms.end()) {
       auto& cached = it->second;
@@ -219,21 +258,27 @@ boost::optional<OSMInfo> MeasureManager::getModel(const openstudio::path& osmPat
     current.model = std::move(*model_);
     openstudio::energyplus::ForwardTranslator ft;
     current.workspace = ft.translateModel(current.model);
+    const std::lock_guard<std::mutex> lock(m_mutex);
     auto [it, ok] = m_osms.insert_or_assign(osmPath, std::move(current));
     return it->second;
   }
 
   fmt::print("Failed to load model '{}'\n", osmPath.generic_string());
+  const std::lock_guard<std::mutex> lock(m_mutex);
   m_osms.erase(osmPath);
 
   return boost::none;
 }
 
 boost::optional<IDFInfo> MeasureManager::getIdf(const openstudio::path& idfPath, bool force_reload) {
+  const std::lock_guard<std::recursive_mutex> pathLock(pathMutex(idfPath));
 
   if (!openstudio::filesystem::is_regular_file(idfPath)) {
     fmt::print("Idf '{}' does not exist\n", idfPath.generic_string());
-    m_idfs.erase(idfPath);
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_idfs.erase(idfPath);
+    }
     clearMeasureInfoForOsmorIdfPath(idfPath);
     return boost::none;
   }
@@ -242,6 +287,7 @@ boost::optional<IDFInfo> MeasureManager::getIdf(const openstudio::path& idfPath,
   current.checksum = openstudio::checksum(idfPath);
 
   if (!force_reload) {
+    const std::lock_guard<std::mutex> lock(m_mutex);
     auto it = m_idfs.find(idfPath);
     if (it != m_idfs.end()) {
       auto& cached = it->second;
@@ -262,6 +308,7 @@ boost::optional<IDFInfo> MeasureManager::getIdf(const openstudio::path& idfPath,
 
     if (workspace_->isValid(openstudio::StrictnessLevel::Draft)) {
       current.workspace = std::move(*workspace_);
+      const std::lock_guard<std::mutex> lock(m_mutex);
       auto [it, ok] = m_idfs.insert_or_assign(idfPath, std::move(current));
       return it->second;
     } else {
@@ -271,54 +318,84 @@ boost::optional<IDFInfo> MeasureManager::getIdf(const openstudio::path& idfPath,
     fmt::print("Failed to load idf '{}'\n", idfPath.generic_string());
   }
 
+  const std::lock_guard<std::mutex> lock(m_mutex);
   m_idfs.erase(idfPath);
 
   return boost::none;
 }
 
+boost::optional<OSMInfo> MeasureManager::cloneModel(const openstudio::path& osmPath, bool force_reload) {
+  // The cached model is shared, so it is cloned while holding the lock of its path
+  const std::lock_guard<std::recursive_mutex> pathLock(pathMutex(osmPath));
+  auto osmInfo_ = getModel(osmPath, force_reload);
+  if (osmInfo_) {
+    osmInfo_->model = osmInfo_->model.clone(true).cast<openstudio::model::Model>();
+    osmInfo_->workspace = osmInfo_->workspace.clone(true);
+  }
+  return osmInfo_;
+}
+
+boost::optional<IDFInfo> MeasureManager::cloneIdf(const openstudio::path& idfPath, bool force_reload) {
+  const std::lock_guard<std::recursive_mutex> pathLock(pathMutex(idfPath));
+  auto idfInfo_ = getIdf(idfPath, force_reload);
+  if (idfInfo_) {
+    idfInfo_->workspace = idfInfo_->workspace.clone(true);
+  }
+  return idfInfo_;
+}
+
 boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& measureDirPath, bool force_reload) {
+  // Updating the measure writes to its directory
+  const std::lock_guard<std::recursive_mutex> pathLock(pathMutex(measureDirPath));
 
   const auto& measureDirPathStr = measureDirPath.string();
 
   // check if measure exists on disk
   if (!openstudio::filesystem::is_directory(measureDirPath)) {
     fmt::print("Measure '{}' does not exist.\n", measureDirPathStr);
+    const std::lock_guard<std::mutex> lock(m_mutex);
     m_measures.erase(measureDirPath);
     return boost::none;
   }
   if (!openstudio::filesystem::is_regular_file(measureDirPath / "measure.xml")) {
     fmt::print("Measure directory '{}' exists but does not have a measure.xml.\n", measureDirPathStr);
+    const std::lock_guard<std::mutex> lock(m_mutex);
     m_measures.erase(measureDirPath);
     return boost::none;
   }
 
-  BCLMeasureInfo* measureInfo_ = nullptr;
+  // Work on a copy of the cached measure, and store it back once updated
+  boost::optional<BCLMeasure> measure_;
   if (!force_reload) {
+    const std::lock_guard<std::mutex> lock(m_mutex);
     auto it = m_measures.find(measureDirPath);
     if (it != m_measures.end()) {
-      measureInfo_ = &(it->second);
+      measure_ = it->second.measure;
       fmt::print("Using cached measure {}\n", measureDirPath.generic_string());
     }
   }
 
-  if (!measureInfo_) {
-    m_measures.erase(measureDirPath);
+  if (!measure_) {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_measures.erase(measureDirPath);
+    }
 
     // load from disk
     fmt::print("Attempting to load measure '{}'\n", measureDirPathStr);
 
-    boost::optional<BCLMeasure> measure_ = openstudio::BCLMeasure::load(measureDirPath);
+    measure_ = openstudio::BCLMeasure::load(measureDirPath);
 
     if (!measure_) {
       fmt::print("Failed to load measure '{}'\n", measureDirPathStr);
       return boost::none;
     }
     fmt::print("Successfully loaded measure '{}'\n", measureDirPathStr);
-    auto [it, ok] = m_measures.insert({measureDirPath, BCLMeasureInfo{std::move(*measure_)}});
-    measureInfo_ = &(it->second);
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_measures.insert({measureDirPath, BCLMeasureInfo{*measure_}});
   }
 
-  auto& measure = measureInfo_->measure;
+  auto& measure = *measure_;
 
   // see if there are updates, want to make sure to perform both checks so do outside of conditional
   bool file_updates = measure.checkForUpdatesFiles();  // checks if any files have been updated
@@ -338,7 +415,13 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
     fmt::print("Changes detected, updating '{}'\n", measureDirPathStr);
 
     // Clear cache before calling getMeasureInfo
-    measureInfo_->measureInfos.clear();
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_measures.find(measureDirPath);
+      if (it != m_measures.end()) {
+        it->second.measureInfos.clear();
+      }
+    }
 
     openstudio::measure::OSMeasureInfo info = getMeasureInfo(measureDirPath, measure, openstudio::path{});
     info.update(measure);
@@ -347,17 +430,21 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
       if (hasReadmeOut) {
         openstudio::filesystem::remove(readmeOutPath);
       }
-      ScriptObject measureInfoBindingObject;
-      try {
-        measureInfoBindingObject = rubyEngine->eval("OpenStudio::Measure::RubyMeasureInfoBinding.new()");
-      } catch (const RubyException& e) {
-        auto msg = fmt::format("Failed to instantiate a RubyMeasureInfoBinding: {}\nlocation={}", e.what(), e.location());
-        fmt::print(stderr, "{}\n", msg);
-        LOG_AND_THROW(msg);
-      }
-      auto* measureInfoBindingPtr = rubyEngine->getAs<openstudio::measure::MeasureInfoBinding*>(measureInfoBindingObject);
-      measureInfoBindingPtr->setMeasureInfo(info);
-      const bool result = measureInfoBindingPtr->renderFile(readmeInPath.generic_string());
+      bool result = false;
+      // The README is rendered via ERB, whatever the language of the measure
+      runOnEngine(MeasureLanguage::Ruby, [this, &info, &readmeInPath, &result]() {
+        ScriptObject measureInfoBindingObject;
+        try {
+          measureInfoBindingObject = rubyEngine->eval("OpenStudio::Measure::RubyMeasureInfoBinding.new()");
+        } catch (const RubyException& e) {
+          auto msg = fmt::format("Failed to instantiate a RubyMeasureInfoBinding: {}\nlocation={}", e.what(), e.location());
+          fmt::print(stderr, "{}\n", msg);
+          LOG_AND_THROW(msg);
+        }
+        auto* measureInfoBindingPtr = rubyEngine->getAs<openstudio::measure::MeasureInfoBinding*>(measureInfoBindingObject);
+        measureInfoBindingPtr->setMeasureInfo(info);
+        result = measureInfoBindingPtr->renderFile(readmeInPath.generic_string());
+      });
       if (result) {
         // check for file updates again
         file_updates = measure.checkForUpdatesFiles();
@@ -370,6 +457,12 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
     measure.save();
   }
 
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_measures.find(measureDirPath);
+  if (it != m_measures.end()) {
+    it->second.measure = measure;
+  }
+
   return measure;
 }
 
@@ -377,14 +470,18 @@ openstudio::measure::OSMeasureInfo MeasureManager::getMeasureInfo(const openstud
                                                                   const openstudio::path& osmOrIdfPath, const boost::optional<model::Model>& model_,
                                                                   const boost::optional<Workspace>& workspace_) {
 
-  if (!m_measures.contains(measureDirPath)) {
-    LOG_AND_THROW("Measure isn't recorded in m_measures, that should NOT happen");
-  }
-  auto& bclMeasureInfo = m_measures.at(measureDirPath);
-  auto it2 = bclMeasureInfo.measureInfos.find(osmOrIdfPath);
-  if (it2 != bclMeasureInfo.measureInfos.end()) {
-    fmt::print("Using cached OSMeasureInfo for '{}', '{}'\n", measureDirPath.generic_string(), osmOrIdfPath.generic_string());
-    return it2->second;
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    // Another request may have dropped the measure from m_measures since it was gotten (reset, or getMeasure with force_reload), in which case
+    // its info is computed again and not recorded
+    auto it = m_measures.find(measureDirPath);
+    if (it != m_measures.end()) {
+      auto it2 = it->second.measureInfos.find(osmOrIdfPath);
+      if (it2 != it->second.measureInfos.end()) {
+        fmt::print("Using cached OSMeasureInfo for '{}', '{}'\n", measureDirPath.generic_string(), osmOrIdfPath.generic_string());
+        return it2->second;
+      }
+    }
   }
 
   auto scriptPath_ = measure.primaryScriptPath();
@@ -393,14 +490,42 @@ openstudio::measure::OSMeasureInfo MeasureManager::getMeasureInfo(const openstud
       fmt::format("Unable to locate primary Ruby script path for BCLMeasure '{}' located at '{}'", measure.name(), measureDirPath.generic_string()));
   }
 
+  // The on-disk cache is keyed by the checksum of the osm or idf file, so it isn't used for a model or workspace passed without its path
+  std::string cacheKey;
+  if (m_infoCache && (!osmOrIdfPath.empty() || (!model_ && !workspace_))) {
+    cacheKey = measure::MeasureInfoCache::key(measure, osmOrIdfPath);
+  }
+
+  auto recordMeasureInfo = [this, &measureDirPath, &osmOrIdfPath](openstudio::measure::OSMeasureInfo info) -> openstudio::measure::OSMeasureInfo {
+    if (info.error()) {
+      return info;
+    }
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_measures.find(measureDirPath);
+    if (it == m_measures.end()) {
+      // The measure was dropped from the cache (reset) in the meantime
+      return info;
+    }
+    auto [it2, ok] = it->second.measureInfos.insert({osmOrIdfPath, std::move(info)});
+    return it2->second;
+  };
+
+  if (!cacheKey.empty()) {
+    if (auto info_ = m_infoCache->get(cacheKey)) {
+      fmt::print("Using OSMeasureInfo from '{}' for '{}', '{}'\n", m_infoCache->directory().generic_string(), measureDirPath.generic_string(),
+                 osmOrIdfPath.generic_string());
+      return recordMeasureInfo(std::move(*info_));
+    }
+  }
+
   auto getOrCreateModel = [this, &model_, &osmOrIdfPath]() -> openstudio::model::Model {
     if (model_) {
       // model should already have been cloned in the endpoint, so no need to do it twice
       return *model_;  // _->clone(true).cast<openstudio::model::Model>();
     } else if (!osmOrIdfPath.empty()) {
       // TODO: not sure we want to keep this here or not..
-      if (auto osmInfo_ = getModel(osmOrIdfPath)) {
-        return osmInfo_->model.clone().cast<openstudio::model::Model>();
+      if (auto osmInfo_ = cloneModel(osmOrIdfPath)) {
+        return osmInfo_->model;
       } else {
         LOG_AND_THROW("Failed to load the Model at " << osmOrIdfPath);
       }
@@ -413,8 +538,8 @@ openstudio::measure::OSMeasureInfo MeasureManager::getMeasureInfo(const openstud
     if (workspace_) {
       return *workspace_;  // ->clone(true);
     } else if (!osmOrIdfPath.empty()) {
-      if (auto idfInfo_ = getIdf(osmOrIdfPath)) {
-        return idfInfo_->workspace.clone();
+      if (auto idfInfo_ = cloneIdf(osmOrIdfPath)) {
+        return idfInfo_->workspace;
       } else {
         LOG_AND_THROW("Failed to load the Model at " << osmOrIdfPath);
       }
@@ -431,74 +556,76 @@ openstudio::measure::OSMeasureInfo MeasureManager::getMeasureInfo(const openstud
     thisEngine = &pythonEngine;
   }
 
-  std::string className = (*thisEngine)->inferMeasureClassName(*scriptPath_);
-  fmt::print("className={}\n", className);
-  if (className.empty()) {
-    // TODO: could also just fallback on trusting the BCLXML is up to date with respect to the class name and use BCLMeasure::className()
-    auto msg = fmt::format("Failed to infer measure name from '{}'", scriptPath_->generic_string());
-    fmt::print(stderr, "{}\n", msg);
-    return openstudio::measure::OSMeasureInfo(msg);
-  }
-  ScriptObject measureScriptObject = (*thisEngine)->loadMeasure(*scriptPath_, className);
-  if (measureScriptObject.empty()) {
-    auto msg = fmt::format("Failed to load measure '{}' from '{}'\n", className, scriptPath_->generic_string());
-    fmt::print(stderr, "{}\n", msg);
-    return openstudio::measure::OSMeasureInfo(msg);
-  }
+  // Everything below calls into the script engine of the measure, so it runs on the interpreter thread of its language
+  auto computeMeasureInfo = [&]() -> openstudio::measure::OSMeasureInfo {
+    std::string className = (*thisEngine)->inferMeasureClassName(*scriptPath_);
+    fmt::print("className={}\n", className);
+    if (className.empty()) {
+      // TODO: could also just fallback on trusting the BCLXML is up to date with respect to the class name and use BCLMeasure::className()
+      auto msg = fmt::format("Failed to infer measure name from '{}'", scriptPath_->generic_string());
+      fmt::print(stderr, "{}\n", msg);
+      return openstudio::measure::OSMeasureInfo(msg);
+    }
+    ScriptObject measureScriptObject = (*thisEngine)->loadMeasure(*scriptPath_, className);
+    if (measureScriptObject.empty()) {
+      auto msg = fmt::format("Failed to load measure '{}' from '{}'\n", className, scriptPath_->generic_string());
+      fmt::print(stderr, "{}\n", msg);
+      return openstudio::measure::OSMeasureInfo(msg);
+    }
 
-  MeasureType measureType;
+    MeasureType measureType;
 
-  std::string name;
-  std::string description;
-  std::string taxonomy;
-  std::string modelerDescription;
+    std::string name;
+    std::string description;
+    std::string taxonomy;
+    std::string modelerDescription;
 
-  std::vector<measure::OSArgument> arguments;
-  std::vector<measure::OSOutput> outputs;
+    std::vector<measure::OSArgument> arguments;
+    std::vector<measure::OSOutput> outputs;
 
-  try {
-    auto* osMeasurePtr = (*thisEngine)->getAs<openstudio::measure::OSMeasure*>(measureScriptObject);
-    measureType = osMeasurePtr->measureType();
-    fmt::print("measureType={}\n", measureType.valueName());
-
-    if (measureType == MeasureType::ModelMeasure) {
-      auto* measurePtr = static_cast<openstudio::measure::ModelMeasure*>(osMeasurePtr);
-      name = measurePtr->name();
-      description = measurePtr->description();
-      taxonomy = measurePtr->taxonomy();
-      modelerDescription = measurePtr->modeler_description();
-
-      auto model = getOrCreateModel();
-      arguments = measurePtr->arguments(model);
-      outputs = measurePtr->outputs();
-
-    } else if (measureType == MeasureType::EnergyPlusMeasure) {
-      auto* measurePtr = static_cast<openstudio::measure::EnergyPlusMeasure*>(osMeasurePtr);
-      name = measurePtr->name();
-      description = measurePtr->description();
-      taxonomy = measurePtr->taxonomy();
-      modelerDescription = measurePtr->modeler_description();
-
-      auto workspace = getOrCreateWorkspace();
-      arguments = measurePtr->arguments(workspace);
-      outputs = measurePtr->outputs();
-    } else if (measureType == MeasureType::ReportingMeasure) {
-      auto* measurePtr = static_cast<openstudio::measure::ReportingMeasure*>(osMeasurePtr);
-      name = measurePtr->name();
-      description = measurePtr->description();
-      taxonomy = measurePtr->taxonomy();
-      modelerDescription = measurePtr->modeler_description();
-
-      // TODO: for ruby at least, need to try the arity... model was added later, at 3.0.0
-      const int numArgs = (*thisEngine)->numberOfArguments(measureScriptObject, "arguments");
-      // fmt::print("numArgs={}\n", numArgs);
-      if (numArgs == 0) {
-        auto msg = fmt::format("Reporting Measure at '{}' is using the old format where the 'arguments' method does not take model. "
-                               " Please consider updating this to `def arguments(model)`.",
-                               scriptPath_->generic_string());
-        fmt::print("{}\n", msg);
-        if (measureLanguage == MeasureLanguage::Ruby) {
-          auto patchArgumentsCmd = fmt::format(R"ruby(
+    try {
+      auto* osMeasurePtr = (*thisEngine)->getAs<openstudio::measure::OSMeasure*>(measureScriptObject);
+      measureType = osMeasurePtr->measureType();
+      fmt::print("measureType={}\n", measureType.valueName());
+
+      if (measureType == MeasureType::ModelMeasure) {
+        auto* measurePtr = static_cast<openstudio::measure::ModelMeasure*>(osMeasurePtr);
+        name = measurePtr->name();
+        description = measurePtr->description();
+        taxonomy = measurePtr->taxonomy();
+        modelerDescription = measurePtr->modeler_description();
+
+        auto model = getOrCreateModel();
+        arguments = measurePtr->arguments(model);
+        outputs = measurePtr->outputs();
+
+      } else if (measureType == MeasureType::EnergyPlusMeasure) {
+        auto* measurePtr = static_cast<openstudio::measure::EnergyPlusMeasure*>(osMeasurePtr);
+        name = measurePtr->name();
+        description = measurePtr->description();
+        taxonomy = measurePtr->taxonomy();
+        modelerDescription = measurePtr->modeler_description();
+
+        auto workspace = getOrCreateWorkspace();
+        arguments = measurePtr->arguments(workspace);
+        outputs = measurePtr->outputs();
+      } else if (measureType == MeasureType::ReportingMeasure) {
+        auto* measurePtr = static_cast<openstudio::measure::ReportingMeasure*>(osMeasurePtr);
+        name = measurePtr->name();
+        description = measurePtr->description();
+        taxonomy = measurePtr->taxonomy();
+        modelerDescription = measurePtr->modeler_description();
+
+        // TODO: for ruby at least, need to try the arity... model was added later, at 3.0.0
+        const int numArgs = (*thisEngine)->numberOfArguments(measureScriptObject, "arguments");
+        // fmt::print("numArgs={}\n", numArgs);
+        if (numArgs == 0) {
+          auto msg = fmt::format("Reporting Measure at '{}' is using the old format where the 'arguments' method does not take model. "
+                                 " Please consider updating this to `def arguments(model)`.",
+                                 scriptPath_->generic_string());
+          fmt::print("{}\n", msg);
+          if (measureLanguage == MeasureLanguage::Ruby) {
+            auto patchArgumentsCmd = fmt::format(R"ruby(
 module {0}Extensions
   def arguments(model)
     super()
@@ -509,45 +636,53 @@ class {0}
   prepend {0}Extensions # the only change to above: prepend instead of include
 end
 )ruby",
-                                               className);
-          rubyEngine->exec(patchArgumentsCmd);
-          arguments = measurePtr->arguments(openstudio::model::Model{});
-          rubyEngine->exec(fmt::format("Object.send(:remove_const, :{}Extensions)", className));
+                                                 className);
+            rubyEngine->exec(patchArgumentsCmd);
+            arguments = measurePtr->arguments(openstudio::model::Model{});
+            rubyEngine->exec(fmt::format("Object.send(:remove_const, :{}Extensions)", className));
+          } else {
+            auto msg =
+              fmt::format("Wrong number of parameters for method `arguments`in measure '{}' from '{}'\n", className, scriptPath_->generic_string());
+            fmt::print(stderr, "{}\n", msg);
+            return openstudio::measure::OSMeasureInfo(msg);
+          }
         } else {
-          auto msg =
-            fmt::format("Wrong number of parameters for method `arguments`in measure '{}' from '{}'\n", className, scriptPath_->generic_string());
-          fmt::print(stderr, "{}\n", msg);
-          return openstudio::measure::OSMeasureInfo(msg);
+          auto model = getOrCreateModel();
+          arguments = measurePtr->arguments(model);
         }
+        outputs = measurePtr->outputs();
+
       } else {
-        auto model = getOrCreateModel();
-        arguments = measurePtr->arguments(model);
+        throw std::runtime_error("Unknown");
       }
-      outputs = measurePtr->outputs();
+    } catch (const std::exception& e) {
+      auto msg = fmt::format("Failed to query information from measure '{}' from '{}': {}\n", className, scriptPath_->generic_string(), e.what());
+      fmt::print(stderr, "{}\n", msg);
+      return openstudio::measure::OSMeasureInfo(msg);
+    }
 
-    } else {
-      throw std::runtime_error("Unknown");
+    if (name.empty()) {
+      name = className;
     }
-  } catch (const std::exception& e) {
-    auto msg = fmt::format("Failed to query information from measure '{}' from '{}': {}\n", className, scriptPath_->generic_string(), e.what());
-    fmt::print(stderr, "{}\n", msg);
-    return openstudio::measure::OSMeasureInfo(msg);
-  }
 
-  if (name.empty()) {
-    name = className;
-  }
+    if (measureLanguage == MeasureLanguage::Ruby) {
+      rubyEngine->exec(fmt::format("Object.send(:remove_const, :{})", className));
+    }
 
-  if (measureLanguage == MeasureLanguage::Ruby) {
-    rubyEngine->exec(fmt::format("Object.send(:remove_const, :{})", className));
+    return {measureType, className, name, description, taxonomy, modelerDescription, arguments, outputs};
+  };
+
+  boost::optional<openstudio::measure::OSMeasureInfo> info_;
+  runOnEngine(measureLanguage, [&computeMeasureInfo, &info_]() { info_ = computeMeasureInfo(); });
+  if (!cacheKey.empty()) {
+    m_infoCache->put(cacheKey, *info_);
   }
 
-  openstudio::measure::OSMeasureInfo info(measureType, className, name, description, taxonomy, modelerDescription, arguments, outputs);
-  auto [it, ok] = bclMeasureInfo.measureInfos.insert({osmOrIdfPath, std::move(info)});
-  return it->second;
+  return recordMeasureInfo(std::move(*info_));
 }
 
 void MeasureManager::reset() {
+  const std::lock_guard<std::mutex> lock(m_mutex);
   m_osms.clear();
   m_idfs.clear();
   m_measures.clear();
@@ -572,6 +707,29 @@ MeasureManagerServer::MeasureManagerServer(unsigned port, ScriptEngineInstance&
 
   m_listener.support(web::http::methods::GET, [this](auto&& request) { handle_get(std::forward<decltype(request)>(request)); });
   m_listener.support(web::http::methods::POST, [this](auto&& request) { handle_post(std::forward<decltype(request)>(request)); });
+
+  m_measureManager.setEngineRunner(
+    [this](MeasureLanguage measureLanguage, const std::function<void()>& fun) { runOnEngine(measureLanguage, fun); });
+}
+
+void MeasureManagerServer::setInfoCacheDirectory(const openstudio::path& cacheDir) {
+  m_measureManager.setInfoCacheDirectory(cacheDir);
+}
+
+void MeasureManagerServer::runOnEngine(MeasureLanguage measureLanguage, const std::function<void()>& fun) {
+  std::packaged_task<void()> task(fun);
+  auto future_result = task.get_future();
+  if (measureLanguage == MeasureLanguage::Python) {
+    m_pythonTasks.push_back(std::move(task));
+  } else {
+    m_rubyTasks.push_back(std::move(task));
+  }
+  future_result.get();  // This blocks until the interpreter thread has run it, and rethrows its exception if any
+}
+
+openstudio::path MeasureManagerServer::myMeasuresDir() const {
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return my_measures_dir;
 }
 
 void MeasureManagerServer::handle_error(pplx::task<void>& t) {
@@ -598,7 +756,7 @@ void MeasureManagerServer::handle_get(web::http::http_request message) {
   if (uri == "/") {
     Json::Value result;
     result["status"] = "running";
-    result["my_measures_dir"] = my_measures_dir.generic_string();
+    result["my_measures_dir"] = myMeasuresDir().generic_string();
     message.reply(web::http::status_codes::OK, toWebJSON(result));
     return;
   }
@@ -672,7 +830,7 @@ void MeasureManagerServer::handle_post(web::http::http_request message) {
 MeasureManagerServer::ResponseType MeasureManagerServer::internal_state([[maybe_unused]] const web::json::value& body) {
   Json::Value result;
   result["status"] = "running";
-  result["my_measures_dir"] = my_measures_dir.generic_string();
+  result["my_measures_dir"] = myMeasuresDir().generic_string();
 
   auto internalState = m_measureManager.internalState();
   for (const auto& key : internalState.getMemberNames()) {
@@ -694,6 +852,7 @@ MeasureManagerServer::ResponseType MeasureManagerServer::set(const web::json::va
       return {web::http::status_codes::BadRequest,
               toWebJSON(fmt::format("Error, my_measures_dir '{}' is a not a valid directory", p_->generic_string()))};
     }
+    const std::lock_guard<std::mutex> lock(m_mutex);
     this->my_measures_dir = std::move(*p_);
     return {web::http::status_codes::OK, web::json::value()};
   } else {
@@ -745,7 +904,7 @@ MeasureManagerServer::ResponseType MeasureManagerServer::bcl_measures([[maybe_un
 }
 
 MeasureManagerServer::ResponseType MeasureManagerServer::update_measures(const web::json::value& body) {
-  auto measuresDir = get_field<openstudio::path>(body, "measures_dir", my_measures_dir);
+  auto measuresDir = get_field<openstudio::path>(body, "measures_dir", myMeasuresDir());
   const bool force_reload = get_field<bool>(body, "force_reload", false);
 
   // Scan the directory for measures
@@ -798,10 +957,9 @@ MeasureManagerServer::ResponseType MeasureManagerServer::compute_arguments(const
   boost::optional<Workspace> workspace_;
 
   if (has_valid_osm_path) {
-    if (auto osmInfo_ = m_measureManager.getModel(osmPath, force_reload)) {
-      // Clone and keep handles
-      model_ = osmInfo_->model.clone(true).cast<openstudio::model::Model>();
-      workspace_ = osmInfo_->workspace.clone(true);
+    if (auto osmInfo_ = m_measureManager.cloneModel(osmPath, force_reload)) {
+      model_ = std::move(osmInfo_->model);
+      workspace_ = std::move(osmInfo_->workspace);
     } else {
       auto msg = fmt::format("Cannot load model at '{}'", osmPath.generic_string());
       fmt::print(stderr, "{}\n", msg);
@@ -990,7 +1148,7 @@ void MeasureManagerServer::handle_request(const web::http::http_request& message
   std::packaged_task<ResponseType()> task([this, &body, &request_handler]() { return (this->*request_handler)(body); });
 
   auto future_result = task.get_future();  // The task hasn't been started yet
-  tasks.push_back(std::move(task));        // It gets queued, the **main** thread will process it
+  tasks.push_back(std::move(task));        // It gets queued, a worker thread will process it
   try {
     auto result = future_result.get();  // This block until it's been processed
     message.reply(result.status_code, result.body);
@@ -1002,11 +1160,31 @@ void MeasureManagerServer::handle_request(const web::http::http_request& message
 }
 
 void MeasureManagerServer::do_tasks_forever() {
+  // Requests are processed concurrently by a pool of worker threads, so the ones that don't need a script engine (internal_state, get_model...)
+  // aren't queued behind a slow compute_arguments. The script engine calls are run by one interpreter thread per language: the ruby interpreter is
+  // initialized on and stays on the main thread, the python one is initialized on and stays on a dedicated thread.
+  // This never returns, so the threads are detached
+  const unsigned numWorkers = std::max(4U, std::thread::hardware_concurrency());
+  for (unsigned i = 0; i < numWorkers; ++i) {
+    std::thread([this]() {
+      while (true) {
+        auto task = tasks.wait_for_one();
+        task();
+      }
+    }).detach();
+  }
+  std::thread([this]() {
+    while (true) {
+      auto task = m_pythonTasks.wait_for_one();
+      task();
+    }
+  }).detach();
+
   fmt::print("MeasureManager Ready");
   fmt::print("Accepting requests on: {}\n", m_url);
   std::fflush(stdout);
   while (true) {
-    auto task = tasks.wait_for_one();
+    auto task = m_rubyTasks.wait_for_one();
     task();
   }
 }
@@ -9,6 +9,7 @@
 #include "../model/Model.hpp"
 #include "../utilities/idf/Workspace.hpp"
 #include "../measure/OSMeasureInfoGetter.hpp"
+#include "../measure/MeasureInfoCache.hpp"
 #include "../utilities/bcl/BCLMeasure.hpp"
 #include <future>
 
@@ -22,7 +23,9 @@
 #  pragma GCC diagnostic pop
 #endif
 
+#include <functional>
 #include <map>
+#include <mutex>
 #include <string>
 
 namespace Json {
@@ -52,13 +55,26 @@ struct BCLMeasureInfo
   std::map<openstudio::path, openstudio::measure::OSMeasureInfo> measureInfos;
 };
 
+// The MeasureManager can be used from several threads at once: the caches are guarded by a mutex, and the work on one measure directory, osm or
+// idf path is done by one thread at a time
 class MeasureManager
 {
  public:
   MeasureManager(ScriptEngineInstance& t_rubyEngine, ScriptEngineInstance& t_pythonEngine);
 
+  // Runs the script engine calls made for a measure of the given language. By default they run on the calling thread
+  using EngineRunner = std::function<void(MeasureLanguage, const std::function<void()>&)>;
+  void setEngineRunner(EngineRunner engineRunner);
+
+  // Also stores the computed OSMeasureInfo on disk in cacheDir, so that later runs can reuse them. An empty path disables it (default)
+  void setInfoCacheDirectory(const openstudio::path& cacheDir);
+  static openstudio::path defaultInfoCacheDirectory();
+
   boost::optional<OSMInfo> getModel(const openstudio::path& osmPath, bool force_reload = false);
   boost::optional<IDFInfo> getIdf(const openstudio::path& idfPath, bool force_reload = false);
+  // Same as getModel / getIdf, but the returned model and workspace are clones (keeping handles) that the caller can modify
+  boost::optional<OSMInfo> cloneModel(const openstudio::path& osmPath, bool force_reload = false);
+  boost::optional<IDFInfo> cloneIdf(const openstudio::path& idfPath, bool force_reload = false);
   boost::optional<BCLMeasure> getMeasure(const openstudio::path& measureDirPath, bool force_reload = false);
   openstudio::measure::OSMeasureInfo getMeasureInfo(const openstudio::path& measureDirPath, const BCLMeasure& measure,
                                                     const openstudio::path& osmOrIdfPath = "",
@@ -80,6 +96,12 @@ class MeasureManager
 
  private:
   REGISTER_LOGGER("MeasureManager");
+
+  void runOnEngine(MeasureLanguage measureLanguage, const std::function<void()>& fun);
+
+  // Held while working on a measure directory, osm or idf path
+  std::recursive_mutex& pathMutex(const openstudio::path& p);
+
   //#if USE_RUBY_ENGINE
   ScriptEngineInstance& rubyEngine;
   //#endif
@@ -90,6 +112,13 @@ class MeasureManager
   std::map<openstudio::path, OSMInfo> m_osms;
   std::map<openstudio::path, IDFInfo> m_idfs;
   std::map<openstudio::path, BCLMeasureInfo> m_measures;
+
+  // Guards m_osms, m_idfs, m_measures and m_pathMutexes
+  mutable std::mutex m_mutex;
+  std::map<openstudio::path, std::recursive_mutex> m_pathMutexes;
+
+  EngineRunner m_engineRunner;
+  boost::optional<measure::MeasureInfoCache> m_infoCache;
 };
 
 class MeasureManagerServer
@@ -101,6 +130,8 @@ class MeasureManagerServer
   bool close();
   void do_tasks_forever();
 
+  void setInfoCacheDirectory(const openstudio::path& cacheDir);
+
  protected:
  private:
   struct ResponseType
@@ -121,7 +152,8 @@ class MeasureManagerServer
   ResponseType duplicate_measure(const web::json::value& body);
   ResponseType update_measures(const web::json::value& body);
 
-  // Generally request handler, to ensure the work is done on the main thread.
+  // Generally request handler, the request is queued for the worker threads and its script engine calls are run by the interpreter thread of their
+  // language, see do_tasks_forever.
   // See commit message at https://github.com/NREL/OpenStudio/commit/3c4a1c32fd096ca183c5668e2aafe99ac6564fb4#diff-9785c162dbb96e5fdead1b101c7a2d639460e0bdb0d95c8ff21be7a451a8f377
   using memRequestHandlerFunPtr = ResponseType (MeasureManagerServer::*)(const web::json::value& body);
   void handle_request(const web::http::http_request& message, const web::json::value& body, memRequestHandlerFunPtr request_handler);
@@ -129,11 +161,19 @@ class MeasureManagerServer
   void handle_get(web::http::http_request message);
   void handle_post(web::http::http_request message);
   static void handle_error(pplx::task<void>& t);
+  void runOnEngine(MeasureLanguage measureLanguage, const std::function<void()>& fun);
+  openstudio::path myMeasuresDir() const;
+
   MeasureManager m_measureManager;
   web::http::experimental::listener::http_listener m_listener;
+  // Requests, processed by the worker threads
   ThreadSafeDeque<std::packaged_task<ResponseType()>> tasks;
+  // Script engine calls, processed by the interpreter thread of their language
+  ThreadSafeDeque<std::packaged_task<void()>> m_rubyTasks;
+  ThreadSafeDeque<std::packaged_task<void()>> m_pythonTasks;
 
   std::string m_url;
+  mutable std::mutex m_mutex;  // Guards my_measures_dir
   openstudio::path my_measures_dir;
 };
 
@@ -103,6 +103,15 @@ namespace cli {
                                               ->option_text("PORT")
                                               ->excludes(directoryPathOpt);
 
+    auto* infoCacheDirOpt = measureCommand
+                              ->add_option("--info_cache_dir", opt->info_cache_dir,
+                                           fmt::format("Directory where the computed measure information (arguments, outputs) is cached between runs "
+                                                       "[Default: '{}']",
+                                                       MeasureManager::defaultInfoCacheDirectory().generic_string()))
+                              ->option_text("DIR");
+    measureCommand->add_flag("--no_info_cache", opt->no_info_cache, "Do not cache the computed measure information between runs")
+      ->excludes(infoCacheDirOpt);
+
     {
       auto* newMeasureSubCommand = measureCommand->add_subcommand("new", "Create a new measure");
 
@@ -305,14 +314,21 @@ $ openstudio measure new --list-for-first-taxonomy-tag HVAC
   void MeasureUpdateOptions::execute(MeasureUpdateOptions const& opt, ScriptEngineInstance& rubyEngine, ScriptEngineInstance& pythonEngine) {
     // opt.debug_print();
 
+    openstudio::path infoCacheDir;
+    if (!opt.no_info_cache) {
+      infoCacheDir = opt.info_cache_dir.empty() ? MeasureManager::defaultInfoCacheDirectory() : opt.info_cache_dir;
+    }
+
     if (opt.server_port > 0) {
       MeasureManagerServer server(opt.server_port, rubyEngine, pythonEngine);
+      server.setInfoCacheDirectory(infoCacheDir);
       server.open();              // This starts the cpprestsdk http listener, which processes tasks in subthreads
-      server.do_tasks_forever();  // This starts the event loop on the **main** thread to process the requests there and NOT in a subthread
+      server.do_tasks_forever();  // This starts the worker threads, and runs the ruby script engine calls on the **main** thread
 
       return;
     } else if (opt.update) {
       MeasureManager measureManager(rubyEngine, pythonEngine);
+      measureManager.setInfoCacheDirectory(infoCacheDir);
       if (auto measure_ = measureManager.getMeasure(opt.directoryPath, true)) {
         // TODO: maybe I should write an OSMeasureInfo::toJSON() method, but that'd be duplicating the code in BCLMeasure (BCLXML to be exact).
         // So since the only thing that's different is the OSArgument (OSMeasureInfo) versus BCLMeasureArgument (BCLMeasure), we just override
@@ -325,6 +341,7 @@ $ openstudio measure new --list-for-first-taxonomy-tag HVAC
       return;
     } else if (opt.update_all) {
       MeasureManager measureManager(rubyEngine, pythonEngine);
+      measureManager.setInfoCacheDirectory(infoCacheDir);
       std::vector<openstudio::path> subDirPaths;
       for (auto const& dir_entry : boost::filesystem::directory_iterator{opt.directoryPath}) {
         const auto& subDirPath = dir_entry.path();
@@ -341,6 +358,7 @@ $ openstudio measure new --list-for-first-taxonomy-tag HVAC
       // NOTE: cannot move into MeasureManager to avoid repeating the code shared with MeasureManagerServer. This expects an OSM **or an IDF** in the
       // case of an EnergyPlus Measure, whereas the server /compute_arguments endpoint always expects an OSM
       MeasureManager measureManager(rubyEngine, pythonEngine);
+      measureManager.setInfoCacheDirectory(infoCacheDir);
       auto measure_ = measureManager.getMeasure(opt.directoryPath, true);
       if (!measure_) {
         auto msg = fmt::format("Cannot load measure at '{}'", opt.directoryPath.generic_string());
@@ -457,6 +475,8 @@ end
     fmt::print("compute_arguments_model={}\n", this->compute_arguments_model.string());
     fmt::print("run_tests={}\n", this->run_tests);
     fmt::print("server_port={}\n", this->server_port);
+    fmt::print("info_cache_dir={}\n", this->info_cache_dir.string());
+    fmt::print("no_info_cache={}\n", this->no_info_cache);
     fmt::print("\n\n");
   }
 
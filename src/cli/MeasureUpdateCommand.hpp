@@ -50,6 +50,9 @@ namespace cli {
 
     unsigned server_port = 0;
 
+    openstudio::path info_cache_dir;
+    bool no_info_cache = false;
+
     MeasureNewOptions newMeasureOpts;
   };
 
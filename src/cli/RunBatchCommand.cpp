@@ -0,0 +1,671 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "RunBatchCommand.hpp"
+#include "../workflow/OSWorkflow.hpp"
+#include "../workflow/WorkflowRunOptions.hpp"
+#include "../scriptengine/ScriptEngine.hpp"
+#include "../utilities/core/ApplicationPathHelpers.hpp"
+#include "../utilities/core/ASCIIStrings.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/filetypes/WorkflowJSON.hpp"
+#include "../utilities/time/DateTime.hpp"
+
+#include <boost/process.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <json/json.h>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace openstudio {
+namespace cli {
+
+  namespace {
+
+    // The messages a worker sends on its stdout are single line JSON objects starting with this prefix: the result of its job, or a
+    // request to enter / a notice that it left a state that has a limit. Anything else it prints is the output of its current job.
+    constexpr std::string_view messagePrefix = "__OPENSTUDIO_RUN_BATCH__ ";
+
+    struct RunBatchOptions
+    {
+      std::vector<openstudio::path> paths;
+      openstudio::path list_path;
+      unsigned num_workers = std::max(1U, std::thread::hardware_concurrency());
+      openstudio::path summary_path = "run_batch_summary.json";
+      std::vector<std::string> state_limits;
+      bool worker = false;
+      WorkflowRunOptions workflowRunOptions;
+    };
+
+    struct BatchJob
+    {
+      openstudio::path osw_path;
+      // Overrides of the run_directory and out_name of the OSW, empty if the OSW's own are used
+      openstudio::path run_dir;
+      openstudio::path out_path;
+      openstudio::path absolute_run_dir;
+      openstudio::path absolute_out_path;
+
+      bool success = false;
+      std::string error;
+      double elapsed = 0.0;
+      int worker = -1;
+    };
+
+    std::string toSingleLineString(const Json::Value& value) {
+      Json::StreamWriterBuilder wbuilder;
+      wbuilder["indentation"] = "";
+      return Json::writeString(wbuilder, value);
+    }
+
+    boost::optional<Json::Value> parseSingleLineString(const std::string& s) {
+      Json::CharReaderBuilder rbuilder;
+      std::istringstream ss(s);
+      std::string formattedErrors;
+      Json::Value root;
+      if (!Json::parseFromStream(rbuilder, ss, &root, &formattedErrors) || !root.isObject()) {
+        return boost::none;
+      }
+      return root;
+    }
+
+    std::map<std::string, unsigned> parseStateLimits(const std::vector<std::string>& stateLimits) {
+      const std::vector<std::string> stateNames = OSWorkflow::stateNames();
+      std::map<std::string, unsigned> result;
+      for (const auto& stateLimit : stateLimits) {
+        const auto pos = stateLimit.find('=');
+        const std::string state = stateLimit.substr(0, pos);
+        unsigned limit = 0;
+        bool isValid = (pos != std::string::npos) && (std::find(stateNames.begin(), stateNames.end(), state) != stateNames.end());
+        if (isValid) {
+          const char* last = stateLimit.data() + stateLimit.size();
+          auto [ptr, ec] = std::from_chars(stateLimit.data() + pos + 1, last, limit);
+          isValid = (ec == std::errc()) && (ptr == last) && (limit > 0);
+        }
+        if (!isValid) {
+          throw std::runtime_error(
+            fmt::format("Invalid state limit '{}', expected STATE=N with N > 0 and STATE one of: {}", stateLimit, fmt::join(stateNames, ", ")));
+        }
+        result[state] = limit;
+      }
+      return result;
+    }
+
+    /** Collects the OSWs to run, in order and without duplicates. A directory is searched for OSWs along with its immediate subdirectories,
+     *  skipping the OSWs that have a completed_status (out.osw from previous runs) */
+    std::vector<BatchJob> collectJobs(const RunBatchOptions& opt) {
+      std::vector<BatchJob> jobs;
+      std::set<openstudio::path> seen;
+
+      auto addJob = [&jobs, &seen](const openstudio::path& p, bool skipOutputs) {
+        BatchJob job;
+        if (!openstudio::filesystem::is_regular_file(p)) {
+          job.osw_path = openstudio::filesystem::system_complete(p);
+          job.error = "Cannot find OSW";
+          jobs.push_back(std::move(job));
+          return;
+        }
+        job.osw_path = openstudio::filesystem::canonical(p);
+        if (!seen.insert(job.osw_path).second) {
+          return;
+        }
+        if (auto workflow_ = WorkflowJSON::load(job.osw_path)) {
+          if (skipOutputs && workflow_->completedStatus()) {
+            return;
+          }
+          job.absolute_run_dir = workflow_->absoluteRunDir();
+          job.absolute_out_path = workflow_->absoluteOutPath();
+        } else {
+          job.error = "Cannot load OSW";
+        }
+        jobs.push_back(std::move(job));
+      };
+
+      auto sortedOSWsIn = [](const openstudio::path& dir) {
+        std::vector<openstudio::path> result;
+        for (const auto& entry : openstudio::filesystem::directory_iterator(dir)) {
+          if ((entry.path().extension() == ".osw") && openstudio::filesystem::is_regular_file(entry.path())) {
+            result.push_back(entry.path());
+          }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+      };
+
+      auto addDirectory = [&addJob, &sortedOSWsIn](const openstudio::path& dir) {
+        for (const auto& oswPath : sortedOSWsIn(dir)) {
+          addJob(oswPath, true);
+        }
+        std::vector<openstudio::path> subDirs;
+        for (const auto& entry : openstudio::filesystem::directory_iterator(dir)) {
+          if (openstudio::filesystem::is_directory(entry.path())) {
+            subDirs.push_back(entry.path());
+          }
+        }
+        std::sort(subDirs.begin(), subDirs.end());
+        for (const auto& subDir : subDirs) {
+          for (const auto& oswPath : sortedOSWsIn(subDir)) {
+            addJob(oswPath, true);
+          }
+        }
+      };
+
+      for (const auto& p : opt.paths) {
+        if (openstudio::filesystem::is_directory(p)) {
+          addDirectory(p);
+        } else {
+          addJob(p, false);
+        }
+      }
+
+      if (!opt.list_path.empty()) {
+        // One OSW per line, relative paths are relative to the list file. Empty lines and lines starting with '#' are ignored
+        const openstudio::path listDir = openstudio::filesystem::system_complete(opt.list_path).parent_path();
+        openstudio::filesystem::ifstream ifs(opt.list_path);
+        std::string line;
+        while (std::getline(ifs, line)) {
+          openstudio::ascii_trim(line);
+          if (line.empty() || line.starts_with('#')) {
+            continue;
+          }
+          openstudio::path p = toPath(line);
+          if (p.is_relative()) {
+            p = listDir / p;
+          }
+          if (openstudio::filesystem::is_directory(p)) {
+            addDirectory(p);
+          } else {
+            addJob(p, false);
+          }
+        }
+      }
+
+      return jobs;
+    }
+
+    /** OSWs that would share a run directory or an out.osw (typically because they are in the same directory) get their own, suffixed
+     *  with the name of the OSW. The ones that would still collide are not run. */
+    void isolateJobs(std::vector<BatchJob>& jobs) {
+      auto countByPaths = [&jobs]() {
+        std::map<openstudio::path, size_t> runDirCounts;
+        std::map<openstudio::path, size_t> outPathCounts;
+        for (const auto& job : jobs) {
+          if (job.error.empty()) {
+            ++runDirCounts[job.absolute_run_dir];
+            ++outPathCounts[job.absolute_out_path];
+          }
+        }
+        return std::make_pair(std::move(runDirCounts), std::move(outPathCounts));
+      };
+
+      auto [runDirCounts, outPathCounts] = countByPaths();
+      for (auto& job : jobs) {
+        if (!job.error.empty()) {
+          continue;
+        }
+        const std::string oswStem = job.osw_path.stem().string();
+        if (runDirCounts[job.absolute_run_dir] > 1) {
+          job.run_dir = job.absolute_run_dir.parent_path() / toPath(job.absolute_run_dir.filename().string() + "_" + oswStem);
+          job.absolute_run_dir = job.run_dir;
+        }
+        if (outPathCounts[job.absolute_out_path] > 1) {
+          job.out_path = job.absolute_out_path.parent_path()
+                         / toPath(job.absolute_out_path.stem().string() + "_" + oswStem + job.absolute_out_path.extension().string());
+          job.absolute_out_path = job.out_path;
+        }
+      }
+
+      std::tie(runDirCounts, outPathCounts) = countByPaths();
+      for (auto& job : jobs) {
+        if (!job.error.empty()) {
+          continue;
+        }
+        if (runDirCounts[job.absolute_run_dir] > 1) {
+          job.error = fmt::format("Run directory '{}' is shared with another OSW of the batch", job.absolute_run_dir.generic_string());
+        } else if (outPathCounts[job.absolute_out_path] > 1) {
+          job.error = fmt::format("Output OSW '{}' is shared with another OSW of the batch", job.absolute_out_path.generic_string());
+        }
+      }
+    }
+
+    void runJob(BatchJob& job, const WorkflowRunOptions& baseRunOptions, ScriptEngineInstance& ruby, ScriptEngineInstance& python) {
+      WorkflowRunOptions runOptions = baseRunOptions;
+      runOptions.osw_path = job.osw_path;
+      runOptions.run_dir = job.run_dir;
+      runOptions.out_path = job.out_path;
+      try {
+        OSWorkflow workflow(runOptions, ruby, python);
+        job.success = workflow.run();
+        if (!job.success) {
+          job.error = "Workflow failed, check the run.log";
+        }
+      } catch (const std::exception& e) {
+        job.success = false;
+        job.error = e.what();
+      }
+    }
+
+    void sendMessage(const Json::Value& message, ScriptEngineInstance& ruby, ScriptEngineInstance& python) {
+      // Everything the job printed must be out before the message
+      if (ruby) {
+        ruby->exec("$stdout.flush; $stderr.flush");
+      }
+      if (python) {
+        python->exec("import sys; sys.stdout.flush(); sys.stderr.flush()");
+      }
+      std::cout.flush();
+      std::fflush(stderr);
+
+      fmt::print("{}{}\n", messagePrefix, toSingleLineString(message));
+      std::fflush(stdout);
+    }
+
+    /** The worker loop: reads jobs from stdin, one per line, and runs them in this process, reusing the script engines. */
+    void runWorker(const WorkflowRunOptions& baseRunOptions, ScriptEngineInstance& ruby, ScriptEngineInstance& python) {
+      WorkflowRunOptions runOptions = baseRunOptions;
+      if (!runOptions.state_limits.empty()) {
+        runOptions.state_callback = [&ruby, &python, &stateLimits = baseRunOptions.state_limits](std::string_view state, bool entering) {
+          if (!stateLimits.contains(std::string{state})) {
+            return;
+          }
+          Json::Value message(Json::objectValue);
+          message["type"] = entering ? "enter" : "leave";
+          message["state"] = std::string{state};
+          sendMessage(message, ruby, python);
+          if (entering) {
+            // Wait for the go-ahead
+            std::string line;
+            std::getline(std::cin, line);
+          }
+        };
+      }
+
+      std::string line;
+      while (std::getline(std::cin, line)) {
+        openstudio::ascii_trim(line);
+        if (line.empty()) {
+          continue;
+        }
+
+        BatchJob job;
+        if (auto request_ = parseSingleLineString(line)) {
+          job.osw_path = toPath((*request_)["osw_path"].asString());
+          job.run_dir = toPath((*request_)["run_dir"].asString());
+          job.out_path = toPath((*request_)["out_path"].asString());
+          runJob(job, runOptions, ruby, python);
+        } else {
+          job.error = fmt::format("Cannot parse job '{}'", line);
+        }
+
+        Json::Value result(Json::objectValue);
+        result["type"] = "result";
+        result["success"] = job.success;
+        result["error"] = job.error;
+        sendMessage(result, ruby, python);
+      }
+    }
+
+    /** Bounds the number of workflows in each state across the workers. */
+    class StateLimiter
+    {
+     public:
+      explicit StateLimiter(std::map<std::string, unsigned> limits) : m_limits(std::move(limits)) {}
+
+      /** Blocks until there are less workflows than the limit in state, if any. */
+      void enter(const std::string& state) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto it = m_limits.find(state);
+        if (it == m_limits.end()) {
+          return;
+        }
+        unsigned& count = m_counts[state];
+        m_stateLeft.wait(lock, [&count, limit = it->second]() { return count < limit; });
+        ++count;
+      }
+
+      void leave(const std::string& state) {
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          auto it = m_counts.find(state);
+          if ((it == m_counts.end()) || (it->second == 0)) {
+            return;
+          }
+          --it->second;
+        }
+        m_stateLeft.notify_all();
+      }
+
+     private:
+      std::mutex m_mutex;
+      std::condition_variable m_stateLeft;
+      const std::map<std::string, unsigned> m_limits;
+      std::map<std::string, unsigned> m_counts;
+    };
+
+    class BatchProgress
+    {
+     public:
+      explicit BatchProgress(size_t numJobs) : m_numJobs(numJobs) {}
+
+      void report(const BatchJob& job) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_numDone;
+        if (job.success) {
+          fmt::print("[{}/{}] Success '{}' ({:.1f}s)\n", m_numDone, m_numJobs, job.osw_path.generic_string(), job.elapsed);
+        } else {
+          fmt::print("[{}/{}] Fail '{}' ({:.1f}s): {}\n", m_numDone, m_numJobs, job.osw_path.generic_string(), job.elapsed, job.error);
+        }
+        std::fflush(stdout);
+      }
+
+     private:
+      std::mutex m_mutex;
+      size_t m_numJobs;
+      size_t m_numDone = 0;
+    };
+
+    struct WorkerProcess
+    {
+      WorkerProcess(const openstudio::path& cliPath, const std::vector<std::string>& workerArgs)
+        : child(cliPath, boost::process::args(workerArgs), boost::process::std_in < in, (boost::process::std_out & boost::process::std_err) > out) {}
+
+      boost::process::opstream in;
+      boost::process::ipstream out;
+      boost::process::child child;
+    };
+
+    /** Runs the jobs with numWorkers `openstudio run_batch --worker` processes, each one running the jobs it is handed one after the other. A
+     *  worker that dies is replaced by a new one for the next jobs. */
+    void runWithWorkers(std::vector<BatchJob>& jobs, unsigned numWorkers, const std::vector<std::string>& workerArgs, StateLimiter& stateLimiter,
+                        BatchProgress& progress) {
+#ifndef _WIN32
+      // A worker that dies while we send it a job must not take us down with it
+      std::signal(SIGPIPE, SIG_IGN);
+#endif
+      const openstudio::path cliPath = getOpenStudioCLI();
+      if (cliPath.empty()) {
+        throw std::runtime_error("Cannot find the openstudio CLI to start the workers");
+      }
+
+      std::atomic<size_t> nextJob = 0;
+
+      auto workerLoop = [&jobs, &nextJob, &cliPath, &workerArgs, &stateLimiter, &progress](int workerIndex) {
+        std::unique_ptr<WorkerProcess> process;
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+          BatchJob& job = jobs[i];
+          if (!job.error.empty()) {
+            progress.report(job);
+            continue;
+          }
+
+          const auto start = std::chrono::steady_clock::now();
+          job.worker = workerIndex;
+          std::string output;
+          bool hasResult = false;
+          std::vector<std::string> enteredStates;
+          try {
+            if (!process) {
+              process = std::make_unique<WorkerProcess>(cliPath, workerArgs);
+            }
+
+            Json::Value request(Json::objectValue);
+            request["osw_path"] = toString(job.osw_path);
+            request["run_dir"] = toString(job.run_dir);
+            request["out_path"] = toString(job.out_path);
+            process->in << toSingleLineString(request) << std::endl;
+
+            std::string line;
+            while (!hasResult && std::getline(process->out, line)) {
+              std::string_view trimmedLine = openstudio::ascii_trim_right(line);  // Fix for windows...
+              // The message follows whatever the job printed last, which may not have ended with a newline
+              const auto prefixPos = trimmedLine.find(messagePrefix);
+              if (prefixPos == std::string_view::npos) {
+                output.append(trimmedLine);
+                output += '\n';
+                continue;
+              }
+              if (prefixPos > 0) {
+                output.append(trimmedLine.substr(0, prefixPos));
+                output += '\n';
+              }
+              trimmedLine.remove_prefix(prefixPos + messagePrefix.size());
+              auto message_ = parseSingleLineString(std::string{trimmedLine});
+              if (!message_) {
+                continue;
+              }
+              const std::string type = (*message_)["type"].asString();
+              if (type == "enter") {
+                const std::string state = (*message_)["state"].asString();
+                stateLimiter.enter(state);
+                enteredStates.push_back(state);
+                process->in << "go" << std::endl;
+              } else if (type == "leave") {
+                const std::string state = (*message_)["state"].asString();
+                auto it = std::find(enteredStates.begin(), enteredStates.end(), state);
+                if (it != enteredStates.end()) {
+                  enteredStates.erase(it);
+                  stateLimiter.leave(state);
+                }
+              } else if (type == "result") {
+                job.success = (*message_)["success"].asBool();
+                job.error = (*message_)["error"].asString();
+                hasResult = true;
+              }
+            }
+
+            if (!hasResult) {
+              process->child.wait();
+              job.error = fmt::format("The worker process exited unexpectedly with code {}", process->child.exit_code());
+              process.reset();
+            }
+          } catch (const std::exception& e) {
+            job.error = fmt::format("Cannot run the worker process: {}", e.what());
+            process.reset();
+          }
+          // A worker that died in a state doesn't hold it anymore
+          for (const auto& state : enteredStates) {
+            stateLimiter.leave(state);
+          }
+          job.elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+          if (!output.empty() && openstudio::filesystem::is_directory(job.absolute_run_dir)) {
+            openstudio::filesystem::ofstream ofs(job.absolute_run_dir / "stdout-openstudio", std::ios_base::trunc);
+            ofs << output;
+          }
+          progress.report(job);
+        }
+
+        if (process) {
+          // Closing its stdin ends the worker
+          process->in.pipe().close();
+          process->child.wait();
+        }
+      };
+
+      std::vector<std::thread> threads;
+      threads.reserve(numWorkers);
+      for (unsigned i = 0; i < numWorkers; ++i) {
+        threads.emplace_back(workerLoop, static_cast<int>(i));
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    }
+
+    void writeSummary(const std::vector<BatchJob>& jobs, const openstudio::path& summaryPath, unsigned numWorkers,
+                      const std::map<std::string, unsigned>& stateLimits, const DateTime& startedAt, double elapsed) {
+      Json::Value root(Json::objectValue);
+      root["started_at"] = startedAt.toISO8601();
+      root["completed_at"] = DateTime::now().toISO8601();
+      root["elapsed"] = elapsed;
+      root["num_workers"] = numWorkers;
+      Json::Value stateLimitsValue(Json::objectValue);
+      for (const auto& [state, limit] : stateLimits) {
+        stateLimitsValue[state] = limit;
+      }
+      root["state_limits"] = stateLimitsValue;
+      root["num_jobs"] = static_cast<Json::UInt64>(jobs.size());
+
+      Json::UInt64 numSucceeded = 0;
+      Json::Value jobsValue(Json::arrayValue);
+      for (const auto& job : jobs) {
+        Json::Value jobValue(Json::objectValue);
+        jobValue["osw_path"] = toString(job.osw_path);
+        jobValue["run_directory"] = toString(job.absolute_run_dir);
+        jobValue["out_path"] = toString(job.absolute_out_path);
+        jobValue["completed_status"] = job.success ? "Success" : "Fail";
+        if (!job.error.empty()) {
+          jobValue["error"] = job.error;
+        }
+        if (job.worker >= 0) {
+          jobValue["worker"] = job.worker;
+        }
+        jobValue["elapsed"] = job.elapsed;
+        jobsValue.append(jobValue);
+        if (job.success) {
+          ++numSucceeded;
+        }
+      }
+      root["num_succeeded"] = numSucceeded;
+      root["num_failed"] = static_cast<Json::UInt64>(jobs.size()) - numSucceeded;
+      root["jobs"] = jobsValue;
+
+      Json::StreamWriterBuilder wbuilder;
+      wbuilder["indentation"] = "  ";
+      openstudio::filesystem::ofstream ofs(summaryPath, std::ios_base::trunc);
+      if (!ofs) {
+        throw std::runtime_error(fmt::format("Cannot write the summary to '{}'", summaryPath.generic_string()));
+      }
+      ofs << Json::writeString(wbuilder, root) << '\n';
+    }
+
+  }  // namespace
+
+  void setupRunBatchOptions(CLI::App* parentApp, ScriptEngineInstance& ruby, ScriptEngineInstance& python, std::vector<std::string> cliArgs) {
+    auto opt = std::make_shared<RunBatchOptions>();
+
+    auto* const app = parentApp->add_subcommand("run_batch", "Executes many OpenStudio Workflow files with a pool of long-lived worker processes");
+
+    app
+      ->add_option("paths", opt->paths,
+                   "OSW files, or directories to search for OSW files (along with their immediate subdirectories, skipping out.osw files)")
+      ->option_text("PATH ...")
+      ->check(CLI::ExistingPath);
+
+    app->add_option("--list", opt->list_path, "FILE listing the OSW files or directories to run, one per line")
+      ->option_text("FILE")
+      ->check(CLI::ExistingFile);
+
+    app
+      ->add_option("-j,--jobs", opt->num_workers,
+                   fmt::format("Number of worker processes, each one runs one OSW at a time [Default: {}]", opt->num_workers))
+      ->option_text("N")
+      ->check(CLI::PositiveNumber);
+
+    app->add_option("--summary", opt->summary_path, "Path of the summary JSON file [Default: run_batch_summary.json]")->option_text("FILE");
+
+    app
+      ->add_option("--state-limit", opt->state_limits,
+                   "Maximum number of workers in a workflow state at the same time (may be used more than once). Eg: with more workers than CPUs "
+                   "and --state-limit EnergyPlus=<number of CPUs>, the measures of some OSWs run while others are simulated")
+      ->option_text("STATE=N");
+
+    app->add_flag(
+      "-m,--measures_only",
+      [opt](std::int64_t val) { opt->workflowRunOptions.no_simulation = (val == 1); }, "Only run the OpenStudio and EnergyPlus measures");
+
+    app->add_flag("-p,--postprocess_only", opt->workflowRunOptions.post_process_only, "Only run the reporting measures");
+
+    app->add_flag(
+      "--export-epJSON", [opt](std::int64_t val) { (val != 0) && opt->workflowRunOptions.runOptions.setEpjson((val == 1)); },
+      "export epJSON file format. The default is IDF");
+
+    app->add_flag(
+      "--debug", [opt](std::int64_t val) { (val != 0) && opt->workflowRunOptions.runOptions.setDebug((val == 1)); },
+      "Includes additional outputs for debugging failing workflows and does not clean up the run directory");
+
+    auto* telemetry_opt = app->add_flag("--telemetry", opt->workflowRunOptions.telemetry,
+                                        "Record the wall time, CPU time, peak memory and I/O of each state and measure of each OSW");
+    app->add_flag("--trace", opt->workflowRunOptions.trace, "Also write a Chrome trace event file in each run directory")->needs(telemetry_opt);
+
+    // Internal: the workers are this same command, which reads the OSWs to run on stdin
+    app->add_flag("--worker", opt->worker)->group("");
+
+    app->footer("Each OSW gets its own run directory and run.log; with more than one worker, what a worker prints while running an OSW goes to its "
+                "run/stdout-openstudio (with a single worker, the OSWs are run by this process and their output is printed as usual). "
+                "OSWs that share a directory are given a run directory and an out.osw suffixed with their name.");
+
+    // The workers are started with the same arguments, with --worker added after the subcommand
+    std::vector<std::string> workerArgs = std::move(cliArgs);
+    auto it = std::find(workerArgs.begin(), workerArgs.end(), "run_batch");
+    if (it != workerArgs.end()) {
+      workerArgs.insert(std::next(it), "--worker");
+    }
+
+    app->callback([opt, &ruby, &python, workerArgs = std::move(workerArgs)] {
+      opt->workflowRunOptions.state_limits = parseStateLimits(opt->state_limits);
+
+      if (opt->worker) {
+        runWorker(opt->workflowRunOptions, ruby, python);
+        return;
+      }
+
+      std::vector<BatchJob> jobs = collectJobs(*opt);
+      if (jobs.empty()) {
+        throw std::runtime_error("No OSW to run");
+      }
+      isolateJobs(jobs);
+
+      const DateTime startedAt = DateTime::now();
+      const auto start = std::chrono::steady_clock::now();
+      const auto numWorkers = static_cast<unsigned>(std::min<size_t>(opt->num_workers, jobs.size()));
+      BatchProgress progress(jobs.size());
+
+      if (numWorkers == 1) {
+        // No point in starting a worker, this process is the worker
+        for (auto& job : jobs) {
+          if (job.error.empty()) {
+            const auto jobStart = std::chrono::steady_clock::now();
+            job.worker = 0;
+            runJob(job, opt->workflowRunOptions, ruby, python);
+            job.elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - jobStart).count();
+          }
+          progress.report(job);
+        }
+      } else {
+        StateLimiter stateLimiter(opt->workflowRunOptions.state_limits);
+        runWithWorkers(jobs, numWorkers, workerArgs, stateLimiter, progress);
+      }
+
+      const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      writeSummary(jobs, opt->summary_path, numWorkers, opt->workflowRunOptions.state_limits, startedAt, elapsed);
+
+      const auto numFailed = std::count_if(jobs.begin(), jobs.end(), [](const auto& job) { return !job.success; });
+      fmt::print("Ran {} OSWs with {} workers in {:.1f}s: {} succeeded, {} failed. Summary written to '{}'\n", jobs.size(), numWorkers, elapsed,
+                 static_cast<std::ptrdiff_t>(jobs.size()) - numFailed, numFailed, opt->summary_path.generic_string());
+      if (numFailed > 0) {
+        std::exit(1);
+      }
+    });
+  }
+
+}  // namespace cli
+}  // namespace openstudio
@@ -0,0 +1,28 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef CLI_RUNBATCHCOMMAND_HPP
+#define CLI_RUNBATCHCOMMAND_HPP
+
+#include <CLI/App.hpp>
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+class ScriptEngineInstance;
+
+namespace cli {
+
+  /** Sets up the `run_batch` subcommand, which runs many OSWs with a pool of long-lived `openstudio run_batch --worker` processes.
+   *  cliArgs are the arguments the CLI was called with (without the program name), they are forwarded to the workers so that they are
+   *  set up the same way (gem paths, python path, log level, run flags...) */
+  void setupRunBatchOptions(CLI::App* parentApp, ScriptEngineInstance& ruby, ScriptEngineInstance& python, std::vector<std::string> cliArgs);
+
+}  // namespace cli
+}  // namespace openstudio
+
+#endif  // CLI_RUNBATCHCOMMAND_HPP
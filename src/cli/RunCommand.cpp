@@ -63,6 +63,12 @@ namespace cli {
       "--debug", [opt](std::int64_t val) { (val != 0) && opt->runOptions.setDebug((val == 1)); },
       "Includes additional outputs for debugging failing workflows and does not clean up the run directory");
 
+    auto* telemetry_opt =
+      app->add_flag("--telemetry", opt->telemetry,
+                    "Record the wall time, CPU time, peak memory and I/O of each state and measure to run/telemetry.json and to the out.osw");
+    app->add_flag("--trace", opt->trace, "Also write run/trace.json in the Chrome trace event format (chrome://tracing, ui.perfetto.dev)")
+      ->needs(telemetry_opt);
+
     // FT options
     static constexpr auto ftGroupName = "Forward Translator Options";
     app
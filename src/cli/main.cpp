@@ -5,6 +5,7 @@
 
 #include "RubyCLI.hpp"
 #include "MeasureUpdateCommand.hpp"
+#include "RunBatchCommand.hpp"
 #include "RunCommand.hpp"
 #include "UpdateCommand.hpp"
 #include "../scriptengine/ScriptEngine.hpp"
@@ -59,6 +60,9 @@ int main(int argc, char* argv[]) {
 
   const bool is_classic = !args.empty() && (args[0] == "classic");
 
+  // Kept untouched, as they are forwarded to the run_batch worker processes
+  const std::vector<std::string> cliArgs = args;
+
   if (is_classic) {
     // The "classic" cli implementation will not be expecting the first arg
     // to be the word classic so we need to remove the first arg
@@ -286,6 +290,9 @@ int main(int argc, char* argv[]) {
     // run command
     openstudio::cli::setupRunOptions(&app, rubyEngine, pythonEngine);
 
+    // run_batch command
+    openstudio::cli::setupRunBatchOptions(&app, rubyEngine, pythonEngine, cliArgs);
+
     // update (model) command
     // openstudio::cli::setupUpdateCommand(&app);
     {
@@ -15,6 +15,7 @@ import signal
 import socket
 import subprocess
 import time
+from concurrent.futures import ThreadPoolExecutor
 from contextlib import closing
 from copy import deepcopy
 from pathlib import Path
@@ -543,3 +544,125 @@ def test_duplicate_measure(
     )
     assert old_measure_dir.is_dir()
     assert new_measure_dir.is_dir()
+
+
+def test_concurrent_requests(
+    measure_manager_client: MeasureManagerClient,
+    tmp_path: Path,
+    osclipath: Path,
+):
+    """Requests are processed concurrently, the script engine ones included."""
+    osm_path = tmp_path / "model.osm"
+    _write_example_model_cli(osclipath=osclipath, osm_path=osm_path)
+
+    measure_dirs = []
+    for measure_language in ["Ruby", "Python"]:
+        measure_dir = tmp_path / f"new_{measure_language}_measure"
+        data = {
+            "measure_dir": str(measure_dir),
+            "display_name": f"A {measure_language} ModelMeasure that depends on model",
+            "class_name": "ModelDependentMeasure",
+            "taxonomy_tag": "taxonomy_tag",
+            "measure_type": "ModelMeasure",
+            "measure_language": measure_language,
+            "description": "This is the description",
+            "modeler_description": "This is the modeler description",
+        }
+        r = measure_manager_client.post(url="/create_measure", json=data)
+        r.raise_for_status()
+        modify_measure_for_model_dependent_arg(measure_dir=measure_dir, is_ruby=(measure_language == "Ruby"))
+        measure_dirs.append(measure_dir)
+
+    def compute_arguments(measure_dir: Path):
+        r = measure_manager_client.post(
+            url="/compute_arguments", json={"measure_dir": str(measure_dir), "osm_path": str(osm_path)}
+        )
+        r.raise_for_status()
+        return r.json()
+
+    def internal_state(_):
+        return measure_manager_client.internal_state()
+
+    def get_model(_):
+        r = measure_manager_client.post("/get_model", json={"osm_path": str(osm_path)})
+        r.raise_for_status()
+        return r.json()
+
+    with ThreadPoolExecutor(max_workers=8) as executor:
+        measure_infos = executor.map(compute_arguments, measure_dirs * 3)
+        states = executor.map(internal_state, range(10))
+        models = executor.map(get_model, range(10))
+
+        for measure_info in measure_infos:
+            arguments = measure_info["arguments"]
+            assert len(arguments) == 2
+            assert any(x["name"] == "construction" for x in arguments)
+        for state in states:
+            assert state["status"] == "running"
+        for model in models:
+            assert model.startswith("OK, loaded model with checksum")
+
+    internal_state = measure_manager_client.internal_state()
+    assert len(internal_state["osm"]) == 1
+    assert len(internal_state["measures"]) == 2
+    assert len([x for x in internal_state["measure_info"] if x["osm_path"] == osm_path.as_posix()]) == 2
+
+
+def test_requests_not_blocked_by_compute_arguments(
+    measure_manager_client: MeasureManagerClient,
+    tmp_path: Path,
+    osclipath: Path,
+):
+    """internal_state and get_model are answered while a slow compute_arguments is still running."""
+    osm_path = tmp_path / "model.osm"
+    _write_example_model_cli(osclipath=osclipath, osm_path=osm_path)
+    r = measure_manager_client.post("/get_model", json={"osm_path": str(osm_path)})
+    r.raise_for_status()
+
+    measure_dir = tmp_path / "slow_measure"
+    data = {
+        "measure_dir": str(measure_dir),
+        "display_name": "A slow ModelMeasure",
+        "class_name": "SlowMeasure",
+        "taxonomy_tag": "taxonomy_tag",
+        "measure_type": "ModelMeasure",
+        "measure_language": "Ruby",
+        "description": "This is the description",
+        "modeler_description": "This is the modeler description",
+    }
+    r = measure_manager_client.post(url="/create_measure", json=data)
+    r.raise_for_status()
+
+    # Computing the arguments now takes at least SLEEP seconds
+    SLEEP = 10
+    measure_rb = measure_dir / "measure.rb"
+    content = measure_rb.read_text()
+    args_line = "    args = OpenStudio::Measure::OSArgumentVector.new\n"
+    assert args_line in content
+    measure_rb.write_text(content.replace(args_line, f"    sleep({SLEEP})\n" + args_line))
+
+    def compute_arguments():
+        # Its own session, requests.Session isn't meant to be shared by threads
+        client = MeasureManagerClient(port=int(measure_manager_client.base_url.rsplit(":", 1)[1]))
+        r = client.post(url="/compute_arguments", json={"measure_dir": str(measure_dir), "osm_path": str(osm_path)})
+        r.raise_for_status()
+        return r.json()
+
+    with ThreadPoolExecutor(max_workers=1) as executor:
+        start = time.time()
+        slow = executor.submit(compute_arguments)
+        # Let the server pick up the slow request first
+        time.sleep(1)
+
+        assert measure_manager_client.internal_state()["status"] == "running"
+        r = measure_manager_client.post("/get_model", json={"osm_path": str(osm_path)})
+        r.raise_for_status()
+        assert r.json().startswith("OK, loaded model with checksum")
+
+        # A serial server would only have answered once the arguments were computed
+        assert not slow.done()
+        assert time.time() - start < SLEEP
+
+        measure_info = slow.result()
+        assert time.time() - start >= SLEEP
+        assert measure_info["arguments"][0]["name"] == "space_name"
@@ -0,0 +1,143 @@
+import json
+import subprocess
+from pathlib import Path
+
+OSW_NAMES = ["compact_ruby_only.osw", "compact_python_only.osw"]
+
+# A worker that stops answering would hang the batch, fail instead
+TIMEOUT = 900
+
+
+def _run_batch(osclipath: Path, args):
+    command = [str(osclipath), "run_batch", *[str(x) for x in args]]
+    return subprocess.run(command, capture_output=True, encoding="utf-8", timeout=TIMEOUT)
+
+
+def _check_summary(summary_path: Path, num_workers: int, osw_paths):
+    summary = json.loads(summary_path.read_text())
+    assert summary["num_workers"] == num_workers
+    assert summary["num_jobs"] == len(osw_paths)
+    assert summary["num_succeeded"] == len(osw_paths)
+    assert summary["num_failed"] == 0
+
+    jobs = summary["jobs"]
+    assert [Path(job["osw_path"]).name for job in jobs] == [Path(p).name for p in osw_paths]
+    # They must not share a run directory nor an out.osw
+    assert len({job["run_directory"] for job in jobs}) == len(jobs)
+    assert len({job["out_path"] for job in jobs}) == len(jobs)
+    for job in jobs:
+        assert job["completed_status"] == "Success"
+        assert job["worker"] in range(num_workers)
+        out_osw = json.loads(Path(job["out_path"]).read_text())
+        assert out_osw["completed_status"] == "Success"
+    return summary
+
+
+def _new_ruby_measure(osclipath: Path, tmp_path: Path, run_lines):
+    """Creates tmp_path/measures/BatchMeasure from the ModelMeasure template, with run_lines added at the start of its run method."""
+    measure_dir = tmp_path / "measures" / "BatchMeasure"
+    subprocess.check_call(
+        [
+            str(osclipath),
+            "measure",
+            "new",
+            "--class-name",
+            "BatchMeasure",
+            "--type",
+            "ModelMeasure",
+            "--language",
+            "Ruby",
+            str(measure_dir),
+        ]
+    )
+    measure_rb = measure_dir / "measure.rb"
+    super_line = "    super(model, runner, user_arguments)  # Do **NOT** remove this line\n"
+    content = measure_rb.read_text()
+    assert super_line in content
+    measure_rb.write_text(content.replace(super_line, super_line + "".join(f"    {line}\n" for line in run_lines)))
+
+
+def _write_osws(tmp_path: Path, names):
+    """One OSW per name, each in its own directory, running the BatchMeasure with space_name set to the name."""
+    osw_paths = []
+    for name in names:
+        osw_dir = tmp_path / name
+        osw_dir.mkdir()
+        osw = {
+            "seed_file": str(Path("files/seb.osm").resolve()),
+            "weather_file": str(Path("files/srrl_2013_amy.epw").resolve()),
+            "measure_paths": [str(tmp_path / "measures")],
+            "steps": [{"measure_dir_name": "BatchMeasure", "arguments": {"space_name": name}}],
+        }
+        osw_path = osw_dir / "workflow.osw"
+        osw_path.write_text(json.dumps(osw, indent=2))
+        osw_paths.append(osw_path)
+    return osw_paths
+
+
+def test_run_batch_with_workers(osclipath):
+    summary_path = Path("test_run_batch_summary.json")
+    summary_path.unlink(missing_ok=True)
+    r = _run_batch(osclipath, ["-m", "-j", "2", "--summary", summary_path, *OSW_NAMES])
+    assert r.returncode == 0, f"stdout:\n{r.stdout}\nstderr:\n{r.stderr}"
+    assert "Ran 2 OSWs with 2 workers" in r.stdout
+
+    summary = _check_summary(summary_path=summary_path, num_workers=2, osw_paths=OSW_NAMES)
+    # Both OSWs are in the same directory, they get a run directory suffixed with their name
+    for job in summary["jobs"]:
+        assert Path(job["run_directory"]).name == f"run_{Path(job['osw_path']).stem}"
+
+
+def test_run_batch_output_without_newline(osclipath, tmp_path: Path):
+    """A job whose output does not end with a newline must not hide the messages of its worker."""
+    _new_ruby_measure(osclipath=osclipath, tmp_path=tmp_path, run_lines=["print 'output without a newline'"])
+    osw_paths = _write_osws(tmp_path=tmp_path, names=["a", "b", "c"])
+
+    summary_path = tmp_path / "run_batch_summary.json"
+    r = _run_batch(osclipath, ["-m", "-j", "2", "--summary", summary_path, *osw_paths])
+    assert r.returncode == 0, f"stdout:\n{r.stdout}\nstderr:\n{r.stderr}"
+
+    summary = _check_summary(summary_path=summary_path, num_workers=2, osw_paths=osw_paths)
+    for job in summary["jobs"]:
+        stdout_path = Path(job["run_directory"]) / "stdout-openstudio"
+        assert stdout_path.is_file()
+        output = stdout_path.read_text()
+        assert "output without a newline" in output
+        assert "__OPENSTUDIO_RUN_BATCH__" not in output
+
+
+def test_run_batch_state_limit(osclipath, tmp_path: Path):
+    """With OpenStudioMeasures=1, the measures of two workers never run at the same time."""
+    times_dir = tmp_path / "times"
+    times_dir.mkdir()
+    _new_ruby_measure(
+        osclipath=osclipath,
+        tmp_path=tmp_path,
+        run_lines=[
+            "space_name = runner.getStringArgumentValue('space_name', user_arguments)",
+            "start = Time.now.to_f",
+            "sleep(2)",
+            f"File.write(File.join('{times_dir.as_posix()}', \"#{{space_name}}.txt\"), \"#{{start}} #{{Time.now.to_f}}\")",
+        ],
+    )
+    osw_paths = _write_osws(tmp_path=tmp_path, names=["a", "b", "c", "d"])
+
+    summary_path = tmp_path / "run_batch_summary.json"
+    r = _run_batch(osclipath, ["-m", "-j", "2", "--state-limit", "OpenStudioMeasures=1", "--summary", summary_path, *osw_paths])
+    assert r.returncode == 0, f"stdout:\n{r.stdout}\nstderr:\n{r.stderr}"
+
+    summary = _check_summary(summary_path=summary_path, num_workers=2, osw_paths=osw_paths)
+    assert summary["state_limits"] == {"OpenStudioMeasures": 1}
+    # Both workers were used, so without the limit their measures would have overlapped
+    assert {job["worker"] for job in summary["jobs"]} == {0, 1}
+
+    intervals = sorted(tuple(float(x) for x in p.read_text().split()) for p in times_dir.glob("*.txt"))
+    assert len(intervals) == len(osw_paths)
+    for (_, previous_end), (start, _) in zip(intervals, intervals[1:]):
+        assert previous_end <= start
+
+
+def test_run_batch_invalid_state_limit(osclipath):
+    r = _run_batch(osclipath, ["-j", "2", "--state-limit", "NotAState=1", *OSW_NAMES])
+    assert r.returncode != 0
+    assert "Invalid state limit 'NotAState=1'" in r.stdout + r.stderr
@@ -29,6 +29,7 @@
   #include <energyplus/ForwardTranslator.hpp>
   #include <energyplus/ReverseTranslator.hpp>
   #include <energyplus/ErrorFile.hpp>
+  #include <energyplus/TranslationProfile.hpp>
 
   using namespace openstudio;
   using namespace openstudio::model;
@@ -47,6 +48,9 @@
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
 %include <energyplus/ErrorFile.hpp>
+%template(ErrorFileRecordVector) std::vector<openstudio::energyplus::ErrorFileRecord>;
+%include <energyplus/TranslationProfile.hpp>
+%template(TranslationProfileEntryVector) std::vector<openstudio::energyplus::TranslationProfileEntry>;
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
 
@@ -5,12 +5,125 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <string_view>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    bool isDigit(char c) {
+      return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    }
+
+    bool isSpace(char c) {
+      return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    size_t skipSpaces(std::string_view line, size_t pos) {
+      while (pos < line.size() && isSpace(line[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    size_t skipStars(std::string_view line, size_t pos) {
+      while (pos < line.size() && line[pos] == '*') {
+        ++pos;
+      }
+      return pos;
+    }
+
+    enum class LineKind
+    {
+      Other,
+      WarningOrError,
+      Continue,
+      CompletedSuccessfully,
+      CompletedUnsuccessfully
+    };
+
+    // Parses what follows the '**' that opens a warning or error line, i.e. 'Warning ** text' or '~~~ ** text'
+    LineKind parseMarker(std::string_view line, size_t pos, std::string_view& levelName, std::string_view& rest) {
+      pos = skipSpaces(line, pos);
+      if (line.substr(pos, 3) == "~~~") {
+        pos = skipSpaces(line, pos + 3);
+        if (line.substr(pos, 2) != "**") {
+          return LineKind::Other;
+        }
+        rest = line.substr(pos + 2);
+        return LineKind::Continue;
+      }
+      const size_t levelStart = pos;
+      while (pos < line.size() && std::isalpha(static_cast<unsigned char>(line[pos])) != 0) {
+        ++pos;
+      }
+      if (pos == levelStart) {
+        return LineKind::Other;
+      }
+      levelName = line.substr(levelStart, pos - levelStart);
+      pos = skipSpaces(line, pos);
+      if (line.substr(pos, 2) != "**") {
+        return LineKind::Other;
+      }
+      rest = line.substr(pos + 2);
+      return LineKind::WarningOrError;
+    }
+
+    /** Classifies a line of the err file by looking at its prefix only. Warning and error lines look like '   ** Warning ** text' (or
+     *  '   *************  ** Warning ** text' in the recurring error summary), continuation lines like '   **   ~~~   ** text', and the
+     *  final line like '   ************* EnergyPlus Completed Successfully-- ...' */
+    LineKind classifyLine(std::string_view line, std::string_view& levelName, std::string_view& rest) {
+      const size_t start = skipSpaces(line, 0);
+      if (start == line.size() || line[start] != '*') {
+        return LineKind::Other;
+      }
+
+      // '**' right after the leading spaces
+      if (start > 0 && line.substr(start, 2) == "**") {
+        const LineKind kind = parseMarker(line, start + 2, levelName, rest);
+        if (kind != LineKind::Other) {
+          return kind;
+        }
+      }
+
+      const size_t starsEnd = skipStars(line, start);
+
+      // '*************  **' at the start of the recurring error summary lines
+      const size_t markerStart = skipSpaces(line, starsEnd);
+      if (markerStart > starsEnd && line.substr(markerStart, 2) == "**") {
+        const LineKind kind = parseMarker(line, markerStart + 2, levelName, rest);
+        if (kind != LineKind::Other) {
+          return kind;
+        }
+      }
+
+      const std::string_view text = line.substr(starsEnd);
+      if (text.starts_with(" EnergyPlus Completed Successfully")) {
+        return LineKind::CompletedSuccessfully;
+      }
+      if (text.starts_with(" EnergyPlus Terminated")) {
+        return LineKind::CompletedUnsuccessfully;
+      }
+      if (text.starts_with(" GroundTempCalc")) {
+        size_t pos = std::string_view(" GroundTempCalc").size();
+        while (pos < text.size() && !isSpace(text[pos])) {
+          ++pos;
+        }
+        if (text.substr(pos).starts_with(" Completed Successfully")) {
+          return LineKind::CompletedSuccessfully;
+        }
+      }
+      return LineKind::Other;
+    }
+
+  }  // namespace
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath) : m_completed(false), m_completedSuccessfully(false) {
     openstudio::filesystem::ifstream ifs(errPath);
@@ -43,58 +156,106 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is) {
-    std::string line;
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError(R"(^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$)");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue(R"(^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$)");
+  std::vector<ErrorFileRecord> ErrorFile::records() const {
+    return m_records;
+  }
 
-    // completed successfully
-    boost::regex completedSuccessful(R"(^\s*\*+ EnergyPlus Completed Successfully.*)");
+  std::vector<ErrorFileRecord> ErrorFile::repeatedRecords(const ErrorLevel& level) const {
+    std::vector<ErrorFileRecord> result;
+    std::copy_if(m_records.begin(), m_records.end(), std::back_inserter(result),
+                 [&level](const ErrorFileRecord& record) { return (record.level == level) && (record.count > 1); });
+    std::stable_sort(result.begin(), result.end(), [](const ErrorFileRecord& a, const ErrorFileRecord& b) { return a.count > b.count; });
+    return result;
+  }
 
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful(R"(^\s*\*+ GroundTempCalc\S* Completed Successfully.*)");
+  std::string ErrorFile::messageTemplate(const std::string& message) {
+    std::string result;
+    result.reserve(message.size());
+    size_t i = 0;
+    while (i < message.size()) {
+      const char c = message[i];
+      if (isDigit(c)) {
+        // 12, 1.5, 7.00E-002 all become '#', the sign is kept as is
+        while (i < message.size() && (isDigit(message[i]) || (message[i] == '.' && i + 1 < message.size() && isDigit(message[i + 1])))) {
+          ++i;
+        }
+        if (i < message.size() && (message[i] == 'E' || message[i] == 'e')) {
+          size_t exponent = i + 1;
+          if (exponent < message.size() && (message[exponent] == '-' || message[exponent] == '+')) {
+            ++exponent;
+          }
+          if (exponent < message.size() && isDigit(message[exponent])) {
+            i = exponent;
+            while (i < message.size() && isDigit(message[i])) {
+              ++i;
+            }
+          }
+        }
+        result += '#';
+      } else if (c == '"') {
+        const size_t close = message.find('"', i + 1);
+        if (close == std::string::npos) {
+          result.append(message, i, std::string::npos);
+          break;
+        }
+        result += "\"*\"";
+        i = close + 1;
+      } else {
+        result += c;
+        ++i;
+      }
+    }
+    return result;
+  }
 
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful(R"(^\s*\*+ EnergyPlus Terminated.*)");
+  void ErrorFile::addRecord(const ErrorLevel& level, std::string message, std::vector<std::string> continuationLines) {
+    std::string t_messageTemplate = messageTemplate(message);
+    std::string key = std::to_string(level.value()) + ':' + t_messageTemplate;
+    auto [it, inserted] = m_recordIndex.try_emplace(std::move(key), m_records.size());
+    if (inserted) {
+      ErrorFileRecord record;
+      record.level = level;
+      record.message = std::move(message);
+      record.continuationLines = std::move(continuationLines);
+      record.messageTemplate = std::move(t_messageTemplate);
+      m_records.push_back(std::move(record));
+    }
+    ++m_records[it->second].count;
+  }
 
-    // repeat count
+  void ErrorFile::parse(openstudio::filesystem::ifstream& is) {
+    std::string line;
+    std::string_view levelName;
+    std::string_view rest;
 
-    // read the file line by line using regexes
+    // Lines are classified in a single pass, each line is read once
     bool alreadyGotLine = false;
 
     while (alreadyGotLine || std::getline(is, line)) {
 
       alreadyGotLine = false;
-      boost::smatch matches;
 
-      // LOG(Trace, "Parsing ErrorFile Line '" << line << "'");
+      const LineKind kind = classifyLine(line, levelName, rest);
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)) {
+      if (kind == LineKind::WarningOrError) {
 
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second);
-        boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second);
-        boost::trim(warningOrErrorString);
+        std::string warningOrErrorType(levelName);
+        std::string message(rest);
+        boost::trim(message);
+        std::string warningOrErrorString = message;
+        std::vector<std::string> continuationLines;
 
         // read the rest of the multi line warning or error
         while (true) {
-          // std::streampos pos = is.tellg();
           if (!std::getline(is, line)) {
             break;
           }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)) {
-            std::string temp = std::string(matches[1].first, matches[1].second);
+          if (classifyLine(line, levelName, rest) == LineKind::Continue) {
+            std::string temp(rest);
             boost::trim_right(temp);
             warningOrErrorString += "\n" + temp;
+            continuationLines.push_back(std::move(temp));
           } else {
-            // unget the line
-            // is.seekg(pos);
             // Instead of rewind then reread (which fails on Windows if you have LF line endings)
             // We just use this bool to avoid having to re-read the line.
             alreadyGotLine = true;
@@ -102,33 +263,32 @@ namespace energyplus {
           }
         }
 
-        // LOG(Trace, "Error parsed: " << warningOrErrorString);
-
         // correctly sort warnings and errors
         try {
           ErrorLevel level(warningOrErrorType);
 
           switch (level.value()) {
             case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
+              m_warnings.push_back(std::move(warningOrErrorString));
               break;
             case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
+              m_severeErrors.push_back(std::move(warningOrErrorString));
               break;
             case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
+              m_fatalErrors.push_back(std::move(warningOrErrorString));
               break;
           }
+          addRecord(level, std::move(message), std::move(continuationLines));
 
         } catch (...) {
           LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "' for line '" << line << "'");
         }
 
-      } else if (boost::regex_match(line, completedSuccessful) || boost::regex_match(line, groundTempCompletedSuccessful)) {
+      } else if (kind == LineKind::CompletedSuccessfully) {
         m_completed = true;
         m_completedSuccessfully = true;
         break;
-      } else if (boost::regex_match(line, completedUnsuccessful)) {
+      } else if (kind == LineKind::CompletedUnsuccessfully) {
         m_completed = true;
         m_completedSuccessfully = false;
         break;
@@ -13,6 +13,7 @@
 #include "../utilities/core/Logger.hpp"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -30,6 +31,25 @@ namespace energyplus {
 
   // clang-format on
 
+  /** A warning or error of the ErrorFile, aggregated over all the occurrences that share the same message template */
+  struct ENERGYPLUS_API ErrorFileRecord
+  {
+    ErrorLevel level;
+
+    /** Message of the first occurrence, trimmed */
+    std::string message;
+
+    /** Continuation lines ('**   ~~~   **') of the first occurrence, right trimmed */
+    std::vector<std::string> continuationLines;
+
+    /** Message with the numbers replaced by '#' and the quoted names by '"*"', occurrences with the same level and template are counted
+     *  together */
+    std::string messageTemplate;
+
+    /** Number of occurrences */
+    unsigned count = 0;
+  };
+
   class ENERGYPLUS_API ErrorFile
   {
    public:
@@ -51,14 +71,28 @@ namespace energyplus {
     /// completed successfully
     bool completedSuccessfully() const;
 
+    /// warnings and errors aggregated by level and message template, in order of first occurrence
+    std::vector<ErrorFileRecord> records() const;
+
+    /// records of the given level that occurred more than once, by decreasing count
+    std::vector<ErrorFileRecord> repeatedRecords(const ErrorLevel& level) const;
+
+    /// message template used to aggregate records: numbers are replaced by '#' and quoted names by '"*"'
+    static std::string messageTemplate(const std::string& message);
+
    private:
     REGISTER_LOGGER("energyplus.ErrorFile");
 
     void parse(openstudio::filesystem::ifstream& is);
 
+    void addRecord(const ErrorLevel& level, std::string message, std::vector<std::string> continuationLines);
+
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
+    std::vector<ErrorFileRecord> m_records;
+    // Index in m_records, keyed by level value and message template
+    std::unordered_map<std::string, size_t> m_recordIndex;
     bool m_completed;
     bool m_completedSuccessfully;
   };
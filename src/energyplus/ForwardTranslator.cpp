@@ -657,2306 +657,52 @@ namespace energyplus {
     std::vector<IddObjectType> m_iddObjectTypes;
   };
 
-  // NOLINTBEGIN(readability-function-size, bugprone-branch-clone)
-  boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelObject& modelObject) {
-    boost::optional<IdfObject> retVal;
-
-    // if already translated then exit
-    auto objInMapIt = m_map.find(modelObject.handle());
-    if (objInMapIt != m_map.end()) {
-      return boost::optional<IdfObject>(objInMapIt->second);
-    }
-
-    LOG(Trace, "Translating " << modelObject.briefDescription() << ".");
-
-    switch (modelObject.iddObject().type().value()) {
-      case openstudio::IddObjectType::OS_AdditionalProperties: {
-        // no op
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow: {
-        auto vrf = modelObject.cast<AirConditionerVariableRefrigerantFlow>();
-        retVal = translateAirConditionerVariableRefrigerantFlow(vrf);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow_FluidTemperatureControl: {
-        model::AirConditionerVariableRefrigerantFlowFluidTemperatureControl vrf =
-          modelObject.cast<AirConditionerVariableRefrigerantFlowFluidTemperatureControl>();
-        retVal = translateAirConditionerVariableRefrigerantFlowFluidTemperatureControl(vrf);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow_FluidTemperatureControl_HR: {
-        model::AirConditionerVariableRefrigerantFlowFluidTemperatureControlHR vrf =
-          modelObject.cast<AirConditionerVariableRefrigerantFlowFluidTemperatureControlHR>();
-        retVal = translateAirConditionerVariableRefrigerantFlowFluidTemperatureControlHR(vrf);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC: {
-        auto airLoopHVAC = modelObject.cast<AirLoopHVAC>();
-        retVal = translateAirLoopHVAC(airLoopHVAC);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_ReturnPlenum: {
-        auto airLoopHVACReturnPlenum = modelObject.cast<AirLoopHVACReturnPlenum>();
-        retVal = translateAirLoopHVACReturnPlenum(airLoopHVACReturnPlenum);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_SupplyPlenum: {
-        auto airLoopHVACSupplyPlenum = modelObject.cast<AirLoopHVACSupplyPlenum>();
-        retVal = translateAirLoopHVACSupplyPlenum(airLoopHVACSupplyPlenum);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_DualDuct_ConstantVolume: {
-        auto mo = modelObject.cast<AirTerminalDualDuctConstantVolume>();
-        retVal = translateAirTerminalDualDuctConstantVolume(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV: {
-        auto mo = modelObject.cast<AirTerminalDualDuctVAV>();
-        retVal = translateAirTerminalDualDuctVAV(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV_OutdoorAir: {
-        auto mo = modelObject.cast<AirTerminalDualDuctVAVOutdoorAir>();
-        retVal = translateAirTerminalDualDuctVAVOutdoorAir(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctConstantVolumeFourPipeInduction>();
-        retVal = translateAirTerminalSingleDuctConstantVolumeFourPipeInduction(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_Reheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctConstantVolumeReheat>();
-        retVal = translateAirTerminalSingleDuctConstantVolumeReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctConstantVolumeCooledBeam>();
-        retVal = translateAirTerminalSingleDuctConstantVolumeCooledBeam(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctConstantVolumeFourPipeBeam>();
-        retVal = translateAirTerminalSingleDuctConstantVolumeFourPipeBeam(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ParallelPIU_Reheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctParallelPIUReheat>();
-        retVal = translateAirTerminalSingleDuctParallelPIUReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_SeriesPIU_Reheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctSeriesPIUReheat>();
-        retVal = translateAirTerminalSingleDuctSeriesPIUReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctConstantVolumeNoReheat>();
-        retVal = translateAirTerminalSingleDuctConstantVolumeNoReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_NoReheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctVAVNoReheat>();
-        retVal = translateAirTerminalSingleDuctVAVNoReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_Reheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctVAVReheat>();
-        retVal = translateAirTerminalSingleDuctVAVReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_InletSideMixer: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctInletSideMixer>();
-        retVal = translateAirTerminalSingleDuctInletSideMixer(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctVAVHeatAndCoolNoReheat>();
-        retVal = translateAirTerminalSingleDuctVAVHeatAndCoolNoReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat: {
-        auto airTerminal = modelObject.cast<AirTerminalSingleDuctVAVHeatAndCoolReheat>();
-        retVal = translateAirTerminalSingleDuctVAVHeatAndCoolReheat(airTerminal);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_ZoneSplitter: {
-        auto splitter = modelObject.cast<AirLoopHVACZoneSplitter>();
-        retVal = translateAirLoopHVACZoneSplitter(splitter);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_ZoneMixer: {
-        auto mixer = modelObject.cast<AirLoopHVACZoneMixer>();
-        retVal = translateAirLoopHVACZoneMixer(mixer);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_OutdoorAirSystem: {
-        auto oaSystem = modelObject.cast<AirLoopHVACOutdoorAirSystem>();
-        retVal = translateAirLoopHVACOutdoorAirSystem(oaSystem);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_DedicatedOutdoorAirSystem: {
-        auto doaSystem = modelObject.cast<AirLoopHVACDedicatedOutdoorAirSystem>();
-        retVal = translateAirLoopHVACDedicatedOutdoorAirSystem(doaSystem);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir: {
-        auto unitary = modelObject.cast<AirLoopHVACUnitaryHeatPumpAirToAir>();
-        retVal = translateAirLoopHVACUnitaryHeatPumpAirToAir(unitary);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass: {
-        auto unitary = modelObject.cast<AirLoopHVACUnitaryHeatCoolVAVChangeoverBypass>();
-        retVal = translateAirLoopHVACUnitaryHeatCoolVAVChangeoverBypass(unitary);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed: {
-        auto unitary = modelObject.cast<AirLoopHVACUnitaryHeatPumpAirToAirMultiSpeed>();
-        retVal = translateAirLoopHVACUnitaryHeatPumpAirToAirMultiSpeed(unitary);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AirLoopHVAC_UnitarySystem: {
-        auto unitary = modelObject.cast<AirLoopHVACUnitarySystem>();
-        retVal = translateAirLoopHVACUnitarySystem(unitary);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManagerAssignmentList: {
-        auto mo = modelObject.cast<AvailabilityManagerAssignmentList>();
-        retVal = translateAvailabilityManagerAssignmentList(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_Scheduled: {
-        auto mo = modelObject.cast<AvailabilityManagerScheduled>();
-        retVal = translateAvailabilityManagerScheduled(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOn: {
-        auto mo = modelObject.cast<AvailabilityManagerScheduledOn>();
-        retVal = translateAvailabilityManagerScheduledOn(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOff: {
-        auto mo = modelObject.cast<AvailabilityManagerScheduledOff>();
-        retVal = translateAvailabilityManagerScheduledOff(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_HybridVentilation: {
-        auto mo = modelObject.cast<AvailabilityManagerHybridVentilation>();
-        retVal = translateAvailabilityManagerHybridVentilation(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_OptimumStart: {
-        auto mo = modelObject.cast<AvailabilityManagerOptimumStart>();
-        retVal = translateAvailabilityManagerOptimumStart(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_DifferentialThermostat: {
-        auto mo = modelObject.cast<AvailabilityManagerDifferentialThermostat>();
-        retVal = translateAvailabilityManagerDifferentialThermostat(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_NightVentilation: {
-        auto mo = modelObject.cast<AvailabilityManagerNightVentilation>();
-        retVal = translateAvailabilityManagerNightVentilation(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_NightCycle: {
-        auto mo = modelObject.cast<AvailabilityManagerNightCycle>();
-        retVal = translateAvailabilityManagerNightCycle(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOn: {
-        auto mo = modelObject.cast<AvailabilityManagerHighTemperatureTurnOn>();
-        retVal = translateAvailabilityManagerHighTemperatureTurnOn(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOff: {
-        auto mo = modelObject.cast<AvailabilityManagerHighTemperatureTurnOff>();
-        retVal = translateAvailabilityManagerHighTemperatureTurnOff(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOn: {
-        auto mo = modelObject.cast<AvailabilityManagerLowTemperatureTurnOn>();
-        retVal = translateAvailabilityManagerLowTemperatureTurnOn(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOff: {
-        auto mo = modelObject.cast<AvailabilityManagerLowTemperatureTurnOff>();
-        retVal = translateAvailabilityManagerLowTemperatureTurnOff(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Boiler_HotWater: {
-        auto boiler = modelObject.cast<BoilerHotWater>();
-        retVal = translateBoilerHotWater(boiler);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Boiler_Steam: {
-        auto boiler = modelObject.cast<BoilerSteam>();
-        retVal = translateBoilerSteam(boiler);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Building: {
-        auto building = modelObject.cast<Building>();
-        retVal = translateBuilding(building);
-        break;
-      }
-      case openstudio::IddObjectType::OS_BuildingStory: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_CentralHeatPumpSystem: {
-        auto mo = modelObject.cast<CentralHeatPumpSystem>();
-        retVal = translateCentralHeatPumpSystem(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CentralHeatPumpSystem_Module: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Chiller_Absorption: {
-        auto mo = modelObject.cast<ChillerAbsorption>();
-        retVal = translateChillerAbsorption(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Chiller_Absorption_Indirect: {
-        auto mo = modelObject.cast<ChillerAbsorptionIndirect>();
-        retVal = translateChillerAbsorptionIndirect(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Chiller_Electric_ASHRAE205: {
-        auto mo = modelObject.cast<ChillerElectricASHRAE205>();
-        retVal = translateChillerElectricASHRAE205(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Chiller_Electric_EIR: {
-        auto chiller = modelObject.cast<ChillerElectricEIR>();
-        retVal = translateChillerElectricEIR(chiller);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Chiller_Electric_ReformulatedEIR: {
-        auto chiller = modelObject.cast<ChillerElectricReformulatedEIR>();
-        retVal = translateChillerElectricReformulatedEIR(chiller);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ChillerHeaterPerformance_Electric_EIR: {
-        auto mo = modelObject.cast<ChillerHeaterPerformanceElectricEIR>();
-        retVal = translateChillerHeaterPerformanceElectricEIR(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ClimateZones: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Construction_CfactorUndergroundWall: {
-        auto construction = modelObject.cast<CFactorUndergroundWallConstruction>();
-        retVal = translateCFactorUndergroundWallConstruction(construction);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ConvergenceLimits: {
-        auto limits = modelObject.cast<ConvergenceLimits>();
-        retVal = translateConvergenceLimits(limits);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_CooledBeam: {
-        // This is handled directly in ATU:SingleDuct:ConstantVolume::CooledBeam
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_FourPipeBeam: {
-        // This is handled directly in ATU:SingleDuct:ConstantVolume::FourPipeBeam
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_FourPipeBeam: {
-        // This is handled directly in ATU:SingleDuct:ConstantVolume::FourPipeBeam
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX: {
-        auto coil = modelObject.cast<CoilCoolingDX>();
-        if (this->isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilCoolingDXWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilCoolingDX(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_CurveFit_Performance: {
-        auto performance = modelObject.cast<CoilCoolingDXCurveFitPerformance>();
-        retVal = translateCoilCoolingDXCurveFitPerformance(performance);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_CurveFit_OperatingMode: {
-        auto operatingMode = modelObject.cast<CoilCoolingDXCurveFitOperatingMode>();
-        retVal = translateCoilCoolingDXCurveFitOperatingMode(operatingMode);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_CurveFit_Speed: {
-        auto speed = modelObject.cast<CoilCoolingDXCurveFitSpeed>();
-        retVal = translateCoilCoolingDXCurveFitSpeed(speed);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_SingleSpeed: {
-        auto coil = modelObject.cast<CoilCoolingDXSingleSpeed>();
-        if (isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilCoolingDXSingleSpeedWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilCoolingDXSingleSpeed(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_SingleSpeed_ThermalStorage: {
-        auto coil = modelObject.cast<CoilCoolingDXSingleSpeedThermalStorage>();
-        if (isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilCoolingDXSingleSpeedThermalStorageWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilCoolingDXSingleSpeedThermalStorage(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_MultiSpeed: {
-        auto coil = modelObject.cast<CoilCoolingDXMultiSpeed>();
-        retVal = translateCoilCoolingDXMultiSpeed(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_MultiSpeed_StageData: {
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoSpeed: {
-        auto coil = modelObject.cast<CoilCoolingDXTwoSpeed>();
-        if (isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilCoolingDXTwoSpeedWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilCoolingDXTwoSpeed(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode: {
-        auto coil = modelObject.cast<CoilCoolingDXTwoStageWithHumidityControlMode>();
-        if (isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilCoolingDXTwoStageWithHumidityControlModeWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilCoolingDXTwoStageWithHumidityControlMode(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableRefrigerantFlow: {
-        auto coil = modelObject.cast<CoilCoolingDXVariableRefrigerantFlow>();
-        retVal = translateCoilCoolingDXVariableRefrigerantFlow(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableRefrigerantFlow_FluidTemperatureControl: {
-        model::CoilCoolingDXVariableRefrigerantFlowFluidTemperatureControl coil =
-          modelObject.cast<CoilCoolingDXVariableRefrigerantFlowFluidTemperatureControl>();
-        retVal = translateCoilCoolingDXVariableRefrigerantFlowFluidTemperatureControl(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableSpeed: {
-        auto coil = modelObject.cast<CoilCoolingDXVariableSpeed>();
-        if (isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilCoolingDXVariableSpeedWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilCoolingDXVariableSpeed(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableSpeed_SpeedData: {
-        // DLM: is this a no-op?
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_ConstantFlow: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_VariableFlow: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_Water: {
-        auto coil = modelObject.cast<CoilCoolingWater>();
-        retVal = translateCoilCoolingWater(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_Water_Panel_Radiant: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_EquationFit: {
-        auto coil = modelObject.cast<CoilCoolingWaterToAirHeatPumpEquationFit>();
-        retVal = translateCoilCoolingWaterToAirHeatPumpEquationFit(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit: {
-        auto coil = modelObject.cast<CoilCoolingWaterToAirHeatPumpVariableSpeedEquationFit>();
-        retVal = translateCoilCoolingWaterToAirHeatPumpVariableSpeedEquationFit(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit_SpeedData: {
-        // DLM: is this a no-op?
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Desuperheater: {
-        auto coil = modelObject.cast<CoilHeatingDesuperheater>();
-        retVal = translateCoilHeatingDesuperheater(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_DX_SingleSpeed: {
-        auto coil = modelObject.cast<CoilHeatingDXSingleSpeed>();
-        if (isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilHeatingDXSingleSpeedWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilHeatingDXSingleSpeed(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_DX_MultiSpeed: {
-        auto coil = modelObject.cast<CoilHeatingDXMultiSpeed>();
-        retVal = translateCoilHeatingDXMultiSpeed(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_DX_MultiSpeed_StageData: {
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_DX_VariableSpeed: {
-        auto coil = modelObject.cast<CoilHeatingDXVariableSpeed>();
-        if (isHVACComponentWithinUnitary(coil)) {
-          retVal = translateCoilHeatingDXVariableSpeedWithoutUnitary(coil);
-        } else {
-          retVal = translateCoilHeatingDXVariableSpeed(coil);
-        }
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_DX_VariableSpeed_SpeedData: {
-        //DLM: is this a no-op?
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Electric: {
-        auto coil = modelObject.cast<CoilHeatingElectric>();
-        retVal = translateCoilHeatingElectric(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Electric_MultiStage: {
-        auto coil = modelObject.cast<CoilHeatingElectricMultiStage>();
-        retVal = translateCoilHeatingElectricMultiStage(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Electric_MultiStage_StageData: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Gas: {
-        auto coil = modelObject.cast<CoilHeatingGas>();
-        retVal = translateCoilHeatingGas(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Gas_MultiStage: {
-        auto coil = modelObject.cast<CoilHeatingGasMultiStage>();
-        retVal = translateCoilHeatingGasMultiStage(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Gas_MultiStage_StageData: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_ConstantFlow: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_VariableFlow: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_DX_VariableRefrigerantFlow: {
-        auto coil = modelObject.cast<CoilHeatingDXVariableRefrigerantFlow>();
-        retVal = translateCoilHeatingDXVariableRefrigerantFlow(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_DX_VariableRefrigerantFlow_FluidTemperatureControl: {
-        model::CoilHeatingDXVariableRefrigerantFlowFluidTemperatureControl coil =
-          modelObject.cast<CoilHeatingDXVariableRefrigerantFlowFluidTemperatureControl>();
-        retVal = translateCoilHeatingDXVariableRefrigerantFlowFluidTemperatureControl(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Water: {
-        auto coil = modelObject.cast<CoilHeatingWater>();
-        retVal = translateCoilHeatingWater(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_EquationFit: {
-        auto coil = modelObject.cast<CoilHeatingWaterToAirHeatPumpEquationFit>();
-        retVal = translateCoilHeatingWaterToAirHeatPumpEquationFit(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit: {
-        auto coil = modelObject.cast<CoilHeatingWaterToAirHeatPumpVariableSpeedEquationFit>();
-        retVal = translateCoilHeatingWaterToAirHeatPumpVariableSpeedEquationFit(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit_SpeedData: {
-        // DLM: is this a no-op?
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard: {
-        // DLM: is this a no-op?
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard_Radiant: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_CoilPerformance_DX_Cooling: {
-        auto mo = modelObject.cast<CoilPerformanceDXCooling>();
-        retVal = translateCoilPerformanceDXCooling(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoilSystem_Cooling_Water_HeatExchangerAssisted: {
-        auto mo = modelObject.cast<CoilSystemCoolingWaterHeatExchangerAssisted>();
-        retVal = translateCoilSystemCoolingWaterHeatExchangerAssisted(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoilSystem_Cooling_DX_HeatExchangerAssisted: {
-        auto mo = modelObject.cast<CoilSystemCoolingDXHeatExchangerAssisted>();
-        retVal = translateCoilSystemCoolingDXHeatExchangerAssisted(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoilSystem_IntegratedHeatPump_AirSource: {
-        auto mo = modelObject.cast<CoilSystemIntegratedHeatPumpAirSource>();
-        retVal = translateCoilSystemIntegratedHeatPumpAirSource(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_UserDefined: {
-        auto coil = modelObject.cast<CoilUserDefined>();
-        retVal = translateCoilUserDefined(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_WaterHeating_Desuperheater: {
-        auto coil = modelObject.cast<CoilWaterHeatingDesuperheater>();
-        retVal = translateCoilWaterHeatingDesuperheater(coil);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_WaterHeating_AirToWaterHeatPump: {
-        auto mo = modelObject.cast<CoilWaterHeatingAirToWaterHeatPump>();
-        retVal = translateCoilWaterHeatingAirToWaterHeatPump(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_WaterHeating_AirToWaterHeatPump_VariableSpeed: {
-        auto mo = modelObject.cast<CoilWaterHeatingAirToWaterHeatPumpVariableSpeed>();
-        retVal = translateCoilWaterHeatingAirToWaterHeatPumpVariableSpeed(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Coil_WaterHeating_AirToWaterHeatPump_Wrapped: {
-        auto mo = modelObject.cast<CoilWaterHeatingAirToWaterHeatPumpWrapped>();
-        retVal = translateCoilWaterHeatingAirToWaterHeatPumpWrapped(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ComponentData: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_ComponentCost_Adjustments: {
-        LOG(Warn, "OS:ComponentCost:Adjustments '" << modelObject.name().get() << "' not translated to EnergyPlus.");
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Connection: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Connector_Mixer: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Connector_Splitter: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Construction: {
-        auto construction = modelObject.cast<Construction>();
-        retVal = translateConstruction(construction);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Construction_AirBoundary: {
-        auto constructionAirBoundary = modelObject.cast<ConstructionAirBoundary>();
-        retVal = translateConstructionAirBoundary(constructionAirBoundary);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Construction_InternalSource: {
-        auto constructionIntSource = modelObject.cast<ConstructionWithInternalSource>();
-        retVal = translateConstructionWithInternalSource(constructionIntSource);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Construction_FfactorGroundFloor: {
-        auto mo = modelObject.cast<FFactorGroundFloorConstruction>();
-        retVal = translateFFactorGroundFloorConstruction(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Construction_WindowDataFile: {
-        LOG(Warn, "OS_WindowDataFile is not currently translated");
-        break;
-      }
-      case openstudio::IddObjectType::OS_Controller_MechanicalVentilation: {
-        auto controller = modelObject.cast<ControllerMechanicalVentilation>();
-        retVal = translateControllerMechanicalVentilation(controller);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Controller_OutdoorAir: {
-        auto controller = modelObject.cast<ControllerOutdoorAir>();
-        retVal = translateControllerOutdoorAir(controller);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Controller_WaterCoil: {
-        auto controller = modelObject.cast<ControllerWaterCoil>();
-        retVal = translateControllerWaterCoil(controller);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoolingTowerPerformance_CoolTools: {
-        auto mo = modelObject.cast<CoolingTowerPerformanceCoolTools>();
-        retVal = translateCoolingTowerPerformanceCoolTools(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoolingTowerPerformance_YorkCalc: {
-        auto mo = modelObject.cast<CoolingTowerPerformanceYorkCalc>();
-        retVal = translateCoolingTowerPerformanceYorkCalc(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoolingTower_SingleSpeed: {
-        auto tower = modelObject.cast<CoolingTowerSingleSpeed>();
-        retVal = translateCoolingTowerSingleSpeed(tower);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoolingTower_TwoSpeed: {
-        auto tower = modelObject.cast<CoolingTowerTwoSpeed>();
-        retVal = translateCoolingTowerTwoSpeed(tower);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CoolingTower_VariableSpeed: {
-        auto tower = modelObject.cast<CoolingTowerVariableSpeed>();
-        retVal = translateCoolingTowerVariableSpeed(tower);
-        break;
-      }
-      case openstudio::IddObjectType::OS_CurrencyType: {
-        auto mo = modelObject.cast<CurrencyType>();
-        retVal = translateCurrencyType(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Bicubic: {
-        auto curve = modelObject.cast<CurveBicubic>();
-        retVal = translateCurveBicubic(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Biquadratic: {
-        auto curve = modelObject.cast<CurveBiquadratic>();
-        retVal = translateCurveBiquadratic(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Cubic: {
-        auto curve = modelObject.cast<CurveCubic>();
-        retVal = translateCurveCubic(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_DoubleExponentialDecay: {
-        auto curve = modelObject.cast<CurveDoubleExponentialDecay>();
-        retVal = translateCurveDoubleExponentialDecay(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Exponent: {
-        auto curve = modelObject.cast<CurveExponent>();
-        retVal = translateCurveExponent(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_ExponentialDecay: {
-        auto curve = modelObject.cast<CurveExponentialDecay>();
-        retVal = translateCurveExponentialDecay(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_ExponentialSkewNormal: {
-        auto curve = modelObject.cast<CurveExponentialSkewNormal>();
-        retVal = translateCurveExponentialSkewNormal(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_FanPressureRise: {
-        auto curve = modelObject.cast<CurveFanPressureRise>();
-        retVal = translateCurveFanPressureRise(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Functional_PressureDrop: {
-        auto curve = modelObject.cast<CurveFunctionalPressureDrop>();
-        retVal = translateCurveFunctionalPressureDrop(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Linear: {
-        auto curve = modelObject.cast<CurveLinear>();
-        retVal = translateCurveLinear(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_QuadLinear: {
-        auto curve = modelObject.cast<CurveQuadLinear>();
-        retVal = translateCurveQuadLinear(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_QuintLinear: {
-        auto curve = modelObject.cast<CurveQuintLinear>();
-        retVal = translateCurveQuintLinear(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Quadratic: {
-        auto curve = modelObject.cast<CurveQuadratic>();
-        retVal = translateCurveQuadratic(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_QuadraticLinear: {
-        auto curve = modelObject.cast<CurveQuadraticLinear>();
-        retVal = translateCurveQuadraticLinear(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Quartic: {
-        auto curve = modelObject.cast<CurveQuartic>();
-        retVal = translateCurveQuartic(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_RectangularHyperbola1: {
-        auto curve = modelObject.cast<CurveRectangularHyperbola1>();
-        retVal = translateCurveRectangularHyperbola1(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_RectangularHyperbola2: {
-        auto curve = modelObject.cast<CurveRectangularHyperbola2>();
-        retVal = translateCurveRectangularHyperbola2(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Sigmoid: {
-        auto curve = modelObject.cast<CurveSigmoid>();
-        retVal = translateCurveSigmoid(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Curve_Triquadratic: {
-        auto curve = modelObject.cast<CurveTriquadratic>();
-        retVal = translateCurveTriquadratic(curve);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SizingPeriod_DesignDay: {
-        auto designDay = modelObject.cast<DesignDay>();
-        retVal = translateDesignDay(designDay);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SizingPeriod_WeatherFileConditionType: {
-        LOG(Warn, "OS_SizingPeriod_WeatherFileConditionType is not currently translated");
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_SizingPeriod_WeatherFileDays: {
-        LOG(Warn, "OS_SizingPeriod_WeatherFileDays is not currently translated");
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Sizing_Plant: {
-        auto sizingPlant = modelObject.cast<SizingPlant>();
-        retVal = translateSizingPlant(sizingPlant);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Sizing_System: {
-        auto mo = modelObject.cast<SizingSystem>();
-        retVal = translateSizingSystem(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Sizing_Zone: {
-        auto mo = modelObject.cast<SizingZone>();
-        retVal = translateSizingZone(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Daylighting_Control: {
-        auto daylightingControl = modelObject.cast<DaylightingControl>();
-        retVal = translateDaylightingControl(daylightingControl);
-        break;
-      }
-
-      case openstudio::IddObjectType::OS_DaylightingDevice_Shelf: {
-        auto daylightingDeviceShelf = modelObject.cast<DaylightingDeviceShelf>();
-        retVal = translateDaylightingDeviceShelf(daylightingDeviceShelf);
-        break;
-      }
-      case openstudio::IddObjectType::OS_DaylightingDevice_Tubular: {
-        auto daylightingDeviceTubular = modelObject.cast<DaylightingDeviceTubular>();
-        retVal = translateDaylightingDeviceTubular(daylightingDeviceTubular);
-        break;
-      }
-      case openstudio::IddObjectType::OS_DaylightingDevice_LightWell: {
-        auto daylightingDeviceLightWell = modelObject.cast<DaylightingDeviceLightWell>();
-        retVal = translateDaylightingDeviceLightWell(daylightingDeviceLightWell);
-        break;
-      }
-      case openstudio::IddObjectType::OS_DefaultConstructionSet: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_DefaultScheduleSet: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_DefaultSurfaceConstructions: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_DefaultSubSurfaceConstructions: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_DesignSpecification_OutdoorAir: {
-        auto designSpecificationOutdoorAir = modelObject.cast<DesignSpecificationOutdoorAir>();
-        retVal = translateDesignSpecificationOutdoorAir(designSpecificationOutdoorAir);
-        break;
-      }
-      case openstudio::IddObjectType::OS_DesignSpecification_ZoneAirDistribution: {
-        // DLM: appears to be translated in SizingZone
-        break;
-      }
-      case openstudio::IddObjectType::OS_DistrictCooling: {
-        auto districtCooling = modelObject.cast<DistrictCooling>();
-        retVal = translateDistrictCooling(districtCooling);
-        break;
-      }
-      case openstudio::IddObjectType::OS_DistrictHeating_Water: {
-        auto districtHeating = modelObject.cast<DistrictHeatingWater>();
-        retVal = translateDistrictHeatingWater(districtHeating);
-        break;
-      }
-      case openstudio::IddObjectType::OS_DistrictHeating_Steam: {
-        auto districtHeatingSteam = modelObject.cast<DistrictHeatingSteam>();
-        retVal = translateDistrictHeatingSteam(districtHeatingSteam);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Duct: {
-        auto duct = modelObject.cast<Duct>();
-        retVal = translateDuct(duct);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricEquipment: {
-        auto equipment = modelObject.cast<ElectricEquipment>();
-        retVal = translateElectricEquipment(equipment);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricEquipment_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricEquipment_ITE_AirCooled: {
-        auto equipmentITE = modelObject.cast<ElectricEquipmentITEAirCooled>();
-        retVal = translateElectricEquipmentITEAirCooled(equipmentITE);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricEquipment_ITE_AirCooled_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Distribution: {
-        auto temp = modelObject.cast<ElectricLoadCenterDistribution>();
-        retVal = translateElectricLoadCenterDistribution(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Inverter_LookUpTable: {
-        auto temp = modelObject.cast<ElectricLoadCenterInverterLookUpTable>();
-        retVal = translateElectricLoadCenterInverterLookUpTable(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Inverter_Simple: {
-        auto temp = modelObject.cast<ElectricLoadCenterInverterSimple>();
-        retVal = translateElectricLoadCenterInverterSimple(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Inverter_PVWatts: {
-        auto temp = modelObject.cast<ElectricLoadCenterInverterPVWatts>();
-        retVal = translateElectricLoadCenterInverterPVWatts(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Storage_Simple: {
-        auto temp = modelObject.cast<ElectricLoadCenterStorageSimple>();
-        retVal = translateElectricLoadCenterStorageSimple(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Storage_Converter: {
-        auto temp = modelObject.cast<ElectricLoadCenterStorageConverter>();
-        retVal = translateElectricLoadCenterStorageConverter(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Storage_LiIonNMCBattery: {
-        auto temp = modelObject.cast<ElectricLoadCenterStorageLiIonNMCBattery>();
-        retVal = translateElectricLoadCenterStorageLiIonNMCBattery(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ElectricLoadCenter_Transformer: {
-        auto temp = modelObject.cast<ElectricLoadCenterTransformer>();
-        retVal = translateElectricLoadCenterTransformer(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_Actuator: {
-        auto actuator = modelObject.cast<EnergyManagementSystemActuator>();
-        retVal = translateEnergyManagementSystemActuator(actuator);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_ConstructionIndexVariable: {
-        auto civ = modelObject.cast<EnergyManagementSystemConstructionIndexVariable>();
-        retVal = translateEnergyManagementSystemConstructionIndexVariable(civ);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_CurveOrTableIndexVariable: {
-        auto cotiv = modelObject.cast<EnergyManagementSystemCurveOrTableIndexVariable>();
-        retVal = translateEnergyManagementSystemCurveOrTableIndexVariable(cotiv);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_GlobalVariable: {
-        auto globalVariable = modelObject.cast<EnergyManagementSystemGlobalVariable>();
-        retVal = translateEnergyManagementSystemGlobalVariable(globalVariable);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_InternalVariable: {
-        auto internalVariable = modelObject.cast<EnergyManagementSystemInternalVariable>();
-        retVal = translateEnergyManagementSystemInternalVariable(internalVariable);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_MeteredOutputVariable: {
-        auto mov = modelObject.cast<EnergyManagementSystemMeteredOutputVariable>();
-        retVal = translateEnergyManagementSystemMeteredOutputVariable(mov);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_OutputVariable: {
-        auto outputVariable = modelObject.cast<EnergyManagementSystemOutputVariable>();
-        retVal = translateEnergyManagementSystemOutputVariable(outputVariable);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_Program: {
-        auto program = modelObject.cast<EnergyManagementSystemProgram>();
-        retVal = translateEnergyManagementSystemProgram(program);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_ProgramCallingManager: {
-        auto programCallingManager = modelObject.cast<EnergyManagementSystemProgramCallingManager>();
-        retVal = translateEnergyManagementSystemProgramCallingManager(programCallingManager);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_Sensor: {
-        auto sensor = modelObject.cast<EnergyManagementSystemSensor>();
-        retVal = translateEnergyManagementSystemSensor(sensor);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_Subroutine: {
-        auto subroutine = modelObject.cast<EnergyManagementSystemSubroutine>();
-        retVal = translateEnergyManagementSystemSubroutine(subroutine);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnergyManagementSystem_TrendVariable: {
-        auto trendVariable = modelObject.cast<EnergyManagementSystemTrendVariable>();
-        retVal = translateEnergyManagementSystemTrendVariable(trendVariable);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EvaporativeCooler_Direct_ResearchSpecial: {
-        auto evap = modelObject.cast<EvaporativeCoolerDirectResearchSpecial>();
-        retVal = translateEvaporativeCoolerDirectResearchSpecial(evap);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EvaporativeCooler_Indirect_ResearchSpecial: {
-        auto evap = modelObject.cast<EvaporativeCoolerIndirectResearchSpecial>();
-        retVal = translateEvaporativeCoolerIndirectResearchSpecial(evap);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EvaporativeFluidCooler_SingleSpeed: {
-        auto evap = modelObject.cast<EvaporativeFluidCoolerSingleSpeed>();
-        retVal = translateEvaporativeFluidCoolerSingleSpeed(evap);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EvaporativeFluidCooler_TwoSpeed: {
-        auto mo = modelObject.cast<EvaporativeFluidCoolerTwoSpeed>();
-        retVal = translateEvaporativeFluidCoolerTwoSpeed(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Exterior_Lights: {
-        auto lights = modelObject.cast<ExteriorLights>();
-        retVal = translateExteriorLights(lights);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Exterior_Lights_Definition: {
-        // no-op
-        break;
-      }
-
-      case openstudio::IddObjectType::OS_Exterior_FuelEquipment: {
-        auto mo = modelObject.cast<ExteriorFuelEquipment>();
-        retVal = translateExteriorFuelEquipment(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Exterior_FuelEquipment_Definition: {
-        // no-op
-        break;
-      }
-
-      case openstudio::IddObjectType::OS_Exterior_WaterEquipment: {
-        auto mo = modelObject.cast<ExteriorWaterEquipment>();
-        retVal = translateExteriorWaterEquipment(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Exterior_WaterEquipment_Definition: {
-        // no-op
-        break;
-      }
-
-      case openstudio::IddObjectType::OS_ExternalInterface: {
-        auto ei = modelObject.cast<ExternalInterface>();
-        retVal = translateExternalInterface(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_Actuator: {
-        auto ei = modelObject.cast<ExternalInterfaceActuator>();
-        retVal = translateExternalInterfaceActuator(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitExport_From_Variable: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitExportFromVariable>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitExportFromVariable(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitExport_To_Actuator: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitExportToActuator>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitExportToActuator(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitExport_To_Schedule: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitExportToSchedule>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitExportToSchedule(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitExport_To_Variable: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitExportToVariable>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitExportToVariable(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitImport: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitImport>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitImport(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitImport_From_Variable: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitImportFromVariable>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitImportFromVariable(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitImport_To_Actuator: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitImportToActuator>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitImportToActuator(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitImport_To_Schedule: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitImportToSchedule>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitImportToSchedule(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_FunctionalMockupUnitImport_To_Variable: {
-        auto ei = modelObject.cast<ExternalInterfaceFunctionalMockupUnitImportToVariable>();
-        retVal = translateExternalInterfaceFunctionalMockupUnitImportToVariable(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_Schedule: {
-        auto ei = modelObject.cast<ExternalInterfaceSchedule>();
-        retVal = translateExternalInterfaceSchedule(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ExternalInterface_Variable: {
-        auto ei = modelObject.cast<ExternalInterfaceVariable>();
-        retVal = translateExternalInterfaceVariable(ei);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Facility: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_Fan_ComponentModel: {
-        auto fan = modelObject.cast<FanComponentModel>();
-        retVal = translateFanComponentModel(fan);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Fan_ConstantVolume: {
-        auto fan = modelObject.cast<FanConstantVolume>();
-        retVal = translateFanConstantVolume(fan);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Fan_OnOff: {
-        auto fan = modelObject.cast<FanOnOff>();
-        retVal = translateFanOnOff(fan);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Fan_SystemModel: {
-        auto fan = modelObject.cast<FanSystemModel>();
-        retVal = translateFanSystemModel(fan);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Fan_VariableVolume: {
-        auto fan = modelObject.cast<FanVariableVolume>();
-        retVal = translateFanVariableVolume(fan);
-        break;
-      }
-
-      case openstudio::IddObjectType::OS_Fan_ZoneExhaust: {
-        auto fan = modelObject.cast<FanZoneExhaust>();
-        retVal = translateFanZoneExhaust(fan);
-        break;
-      }
-      case openstudio::IddObjectType::OS_FluidCooler_SingleSpeed: {
-        auto fluidCoolerSingleSpeed = modelObject.cast<FluidCoolerSingleSpeed>();
-        retVal = translateFluidCoolerSingleSpeed(fluidCoolerSingleSpeed);
-        break;
-      }
-      case openstudio::IddObjectType::OS_FluidCooler_TwoSpeed: {
-        auto fluidCoolerTwoSpeed = modelObject.cast<FluidCoolerTwoSpeed>();
-        retVal = translateFluidCoolerTwoSpeed(fluidCoolerTwoSpeed);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Foundation_Kiva: {
-        auto kiva = modelObject.cast<FoundationKiva>();
-        retVal = translateFoundationKiva(kiva);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Foundation_Kiva_Settings: {
-        auto kivaSettings = modelObject.cast<FoundationKivaSettings>();
-        retVal = translateFoundationKivaSettings(kivaSettings);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_MicroTurbine: {
-        // Will also translate the Generator:MicroTurbine:HeatRecovery if there is one attached to the Generator:MicroTurbine
-        auto mchp = modelObject.cast<GeneratorMicroTurbine>();
-        retVal = translateGeneratorMicroTurbine(mchp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_MicroTurbine_HeatRecovery: {
-        // no-op, just Log a Trace message
-        LOG(Trace, "OS_Generator_MicroTurbine_HeatRecovery is not translated by itself but in the parent GeneratorMicroTurbine");
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell: {
-        // Will also translate all children of Generator:FuelCell (Generator:FuelCell:AirSupply, etc)
-        auto temp = modelObject.cast<GeneratorFuelCell>();
-        retVal = translateGeneratorFuelCell(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_AirSupply: {
-        auto temp = modelObject.cast<GeneratorFuelCellAirSupply>();
-        retVal = translateGeneratorFuelCellAirSupply(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_AuxiliaryHeater: {
-        auto temp = modelObject.cast<GeneratorFuelCellAuxiliaryHeater>();
-        retVal = translateGeneratorFuelCellAuxiliaryHeater(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_ElectricalStorage: {
-        auto temp = modelObject.cast<GeneratorFuelCellElectricalStorage>();
-        retVal = translateGeneratorFuelCellElectricalStorage(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger: {
-        auto temp = modelObject.cast<GeneratorFuelCellExhaustGasToWaterHeatExchanger>();
-        retVal = translateGeneratorFuelCellExhaustGasToWaterHeatExchanger(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_Inverter: {
-        auto temp = modelObject.cast<GeneratorFuelCellInverter>();
-        retVal = translateGeneratorFuelCellInverter(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_PowerModule: {
-        auto temp = modelObject.cast<GeneratorFuelCellPowerModule>();
-        retVal = translateGeneratorFuelCellPowerModule(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_StackCooler: {
-        auto temp = modelObject.cast<GeneratorFuelCellStackCooler>();
-        retVal = translateGeneratorFuelCellStackCooler(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelCell_WaterSupply: {
-        auto temp = modelObject.cast<GeneratorFuelCellWaterSupply>();
-        retVal = translateGeneratorFuelCellWaterSupply(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_FuelSupply: {
-        auto temp = modelObject.cast<GeneratorFuelSupply>();
-        retVal = translateGeneratorFuelSupply(temp);
-        break;
-      }
-      // TODO: JM 2018-10-12 Placeholder for Generator:MicroCHP if/when it is implemented
-      // to remember that translateGeneratorMicroCHP should be calling translation of child GeneratorFuelSupply as needed
-      /*
-   *case openstudio::IddObjectType::OS_Generator_MicroCHP:
-   *{
-   *  auto temp = modelObject.cast<GeneratorMicroCHP>();
-   *  retVal = translateGeneratorMicroCHP(temp);
-   *  break;
-   *}
-   */
-      case openstudio::IddObjectType::OS_Generator_Photovoltaic: {
-        auto temp = modelObject.cast<GeneratorPhotovoltaic>();
-        retVal = translateGeneratorPhotovoltaic(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_PVWatts: {
-        auto temp = modelObject.cast<GeneratorPVWatts>();
-        retVal = translateGeneratorPVWatts(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Generator_WindTurbine: {
-        auto temp = modelObject.cast<GeneratorWindTurbine>();
-        retVal = translateGeneratorWindTurbine(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Glare_Sensor: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_GroundHeatExchanger_HorizontalTrench: {
-        auto mo = modelObject.cast<GroundHeatExchangerHorizontalTrench>();
-        retVal = translateGroundHeatExchangerHorizontalTrench(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_GroundHeatExchanger_Vertical: {
-        auto groundHeatExchangerVertical = modelObject.cast<GroundHeatExchangerVertical>();
-        retVal = translateGroundHeatExchangerVertical(groundHeatExchangerVertical);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeaderedPumps_ConstantSpeed: {
-        auto mo = modelObject.cast<HeaderedPumpsConstantSpeed>();
-        retVal = translateHeaderedPumpsConstantSpeed(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeaderedPumps_VariableSpeed: {
-        auto mo = modelObject.cast<HeaderedPumpsVariableSpeed>();
-        retVal = translateHeaderedPumpsVariableSpeed(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatBalanceAlgorithm: {
-        auto mo = modelObject.cast<HeatBalanceAlgorithm>();
-        retVal = translateHeatBalanceAlgorithm(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatExchanger_AirToAir_SensibleAndLatent: {
-        auto mo = modelObject.cast<HeatExchangerAirToAirSensibleAndLatent>();
-        retVal = translateHeatExchangerAirToAirSensibleAndLatent(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatExchanger_Desiccant_BalancedFlow: {
-        auto mo = modelObject.cast<HeatExchangerDesiccantBalancedFlow>();
-        retVal = translateHeatExchangerDesiccantBalancedFlow(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatExchanger_Desiccant_BalancedFlow_PerformanceDataType1: {
-        auto mo = modelObject.cast<HeatExchangerDesiccantBalancedFlowPerformanceDataType1>();
-        retVal = translateHeatExchangerDesiccantBalancedFlowPerformanceDataType1(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatExchanger_FluidToFluid: {
-        auto mo = modelObject.cast<HeatExchangerFluidToFluid>();
-        retVal = translateHeatExchangerFluidToFluid(mo);
-        break;
-      }
-
-      case openstudio::IddObjectType::OS_HeatPump_AirToWater_FuelFired_Heating: {
-        auto mo = modelObject.cast<HeatPumpAirToWaterFuelFiredHeating>();
-        retVal = translateHeatPumpAirToWaterFuelFiredHeating(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatPump_AirToWater_FuelFired_Cooling: {
-        auto mo = modelObject.cast<HeatPumpAirToWaterFuelFiredCooling>();
-        retVal = translateHeatPumpAirToWaterFuelFiredCooling(mo);
-        break;
-      }
-
-      case openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling: {
-        auto mo = modelObject.cast<HeatPumpWaterToWaterEquationFitCooling>();
-        retVal = translateHeatPumpWaterToWaterEquationFitCooling(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating: {
-        auto mo = modelObject.cast<HeatPumpWaterToWaterEquationFitHeating>();
-        retVal = translateHeatPumpWaterToWaterEquationFitHeating(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatPump_PlantLoop_EIR_Cooling: {
-        auto mo = modelObject.cast<HeatPumpPlantLoopEIRCooling>();
-        retVal = translateHeatPumpPlantLoopEIRCooling(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HeatPump_PlantLoop_EIR_Heating: {
-        auto mo = modelObject.cast<HeatPumpPlantLoopEIRHeating>();
-        retVal = translateHeatPumpPlantLoopEIRHeating(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HotWaterEquipment: {
-        auto hotWaterEquipment = modelObject.cast<HotWaterEquipment>();
-        retVal = translateHotWaterEquipment(hotWaterEquipment);
-        break;
-      }
-      case openstudio::IddObjectType::OS_HotWaterEquipment_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Humidifier_Steam_Electric: {
-        auto humidifierSteamElectric = modelObject.cast<HumidifierSteamElectric>();
-        retVal = translateHumidifierSteamElectric(humidifierSteamElectric);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Humidifier_Steam_Gas: {
-        auto humidifierSteamGas = modelObject.cast<HumidifierSteamGas>();
-        retVal = translateHumidifierSteamGas(humidifierSteamGas);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_Gas: {
-        auto gas = modelObject.cast<Gas>();
-        retVal = translateGas(gas);
-        break;
-      }
-      case openstudio::IddObjectType::OS_GasEquipment: {
-        auto equipment = modelObject.cast<GasEquipment>();
-        retVal = translateGasEquipment(equipment);
-        break;
-      }
-      case openstudio::IddObjectType::OS_GasEquipment_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_IlluminanceMap: {
-        auto illuminanceMap = modelObject.cast<IlluminanceMap>();
-        retVal = translateIlluminanceMap(illuminanceMap);
-        break;
-      }
-      case openstudio::IddObjectType::OS_InteriorPartitionSurface: {
-        auto interiorPartitionSurface = modelObject.cast<InteriorPartitionSurface>();
-        retVal = translateInteriorPartitionSurface(interiorPartitionSurface);
-        break;
-      }
-      case openstudio::IddObjectType::OS_InteriorPartitionSurfaceGroup: {
-        auto interiorPartitionSurfaceGroup = modelObject.cast<InteriorPartitionSurfaceGroup>();
-        retVal = translateInteriorPartitionSurfaceGroup(interiorPartitionSurfaceGroup);
-        break;
-      }
-      case openstudio::IddObjectType::OS_InternalMass: {
-        auto internalMass = modelObject.cast<InternalMass>();
-        retVal = translateInternalMass(internalMass);
-        break;
-      }
-      case openstudio::IddObjectType::OS_InternalMass_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterHeater_Mixed: {
-        auto waterHeaterMixed = modelObject.cast<WaterHeaterMixed>();
-        retVal = translateWaterHeaterMixed(waterHeaterMixed);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterHeater_HeatPump: {
-        auto mo = modelObject.cast<WaterHeaterHeatPump>();
-        retVal = translateWaterHeaterHeatPump(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser: {
-        auto mo = modelObject.cast<WaterHeaterHeatPumpWrappedCondenser>();
-        retVal = translateWaterHeaterHeatPumpWrappedCondenser(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterHeater_Sizing: {
-        auto waterHeaterSizing = modelObject.cast<WaterHeaterSizing>();
-        retVal = translateWaterHeaterSizing(waterHeaterSizing);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterHeater_Stratified: {
-        auto waterHeaterStratified = modelObject.cast<WaterHeaterStratified>();
-        retVal = translateWaterHeaterStratified(waterHeaterStratified);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterUse_Connections: {
-        auto waterUseConnections = modelObject.cast<WaterUseConnections>();
-        retVal = translateWaterUseConnections(waterUseConnections);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterUse_Equipment: {
-        auto waterUseEquipment = modelObject.cast<WaterUseEquipment>();
-        retVal = translateWaterUseEquipment(waterUseEquipment);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WaterUse_Equipment_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_GasMixture: {
-        auto gasMixture = modelObject.cast<GasMixture>();
-        retVal = translateGasMixture(gasMixture);
-        break;
-      }
-      case openstudio::IddObjectType::OS_LoadProfile_Plant: {
-        auto mo = modelObject.cast<LoadProfilePlant>();
-        retVal = translateLoadProfilePlant(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_LifeCycleCost: {
-        auto lifeCycleCost = modelObject.cast<LifeCycleCost>();
-        retVal = translateLifeCycleCost(lifeCycleCost);
-        break;
-      }
-      case openstudio::IddObjectType::OS_LifeCycleCost_Parameters: {
-        auto lifeCycleCostParameters = modelObject.cast<LifeCycleCostParameters>();
-        retVal = translateLifeCycleCostParameters(lifeCycleCostParameters);
-        break;
-      }
-      case openstudio::IddObjectType::OS_LifeCycleCost_UsePriceEscalation: {
-        // DLM: these objects can be created from LifeCycleCostParameters
-        LOG(Warn, "OS:LifeCycleCost:UsePriceEscalation '" << modelObject.name().get() << "' not translated to EnergyPlus.");
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_LightingDesignDay: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_LightingSimulationControl: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_LightingSimulationZone: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Lights: {
-        auto lights = modelObject.cast<Lights>();
-        retVal = translateLights(lights);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Lights_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Luminaire: {
-        auto luminaire = modelObject.cast<Luminaire>();
-        retVal = translateLuminaire(luminaire);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Luminaire_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Material: {
-        auto material = modelObject.cast<StandardOpaqueMaterial>();
-        retVal = translateStandardOpaqueMaterial(material);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Material_AirGap: {
-        auto material = modelObject.cast<AirGap>();
-        retVal = translateAirGap(material);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Material_InfraredTransparent: {
-        auto material = modelObject.cast<InfraredTransparentMaterial>();
-        retVal = translateInfraredTransparentMaterial(material);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Material_NoMass: {
-        auto material = modelObject.cast<MasslessOpaqueMaterial>();
-        retVal = translateMasslessOpaqueMaterial(material);
-        break;
-      }
-      case openstudio::IddObjectType::OS_MaterialProperty_GlazingSpectralData: {
-        auto spectralData = modelObject.cast<MaterialPropertyGlazingSpectralData>();
-        retVal = translateMaterialPropertyGlazingSpectralData(spectralData);
-        break;
-      }
-      case openstudio::IddObjectType::OS_MaterialProperty_MoisturePenetrationDepth_Settings: {
-        auto empd = modelObject.cast<MaterialPropertyMoisturePenetrationDepthSettings>();
-        retVal = translateMaterialPropertyMoisturePenetrationDepthSettings(empd);
-        break;
-      }
-      case openstudio::IddObjectType::OS_MaterialProperty_PhaseChange: {
-        auto phaseChange = modelObject.cast<MaterialPropertyPhaseChange>();
-        retVal = translateMaterialPropertyPhaseChange(phaseChange);
-        break;
-      }
-      case openstudio::IddObjectType::OS_MaterialProperty_PhaseChangeHysteresis: {
-        auto phaseChangeHysteresis = modelObject.cast<MaterialPropertyPhaseChangeHysteresis>();
-        retVal = translateMaterialPropertyPhaseChangeHysteresis(phaseChangeHysteresis);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Material_RoofVegetation: {
-        auto material = modelObject.cast<RoofVegetation>();
-        retVal = translateRoofVegetation(material);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Meter_Custom: {
-        auto meterCustom = modelObject.cast<MeterCustom>();
-        retVal = translateMeterCustom(meterCustom);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Meter_CustomDecrement: {
-        auto meterCustomDecrement = modelObject.cast<MeterCustomDecrement>();
-        retVal = translateMeterCustomDecrement(meterCustomDecrement);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ModelObjectList: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Node: {
-        auto node = modelObject.cast<Node>();
-        retVal = translateNode(node);
-        break;
-      }
-      case openstudio::IddObjectType::OS_OtherEquipment: {
-        auto otherEquipment = modelObject.cast<OtherEquipment>();
-        retVal = translateOtherEquipment(otherEquipment);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PhotovoltaicPerformance_EquivalentOneDiode: {
-        auto temp = modelObject.cast<PhotovoltaicPerformanceEquivalentOneDiode>();
-        retVal = translatePhotovoltaicPerformanceEquivalentOneDiode(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PhotovoltaicPerformance_Sandia: {
-        auto temp = modelObject.cast<PhotovoltaicPerformanceSandia>();
-        retVal = translatePhotovoltaicPerformanceSandia(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PhotovoltaicPerformance_Simple: {
-        auto temp = modelObject.cast<PhotovoltaicPerformanceSimple>();
-        retVal = translatePhotovoltaicPerformanceSimple(temp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_OtherEquipment_Definition: {
-        //no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantLoop: {
-        auto plantLoop = modelObject.cast<PlantLoop>();
-        retVal = translatePlantLoop(plantLoop);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantComponent_TemperatureSource: {
-        auto mo = modelObject.cast<PlantComponentTemperatureSource>();
-        retVal = translatePlantComponentTemperatureSource(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantComponent_UserDefined: {
-        auto mo = modelObject.cast<PlantComponentUserDefined>();
-        retVal = translatePlantComponentUserDefined(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_CoolingLoad: {
-        auto mo = modelObject.cast<PlantEquipmentOperationCoolingLoad>();
-        retVal = translatePlantEquipmentOperationCoolingLoad(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_HeatingLoad: {
-        auto mo = modelObject.cast<PlantEquipmentOperationHeatingLoad>();
-        retVal = translatePlantEquipmentOperationHeatingLoad(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_OutdoorDryBulb: {
-        auto mo = modelObject.cast<PlantEquipmentOperationOutdoorDryBulb>();
-        retVal = translatePlantEquipmentOperationOutdoorDryBulb(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_OutdoorWetBulb: {
-        auto mo = modelObject.cast<PlantEquipmentOperationOutdoorWetBulb>();
-        retVal = translatePlantEquipmentOperationOutdoorWetBulb(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_OutdoorDewpoint: {
-        auto mo = modelObject.cast<PlantEquipmentOperationOutdoorDewpoint>();
-        retVal = translatePlantEquipmentOperationOutdoorDewpoint(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_OutdoorDryBulbDifference: {
-        auto mo = modelObject.cast<PlantEquipmentOperationOutdoorDryBulbDifference>();
-        retVal = translatePlantEquipmentOperationOutdoorDryBulbDifference(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_OutdoorWetBulbDifference: {
-        auto mo = modelObject.cast<PlantEquipmentOperationOutdoorWetBulbDifference>();
-        retVal = translatePlantEquipmentOperationOutdoorWetBulbDifference(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_OutdoorDewpointDifference: {
-        auto mo = modelObject.cast<PlantEquipmentOperationOutdoorDewpointDifference>();
-        retVal = translatePlantEquipmentOperationOutdoorDewpointDifference(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PlantEquipmentOperation_OutdoorRelativeHumidity: {
-        auto mo = modelObject.cast<PlantEquipmentOperationOutdoorRelativeHumidity>();
-        retVal = translatePlantEquipmentOperationOutdoorRelativeHumidity(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Pump_ConstantSpeed: {
-        auto pump = modelObject.cast<PumpConstantSpeed>();
-        retVal = translatePumpConstantSpeed(pump);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Pump_VariableSpeed: {
-        auto pump = modelObject.cast<PumpVariableSpeed>();
-        retVal = translatePumpVariableSpeed(pump);
-        break;
-      }
-      case openstudio::IddObjectType::OS_OutputControl_Files: {
-        auto outputControlFiles = modelObject.cast<OutputControlFiles>();
-        retVal = translateOutputControlFiles(outputControlFiles);
-        break;
-      }
-      case openstudio::IddObjectType::OS_OutputControl_ReportingTolerances: {
-        auto outputControlReportingTolerances = modelObject.cast<OutputControlReportingTolerances>();
-        retVal = translateOutputControlReportingTolerances(outputControlReportingTolerances);
-        break;
-      }
-      case openstudio::IddObjectType::OS_OutputControl_Table_Style: {
-        auto outputControlTableStyle = modelObject.cast<OutputControlTableStyle>();
-        retVal = translateOutputControlTableStyle(outputControlTableStyle);
-        break;
-      }
-      case openstudio::IddObjectType::OS_OutputControl_Timestamp: {
-        auto outputControlTimestamp = modelObject.cast<OutputControlTimestamp>();
-        retVal = translateOutputControlTimestamp(outputControlTimestamp);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_DebuggingData: {
-        auto mo = modelObject.cast<OutputDebuggingData>();
-        retVal = translateOutputDebuggingData(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_Diagnostics: {
-        auto mo = modelObject.cast<OutputDiagnostics>();
-        retVal = translateOutputDiagnostics(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_JSON: {
-        auto mo = modelObject.cast<OutputJSON>();
-        retVal = translateOutputJSON(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_SQLite: {
-        auto mo = modelObject.cast<OutputSQLite>();
-        retVal = translateOutputSQLite(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_Schedules: {
-        auto mo = modelObject.cast<OutputSchedules>();
-        retVal = translateOutputSchedules(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_Constructions: {
-        auto mo = modelObject.cast<OutputConstructions>();
-        retVal = translateOutputConstructions(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_EnvironmentalImpactFactors: {
-        auto mo = modelObject.cast<OutputEnvironmentalImpactFactors>();
-        retVal = translateOutputEnvironmentalImpactFactors(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_EnvironmentalImpactFactors: {
-        auto mo = modelObject.cast<EnvironmentalImpactFactors>();
-        retVal = translateEnvironmentalImpactFactors(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_FuelFactors: {
-        auto mo = modelObject.cast<FuelFactors>();
-        retVal = translateFuelFactors(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_Meter: {
-        auto meter = modelObject.cast<OutputMeter>();
-        retVal = translateOutputMeter(meter);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_Variable: {
-        auto outputVariable = modelObject.cast<OutputVariable>();
-        retVal = translateOutputVariable(outputVariable);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_EnergyManagementSystem: {
-        auto outputEnergyManagementSystem = modelObject.cast<OutputEnergyManagementSystem>();
-        retVal = translateOutputEnergyManagementSystem(outputEnergyManagementSystem);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Output_Table_SummaryReports: {
-        auto summaryReports = modelObject.cast<OutputTableSummaryReports>();
-        retVal = translateOutputTableSummaryReports(summaryReports);
-        break;
-      }
-      case openstudio::IddObjectType::OS_People: {
-        auto people = modelObject.cast<People>();
-        retVal = translatePeople(people);
-        break;
-      }
-      case openstudio::IddObjectType::OS_People_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_PerformancePrecisionTradeoffs: {
-        auto performancePrecisionTradeoffs = modelObject.cast<PerformancePrecisionTradeoffs>();
-        retVal = translatePerformancePrecisionTradeoffs(performancePrecisionTradeoffs);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Pipe_Adiabatic: {
-        auto pipe = modelObject.cast<PipeAdiabatic>();
-        retVal = translatePipeAdiabatic(pipe);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Pipe_Indoor: {
-        auto pipe = modelObject.cast<PipeIndoor>();
-        retVal = translatePipeIndoor(pipe);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Pipe_Outdoor: {
-        auto pipe = modelObject.cast<PipeOutdoor>();
-        retVal = translatePipeOutdoor(pipe);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PortList: {
-        auto portList = modelObject.cast<PortList>();
-        retVal = translatePortList(portList);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ProgramControl: {
-        LOG(Warn, "OS_ProgramControl is not currently translated");
-        break;
-      }
-      case openstudio::IddObjectType::OS_PythonPlugin_Instance: {
-        auto obj = modelObject.cast<PythonPluginInstance>();
-        retVal = translatePythonPluginInstance(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PythonPlugin_Variable: {
-        auto obj = modelObject.cast<PythonPluginVariable>();
-        retVal = translatePythonPluginVariable(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PythonPlugin_TrendVariable: {
-        auto obj = modelObject.cast<PythonPluginTrendVariable>();
-        retVal = translatePythonPluginTrendVariable(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PythonPlugin_OutputVariable: {
-        auto obj = modelObject.cast<PythonPluginOutputVariable>();
-        retVal = translatePythonPluginOutputVariable(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_PythonPlugin_SearchPaths: {
-        auto obj = modelObject.cast<PythonPluginSearchPaths>();
-        retVal = translatePythonPluginSearchPaths(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_RadianceParameters: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_AirChiller: {
-        auto refrigerationAirChiller = modelObject.cast<RefrigerationAirChiller>();
-        retVal = translateRefrigerationAirChiller(refrigerationAirChiller);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Case: {
-        auto refrigerationCase = modelObject.cast<RefrigerationCase>();
-        retVal = translateRefrigerationCase(refrigerationCase);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Compressor: {
-        auto refrigerationCompressor = modelObject.cast<RefrigerationCompressor>();
-        retVal = translateRefrigerationCompressor(refrigerationCompressor);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_CompressorRack: {
-        auto refrigerationCompressorRack = modelObject.cast<RefrigerationCompressorRack>();
-        retVal = translateRefrigerationCompressorRack(refrigerationCompressorRack);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Condenser_AirCooled: {
-        auto refrigerationCondenserAirCooled = modelObject.cast<RefrigerationCondenserAirCooled>();
-        retVal = translateRefrigerationCondenserAirCooled(refrigerationCondenserAirCooled);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Condenser_Cascade: {
-        auto refrigerationCondenserCascade = modelObject.cast<RefrigerationCondenserCascade>();
-        retVal = translateRefrigerationCondenserCascade(refrigerationCondenserCascade);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Condenser_EvaporativeCooled: {
-        auto refrigerationCondenserEvaporativeCooled = modelObject.cast<RefrigerationCondenserEvaporativeCooled>();
-        retVal = translateRefrigerationCondenserEvaporativeCooled(refrigerationCondenserEvaporativeCooled);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Condenser_WaterCooled: {
-        auto refrigerationCondenserWaterCooled = modelObject.cast<RefrigerationCondenserWaterCooled>();
-        retVal = translateRefrigerationCondenserWaterCooled(refrigerationCondenserWaterCooled);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_DefrostCycleParameters: {
-        // DLM: is this a no-op?
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_GasCooler_AirCooled: {
-        auto refrigerationGasCoolerAirCooled = modelObject.cast<RefrigerationGasCoolerAirCooled>();
-        retVal = translateRefrigerationGasCoolerAirCooled(refrigerationGasCoolerAirCooled);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Subcooler_LiquidSuction: {
-        auto refrigerationSubcoolerLiquidSuction = modelObject.cast<RefrigerationSubcoolerLiquidSuction>();
-        retVal = translateRefrigerationSubcoolerLiquidSuction(refrigerationSubcoolerLiquidSuction);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_Subcooler_Mechanical: {
-        auto refrigerationSubcoolerMechanical = modelObject.cast<RefrigerationSubcoolerMechanical>();
-        retVal = translateRefrigerationSubcoolerMechanical(refrigerationSubcoolerMechanical);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_SecondarySystem: {
-        auto refrigerationSecondarySystem = modelObject.cast<RefrigerationSecondarySystem>();
-        retVal = translateRefrigerationSecondarySystem(refrigerationSecondarySystem);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_System: {
-        auto refrigerationSystem = modelObject.cast<RefrigerationSystem>();
-        retVal = translateRefrigerationSystem(refrigerationSystem);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_TranscriticalSystem: {
-        auto refrigerationTranscriticalSystem = modelObject.cast<RefrigerationTranscriticalSystem>();
-        retVal = translateRefrigerationTranscriticalSystem(refrigerationTranscriticalSystem);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_WalkIn: {
-        auto refrigerationWalkIn = modelObject.cast<RefrigerationWalkIn>();
-        retVal = translateRefrigerationWalkIn(refrigerationWalkIn);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Refrigeration_WalkIn_ZoneBoundary: {
-        // DLM: is this a no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Rendering_Color: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_RunPeriod: {
-        auto runPeriod = modelObject.cast<RunPeriod>();
-        retVal = translateRunPeriod(runPeriod);
-        break;
-      }
-      case openstudio::IddObjectType::OS_RunPeriodControl_DaylightSavingTime: {
-        auto mo = modelObject.cast<RunPeriodControlDaylightSavingTime>();
-        retVal = translateRunPeriodControlDaylightSavingTime(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_RunPeriodControl_SpecialDays: {
-        auto mo = modelObject.cast<RunPeriodControlSpecialDays>();
-        retVal = translateRunPeriodControlSpecialDays(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_Compact: {
-        auto schedule = modelObject.cast<ScheduleCompact>();
-        retVal = translateScheduleCompact(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_Constant: {
-        auto schedule = modelObject.cast<ScheduleConstant>();
-        retVal = translateScheduleConstant(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_Day: {
-        auto schedule = modelObject.cast<ScheduleDay>();
-        retVal = translateScheduleDay(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_FixedInterval: {
-        auto schedule = modelObject.cast<ScheduleFixedInterval>();
-        retVal = translateScheduleFixedInterval(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_File: {
-        auto schedule = modelObject.cast<ScheduleFile>();
-        retVal = translateScheduleFile(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_Rule: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_Ruleset: {
-        auto mo = modelObject.cast<ScheduleRuleset>();
-        retVal = translateScheduleRuleset(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ScheduleTypeLimits: {
-        auto mo = modelObject.cast<ScheduleTypeLimits>();
-        retVal = translateScheduleTypeLimits(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_Week: {
-        auto schedule = modelObject.cast<ScheduleWeek>();
-        retVal = translateScheduleWeek(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_Year: {
-        auto schedule = modelObject.cast<ScheduleYear>();
-        retVal = translateScheduleYear(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Schedule_VariableInterval: {
-        auto schedule = modelObject.cast<ScheduleVariableInterval>();
-        retVal = translateScheduleVariableInterval(schedule);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_Coldest: {
-        auto spm = modelObject.cast<SetpointManagerColdest>();
-        retVal = translateSetpointManagerColdest(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_FollowGroundTemperature: {
-        auto spm = modelObject.cast<SetpointManagerFollowGroundTemperature>();
-        retVal = translateSetpointManagerFollowGroundTemperature(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_FollowOutdoorAirTemperature: {
-        auto spm = modelObject.cast<SetpointManagerFollowOutdoorAirTemperature>();
-        retVal = translateSetpointManagerFollowOutdoorAirTemperature(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_FollowSystemNodeTemperature: {
-        auto spm = modelObject.cast<SetpointManagerFollowSystemNodeTemperature>();
-        retVal = translateSetpointManagerFollowSystemNodeTemperature(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_MixedAir: {
-        auto spm = modelObject.cast<SetpointManagerMixedAir>();
-        retVal = translateSetpointManagerMixedAir(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_MultiZone_Cooling_Average: {
-        auto spm = modelObject.cast<SetpointManagerMultiZoneCoolingAverage>();
-        retVal = translateSetpointManagerMultiZoneCoolingAverage(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_MultiZone_Heating_Average: {
-        auto spm = modelObject.cast<SetpointManagerMultiZoneHeatingAverage>();
-        retVal = translateSetpointManagerMultiZoneHeatingAverage(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_MultiZone_Humidity_Maximum: {
-        auto spm = modelObject.cast<SetpointManagerMultiZoneHumidityMaximum>();
-        retVal = translateSetpointManagerMultiZoneHumidityMaximum(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_MultiZone_Humidity_Minimum: {
-        auto spm = modelObject.cast<SetpointManagerMultiZoneHumidityMinimum>();
-        retVal = translateSetpointManagerMultiZoneHumidityMinimum(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_MultiZone_MaximumHumidity_Average: {
-        auto spm = modelObject.cast<SetpointManagerMultiZoneMaximumHumidityAverage>();
-        retVal = translateSetpointManagerMultiZoneMaximumHumidityAverage(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_MultiZone_MinimumHumidity_Average: {
-        auto spm = modelObject.cast<SetpointManagerMultiZoneMinimumHumidityAverage>();
-        retVal = translateSetpointManagerMultiZoneMinimumHumidityAverage(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_OutdoorAirPretreat: {
-        auto spm = modelObject.cast<SetpointManagerOutdoorAirPretreat>();
-        retVal = translateSetpointManagerOutdoorAirPretreat(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_OutdoorAirReset: {
-        auto spm = modelObject.cast<SetpointManagerOutdoorAirReset>();
-        retVal = translateSetpointManagerOutdoorAirReset(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_Scheduled: {
-        auto spm = modelObject.cast<SetpointManagerScheduled>();
-        retVal = translateSetpointManagerScheduled(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_Scheduled_DualSetpoint: {
-        auto spm = modelObject.cast<SetpointManagerScheduledDualSetpoint>();
-        retVal = translateSetpointManagerScheduledDualSetpoint(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SingleZone_Cooling: {
-        auto spm = modelObject.cast<SetpointManagerSingleZoneCooling>();
-        retVal = translateSetpointManagerSingleZoneCooling(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SingleZone_Heating: {
-        auto spm = modelObject.cast<SetpointManagerSingleZoneHeating>();
-        retVal = translateSetpointManagerSingleZoneHeating(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SingleZone_Humidity_Maximum: {
-        auto spm = modelObject.cast<SetpointManagerSingleZoneHumidityMaximum>();
-        retVal = translateSetpointManagerSingleZoneHumidityMaximum(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SingleZone_Humidity_Minimum: {
-        auto spm = modelObject.cast<SetpointManagerSingleZoneHumidityMinimum>();
-        retVal = translateSetpointManagerSingleZoneHumidityMinimum(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SingleZone_OneStageCooling: {
-        auto spm = modelObject.cast<SetpointManagerSingleZoneOneStageCooling>();
-        retVal = translateSetpointManagerSingleZoneOneStageCooling(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SingleZone_OneStageHeating: {
-        auto spm = modelObject.cast<SetpointManagerSingleZoneOneStageHeating>();
-        retVal = translateSetpointManagerSingleZoneOneStageHeating(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SingleZone_Reheat: {
-        auto spm = modelObject.cast<SetpointManagerSingleZoneReheat>();
-        retVal = translateSetpointManagerSingleZoneReheat(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_Warmest: {
-        auto spm = modelObject.cast<SetpointManagerWarmest>();
-        retVal = translateSetpointManagerWarmest(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_WarmestTemperatureFlow: {
-        auto spm = modelObject.cast<SetpointManagerWarmestTemperatureFlow>();
-        retVal = translateSetpointManagerWarmestTemperatureFlow(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SystemNodeReset_Humidity: {
-        auto spm = modelObject.cast<SetpointManagerSystemNodeResetHumidity>();
-        retVal = translateSetpointManagerSystemNodeResetHumidity(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SetpointManager_SystemNodeReset_Temperature: {
-        auto spm = modelObject.cast<SetpointManagerSystemNodeResetTemperature>();
-        retVal = translateSetpointManagerSystemNodeResetTemperature(spm);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ShadingControl: {
-        auto shadingControl = modelObject.cast<ShadingControl>();
-        retVal = translateShadingControl(shadingControl);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ShadingSurface: {
-        auto shadingSurface = modelObject.cast<ShadingSurface>();
-        retVal = translateShadingSurface(shadingSurface);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ShadingSurfaceGroup: {
-        auto shadingSurfaceGroup = modelObject.cast<ShadingSurfaceGroup>();
-        retVal = translateShadingSurfaceGroup(shadingSurfaceGroup);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ShadowCalculation: {
-        auto mo = modelObject.cast<ShadowCalculation>();
-        retVal = translateShadowCalculation(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SimulationControl: {
-        auto simulationControl = modelObject.cast<SimulationControl>();
-        retVal = translateSimulationControl(simulationControl);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Space: {
-        auto space = modelObject.cast<Space>();
-        retVal = translateSpace(space);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SpaceInfiltration_DesignFlowRate: {
-        auto spaceInfiltrationDesignFlowRate = modelObject.cast<SpaceInfiltrationDesignFlowRate>();
-        retVal = translateSpaceInfiltrationDesignFlowRate(spaceInfiltrationDesignFlowRate);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea: {
-        auto spaceInfiltrationEffectiveLeakageArea = modelObject.cast<SpaceInfiltrationEffectiveLeakageArea>();
-        retVal = translateSpaceInfiltrationEffectiveLeakageArea(spaceInfiltrationEffectiveLeakageArea);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SpaceInfiltration_FlowCoefficient: {
-        auto spaceInfiltrationFlowCoefficient = modelObject.cast<SpaceInfiltrationFlowCoefficient>();
-        retVal = translateSpaceInfiltrationFlowCoefficient(spaceInfiltrationFlowCoefficient);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SpaceType: {
-        auto spaceType = modelObject.cast<SpaceType>();
-        retVal = translateSpaceType(spaceType);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site: {
-        auto site = modelObject.cast<Site>();
-        retVal = translateSite(site);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_GroundReflectance: {
-        auto mo = modelObject.cast<SiteGroundReflectance>();
-        retVal = translateSiteGroundReflectance(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_GroundTemperature_BuildingSurface: {
-        auto mo = modelObject.cast<SiteGroundTemperatureBuildingSurface>();
-        retVal = translateSiteGroundTemperatureBuildingSurface(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_GroundTemperature_Deep: {
-        auto mo = modelObject.cast<SiteGroundTemperatureDeep>();
-        retVal = translateSiteGroundTemperatureDeep(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_GroundTemperature_FCfactorMethod: {
-        auto mo = modelObject.cast<SiteGroundTemperatureFCfactorMethod>();
-        retVal = translateSiteGroundTemperatureFCfactorMethod(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_GroundTemperature_Shallow: {
-        auto mo = modelObject.cast<SiteGroundTemperatureShallow>();
-        retVal = translateSiteGroundTemperatureShallow(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_GroundTemperature_Undisturbed_KusudaAchenbach: {
-        model::SiteGroundTemperatureUndisturbedKusudaAchenbach mo = modelObject.cast<SiteGroundTemperatureUndisturbedKusudaAchenbach>();
-        retVal = translateSiteGroundTemperatureUndisturbedKusudaAchenbach(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_GroundTemperature_Undisturbed_Xing: {
-        model::SiteGroundTemperatureUndisturbedXing mo = modelObject.cast<SiteGroundTemperatureUndisturbedXing>();
-        retVal = translateSiteGroundTemperatureUndisturbedXing(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Site_WaterMainsTemperature: {
-        auto mo = modelObject.cast<SiteWaterMainsTemperature>();
-        retVal = translateSiteWaterMainsTemperature(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Sizing_Parameters: {
-        auto mo = modelObject.cast<SizingParameters>();
-        retVal = translateSizingParameters(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SolarCollector_FlatPlate_PhotovoltaicThermal: {
-        auto mo = modelObject.cast<SolarCollectorFlatPlatePhotovoltaicThermal>();
-        retVal = translateSolarCollectorFlatPlatePhotovoltaicThermal(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SolarCollector_FlatPlate_Water: {
-        auto mo = modelObject.cast<SolarCollectorFlatPlateWater>();
-        retVal = translateSolarCollectorFlatPlateWater(mo);
-        break;
-      }
+  struct ForwardTranslator::ModelObjectTranslatorAdapters
+  {
+    // Casts the ModelObject to ModelObjectType and calls the translate member function
+    template <typename ModelObjectType, auto translate>
+    static boost::optional<IdfObject> translateAs(ForwardTranslator& ft, ModelObject& modelObject) {
+      auto mo = modelObject.cast<ModelObjectType>();
+      return (ft.*translate)(mo);
+    }
 
-      case openstudio::IddObjectType::OS_SolarCollector_IntegralCollectorStorage: {
-        auto mo = modelObject.cast<SolarCollectorIntegralCollectorStorage>();
-        retVal = translateSolarCollectorIntegralCollectorStorage(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SolarCollectorPerformance_FlatPlate: {
-        auto mo = modelObject.cast<SolarCollectorPerformanceFlatPlate>();
-        retVal = translateSolarCollectorPerformanceFlatPlate(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SolarCollectorPerformance_IntegralCollectorStorage: {
-        auto mo = modelObject.cast<SolarCollectorPerformanceIntegralCollectorStorage>();
-        retVal = translateSolarCollectorPerformanceIntegralCollectorStorage(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SolarCollectorPerformance_PhotovoltaicThermal_BIPVT: {
-        auto mo = modelObject.cast<SolarCollectorPerformancePhotovoltaicThermalBIPVT>();
-        retVal = translateSolarCollectorPerformancePhotovoltaicThermalBIPVT(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SolarCollectorPerformance_PhotovoltaicThermal_Simple: {
-        auto mo = modelObject.cast<SolarCollectorPerformancePhotovoltaicThermalSimple>();
-        retVal = translateSolarCollectorPerformancePhotovoltaicThermalSimple(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_StandardsInformation_Construction: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_StandardsInformation_Material: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_SteamEquipment: {
-        auto steamEquipment = modelObject.cast<SteamEquipment>();
-        retVal = translateSteamEquipment(steamEquipment);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SteamEquipment_Definition: {
-        // no-op
-        break;
-      }
-      case openstudio::IddObjectType::OS_Surface: {
-        auto surface = modelObject.cast<Surface>();
-        retVal = translateSurface(surface);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceConvectionAlgorithm_Inside: {
-        auto mo = modelObject.cast<InsideSurfaceConvectionAlgorithm>();
-        retVal = translateInsideSurfaceConvectionAlgorithm(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceConvectionAlgorithm_Outside: {
-        auto mo = modelObject.cast<OutsideSurfaceConvectionAlgorithm>();
-        retVal = translateOutsideSurfaceConvectionAlgorithm(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceControl_MovableInsulation: {
-        auto obj = modelObject.cast<SurfaceControlMovableInsulation>();
-        retVal = translateSurfaceControlMovableInsulation(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_ConvectionCoefficients: {
-        auto obj = modelObject.cast<SurfacePropertyConvectionCoefficients>();
-        retVal = translateSurfacePropertyConvectionCoefficients(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_ConvectionCoefficients_MultipleSurface: {
-        auto obj = modelObject.cast<SurfacePropertyConvectionCoefficientsMultipleSurface>();
-        retVal = translateSurfacePropertyConvectionCoefficientsMultipleSurface(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_LocalEnvironment: {
-        auto obj = modelObject.cast<SurfacePropertyLocalEnvironment>();
-        retVal = translateSurfacePropertyLocalEnvironment(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_ExposedFoundationPerimeter: {
-        auto obj = modelObject.cast<SurfacePropertyExposedFoundationPerimeter>();
-        retVal = translateSurfacePropertyExposedFoundationPerimeter(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_OtherSideCoefficients: {
-        auto obj = modelObject.cast<SurfacePropertyOtherSideCoefficients>();
-        retVal = translateSurfacePropertyOtherSideCoefficients(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_OtherSideConditionsModel: {
-        auto obj = modelObject.cast<SurfacePropertyOtherSideConditionsModel>();
-        retVal = translateSurfacePropertyOtherSideConditionsModel(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_SurroundingSurfaces: {
-        auto obj = modelObject.cast<SurfacePropertySurroundingSurfaces>();
-        retVal = translateSurfacePropertySurroundingSurfaces(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_GroundSurfaces: {
-        auto obj = modelObject.cast<SurfacePropertyGroundSurfaces>();
-        retVal = translateSurfacePropertyGroundSurfaces(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SurfaceProperty_IncidentSolarMultiplier: {
-        auto obj = modelObject.cast<SurfacePropertyIncidentSolarMultiplier>();
-        retVal = translateSurfacePropertyIncidentSolarMultiplier(obj);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SubSurface: {
-        auto subSurface = modelObject.cast<SubSurface>();
-        retVal = translateSubSurface(subSurface);
-        break;
-      }
-      case openstudio::IddObjectType::OS_SwimmingPool_Indoor: {
-        auto obj = modelObject.cast<SwimmingPoolIndoor>();
-        retVal = translateSwimmingPoolIndoor(obj);
-        break;
+    // Same as translateAs, but calls translateWithoutUnitary if the component is contained in a unitary system
+    template <typename ModelObjectType, auto translate, auto translateWithoutUnitary>
+    static boost::optional<IdfObject> translateUnitaryAs(ForwardTranslator& ft, ModelObject& modelObject) {
+      auto mo = modelObject.cast<ModelObjectType>();
+      if (isHVACComponentWithinUnitary(mo)) {
+        return (ft.*translateWithoutUnitary)(mo);
       }
+      return (ft.*translate)(mo);
+    }
+  };
+
+// Casts to MODELOBJECT and calls TRANSLATE
+#define OS_FT_TRANSLATOR(IDDTYPE, MODELOBJECT, TRANSLATE)                                                                 \
+  ModelObjectTranslator {                                                                                                 \
+    openstudio::IddObjectType::IDDTYPE, &ModelObjectTranslatorAdapters::translateAs<MODELOBJECT, &ForwardTranslator::TRANSLATE>,    \
+      true                                                                                                                \
+  }
+// Casts to MODELOBJECT and calls TRANSLATEWithoutUnitary if the component is inside a unitary, TRANSLATE otherwise
+#define OS_FT_UNITARY_TRANSLATOR(IDDTYPE, MODELOBJECT, TRANSLATE)                                                         \
+  ModelObjectTranslator {                                                                                                 \
+    openstudio::IddObjectType::IDDTYPE,                                                                                   \
+      &ModelObjectTranslatorAdapters::translateUnitaryAs<MODELOBJECT, &ForwardTranslator::TRANSLATE,                      \
+                                                         &ForwardTranslator::TRANSLATE##WithoutUnitary>,                  \
+      true                                                                                                                \
+  }
+// Not translated by itself, but the children of a ParentObject are
+#define OS_FT_NOOP(IDDTYPE)                                                                                               \
+  ModelObjectTranslator {                                                                                                 \
+    openstudio::IddObjectType::IDDTYPE, nullptr, true                                                                     \
+  }
+// Not translated, and neither are the children of a ParentObject
+#define OS_FT_SKIP(IDDTYPE)                                                                                               \
+  ModelObjectTranslator {                                                                                                 \
+    openstudio::IddObjectType::IDDTYPE, nullptr, false                                                                    \
+  }
 
+  // TableMultiVariableLookup is deprecated
 #if defined(_MSC_VER)
 #  pragma warning(push)
 #  pragma warning(disable : 4996)
@@ -2964,331 +710,846 @@ namespace energyplus {
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #endif
-      case openstudio::IddObjectType::OS_Table_MultiVariableLookup: {
-        auto table = modelObject.cast<TableMultiVariableLookup>();
-        retVal = translateTableMultiVariableLookup(table);
-        break;
-      }
+  // NOLINTBEGIN(readability-function-size)
+  const std::vector<ForwardTranslator::ModelObjectTranslator>& ForwardTranslator::modelObjectTranslators() {
+    static const std::vector<ModelObjectTranslator> translators{
+      // no op
+      OS_FT_NOOP(OS_AdditionalProperties),
+      OS_FT_TRANSLATOR(OS_AirConditioner_VariableRefrigerantFlow, AirConditionerVariableRefrigerantFlow,
+                       translateAirConditionerVariableRefrigerantFlow),
+      OS_FT_TRANSLATOR(OS_AirConditioner_VariableRefrigerantFlow_FluidTemperatureControl,
+                       AirConditionerVariableRefrigerantFlowFluidTemperatureControl,
+                       translateAirConditionerVariableRefrigerantFlowFluidTemperatureControl),
+      OS_FT_TRANSLATOR(OS_AirConditioner_VariableRefrigerantFlow_FluidTemperatureControl_HR,
+                       AirConditionerVariableRefrigerantFlowFluidTemperatureControlHR,
+                       translateAirConditionerVariableRefrigerantFlowFluidTemperatureControlHR),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC, AirLoopHVAC, translateAirLoopHVAC),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_ReturnPlenum, AirLoopHVACReturnPlenum, translateAirLoopHVACReturnPlenum),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_SupplyPlenum, AirLoopHVACSupplyPlenum, translateAirLoopHVACSupplyPlenum),
+      OS_FT_TRANSLATOR(OS_AirTerminal_DualDuct_ConstantVolume, AirTerminalDualDuctConstantVolume, translateAirTerminalDualDuctConstantVolume),
+      OS_FT_TRANSLATOR(OS_AirTerminal_DualDuct_VAV, AirTerminalDualDuctVAV, translateAirTerminalDualDuctVAV),
+      OS_FT_TRANSLATOR(OS_AirTerminal_DualDuct_VAV_OutdoorAir, AirTerminalDualDuctVAVOutdoorAir, translateAirTerminalDualDuctVAVOutdoorAir),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction, AirTerminalSingleDuctConstantVolumeFourPipeInduction,
+                       translateAirTerminalSingleDuctConstantVolumeFourPipeInduction),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_ConstantVolume_Reheat, AirTerminalSingleDuctConstantVolumeReheat,
+                       translateAirTerminalSingleDuctConstantVolumeReheat),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam, AirTerminalSingleDuctConstantVolumeCooledBeam,
+                       translateAirTerminalSingleDuctConstantVolumeCooledBeam),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam, AirTerminalSingleDuctConstantVolumeFourPipeBeam,
+                       translateAirTerminalSingleDuctConstantVolumeFourPipeBeam),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_ParallelPIU_Reheat, AirTerminalSingleDuctParallelPIUReheat,
+                       translateAirTerminalSingleDuctParallelPIUReheat),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_SeriesPIU_Reheat, AirTerminalSingleDuctSeriesPIUReheat,
+                       translateAirTerminalSingleDuctSeriesPIUReheat),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat, AirTerminalSingleDuctConstantVolumeNoReheat,
+                       translateAirTerminalSingleDuctConstantVolumeNoReheat),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_VAV_NoReheat, AirTerminalSingleDuctVAVNoReheat, translateAirTerminalSingleDuctVAVNoReheat),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_VAV_Reheat, AirTerminalSingleDuctVAVReheat, translateAirTerminalSingleDuctVAVReheat),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_InletSideMixer, AirTerminalSingleDuctInletSideMixer, translateAirTerminalSingleDuctInletSideMixer),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat, AirTerminalSingleDuctVAVHeatAndCoolNoReheat,
+                       translateAirTerminalSingleDuctVAVHeatAndCoolNoReheat),
+      OS_FT_TRANSLATOR(OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat, AirTerminalSingleDuctVAVHeatAndCoolReheat,
+                       translateAirTerminalSingleDuctVAVHeatAndCoolReheat),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_ZoneSplitter, AirLoopHVACZoneSplitter, translateAirLoopHVACZoneSplitter),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_ZoneMixer, AirLoopHVACZoneMixer, translateAirLoopHVACZoneMixer),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_OutdoorAirSystem, AirLoopHVACOutdoorAirSystem, translateAirLoopHVACOutdoorAirSystem),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_DedicatedOutdoorAirSystem, AirLoopHVACDedicatedOutdoorAirSystem, translateAirLoopHVACDedicatedOutdoorAirSystem),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_UnitaryHeatPump_AirToAir, AirLoopHVACUnitaryHeatPumpAirToAir, translateAirLoopHVACUnitaryHeatPumpAirToAir),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass, AirLoopHVACUnitaryHeatCoolVAVChangeoverBypass,
+                       translateAirLoopHVACUnitaryHeatCoolVAVChangeoverBypass),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed, AirLoopHVACUnitaryHeatPumpAirToAirMultiSpeed,
+                       translateAirLoopHVACUnitaryHeatPumpAirToAirMultiSpeed),
+      OS_FT_TRANSLATOR(OS_AirLoopHVAC_UnitarySystem, AirLoopHVACUnitarySystem, translateAirLoopHVACUnitarySystem),
+      OS_FT_TRANSLATOR(OS_AvailabilityManagerAssignmentList, AvailabilityManagerAssignmentList, translateAvailabilityManagerAssignmentList),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_Scheduled, AvailabilityManagerScheduled, translateAvailabilityManagerScheduled),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_ScheduledOn, AvailabilityManagerScheduledOn, translateAvailabilityManagerScheduledOn),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_ScheduledOff, AvailabilityManagerScheduledOff, translateAvailabilityManagerScheduledOff),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_HybridVentilation, AvailabilityManagerHybridVentilation, translateAvailabilityManagerHybridVentilation),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_OptimumStart, AvailabilityManagerOptimumStart, translateAvailabilityManagerOptimumStart),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_DifferentialThermostat, AvailabilityManagerDifferentialThermostat,
+                       translateAvailabilityManagerDifferentialThermostat),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_NightVentilation, AvailabilityManagerNightVentilation, translateAvailabilityManagerNightVentilation),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_NightCycle, AvailabilityManagerNightCycle, translateAvailabilityManagerNightCycle),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_HighTemperatureTurnOn, AvailabilityManagerHighTemperatureTurnOn,
+                       translateAvailabilityManagerHighTemperatureTurnOn),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_HighTemperatureTurnOff, AvailabilityManagerHighTemperatureTurnOff,
+                       translateAvailabilityManagerHighTemperatureTurnOff),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_LowTemperatureTurnOn, AvailabilityManagerLowTemperatureTurnOn,
+                       translateAvailabilityManagerLowTemperatureTurnOn),
+      OS_FT_TRANSLATOR(OS_AvailabilityManager_LowTemperatureTurnOff, AvailabilityManagerLowTemperatureTurnOff,
+                       translateAvailabilityManagerLowTemperatureTurnOff),
+      OS_FT_TRANSLATOR(OS_Boiler_HotWater, BoilerHotWater, translateBoilerHotWater),
+      OS_FT_TRANSLATOR(OS_Boiler_Steam, BoilerSteam, translateBoilerSteam),
+      OS_FT_TRANSLATOR(OS_Building, Building, translateBuilding),
+      // no-op
+      OS_FT_SKIP(OS_BuildingStory),
+      OS_FT_TRANSLATOR(OS_CentralHeatPumpSystem, CentralHeatPumpSystem, translateCentralHeatPumpSystem),
+      // no-op
+      OS_FT_SKIP(OS_CentralHeatPumpSystem_Module),
+      OS_FT_TRANSLATOR(OS_Chiller_Absorption, ChillerAbsorption, translateChillerAbsorption),
+      OS_FT_TRANSLATOR(OS_Chiller_Absorption_Indirect, ChillerAbsorptionIndirect, translateChillerAbsorptionIndirect),
+      OS_FT_TRANSLATOR(OS_Chiller_Electric_ASHRAE205, ChillerElectricASHRAE205, translateChillerElectricASHRAE205),
+      OS_FT_TRANSLATOR(OS_Chiller_Electric_EIR, ChillerElectricEIR, translateChillerElectricEIR),
+      OS_FT_TRANSLATOR(OS_Chiller_Electric_ReformulatedEIR, ChillerElectricReformulatedEIR, translateChillerElectricReformulatedEIR),
+      OS_FT_TRANSLATOR(OS_ChillerHeaterPerformance_Electric_EIR, ChillerHeaterPerformanceElectricEIR, translateChillerHeaterPerformanceElectricEIR),
+      // no-op
+      OS_FT_SKIP(OS_ClimateZones),
+      OS_FT_TRANSLATOR(OS_Construction_CfactorUndergroundWall, CFactorUndergroundWallConstruction, translateCFactorUndergroundWallConstruction),
+      OS_FT_TRANSLATOR(OS_ConvergenceLimits, ConvergenceLimits, translateConvergenceLimits),
+      // This is handled directly in ATU:SingleDuct:ConstantVolume::CooledBeam
+      OS_FT_NOOP(OS_Coil_Cooling_CooledBeam),
+      // This is handled directly in ATU:SingleDuct:ConstantVolume::FourPipeBeam
+      OS_FT_NOOP(OS_Coil_Cooling_FourPipeBeam),
+      // This is handled directly in ATU:SingleDuct:ConstantVolume::FourPipeBeam
+      OS_FT_NOOP(OS_Coil_Heating_FourPipeBeam),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Cooling_DX, CoilCoolingDX, translateCoilCoolingDX),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_DX_CurveFit_Performance, CoilCoolingDXCurveFitPerformance, translateCoilCoolingDXCurveFitPerformance),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_DX_CurveFit_OperatingMode, CoilCoolingDXCurveFitOperatingMode, translateCoilCoolingDXCurveFitOperatingMode),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_DX_CurveFit_Speed, CoilCoolingDXCurveFitSpeed, translateCoilCoolingDXCurveFitSpeed),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Cooling_DX_SingleSpeed, CoilCoolingDXSingleSpeed, translateCoilCoolingDXSingleSpeed),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Cooling_DX_SingleSpeed_ThermalStorage, CoilCoolingDXSingleSpeedThermalStorage,
+                               translateCoilCoolingDXSingleSpeedThermalStorage),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_DX_MultiSpeed, CoilCoolingDXMultiSpeed, translateCoilCoolingDXMultiSpeed),
+      OS_FT_SKIP(OS_Coil_Cooling_DX_MultiSpeed_StageData),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Cooling_DX_TwoSpeed, CoilCoolingDXTwoSpeed, translateCoilCoolingDXTwoSpeed),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode, CoilCoolingDXTwoStageWithHumidityControlMode,
+                               translateCoilCoolingDXTwoStageWithHumidityControlMode),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_DX_VariableRefrigerantFlow, CoilCoolingDXVariableRefrigerantFlow,
+                       translateCoilCoolingDXVariableRefrigerantFlow),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_DX_VariableRefrigerantFlow_FluidTemperatureControl,
+                       CoilCoolingDXVariableRefrigerantFlowFluidTemperatureControl,
+                       translateCoilCoolingDXVariableRefrigerantFlowFluidTemperatureControl),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Cooling_DX_VariableSpeed, CoilCoolingDXVariableSpeed, translateCoilCoolingDXVariableSpeed),
+      // DLM: is this a no-op?
+      OS_FT_NOOP(OS_Coil_Cooling_DX_VariableSpeed_SpeedData),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Cooling_LowTemperatureRadiant_ConstantFlow),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Cooling_LowTemperatureRadiant_VariableFlow),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_Water, CoilCoolingWater, translateCoilCoolingWater),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Cooling_Water_Panel_Radiant),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_WaterToAirHeatPump_EquationFit, CoilCoolingWaterToAirHeatPumpEquationFit,
+                       translateCoilCoolingWaterToAirHeatPumpEquationFit),
+      OS_FT_TRANSLATOR(OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit, CoilCoolingWaterToAirHeatPumpVariableSpeedEquationFit,
+                       translateCoilCoolingWaterToAirHeatPumpVariableSpeedEquationFit),
+      // DLM: is this a no-op?
+      OS_FT_NOOP(OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit_SpeedData),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_Desuperheater, CoilHeatingDesuperheater, translateCoilHeatingDesuperheater),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Heating_DX_SingleSpeed, CoilHeatingDXSingleSpeed, translateCoilHeatingDXSingleSpeed),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_DX_MultiSpeed, CoilHeatingDXMultiSpeed, translateCoilHeatingDXMultiSpeed),
+      OS_FT_SKIP(OS_Coil_Heating_DX_MultiSpeed_StageData),
+      OS_FT_UNITARY_TRANSLATOR(OS_Coil_Heating_DX_VariableSpeed, CoilHeatingDXVariableSpeed, translateCoilHeatingDXVariableSpeed),
+      //DLM: is this a no-op?
+      OS_FT_NOOP(OS_Coil_Heating_DX_VariableSpeed_SpeedData),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_Electric, CoilHeatingElectric, translateCoilHeatingElectric),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_Electric_MultiStage, CoilHeatingElectricMultiStage, translateCoilHeatingElectricMultiStage),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Heating_Electric_MultiStage_StageData),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_Gas, CoilHeatingGas, translateCoilHeatingGas),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_Gas_MultiStage, CoilHeatingGasMultiStage, translateCoilHeatingGasMultiStage),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Heating_Gas_MultiStage_StageData),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Heating_LowTemperatureRadiant_ConstantFlow),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Heating_LowTemperatureRadiant_VariableFlow),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_DX_VariableRefrigerantFlow, CoilHeatingDXVariableRefrigerantFlow,
+                       translateCoilHeatingDXVariableRefrigerantFlow),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_DX_VariableRefrigerantFlow_FluidTemperatureControl,
+                       CoilHeatingDXVariableRefrigerantFlowFluidTemperatureControl,
+                       translateCoilHeatingDXVariableRefrigerantFlowFluidTemperatureControl),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_Water, CoilHeatingWater, translateCoilHeatingWater),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_WaterToAirHeatPump_EquationFit, CoilHeatingWaterToAirHeatPumpEquationFit,
+                       translateCoilHeatingWaterToAirHeatPumpEquationFit),
+      OS_FT_TRANSLATOR(OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit, CoilHeatingWaterToAirHeatPumpVariableSpeedEquationFit,
+                       translateCoilHeatingWaterToAirHeatPumpVariableSpeedEquationFit),
+      // DLM: is this a no-op?
+      OS_FT_NOOP(OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit_SpeedData),
+      // DLM: is this a no-op?
+      OS_FT_NOOP(OS_Coil_Heating_Water_Baseboard),
+      // no-op
+      OS_FT_SKIP(OS_Coil_Heating_Water_Baseboard_Radiant),
+      OS_FT_TRANSLATOR(OS_CoilPerformance_DX_Cooling, CoilPerformanceDXCooling, translateCoilPerformanceDXCooling),
+      OS_FT_TRANSLATOR(OS_CoilSystem_Cooling_Water_HeatExchangerAssisted, CoilSystemCoolingWaterHeatExchangerAssisted,
+                       translateCoilSystemCoolingWaterHeatExchangerAssisted),
+      OS_FT_TRANSLATOR(OS_CoilSystem_Cooling_DX_HeatExchangerAssisted, CoilSystemCoolingDXHeatExchangerAssisted,
+                       translateCoilSystemCoolingDXHeatExchangerAssisted),
+      OS_FT_TRANSLATOR(OS_CoilSystem_IntegratedHeatPump_AirSource, CoilSystemIntegratedHeatPumpAirSource,
+                       translateCoilSystemIntegratedHeatPumpAirSource),
+      OS_FT_TRANSLATOR(OS_Coil_UserDefined, CoilUserDefined, translateCoilUserDefined),
+      OS_FT_TRANSLATOR(OS_Coil_WaterHeating_Desuperheater, CoilWaterHeatingDesuperheater, translateCoilWaterHeatingDesuperheater),
+      OS_FT_TRANSLATOR(OS_Coil_WaterHeating_AirToWaterHeatPump, CoilWaterHeatingAirToWaterHeatPump, translateCoilWaterHeatingAirToWaterHeatPump),
+      OS_FT_TRANSLATOR(OS_Coil_WaterHeating_AirToWaterHeatPump_VariableSpeed, CoilWaterHeatingAirToWaterHeatPumpVariableSpeed,
+                       translateCoilWaterHeatingAirToWaterHeatPumpVariableSpeed),
+      OS_FT_TRANSLATOR(OS_Coil_WaterHeating_AirToWaterHeatPump_Wrapped, CoilWaterHeatingAirToWaterHeatPumpWrapped,
+                       translateCoilWaterHeatingAirToWaterHeatPumpWrapped),
+      // no-op
+      OS_FT_SKIP(OS_ComponentData),
+      {openstudio::IddObjectType::OS_ComponentCost_Adjustments,
+       [](ForwardTranslator& /*ft*/, ModelObject& modelObject) -> boost::optional<IdfObject> {
+         LOG(Warn, "OS:ComponentCost:Adjustments '" << modelObject.name().get() << "' not translated to EnergyPlus.");
+         return boost::none;
+       },
+       false},
+      // no-op
+      OS_FT_SKIP(OS_Connection),
+      // no-op
+      OS_FT_SKIP(OS_Connector_Mixer),
+      // no-op
+      OS_FT_SKIP(OS_Connector_Splitter),
+      OS_FT_TRANSLATOR(OS_Construction, Construction, translateConstruction),
+      OS_FT_TRANSLATOR(OS_Construction_AirBoundary, ConstructionAirBoundary, translateConstructionAirBoundary),
+      OS_FT_TRANSLATOR(OS_Construction_InternalSource, ConstructionWithInternalSource, translateConstructionWithInternalSource),
+      OS_FT_TRANSLATOR(OS_Construction_FfactorGroundFloor, FFactorGroundFloorConstruction, translateFFactorGroundFloorConstruction),
+      {openstudio::IddObjectType::OS_Construction_WindowDataFile,
+       [](ForwardTranslator& /*ft*/, ModelObject& /*modelObject*/) -> boost::optional<IdfObject> {
+         LOG(Warn, "OS_WindowDataFile is not currently translated");
+         return boost::none;
+       },
+       true},
+      OS_FT_TRANSLATOR(OS_Controller_MechanicalVentilation, ControllerMechanicalVentilation, translateControllerMechanicalVentilation),
+      OS_FT_TRANSLATOR(OS_Controller_OutdoorAir, ControllerOutdoorAir, translateControllerOutdoorAir),
+      OS_FT_TRANSLATOR(OS_Controller_WaterCoil, ControllerWaterCoil, translateControllerWaterCoil),
+      OS_FT_TRANSLATOR(OS_CoolingTowerPerformance_CoolTools, CoolingTowerPerformanceCoolTools, translateCoolingTowerPerformanceCoolTools),
+      OS_FT_TRANSLATOR(OS_CoolingTowerPerformance_YorkCalc, CoolingTowerPerformanceYorkCalc, translateCoolingTowerPerformanceYorkCalc),
+      OS_FT_TRANSLATOR(OS_CoolingTower_SingleSpeed, CoolingTowerSingleSpeed, translateCoolingTowerSingleSpeed),
+      OS_FT_TRANSLATOR(OS_CoolingTower_TwoSpeed, CoolingTowerTwoSpeed, translateCoolingTowerTwoSpeed),
+      OS_FT_TRANSLATOR(OS_CoolingTower_VariableSpeed, CoolingTowerVariableSpeed, translateCoolingTowerVariableSpeed),
+      OS_FT_TRANSLATOR(OS_CurrencyType, CurrencyType, translateCurrencyType),
+      OS_FT_TRANSLATOR(OS_Curve_Bicubic, CurveBicubic, translateCurveBicubic),
+      OS_FT_TRANSLATOR(OS_Curve_Biquadratic, CurveBiquadratic, translateCurveBiquadratic),
+      OS_FT_TRANSLATOR(OS_Curve_Cubic, CurveCubic, translateCurveCubic),
+      OS_FT_TRANSLATOR(OS_Curve_DoubleExponentialDecay, CurveDoubleExponentialDecay, translateCurveDoubleExponentialDecay),
+      OS_FT_TRANSLATOR(OS_Curve_Exponent, CurveExponent, translateCurveExponent),
+      OS_FT_TRANSLATOR(OS_Curve_ExponentialDecay, CurveExponentialDecay, translateCurveExponentialDecay),
+      OS_FT_TRANSLATOR(OS_Curve_ExponentialSkewNormal, CurveExponentialSkewNormal, translateCurveExponentialSkewNormal),
+      OS_FT_TRANSLATOR(OS_Curve_FanPressureRise, CurveFanPressureRise, translateCurveFanPressureRise),
+      OS_FT_TRANSLATOR(OS_Curve_Functional_PressureDrop, CurveFunctionalPressureDrop, translateCurveFunctionalPressureDrop),
+      OS_FT_TRANSLATOR(OS_Curve_Linear, CurveLinear, translateCurveLinear),
+      OS_FT_TRANSLATOR(OS_Curve_QuadLinear, CurveQuadLinear, translateCurveQuadLinear),
+      OS_FT_TRANSLATOR(OS_Curve_QuintLinear, CurveQuintLinear, translateCurveQuintLinear),
+      OS_FT_TRANSLATOR(OS_Curve_Quadratic, CurveQuadratic, translateCurveQuadratic),
+      OS_FT_TRANSLATOR(OS_Curve_QuadraticLinear, CurveQuadraticLinear, translateCurveQuadraticLinear),
+      OS_FT_TRANSLATOR(OS_Curve_Quartic, CurveQuartic, translateCurveQuartic),
+      OS_FT_TRANSLATOR(OS_Curve_RectangularHyperbola1, CurveRectangularHyperbola1, translateCurveRectangularHyperbola1),
+      OS_FT_TRANSLATOR(OS_Curve_RectangularHyperbola2, CurveRectangularHyperbola2, translateCurveRectangularHyperbola2),
+      OS_FT_TRANSLATOR(OS_Curve_Sigmoid, CurveSigmoid, translateCurveSigmoid),
+      OS_FT_TRANSLATOR(OS_Curve_Triquadratic, CurveTriquadratic, translateCurveTriquadratic),
+      OS_FT_TRANSLATOR(OS_SizingPeriod_DesignDay, DesignDay, translateDesignDay),
+      {openstudio::IddObjectType::OS_SizingPeriod_WeatherFileConditionType,
+       [](ForwardTranslator& /*ft*/, ModelObject& /*modelObject*/) -> boost::optional<IdfObject> {
+         LOG(Warn, "OS_SizingPeriod_WeatherFileConditionType is not currently translated");
+         return boost::none;
+       },
+       false},
+      {openstudio::IddObjectType::OS_SizingPeriod_WeatherFileDays,
+       [](ForwardTranslator& /*ft*/, ModelObject& /*modelObject*/) -> boost::optional<IdfObject> {
+         LOG(Warn, "OS_SizingPeriod_WeatherFileDays is not currently translated");
+         return boost::none;
+       },
+       false},
+      OS_FT_TRANSLATOR(OS_Sizing_Plant, SizingPlant, translateSizingPlant),
+      OS_FT_TRANSLATOR(OS_Sizing_System, SizingSystem, translateSizingSystem),
+      OS_FT_TRANSLATOR(OS_Sizing_Zone, SizingZone, translateSizingZone),
+      OS_FT_TRANSLATOR(OS_Daylighting_Control, DaylightingControl, translateDaylightingControl),
+      OS_FT_TRANSLATOR(OS_DaylightingDevice_Shelf, DaylightingDeviceShelf, translateDaylightingDeviceShelf),
+      OS_FT_TRANSLATOR(OS_DaylightingDevice_Tubular, DaylightingDeviceTubular, translateDaylightingDeviceTubular),
+      OS_FT_TRANSLATOR(OS_DaylightingDevice_LightWell, DaylightingDeviceLightWell, translateDaylightingDeviceLightWell),
+      // no-op
+      OS_FT_SKIP(OS_DefaultConstructionSet),
+      // no-op
+      OS_FT_SKIP(OS_DefaultScheduleSet),
+      // no-op
+      OS_FT_SKIP(OS_DefaultSurfaceConstructions),
+      // no-op
+      OS_FT_SKIP(OS_DefaultSubSurfaceConstructions),
+      OS_FT_TRANSLATOR(OS_DesignSpecification_OutdoorAir, DesignSpecificationOutdoorAir, translateDesignSpecificationOutdoorAir),
+      // DLM: appears to be translated in SizingZone
+      OS_FT_NOOP(OS_DesignSpecification_ZoneAirDistribution),
+      OS_FT_TRANSLATOR(OS_DistrictCooling, DistrictCooling, translateDistrictCooling),
+      OS_FT_TRANSLATOR(OS_DistrictHeating_Water, DistrictHeatingWater, translateDistrictHeatingWater),
+      OS_FT_TRANSLATOR(OS_DistrictHeating_Steam, DistrictHeatingSteam, translateDistrictHeatingSteam),
+      OS_FT_TRANSLATOR(OS_Duct, Duct, translateDuct),
+      OS_FT_TRANSLATOR(OS_ElectricEquipment, ElectricEquipment, translateElectricEquipment),
+      // no-op
+      OS_FT_NOOP(OS_ElectricEquipment_Definition),
+      OS_FT_TRANSLATOR(OS_ElectricEquipment_ITE_AirCooled, ElectricEquipmentITEAirCooled, translateElectricEquipmentITEAirCooled),
+      // no-op
+      OS_FT_NOOP(OS_ElectricEquipment_ITE_AirCooled_Definition),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Distribution, ElectricLoadCenterDistribution, translateElectricLoadCenterDistribution),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Inverter_LookUpTable, ElectricLoadCenterInverterLookUpTable,
+                       translateElectricLoadCenterInverterLookUpTable),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Inverter_Simple, ElectricLoadCenterInverterSimple, translateElectricLoadCenterInverterSimple),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Inverter_PVWatts, ElectricLoadCenterInverterPVWatts, translateElectricLoadCenterInverterPVWatts),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Storage_Simple, ElectricLoadCenterStorageSimple, translateElectricLoadCenterStorageSimple),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Storage_Converter, ElectricLoadCenterStorageConverter, translateElectricLoadCenterStorageConverter),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Storage_LiIonNMCBattery, ElectricLoadCenterStorageLiIonNMCBattery,
+                       translateElectricLoadCenterStorageLiIonNMCBattery),
+      OS_FT_TRANSLATOR(OS_ElectricLoadCenter_Transformer, ElectricLoadCenterTransformer, translateElectricLoadCenterTransformer),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_Actuator, EnergyManagementSystemActuator, translateEnergyManagementSystemActuator),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_ConstructionIndexVariable, EnergyManagementSystemConstructionIndexVariable,
+                       translateEnergyManagementSystemConstructionIndexVariable),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_CurveOrTableIndexVariable, EnergyManagementSystemCurveOrTableIndexVariable,
+                       translateEnergyManagementSystemCurveOrTableIndexVariable),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_GlobalVariable, EnergyManagementSystemGlobalVariable, translateEnergyManagementSystemGlobalVariable),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_InternalVariable, EnergyManagementSystemInternalVariable,
+                       translateEnergyManagementSystemInternalVariable),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_MeteredOutputVariable, EnergyManagementSystemMeteredOutputVariable,
+                       translateEnergyManagementSystemMeteredOutputVariable),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_OutputVariable, EnergyManagementSystemOutputVariable, translateEnergyManagementSystemOutputVariable),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_Program, EnergyManagementSystemProgram, translateEnergyManagementSystemProgram),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_ProgramCallingManager, EnergyManagementSystemProgramCallingManager,
+                       translateEnergyManagementSystemProgramCallingManager),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_Sensor, EnergyManagementSystemSensor, translateEnergyManagementSystemSensor),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_Subroutine, EnergyManagementSystemSubroutine, translateEnergyManagementSystemSubroutine),
+      OS_FT_TRANSLATOR(OS_EnergyManagementSystem_TrendVariable, EnergyManagementSystemTrendVariable, translateEnergyManagementSystemTrendVariable),
+      OS_FT_TRANSLATOR(OS_EvaporativeCooler_Direct_ResearchSpecial, EvaporativeCoolerDirectResearchSpecial,
+                       translateEvaporativeCoolerDirectResearchSpecial),
+      OS_FT_TRANSLATOR(OS_EvaporativeCooler_Indirect_ResearchSpecial, EvaporativeCoolerIndirectResearchSpecial,
+                       translateEvaporativeCoolerIndirectResearchSpecial),
+      OS_FT_TRANSLATOR(OS_EvaporativeFluidCooler_SingleSpeed, EvaporativeFluidCoolerSingleSpeed, translateEvaporativeFluidCoolerSingleSpeed),
+      OS_FT_TRANSLATOR(OS_EvaporativeFluidCooler_TwoSpeed, EvaporativeFluidCoolerTwoSpeed, translateEvaporativeFluidCoolerTwoSpeed),
+      OS_FT_TRANSLATOR(OS_Exterior_Lights, ExteriorLights, translateExteriorLights),
+      // no-op
+      OS_FT_NOOP(OS_Exterior_Lights_Definition),
+      OS_FT_TRANSLATOR(OS_Exterior_FuelEquipment, ExteriorFuelEquipment, translateExteriorFuelEquipment),
+      // no-op
+      OS_FT_NOOP(OS_Exterior_FuelEquipment_Definition),
+      OS_FT_TRANSLATOR(OS_Exterior_WaterEquipment, ExteriorWaterEquipment, translateExteriorWaterEquipment),
+      // no-op
+      OS_FT_NOOP(OS_Exterior_WaterEquipment_Definition),
+      OS_FT_TRANSLATOR(OS_ExternalInterface, ExternalInterface, translateExternalInterface),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_Actuator, ExternalInterfaceActuator, translateExternalInterfaceActuator),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitExport_From_Variable, ExternalInterfaceFunctionalMockupUnitExportFromVariable,
+                       translateExternalInterfaceFunctionalMockupUnitExportFromVariable),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitExport_To_Actuator, ExternalInterfaceFunctionalMockupUnitExportToActuator,
+                       translateExternalInterfaceFunctionalMockupUnitExportToActuator),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitExport_To_Schedule, ExternalInterfaceFunctionalMockupUnitExportToSchedule,
+                       translateExternalInterfaceFunctionalMockupUnitExportToSchedule),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitExport_To_Variable, ExternalInterfaceFunctionalMockupUnitExportToVariable,
+                       translateExternalInterfaceFunctionalMockupUnitExportToVariable),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitImport, ExternalInterfaceFunctionalMockupUnitImport,
+                       translateExternalInterfaceFunctionalMockupUnitImport),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitImport_From_Variable, ExternalInterfaceFunctionalMockupUnitImportFromVariable,
+                       translateExternalInterfaceFunctionalMockupUnitImportFromVariable),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitImport_To_Actuator, ExternalInterfaceFunctionalMockupUnitImportToActuator,
+                       translateExternalInterfaceFunctionalMockupUnitImportToActuator),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitImport_To_Schedule, ExternalInterfaceFunctionalMockupUnitImportToSchedule,
+                       translateExternalInterfaceFunctionalMockupUnitImportToSchedule),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_FunctionalMockupUnitImport_To_Variable, ExternalInterfaceFunctionalMockupUnitImportToVariable,
+                       translateExternalInterfaceFunctionalMockupUnitImportToVariable),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_Schedule, ExternalInterfaceSchedule, translateExternalInterfaceSchedule),
+      OS_FT_TRANSLATOR(OS_ExternalInterface_Variable, ExternalInterfaceVariable, translateExternalInterfaceVariable),
+      // no-op
+      OS_FT_SKIP(OS_Facility),
+      OS_FT_TRANSLATOR(OS_Fan_ComponentModel, FanComponentModel, translateFanComponentModel),
+      OS_FT_TRANSLATOR(OS_Fan_ConstantVolume, FanConstantVolume, translateFanConstantVolume),
+      OS_FT_TRANSLATOR(OS_Fan_OnOff, FanOnOff, translateFanOnOff),
+      OS_FT_TRANSLATOR(OS_Fan_SystemModel, FanSystemModel, translateFanSystemModel),
+      OS_FT_TRANSLATOR(OS_Fan_VariableVolume, FanVariableVolume, translateFanVariableVolume),
+      OS_FT_TRANSLATOR(OS_Fan_ZoneExhaust, FanZoneExhaust, translateFanZoneExhaust),
+      OS_FT_TRANSLATOR(OS_FluidCooler_SingleSpeed, FluidCoolerSingleSpeed, translateFluidCoolerSingleSpeed),
+      OS_FT_TRANSLATOR(OS_FluidCooler_TwoSpeed, FluidCoolerTwoSpeed, translateFluidCoolerTwoSpeed),
+      OS_FT_TRANSLATOR(OS_Foundation_Kiva, FoundationKiva, translateFoundationKiva),
+      OS_FT_TRANSLATOR(OS_Foundation_Kiva_Settings, FoundationKivaSettings, translateFoundationKivaSettings),
+      // Will also translate the Generator:MicroTurbine:HeatRecovery if there is one attached to the Generator:MicroTurbine
+      OS_FT_TRANSLATOR(OS_Generator_MicroTurbine, GeneratorMicroTurbine, translateGeneratorMicroTurbine),
+      // no-op, just Log a Trace message
+      // no-op, just Log a Trace message
+      {openstudio::IddObjectType::OS_Generator_MicroTurbine_HeatRecovery,
+       [](ForwardTranslator& /*ft*/, ModelObject& /*modelObject*/) -> boost::optional<IdfObject> {
+         LOG(Trace, "OS_Generator_MicroTurbine_HeatRecovery is not translated by itself but in the parent GeneratorMicroTurbine");
+         return boost::none;
+       },
+       true},
+      // Will also translate all children of Generator:FuelCell (Generator:FuelCell:AirSupply, etc)
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell, GeneratorFuelCell, translateGeneratorFuelCell),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_AirSupply, GeneratorFuelCellAirSupply, translateGeneratorFuelCellAirSupply),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_AuxiliaryHeater, GeneratorFuelCellAuxiliaryHeater, translateGeneratorFuelCellAuxiliaryHeater),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_ElectricalStorage, GeneratorFuelCellElectricalStorage, translateGeneratorFuelCellElectricalStorage),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger, GeneratorFuelCellExhaustGasToWaterHeatExchanger,
+                       translateGeneratorFuelCellExhaustGasToWaterHeatExchanger),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_Inverter, GeneratorFuelCellInverter, translateGeneratorFuelCellInverter),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_PowerModule, GeneratorFuelCellPowerModule, translateGeneratorFuelCellPowerModule),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_StackCooler, GeneratorFuelCellStackCooler, translateGeneratorFuelCellStackCooler),
+      OS_FT_TRANSLATOR(OS_Generator_FuelCell_WaterSupply, GeneratorFuelCellWaterSupply, translateGeneratorFuelCellWaterSupply),
+      OS_FT_TRANSLATOR(OS_Generator_FuelSupply, GeneratorFuelSupply, translateGeneratorFuelSupply),
+      // TODO: JM 2018-10-12 Placeholder for Generator:MicroCHP if/when it is implemented
+      // to remember that translateGeneratorMicroCHP should be calling translation of child GeneratorFuelSupply as needed
+      // OS_FT_TRANSLATOR(OS_Generator_MicroCHP, GeneratorMicroCHP, translateGeneratorMicroCHP),
+      OS_FT_TRANSLATOR(OS_Generator_Photovoltaic, GeneratorPhotovoltaic, translateGeneratorPhotovoltaic),
+      OS_FT_TRANSLATOR(OS_Generator_PVWatts, GeneratorPVWatts, translateGeneratorPVWatts),
+      OS_FT_TRANSLATOR(OS_Generator_WindTurbine, GeneratorWindTurbine, translateGeneratorWindTurbine),
+      // no-op
+      OS_FT_NOOP(OS_Glare_Sensor),
+      OS_FT_TRANSLATOR(OS_GroundHeatExchanger_HorizontalTrench, GroundHeatExchangerHorizontalTrench, translateGroundHeatExchangerHorizontalTrench),
+      OS_FT_TRANSLATOR(OS_GroundHeatExchanger_Vertical, GroundHeatExchangerVertical, translateGroundHeatExchangerVertical),
+      OS_FT_TRANSLATOR(OS_HeaderedPumps_ConstantSpeed, HeaderedPumpsConstantSpeed, translateHeaderedPumpsConstantSpeed),
+      OS_FT_TRANSLATOR(OS_HeaderedPumps_VariableSpeed, HeaderedPumpsVariableSpeed, translateHeaderedPumpsVariableSpeed),
+      OS_FT_TRANSLATOR(OS_HeatBalanceAlgorithm, HeatBalanceAlgorithm, translateHeatBalanceAlgorithm),
+      OS_FT_TRANSLATOR(OS_HeatExchanger_AirToAir_SensibleAndLatent, HeatExchangerAirToAirSensibleAndLatent,
+                       translateHeatExchangerAirToAirSensibleAndLatent),
+      OS_FT_TRANSLATOR(OS_HeatExchanger_Desiccant_BalancedFlow, HeatExchangerDesiccantBalancedFlow, translateHeatExchangerDesiccantBalancedFlow),
+      OS_FT_TRANSLATOR(OS_HeatExchanger_Desiccant_BalancedFlow_PerformanceDataType1, HeatExchangerDesiccantBalancedFlowPerformanceDataType1,
+                       translateHeatExchangerDesiccantBalancedFlowPerformanceDataType1),
+      OS_FT_TRANSLATOR(OS_HeatExchanger_FluidToFluid, HeatExchangerFluidToFluid, translateHeatExchangerFluidToFluid),
+      OS_FT_TRANSLATOR(OS_HeatPump_AirToWater_FuelFired_Heating, HeatPumpAirToWaterFuelFiredHeating, translateHeatPumpAirToWaterFuelFiredHeating),
+      OS_FT_TRANSLATOR(OS_HeatPump_AirToWater_FuelFired_Cooling, HeatPumpAirToWaterFuelFiredCooling, translateHeatPumpAirToWaterFuelFiredCooling),
+      OS_FT_TRANSLATOR(OS_HeatPump_WaterToWater_EquationFit_Cooling, HeatPumpWaterToWaterEquationFitCooling,
+                       translateHeatPumpWaterToWaterEquationFitCooling),
+      OS_FT_TRANSLATOR(OS_HeatPump_WaterToWater_EquationFit_Heating, HeatPumpWaterToWaterEquationFitHeating,
+                       translateHeatPumpWaterToWaterEquationFitHeating),
+      OS_FT_TRANSLATOR(OS_HeatPump_PlantLoop_EIR_Cooling, HeatPumpPlantLoopEIRCooling, translateHeatPumpPlantLoopEIRCooling),
+      OS_FT_TRANSLATOR(OS_HeatPump_PlantLoop_EIR_Heating, HeatPumpPlantLoopEIRHeating, translateHeatPumpPlantLoopEIRHeating),
+      OS_FT_TRANSLATOR(OS_HotWaterEquipment, HotWaterEquipment, translateHotWaterEquipment),
+      // no-op
+      OS_FT_NOOP(OS_HotWaterEquipment_Definition),
+      OS_FT_TRANSLATOR(OS_Humidifier_Steam_Electric, HumidifierSteamElectric, translateHumidifierSteamElectric),
+      OS_FT_TRANSLATOR(OS_Humidifier_Steam_Gas, HumidifierSteamGas, translateHumidifierSteamGas),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_Gas, Gas, translateGas),
+      OS_FT_TRANSLATOR(OS_GasEquipment, GasEquipment, translateGasEquipment),
+      // no-op
+      OS_FT_NOOP(OS_GasEquipment_Definition),
+      OS_FT_TRANSLATOR(OS_IlluminanceMap, IlluminanceMap, translateIlluminanceMap),
+      OS_FT_TRANSLATOR(OS_InteriorPartitionSurface, InteriorPartitionSurface, translateInteriorPartitionSurface),
+      OS_FT_TRANSLATOR(OS_InteriorPartitionSurfaceGroup, InteriorPartitionSurfaceGroup, translateInteriorPartitionSurfaceGroup),
+      OS_FT_TRANSLATOR(OS_InternalMass, InternalMass, translateInternalMass),
+      // no-op
+      OS_FT_NOOP(OS_InternalMass_Definition),
+      OS_FT_TRANSLATOR(OS_WaterHeater_Mixed, WaterHeaterMixed, translateWaterHeaterMixed),
+      OS_FT_TRANSLATOR(OS_WaterHeater_HeatPump, WaterHeaterHeatPump, translateWaterHeaterHeatPump),
+      OS_FT_TRANSLATOR(OS_WaterHeater_HeatPump_WrappedCondenser, WaterHeaterHeatPumpWrappedCondenser, translateWaterHeaterHeatPumpWrappedCondenser),
+      OS_FT_TRANSLATOR(OS_WaterHeater_Sizing, WaterHeaterSizing, translateWaterHeaterSizing),
+      OS_FT_TRANSLATOR(OS_WaterHeater_Stratified, WaterHeaterStratified, translateWaterHeaterStratified),
+      OS_FT_TRANSLATOR(OS_WaterUse_Connections, WaterUseConnections, translateWaterUseConnections),
+      OS_FT_TRANSLATOR(OS_WaterUse_Equipment, WaterUseEquipment, translateWaterUseEquipment),
+      // no-op
+      OS_FT_NOOP(OS_WaterUse_Equipment_Definition),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_GasMixture, GasMixture, translateGasMixture),
+      OS_FT_TRANSLATOR(OS_LoadProfile_Plant, LoadProfilePlant, translateLoadProfilePlant),
+      OS_FT_TRANSLATOR(OS_LifeCycleCost, LifeCycleCost, translateLifeCycleCost),
+      OS_FT_TRANSLATOR(OS_LifeCycleCost_Parameters, LifeCycleCostParameters, translateLifeCycleCostParameters),
+      // DLM: these objects can be created from LifeCycleCostParameters
+      // DLM: these objects can be created from LifeCycleCostParameters
+      {openstudio::IddObjectType::OS_LifeCycleCost_UsePriceEscalation,
+       [](ForwardTranslator& /*ft*/, ModelObject& modelObject) -> boost::optional<IdfObject> {
+         LOG(Warn, "OS:LifeCycleCost:UsePriceEscalation '" << modelObject.name().get() << "' not translated to EnergyPlus.");
+         return boost::none;
+       },
+       false},
+      // no-op
+      OS_FT_NOOP(OS_LightingDesignDay),
+      // no-op
+      OS_FT_NOOP(OS_LightingSimulationControl),
+      // no-op
+      OS_FT_NOOP(OS_LightingSimulationZone),
+      OS_FT_TRANSLATOR(OS_Lights, Lights, translateLights),
+      // no-op
+      OS_FT_NOOP(OS_Lights_Definition),
+      OS_FT_TRANSLATOR(OS_Luminaire, Luminaire, translateLuminaire),
+      // no-op
+      OS_FT_NOOP(OS_Luminaire_Definition),
+      OS_FT_TRANSLATOR(OS_Material, StandardOpaqueMaterial, translateStandardOpaqueMaterial),
+      OS_FT_TRANSLATOR(OS_Material_AirGap, AirGap, translateAirGap),
+      OS_FT_TRANSLATOR(OS_Material_InfraredTransparent, InfraredTransparentMaterial, translateInfraredTransparentMaterial),
+      OS_FT_TRANSLATOR(OS_Material_NoMass, MasslessOpaqueMaterial, translateMasslessOpaqueMaterial),
+      OS_FT_TRANSLATOR(OS_MaterialProperty_GlazingSpectralData, MaterialPropertyGlazingSpectralData, translateMaterialPropertyGlazingSpectralData),
+      OS_FT_TRANSLATOR(OS_MaterialProperty_MoisturePenetrationDepth_Settings, MaterialPropertyMoisturePenetrationDepthSettings,
+                       translateMaterialPropertyMoisturePenetrationDepthSettings),
+      OS_FT_TRANSLATOR(OS_MaterialProperty_PhaseChange, MaterialPropertyPhaseChange, translateMaterialPropertyPhaseChange),
+      OS_FT_TRANSLATOR(OS_MaterialProperty_PhaseChangeHysteresis, MaterialPropertyPhaseChangeHysteresis,
+                       translateMaterialPropertyPhaseChangeHysteresis),
+      OS_FT_TRANSLATOR(OS_Material_RoofVegetation, RoofVegetation, translateRoofVegetation),
+      OS_FT_TRANSLATOR(OS_Meter_Custom, MeterCustom, translateMeterCustom),
+      OS_FT_TRANSLATOR(OS_Meter_CustomDecrement, MeterCustomDecrement, translateMeterCustomDecrement),
+      // no-op
+      OS_FT_NOOP(OS_ModelObjectList),
+      OS_FT_TRANSLATOR(OS_Node, Node, translateNode),
+      OS_FT_TRANSLATOR(OS_OtherEquipment, OtherEquipment, translateOtherEquipment),
+      OS_FT_TRANSLATOR(OS_PhotovoltaicPerformance_EquivalentOneDiode, PhotovoltaicPerformanceEquivalentOneDiode,
+                       translatePhotovoltaicPerformanceEquivalentOneDiode),
+      OS_FT_TRANSLATOR(OS_PhotovoltaicPerformance_Sandia, PhotovoltaicPerformanceSandia, translatePhotovoltaicPerformanceSandia),
+      OS_FT_TRANSLATOR(OS_PhotovoltaicPerformance_Simple, PhotovoltaicPerformanceSimple, translatePhotovoltaicPerformanceSimple),
+      //no-op
+      OS_FT_NOOP(OS_OtherEquipment_Definition),
+      OS_FT_TRANSLATOR(OS_PlantLoop, PlantLoop, translatePlantLoop),
+      OS_FT_TRANSLATOR(OS_PlantComponent_TemperatureSource, PlantComponentTemperatureSource, translatePlantComponentTemperatureSource),
+      OS_FT_TRANSLATOR(OS_PlantComponent_UserDefined, PlantComponentUserDefined, translatePlantComponentUserDefined),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_CoolingLoad, PlantEquipmentOperationCoolingLoad, translatePlantEquipmentOperationCoolingLoad),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_HeatingLoad, PlantEquipmentOperationHeatingLoad, translatePlantEquipmentOperationHeatingLoad),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_OutdoorDryBulb, PlantEquipmentOperationOutdoorDryBulb,
+                       translatePlantEquipmentOperationOutdoorDryBulb),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_OutdoorWetBulb, PlantEquipmentOperationOutdoorWetBulb,
+                       translatePlantEquipmentOperationOutdoorWetBulb),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_OutdoorDewpoint, PlantEquipmentOperationOutdoorDewpoint,
+                       translatePlantEquipmentOperationOutdoorDewpoint),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_OutdoorDryBulbDifference, PlantEquipmentOperationOutdoorDryBulbDifference,
+                       translatePlantEquipmentOperationOutdoorDryBulbDifference),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_OutdoorWetBulbDifference, PlantEquipmentOperationOutdoorWetBulbDifference,
+                       translatePlantEquipmentOperationOutdoorWetBulbDifference),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_OutdoorDewpointDifference, PlantEquipmentOperationOutdoorDewpointDifference,
+                       translatePlantEquipmentOperationOutdoorDewpointDifference),
+      OS_FT_TRANSLATOR(OS_PlantEquipmentOperation_OutdoorRelativeHumidity, PlantEquipmentOperationOutdoorRelativeHumidity,
+                       translatePlantEquipmentOperationOutdoorRelativeHumidity),
+      OS_FT_TRANSLATOR(OS_Pump_ConstantSpeed, PumpConstantSpeed, translatePumpConstantSpeed),
+      OS_FT_TRANSLATOR(OS_Pump_VariableSpeed, PumpVariableSpeed, translatePumpVariableSpeed),
+      OS_FT_TRANSLATOR(OS_OutputControl_Files, OutputControlFiles, translateOutputControlFiles),
+      OS_FT_TRANSLATOR(OS_OutputControl_ReportingTolerances, OutputControlReportingTolerances, translateOutputControlReportingTolerances),
+      OS_FT_TRANSLATOR(OS_OutputControl_Table_Style, OutputControlTableStyle, translateOutputControlTableStyle),
+      OS_FT_TRANSLATOR(OS_OutputControl_Timestamp, OutputControlTimestamp, translateOutputControlTimestamp),
+      OS_FT_TRANSLATOR(OS_Output_DebuggingData, OutputDebuggingData, translateOutputDebuggingData),
+      OS_FT_TRANSLATOR(OS_Output_Diagnostics, OutputDiagnostics, translateOutputDiagnostics),
+      OS_FT_TRANSLATOR(OS_Output_JSON, OutputJSON, translateOutputJSON),
+      OS_FT_TRANSLATOR(OS_Output_SQLite, OutputSQLite, translateOutputSQLite),
+      OS_FT_TRANSLATOR(OS_Output_Schedules, OutputSchedules, translateOutputSchedules),
+      OS_FT_TRANSLATOR(OS_Output_Constructions, OutputConstructions, translateOutputConstructions),
+      OS_FT_TRANSLATOR(OS_Output_EnvironmentalImpactFactors, OutputEnvironmentalImpactFactors, translateOutputEnvironmentalImpactFactors),
+      OS_FT_TRANSLATOR(OS_EnvironmentalImpactFactors, EnvironmentalImpactFactors, translateEnvironmentalImpactFactors),
+      OS_FT_TRANSLATOR(OS_FuelFactors, FuelFactors, translateFuelFactors),
+      OS_FT_TRANSLATOR(OS_Output_Meter, OutputMeter, translateOutputMeter),
+      OS_FT_TRANSLATOR(OS_Output_Variable, OutputVariable, translateOutputVariable),
+      OS_FT_TRANSLATOR(OS_Output_EnergyManagementSystem, OutputEnergyManagementSystem, translateOutputEnergyManagementSystem),
+      OS_FT_TRANSLATOR(OS_Output_Table_SummaryReports, OutputTableSummaryReports, translateOutputTableSummaryReports),
+      OS_FT_TRANSLATOR(OS_People, People, translatePeople),
+      // no-op
+      OS_FT_NOOP(OS_People_Definition),
+      OS_FT_TRANSLATOR(OS_PerformancePrecisionTradeoffs, PerformancePrecisionTradeoffs, translatePerformancePrecisionTradeoffs),
+      OS_FT_TRANSLATOR(OS_Pipe_Adiabatic, PipeAdiabatic, translatePipeAdiabatic),
+      OS_FT_TRANSLATOR(OS_Pipe_Indoor, PipeIndoor, translatePipeIndoor),
+      OS_FT_TRANSLATOR(OS_Pipe_Outdoor, PipeOutdoor, translatePipeOutdoor),
+      OS_FT_TRANSLATOR(OS_PortList, PortList, translatePortList),
+      {openstudio::IddObjectType::OS_ProgramControl,
+       [](ForwardTranslator& /*ft*/, ModelObject& /*modelObject*/) -> boost::optional<IdfObject> {
+         LOG(Warn, "OS_ProgramControl is not currently translated");
+         return boost::none;
+       },
+       true},
+      OS_FT_TRANSLATOR(OS_PythonPlugin_Instance, PythonPluginInstance, translatePythonPluginInstance),
+      OS_FT_TRANSLATOR(OS_PythonPlugin_Variable, PythonPluginVariable, translatePythonPluginVariable),
+      OS_FT_TRANSLATOR(OS_PythonPlugin_TrendVariable, PythonPluginTrendVariable, translatePythonPluginTrendVariable),
+      OS_FT_TRANSLATOR(OS_PythonPlugin_OutputVariable, PythonPluginOutputVariable, translatePythonPluginOutputVariable),
+      OS_FT_TRANSLATOR(OS_PythonPlugin_SearchPaths, PythonPluginSearchPaths, translatePythonPluginSearchPaths),
+      // no-op
+      OS_FT_NOOP(OS_RadianceParameters),
+      OS_FT_TRANSLATOR(OS_Refrigeration_AirChiller, RefrigerationAirChiller, translateRefrigerationAirChiller),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Case, RefrigerationCase, translateRefrigerationCase),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Compressor, RefrigerationCompressor, translateRefrigerationCompressor),
+      OS_FT_TRANSLATOR(OS_Refrigeration_CompressorRack, RefrigerationCompressorRack, translateRefrigerationCompressorRack),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Condenser_AirCooled, RefrigerationCondenserAirCooled, translateRefrigerationCondenserAirCooled),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Condenser_Cascade, RefrigerationCondenserCascade, translateRefrigerationCondenserCascade),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Condenser_EvaporativeCooled, RefrigerationCondenserEvaporativeCooled,
+                       translateRefrigerationCondenserEvaporativeCooled),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Condenser_WaterCooled, RefrigerationCondenserWaterCooled, translateRefrigerationCondenserWaterCooled),
+      // DLM: is this a no-op?
+      OS_FT_NOOP(OS_Refrigeration_DefrostCycleParameters),
+      OS_FT_TRANSLATOR(OS_Refrigeration_GasCooler_AirCooled, RefrigerationGasCoolerAirCooled, translateRefrigerationGasCoolerAirCooled),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Subcooler_LiquidSuction, RefrigerationSubcoolerLiquidSuction, translateRefrigerationSubcoolerLiquidSuction),
+      OS_FT_TRANSLATOR(OS_Refrigeration_Subcooler_Mechanical, RefrigerationSubcoolerMechanical, translateRefrigerationSubcoolerMechanical),
+      OS_FT_TRANSLATOR(OS_Refrigeration_SecondarySystem, RefrigerationSecondarySystem, translateRefrigerationSecondarySystem),
+      OS_FT_TRANSLATOR(OS_Refrigeration_System, RefrigerationSystem, translateRefrigerationSystem),
+      OS_FT_TRANSLATOR(OS_Refrigeration_TranscriticalSystem, RefrigerationTranscriticalSystem, translateRefrigerationTranscriticalSystem),
+      OS_FT_TRANSLATOR(OS_Refrigeration_WalkIn, RefrigerationWalkIn, translateRefrigerationWalkIn),
+      // DLM: is this a no-op
+      OS_FT_NOOP(OS_Refrigeration_WalkIn_ZoneBoundary),
+      // no-op
+      OS_FT_SKIP(OS_Rendering_Color),
+      OS_FT_TRANSLATOR(OS_RunPeriod, RunPeriod, translateRunPeriod),
+      OS_FT_TRANSLATOR(OS_RunPeriodControl_DaylightSavingTime, RunPeriodControlDaylightSavingTime, translateRunPeriodControlDaylightSavingTime),
+      OS_FT_TRANSLATOR(OS_RunPeriodControl_SpecialDays, RunPeriodControlSpecialDays, translateRunPeriodControlSpecialDays),
+      OS_FT_TRANSLATOR(OS_Schedule_Compact, ScheduleCompact, translateScheduleCompact),
+      OS_FT_TRANSLATOR(OS_Schedule_Constant, ScheduleConstant, translateScheduleConstant),
+      OS_FT_TRANSLATOR(OS_Schedule_Day, ScheduleDay, translateScheduleDay),
+      OS_FT_TRANSLATOR(OS_Schedule_FixedInterval, ScheduleFixedInterval, translateScheduleFixedInterval),
+      OS_FT_TRANSLATOR(OS_Schedule_File, ScheduleFile, translateScheduleFile),
+      // no-op
+      OS_FT_NOOP(OS_Schedule_Rule),
+      OS_FT_TRANSLATOR(OS_Schedule_Ruleset, ScheduleRuleset, translateScheduleRuleset),
+      OS_FT_TRANSLATOR(OS_ScheduleTypeLimits, ScheduleTypeLimits, translateScheduleTypeLimits),
+      OS_FT_TRANSLATOR(OS_Schedule_Week, ScheduleWeek, translateScheduleWeek),
+      OS_FT_TRANSLATOR(OS_Schedule_Year, ScheduleYear, translateScheduleYear),
+      OS_FT_TRANSLATOR(OS_Schedule_VariableInterval, ScheduleVariableInterval, translateScheduleVariableInterval),
+      OS_FT_TRANSLATOR(OS_SetpointManager_Coldest, SetpointManagerColdest, translateSetpointManagerColdest),
+      OS_FT_TRANSLATOR(OS_SetpointManager_FollowGroundTemperature, SetpointManagerFollowGroundTemperature,
+                       translateSetpointManagerFollowGroundTemperature),
+      OS_FT_TRANSLATOR(OS_SetpointManager_FollowOutdoorAirTemperature, SetpointManagerFollowOutdoorAirTemperature,
+                       translateSetpointManagerFollowOutdoorAirTemperature),
+      OS_FT_TRANSLATOR(OS_SetpointManager_FollowSystemNodeTemperature, SetpointManagerFollowSystemNodeTemperature,
+                       translateSetpointManagerFollowSystemNodeTemperature),
+      OS_FT_TRANSLATOR(OS_SetpointManager_MixedAir, SetpointManagerMixedAir, translateSetpointManagerMixedAir),
+      OS_FT_TRANSLATOR(OS_SetpointManager_MultiZone_Cooling_Average, SetpointManagerMultiZoneCoolingAverage,
+                       translateSetpointManagerMultiZoneCoolingAverage),
+      OS_FT_TRANSLATOR(OS_SetpointManager_MultiZone_Heating_Average, SetpointManagerMultiZoneHeatingAverage,
+                       translateSetpointManagerMultiZoneHeatingAverage),
+      OS_FT_TRANSLATOR(OS_SetpointManager_MultiZone_Humidity_Maximum, SetpointManagerMultiZoneHumidityMaximum,
+                       translateSetpointManagerMultiZoneHumidityMaximum),
+      OS_FT_TRANSLATOR(OS_SetpointManager_MultiZone_Humidity_Minimum, SetpointManagerMultiZoneHumidityMinimum,
+                       translateSetpointManagerMultiZoneHumidityMinimum),
+      OS_FT_TRANSLATOR(OS_SetpointManager_MultiZone_MaximumHumidity_Average, SetpointManagerMultiZoneMaximumHumidityAverage,
+                       translateSetpointManagerMultiZoneMaximumHumidityAverage),
+      OS_FT_TRANSLATOR(OS_SetpointManager_MultiZone_MinimumHumidity_Average, SetpointManagerMultiZoneMinimumHumidityAverage,
+                       translateSetpointManagerMultiZoneMinimumHumidityAverage),
+      OS_FT_TRANSLATOR(OS_SetpointManager_OutdoorAirPretreat, SetpointManagerOutdoorAirPretreat, translateSetpointManagerOutdoorAirPretreat),
+      OS_FT_TRANSLATOR(OS_SetpointManager_OutdoorAirReset, SetpointManagerOutdoorAirReset, translateSetpointManagerOutdoorAirReset),
+      OS_FT_TRANSLATOR(OS_SetpointManager_Scheduled, SetpointManagerScheduled, translateSetpointManagerScheduled),
+      OS_FT_TRANSLATOR(OS_SetpointManager_Scheduled_DualSetpoint, SetpointManagerScheduledDualSetpoint,
+                       translateSetpointManagerScheduledDualSetpoint),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SingleZone_Cooling, SetpointManagerSingleZoneCooling, translateSetpointManagerSingleZoneCooling),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SingleZone_Heating, SetpointManagerSingleZoneHeating, translateSetpointManagerSingleZoneHeating),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SingleZone_Humidity_Maximum, SetpointManagerSingleZoneHumidityMaximum,
+                       translateSetpointManagerSingleZoneHumidityMaximum),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SingleZone_Humidity_Minimum, SetpointManagerSingleZoneHumidityMinimum,
+                       translateSetpointManagerSingleZoneHumidityMinimum),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SingleZone_OneStageCooling, SetpointManagerSingleZoneOneStageCooling,
+                       translateSetpointManagerSingleZoneOneStageCooling),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SingleZone_OneStageHeating, SetpointManagerSingleZoneOneStageHeating,
+                       translateSetpointManagerSingleZoneOneStageHeating),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SingleZone_Reheat, SetpointManagerSingleZoneReheat, translateSetpointManagerSingleZoneReheat),
+      OS_FT_TRANSLATOR(OS_SetpointManager_Warmest, SetpointManagerWarmest, translateSetpointManagerWarmest),
+      OS_FT_TRANSLATOR(OS_SetpointManager_WarmestTemperatureFlow, SetpointManagerWarmestTemperatureFlow,
+                       translateSetpointManagerWarmestTemperatureFlow),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SystemNodeReset_Humidity, SetpointManagerSystemNodeResetHumidity,
+                       translateSetpointManagerSystemNodeResetHumidity),
+      OS_FT_TRANSLATOR(OS_SetpointManager_SystemNodeReset_Temperature, SetpointManagerSystemNodeResetTemperature,
+                       translateSetpointManagerSystemNodeResetTemperature),
+      OS_FT_TRANSLATOR(OS_ShadingControl, ShadingControl, translateShadingControl),
+      OS_FT_TRANSLATOR(OS_ShadingSurface, ShadingSurface, translateShadingSurface),
+      OS_FT_TRANSLATOR(OS_ShadingSurfaceGroup, ShadingSurfaceGroup, translateShadingSurfaceGroup),
+      OS_FT_TRANSLATOR(OS_ShadowCalculation, ShadowCalculation, translateShadowCalculation),
+      OS_FT_TRANSLATOR(OS_SimulationControl, SimulationControl, translateSimulationControl),
+      OS_FT_TRANSLATOR(OS_Space, Space, translateSpace),
+      OS_FT_TRANSLATOR(OS_SpaceInfiltration_DesignFlowRate, SpaceInfiltrationDesignFlowRate, translateSpaceInfiltrationDesignFlowRate),
+      OS_FT_TRANSLATOR(OS_SpaceInfiltration_EffectiveLeakageArea, SpaceInfiltrationEffectiveLeakageArea,
+                       translateSpaceInfiltrationEffectiveLeakageArea),
+      OS_FT_TRANSLATOR(OS_SpaceInfiltration_FlowCoefficient, SpaceInfiltrationFlowCoefficient, translateSpaceInfiltrationFlowCoefficient),
+      OS_FT_TRANSLATOR(OS_SpaceType, SpaceType, translateSpaceType),
+      OS_FT_TRANSLATOR(OS_Site, Site, translateSite),
+      OS_FT_TRANSLATOR(OS_Site_GroundReflectance, SiteGroundReflectance, translateSiteGroundReflectance),
+      OS_FT_TRANSLATOR(OS_Site_GroundTemperature_BuildingSurface, SiteGroundTemperatureBuildingSurface,
+                       translateSiteGroundTemperatureBuildingSurface),
+      OS_FT_TRANSLATOR(OS_Site_GroundTemperature_Deep, SiteGroundTemperatureDeep, translateSiteGroundTemperatureDeep),
+      OS_FT_TRANSLATOR(OS_Site_GroundTemperature_FCfactorMethod, SiteGroundTemperatureFCfactorMethod, translateSiteGroundTemperatureFCfactorMethod),
+      OS_FT_TRANSLATOR(OS_Site_GroundTemperature_Shallow, SiteGroundTemperatureShallow, translateSiteGroundTemperatureShallow),
+      OS_FT_TRANSLATOR(OS_Site_GroundTemperature_Undisturbed_KusudaAchenbach, SiteGroundTemperatureUndisturbedKusudaAchenbach,
+                       translateSiteGroundTemperatureUndisturbedKusudaAchenbach),
+      OS_FT_TRANSLATOR(OS_Site_GroundTemperature_Undisturbed_Xing, SiteGroundTemperatureUndisturbedXing,
+                       translateSiteGroundTemperatureUndisturbedXing),
+      OS_FT_TRANSLATOR(OS_Site_WaterMainsTemperature, SiteWaterMainsTemperature, translateSiteWaterMainsTemperature),
+      OS_FT_TRANSLATOR(OS_Sizing_Parameters, SizingParameters, translateSizingParameters),
+      OS_FT_TRANSLATOR(OS_SolarCollector_FlatPlate_PhotovoltaicThermal, SolarCollectorFlatPlatePhotovoltaicThermal,
+                       translateSolarCollectorFlatPlatePhotovoltaicThermal),
+      OS_FT_TRANSLATOR(OS_SolarCollector_FlatPlate_Water, SolarCollectorFlatPlateWater, translateSolarCollectorFlatPlateWater),
+      OS_FT_TRANSLATOR(OS_SolarCollector_IntegralCollectorStorage, SolarCollectorIntegralCollectorStorage,
+                       translateSolarCollectorIntegralCollectorStorage),
+      OS_FT_TRANSLATOR(OS_SolarCollectorPerformance_FlatPlate, SolarCollectorPerformanceFlatPlate, translateSolarCollectorPerformanceFlatPlate),
+      OS_FT_TRANSLATOR(OS_SolarCollectorPerformance_IntegralCollectorStorage, SolarCollectorPerformanceIntegralCollectorStorage,
+                       translateSolarCollectorPerformanceIntegralCollectorStorage),
+      OS_FT_TRANSLATOR(OS_SolarCollectorPerformance_PhotovoltaicThermal_BIPVT, SolarCollectorPerformancePhotovoltaicThermalBIPVT,
+                       translateSolarCollectorPerformancePhotovoltaicThermalBIPVT),
+      OS_FT_TRANSLATOR(OS_SolarCollectorPerformance_PhotovoltaicThermal_Simple, SolarCollectorPerformancePhotovoltaicThermalSimple,
+                       translateSolarCollectorPerformancePhotovoltaicThermalSimple),
+      // no-op
+      OS_FT_SKIP(OS_StandardsInformation_Construction),
+      // no-op
+      OS_FT_SKIP(OS_StandardsInformation_Material),
+      OS_FT_TRANSLATOR(OS_SteamEquipment, SteamEquipment, translateSteamEquipment),
+      // no-op
+      OS_FT_NOOP(OS_SteamEquipment_Definition),
+      OS_FT_TRANSLATOR(OS_Surface, Surface, translateSurface),
+      OS_FT_TRANSLATOR(OS_SurfaceConvectionAlgorithm_Inside, InsideSurfaceConvectionAlgorithm, translateInsideSurfaceConvectionAlgorithm),
+      OS_FT_TRANSLATOR(OS_SurfaceConvectionAlgorithm_Outside, OutsideSurfaceConvectionAlgorithm, translateOutsideSurfaceConvectionAlgorithm),
+      OS_FT_TRANSLATOR(OS_SurfaceControl_MovableInsulation, SurfaceControlMovableInsulation, translateSurfaceControlMovableInsulation),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_ConvectionCoefficients, SurfacePropertyConvectionCoefficients,
+                       translateSurfacePropertyConvectionCoefficients),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_ConvectionCoefficients_MultipleSurface, SurfacePropertyConvectionCoefficientsMultipleSurface,
+                       translateSurfacePropertyConvectionCoefficientsMultipleSurface),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_LocalEnvironment, SurfacePropertyLocalEnvironment, translateSurfacePropertyLocalEnvironment),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_ExposedFoundationPerimeter, SurfacePropertyExposedFoundationPerimeter,
+                       translateSurfacePropertyExposedFoundationPerimeter),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_OtherSideCoefficients, SurfacePropertyOtherSideCoefficients, translateSurfacePropertyOtherSideCoefficients),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_OtherSideConditionsModel, SurfacePropertyOtherSideConditionsModel,
+                       translateSurfacePropertyOtherSideConditionsModel),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_SurroundingSurfaces, SurfacePropertySurroundingSurfaces, translateSurfacePropertySurroundingSurfaces),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_GroundSurfaces, SurfacePropertyGroundSurfaces, translateSurfacePropertyGroundSurfaces),
+      OS_FT_TRANSLATOR(OS_SurfaceProperty_IncidentSolarMultiplier, SurfacePropertyIncidentSolarMultiplier,
+                       translateSurfacePropertyIncidentSolarMultiplier),
+      OS_FT_TRANSLATOR(OS_SubSurface, SubSurface, translateSubSurface),
+      OS_FT_TRANSLATOR(OS_SwimmingPool_Indoor, SwimmingPoolIndoor, translateSwimmingPoolIndoor),
+      OS_FT_TRANSLATOR(OS_Table_MultiVariableLookup, TableMultiVariableLookup, translateTableMultiVariableLookup),
+      OS_FT_TRANSLATOR(OS_Table_Lookup, TableLookup, translateTableLookup),
+      OS_FT_TRANSLATOR(OS_Table_IndependentVariable, TableIndependentVariable, translateTableIndependentVariable),
+      OS_FT_TRANSLATOR(OS_TemperingValve, TemperingValve, translateTemperingValve),
+      OS_FT_TRANSLATOR(OS_ThermalZone, ThermalZone, translateThermalZone),
+      OS_FT_TRANSLATOR(OS_ThermalStorage_Ice_Detailed, ThermalStorageIceDetailed, translateThermalStorageIceDetailed),
+      OS_FT_TRANSLATOR(OS_ThermalStorage_ChilledWater_Stratified, ThermalStorageChilledWaterStratified,
+                       translateThermalStorageChilledWaterStratified),
+      OS_FT_TRANSLATOR(OS_ThermostatSetpoint_DualSetpoint, ThermostatSetpointDualSetpoint, translateThermostatSetpointDualSetpoint),
+      OS_FT_TRANSLATOR(OS_Timestep, Timestep, translateTimestep),
+      OS_FT_TRANSLATOR(OS_UnitarySystemPerformance_Multispeed, UnitarySystemPerformanceMultispeed, translateUnitarySystemPerformanceMultispeed),
+      // no-op
+      OS_FT_NOOP(OS_UtilityBill),
+      // TODO: once UtilityCost objects are wrapped, they should not be translated (with a warning):
+      // OS_UtilityCost_Charge_Block
+      // OS_UtilityCost_Charge_Simple
+      // OS_UtilityCost_Computation
+      // OS_UtilityCost_Qualify
+      // OS_UtilityCost_Ratchet
+      // OS_UtilityCost_Tariff
+      // OS_UtilityCost_Variable
+      OS_FT_TRANSLATOR(OS_Version, Version, translateVersion),
+      // no-op
+      OS_FT_SKIP(OS_WeatherFile),
+      OS_FT_TRANSLATOR(OS_WeatherProperty_SkyTemperature, SkyTemperature, translateSkyTemperature),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_Blind, Blind, translateBlind),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_DaylightRedirectionDevice, DaylightRedirectionDevice, translateDaylightRedirectionDevice),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_Glazing_RefractionExtinctionMethod, RefractionExtinctionGlazing, translateRefractionExtinctionGlazing),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_Screen, Screen, translateScreen),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_Shade, Shade, translateShade),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_SimpleGlazingSystem, SimpleGlazing, translateSimpleGlazing),
+      OS_FT_TRANSLATOR(OS_WindowMaterial_Glazing, StandardGlazing, translateStandardGlazing),
+      {openstudio::IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic,
+       [](ForwardTranslator& /*ft*/, ModelObject& /*modelObject*/) -> boost::optional<IdfObject> {
+         LOG(Warn, "OS_WindowMaterial_GlazingGroup_Thermochromic is not currently translated");
+         return boost::none;
+       },
+       true},
+      OS_FT_TRANSLATOR(OS_WindowProperty_FrameAndDivider, WindowPropertyFrameAndDivider, translateWindowPropertyFrameAndDivider),
+      // no-op
+      OS_FT_SKIP(OS_YearDescription),
+      OS_FT_TRANSLATOR(OS_ZoneAirContaminantBalance, ZoneAirContaminantBalance, translateZoneAirContaminantBalance),
+      OS_FT_TRANSLATOR(OS_ZoneAirHeatBalanceAlgorithm, ZoneAirHeatBalanceAlgorithm, translateZoneAirHeatBalanceAlgorithm),
+      OS_FT_TRANSLATOR(OS_ZoneAirMassFlowConservation, ZoneAirMassFlowConservation, translateZoneAirMassFlowConservation),
+      OS_FT_TRANSLATOR(OS_ZoneCapacitanceMultiplier_ResearchSpecial, ZoneCapacitanceMultiplierResearchSpecial,
+                       translateZoneCapacitanceMultiplierResearchSpecial),
+      OS_FT_TRANSLATOR(OS_ZoneControl_ContaminantController, ZoneControlContaminantController, translateZoneControlContaminantController),
+      OS_FT_TRANSLATOR(OS_ZoneControl_Humidistat, ZoneControlHumidistat, translateZoneControlHumidistat),
+      OS_FT_TRANSLATOR(OS_ZoneControl_Thermostat_StagedDualSetpoint, ZoneControlThermostatStagedDualSetpoint,
+                       translateZoneControlThermostatStagedDualSetpoint),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_Baseboard_Convective_Electric, ZoneHVACBaseboardConvectiveElectric, translateZoneHVACBaseboardConvectiveElectric),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_Baseboard_Convective_Water, ZoneHVACBaseboardConvectiveWater, translateZoneHVACBaseboardConvectiveWater),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_Baseboard_RadiantConvective_Electric, ZoneHVACBaseboardRadiantConvectiveElectric,
+                       translateZoneHVACBaseboardRadiantConvectiveElectric),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_Baseboard_RadiantConvective_Water, ZoneHVACBaseboardRadiantConvectiveWater,
+                       translateZoneHVACBaseboardRadiantConvectiveWater),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water, ZoneHVACCoolingPanelRadiantConvectiveWater,
+                       translateZoneHVACCoolingPanelRadiantConvectiveWater),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_Dehumidifier_DX, ZoneHVACDehumidifierDX, translateZoneHVACDehumidifierDX),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_EnergyRecoveryVentilator, ZoneHVACEnergyRecoveryVentilator, translateZoneHVACEnergyRecoveryVentilator),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_EnergyRecoveryVentilator_Controller, ZoneHVACEnergyRecoveryVentilatorController,
+                       translateZoneHVACEnergyRecoveryVentilatorController),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_EquipmentList, ZoneHVACEquipmentList, translateZoneHVACEquipmentList),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_FourPipeFanCoil, ZoneHVACFourPipeFanCoil, translateZoneHVACFourPipeFanCoil),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_HighTemperatureRadiant, ZoneHVACHighTemperatureRadiant, translateZoneHVACHighTemperatureRadiant),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_IdealLoadsAirSystem, ZoneHVACIdealLoadsAirSystem, translateZoneHVACIdealLoadsAirSystem),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_LowTemperatureRadiant_Electric, ZoneHVACLowTemperatureRadiantElectric,
+                       translateZoneHVACLowTemperatureRadiantElectric),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow, ZoneHVACLowTempRadiantConstFlow, translateZoneHVACLowTempRadiantConstFlow),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow, ZoneHVACLowTempRadiantVarFlow, translateZoneHVACLowTempRadiantVarFlow),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_PackagedTerminalHeatPump, ZoneHVACPackagedTerminalHeatPump, translateZoneHVACPackagedTerminalHeatPump),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_PackagedTerminalAirConditioner, ZoneHVACPackagedTerminalAirConditioner,
+                       translateZoneHVACPackagedTerminalAirConditioner),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow, ZoneHVACTerminalUnitVariableRefrigerantFlow,
+                       translateZoneHVACTerminalUnitVariableRefrigerantFlow),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_UnitHeater, ZoneHVACUnitHeater, translateZoneHVACUnitHeater),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_UnitVentilator, ZoneHVACUnitVentilator, translateZoneHVACUnitVentilator),
+      OS_FT_TRANSLATOR(OS_ZoneHVAC_WaterToAirHeatPump, ZoneHVACWaterToAirHeatPump, translateZoneHVACWaterToAirHeatPump),
+      OS_FT_TRANSLATOR(OS_ZoneMixing, ZoneMixing, translateZoneMixing),
+      OS_FT_TRANSLATOR(OS_ZoneProperty_UserViewFactors_BySurfaceName, ZonePropertyUserViewFactorsBySurfaceName,
+                       translateZonePropertyUserViewFactorsBySurfaceName),
+      OS_FT_TRANSLATOR(OS_ZoneVentilation_DesignFlowRate, ZoneVentilationDesignFlowRate, translateZoneVentilationDesignFlowRate),
+      OS_FT_TRANSLATOR(OS_ZoneVentilation_WindandStackOpenArea, ZoneVentilationWindandStackOpenArea, translateZoneVentilationWindandStackOpenArea),
+    };
+    return translators;
+  }
+  // NOLINTEND(readability-function-size)
 #if defined(_MSC_VER)
 #  pragma warning(pop)
 #elif (defined(__GNUC__))
 #  pragma GCC diagnostic pop
 #endif
 
-      case openstudio::IddObjectType::OS_Table_Lookup: {
-        auto table = modelObject.cast<TableLookup>();
-        retVal = translateTableLookup(table);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Table_IndependentVariable: {
-        auto tableIndependentVariable = modelObject.cast<TableIndependentVariable>();
-        retVal = translateTableIndependentVariable(tableIndependentVariable);
-        break;
-      }
-      case openstudio::IddObjectType::OS_TemperingValve: {
-        auto mo = modelObject.cast<TemperingValve>();
-        retVal = translateTemperingValve(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ThermalZone: {
-        auto zone = modelObject.cast<ThermalZone>();
-        retVal = translateThermalZone(zone);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ThermalStorage_Ice_Detailed: {
-        auto mo = modelObject.cast<ThermalStorageIceDetailed>();
-        retVal = translateThermalStorageIceDetailed(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ThermalStorage_ChilledWater_Stratified: {
-        auto mo = modelObject.cast<ThermalStorageChilledWaterStratified>();
-        retVal = translateThermalStorageChilledWaterStratified(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ThermostatSetpoint_DualSetpoint: {
-        auto thermostat = modelObject.cast<ThermostatSetpointDualSetpoint>();
-        retVal = translateThermostatSetpointDualSetpoint(thermostat);
-        break;
-      }
-      case openstudio::IddObjectType::OS_Timestep: {
-        auto timestep = modelObject.cast<Timestep>();
-        retVal = translateTimestep(timestep);
-        break;
-      }
-      case openstudio::IddObjectType::OS_UnitarySystemPerformance_Multispeed: {
-        auto sysPerfMultispeed = modelObject.cast<UnitarySystemPerformanceMultispeed>();
-        retVal = translateUnitarySystemPerformanceMultispeed(sysPerfMultispeed);
-        break;
-      }
-      case openstudio::IddObjectType::OS_UtilityBill: {
-        // no-op
-        break;
-      }
+#undef OS_FT_TRANSLATOR
+#undef OS_FT_UNITARY_TRANSLATOR
+#undef OS_FT_NOOP
+#undef OS_FT_SKIP
+
+  const ForwardTranslator::ModelObjectTranslator* ForwardTranslator::findModelObjectTranslator(const IddObjectType& iddObjectType) {
+    // IddObjectType values are contiguous, so a vector indexed by value is a perfect hash of the registry
+    static const std::vector<const ModelObjectTranslator*> lookup = [] {
+      const auto& values = IddObjectType::getValues();
+      std::vector<const ModelObjectTranslator*> result(values.empty() ? 0 : *values.rbegin() + 1, nullptr);
+      for (const auto& translator : modelObjectTranslators()) {
+        OS_ASSERT(translator.iddObjectType >= 0 && static_cast<size_t>(translator.iddObjectType) < result.size());
+        OS_ASSERT(!result[translator.iddObjectType]);
+        result[translator.iddObjectType] = &translator;
+      }
+      return result;
+    }();
+
+    const int value = iddObjectType.value();
+    if (value < 0 || static_cast<size_t>(value) >= lookup.size()) {
+      return nullptr;
+    }
+    return lookup[value];
+  }
 
-        // TODO: once UtilityCost objects are wrapped
-        //case openstudio::IddObjectType::OS_UtilityCost_Charge_Block:
-        //{
-        //LOG(Warn, "OS_UtilityCost_Charge_Block is not currently translated");
-        //break;
-        //}
-        //case openstudio::IddObjectType::OS_UtilityCost_Charge_Simple:
-        //{
-        //LOG(Warn, "OS_UtilityCost_Charge_Simple is not currently translated");
-        //break;
-        //}
-        //case openstudio::IddObjectType::OS_UtilityCost_Computation:
-        //{
-        //LOG(Warn, "OS_UtilityCost_Computation is not currently translated");
-        //break;
-        //}
-        //case openstudio::IddObjectType::OS_UtilityCost_Qualify:
-        //{
-        //LOG(Warn, "OS_UtilityCost_Qualify is not currently translated");
-        //break;
-        //}
-        //case openstudio::IddObjectType::OS_UtilityCost_Ratchet:
-        //{
-        //LOG(Warn, "OS_UtilityCost_Ratchet is not currently translated");
-        //break;
-        //}
-        //case openstudio::IddObjectType::OS_UtilityCost_Tariff:
-        //{
-        //LOG(Warn, "OS_UtilityCost_Tariff is not currently translated");
-        //break;
-        //}
-        //case openstudio::IddObjectType::OS_UtilityCost_Variable:
-        //{
-        //LOG(Warn, "OS_UtilityCost_Variable is not currently translated");
-        //break;
-        //}
-
-      case openstudio::IddObjectType::OS_Version: {
-        auto version = modelObject.cast<Version>();
-        retVal = translateVersion(version);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WeatherFile: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_WeatherProperty_SkyTemperature: {
-        auto mo = modelObject.cast<SkyTemperature>();
-        retVal = translateSkyTemperature(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_Blind: {
-        auto blind = modelObject.cast<Blind>();
-        retVal = translateBlind(blind);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice: {
-        auto drd = modelObject.cast<DaylightRedirectionDevice>();
-        retVal = translateDaylightRedirectionDevice(drd);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod: {
-        auto mo = modelObject.cast<RefractionExtinctionGlazing>();
-        retVal = translateRefractionExtinctionGlazing(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_Screen: {
-        auto mo = modelObject.cast<Screen>();
-        retVal = translateScreen(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_Shade: {
-        auto shade = modelObject.cast<Shade>();
-        retVal = translateShade(shade);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_SimpleGlazingSystem: {
-        auto glazing = modelObject.cast<SimpleGlazing>();
-        retVal = translateSimpleGlazing(glazing);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_Glazing: {
-        auto glazing = modelObject.cast<StandardGlazing>();
-        retVal = translateStandardGlazing(glazing);
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic: {
-        LOG(Warn, "OS_WindowMaterial_GlazingGroup_Thermochromic is not currently translated");
-        break;
-      }
-      case openstudio::IddObjectType::OS_WindowProperty_FrameAndDivider: {
-        auto frameAndDivider = modelObject.cast<WindowPropertyFrameAndDivider>();
-        retVal = translateWindowPropertyFrameAndDivider(frameAndDivider);
-        break;
-      }
-      case openstudio::IddObjectType::OS_YearDescription: {
-        // no-op
-        return retVal;
-      }
-      case openstudio::IddObjectType::OS_ZoneAirContaminantBalance: {
-        auto mo = modelObject.cast<ZoneAirContaminantBalance>();
-        retVal = translateZoneAirContaminantBalance(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneAirHeatBalanceAlgorithm: {
-        auto mo = modelObject.cast<ZoneAirHeatBalanceAlgorithm>();
-        retVal = translateZoneAirHeatBalanceAlgorithm(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneAirMassFlowConservation: {
-        auto mo = modelObject.cast<ZoneAirMassFlowConservation>();
-        retVal = translateZoneAirMassFlowConservation(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneCapacitanceMultiplier_ResearchSpecial: {
-        auto mo = modelObject.cast<ZoneCapacitanceMultiplierResearchSpecial>();
-        retVal = translateZoneCapacitanceMultiplierResearchSpecial(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneControl_ContaminantController: {
-        auto mo = modelObject.cast<ZoneControlContaminantController>();
-        retVal = translateZoneControlContaminantController(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneControl_Humidistat: {
-        auto mo = modelObject.cast<ZoneControlHumidistat>();
-        retVal = translateZoneControlHumidistat(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneControl_Thermostat_StagedDualSetpoint: {
-        auto mo = modelObject.cast<ZoneControlThermostatStagedDualSetpoint>();
-        retVal = translateZoneControlThermostatStagedDualSetpoint(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Electric: {
-        auto mo = modelObject.cast<ZoneHVACBaseboardConvectiveElectric>();
-        retVal = translateZoneHVACBaseboardConvectiveElectric(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Water: {
-        auto mo = modelObject.cast<ZoneHVACBaseboardConvectiveWater>();
-        retVal = translateZoneHVACBaseboardConvectiveWater(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Electric: {
-        auto mo = modelObject.cast<ZoneHVACBaseboardRadiantConvectiveElectric>();
-        retVal = translateZoneHVACBaseboardRadiantConvectiveElectric(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Water: {
-        auto mo = modelObject.cast<ZoneHVACBaseboardRadiantConvectiveWater>();
-        retVal = translateZoneHVACBaseboardRadiantConvectiveWater(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water: {
-        auto mo = modelObject.cast<ZoneHVACCoolingPanelRadiantConvectiveWater>();
-        retVal = translateZoneHVACCoolingPanelRadiantConvectiveWater(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_Dehumidifier_DX: {
-        auto mo = modelObject.cast<ZoneHVACDehumidifierDX>();
-        retVal = translateZoneHVACDehumidifierDX(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator: {
-        auto mo = modelObject.cast<ZoneHVACEnergyRecoveryVentilator>();
-        retVal = translateZoneHVACEnergyRecoveryVentilator(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator_Controller: {
-        auto mo = modelObject.cast<ZoneHVACEnergyRecoveryVentilatorController>();
-        retVal = translateZoneHVACEnergyRecoveryVentilatorController(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_EquipmentList: {
-        auto mo = modelObject.cast<ZoneHVACEquipmentList>();
-        retVal = translateZoneHVACEquipmentList(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_FourPipeFanCoil: {
-        auto mo = modelObject.cast<ZoneHVACFourPipeFanCoil>();
-        retVal = translateZoneHVACFourPipeFanCoil(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant: {
-        auto mo = modelObject.cast<ZoneHVACHighTemperatureRadiant>();
-        retVal = translateZoneHVACHighTemperatureRadiant(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_IdealLoadsAirSystem: {
-        auto mo = modelObject.cast<ZoneHVACIdealLoadsAirSystem>();
-        retVal = translateZoneHVACIdealLoadsAirSystem(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric: {
-        auto mo = modelObject.cast<ZoneHVACLowTemperatureRadiantElectric>();
-        retVal = translateZoneHVACLowTemperatureRadiantElectric(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow: {
-        auto mo = modelObject.cast<ZoneHVACLowTempRadiantConstFlow>();
-        retVal = translateZoneHVACLowTempRadiantConstFlow(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow: {
-        auto mo = modelObject.cast<ZoneHVACLowTempRadiantVarFlow>();
-        retVal = translateZoneHVACLowTempRadiantVarFlow(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump: {
-        auto mo = modelObject.cast<ZoneHVACPackagedTerminalHeatPump>();
-        retVal = translateZoneHVACPackagedTerminalHeatPump(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner: {
-        auto mo = modelObject.cast<ZoneHVACPackagedTerminalAirConditioner>();
-        retVal = translateZoneHVACPackagedTerminalAirConditioner(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow: {
-        auto mo = modelObject.cast<ZoneHVACTerminalUnitVariableRefrigerantFlow>();
-        retVal = translateZoneHVACTerminalUnitVariableRefrigerantFlow(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_UnitHeater: {
-        auto mo = modelObject.cast<ZoneHVACUnitHeater>();
-        retVal = translateZoneHVACUnitHeater(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_UnitVentilator: {
-        auto mo = modelObject.cast<ZoneHVACUnitVentilator>();
-        retVal = translateZoneHVACUnitVentilator(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump: {
-        auto mo = modelObject.cast<ZoneHVACWaterToAirHeatPump>();
-        retVal = translateZoneHVACWaterToAirHeatPump(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneMixing: {
-        auto mo = modelObject.cast<ZoneMixing>();
-        retVal = translateZoneMixing(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneProperty_UserViewFactors_BySurfaceName: {
-        auto mo = modelObject.cast<ZonePropertyUserViewFactorsBySurfaceName>();
-        retVal = translateZonePropertyUserViewFactorsBySurfaceName(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneVentilation_DesignFlowRate: {
-        auto mo = modelObject.cast<ZoneVentilationDesignFlowRate>();
-        retVal = translateZoneVentilationDesignFlowRate(mo);
-        break;
-      }
-      case openstudio::IddObjectType::OS_ZoneVentilation_WindandStackOpenArea: {
-        auto mo = modelObject.cast<ZoneVentilationWindandStackOpenArea>();
-        retVal = translateZoneVentilationWindandStackOpenArea(mo);
-        break;
-      }
-      //If no case statement log a warning
-      default: {
-        LOG(Warn, "Unknown IddObjectType: '" << modelObject.iddObject().name() << "'");
-        return retVal;
-      }
+  std::vector<IddObjectType> ForwardTranslator::registeredIddObjectTypes() {
+    std::vector<IddObjectType> result;
+    result.reserve(modelObjectTranslators().size());
+    for (const auto& translator : modelObjectTranslators()) {
+      result.emplace_back(translator.iddObjectType);
+    }
+    return result;
+  }
+
+  void ForwardTranslator::setTranslationEnabled(const IddObjectType& iddObjectType, bool enabled) {
+    if (enabled) {
+      m_disabledIddObjectTypes.erase(iddObjectType);
+    } else {
+      m_disabledIddObjectTypes.insert(iddObjectType);
+    }
+  }
+
+  bool ForwardTranslator::isTranslationEnabled(const IddObjectType& iddObjectType) const {
+    return m_disabledIddObjectTypes.find(iddObjectType) == m_disabledIddObjectTypes.end();
+  }
+
+  std::vector<TranslationProfileEntry> ForwardTranslator::translationProfile() const {
+    return m_translationProfiler.profile();
+  }
+
+
+  boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelObject& modelObject) {
+    boost::optional<IdfObject> retVal;
+
+    // if already translated then exit
+    auto objInMapIt = m_map.find(modelObject.handle());
+    if (objInMapIt != m_map.end()) {
+      return boost::optional<IdfObject>(objInMapIt->second);
+    }
+
+    LOG(Trace, "Translating " << modelObject.briefDescription() << ".");
+
+    const IddObjectType iddObjectType = modelObject.iddObject().type();
+    const ModelObjectTranslator* translator = findModelObjectTranslator(iddObjectType);
+    if (!translator) {
+      LOG(Warn, "Unknown IddObjectType: '" << modelObject.iddObject().name() << "'");
+      return retVal;
+    }
+
+    if (!m_disabledIddObjectTypes.empty() && !isTranslationEnabled(iddObjectType)) {
+      LOG(Trace, "Translation of " << iddObjectType.valueName() << " is disabled, skipping " << modelObject.briefDescription() << ".");
+      return retVal;
+    }
+
+    if (translator->translate) {
+      m_translationProfiler.start(iddObjectType, m_idfObjects.size());
+      retVal = translator->translate(*this, modelObject);
+      m_translationProfiler.stop(m_idfObjects.size());
+    }
+
+    if (!translator->translateChildren) {
+      return retVal;
     }
 
     if (retVal) {
@@ -3318,7 +1579,6 @@ namespace energyplus {
 
     return retVal;
   }
-  // NOLINTEND(readability-function-size, bugprone-branch-clone)
 
   std::string ForwardTranslator::stripOS2(const string& s) {
     std::string result;
@@ -4003,6 +2263,8 @@ namespace energyplus {
   void ForwardTranslator::reset() {
     m_idfObjects.clear();
 
+    m_translationProfiler.reset();
+
     m_map.clear();
 
     m_anyNumberScheduleTypeLimits.reset();
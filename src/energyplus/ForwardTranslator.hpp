@@ -7,6 +7,7 @@
 #define ENERGYPLUS_FORWARDTRANSLATOR_HPP
 
 #include "EnergyPlusAPI.hpp"
+#include "TranslationProfile.hpp"
 #include "../model/Model.hpp"
 #include "../model/ConstructionBase.hpp"
 #include "../model/HVACComponent.hpp"
@@ -19,6 +20,8 @@
 #include "../utilities/core/Deprecated.hpp"
 
 #include <iostream>
+#include <set>
+#include <vector>
 
 namespace openstudio {
 
@@ -569,6 +572,26 @@ namespace energyplus {
 
     //@}
 
+    /** @name Per type translation */
+    //@{
+
+    /** The IddObjectTypes that have an entry in the translator registry. Objects of any other type are not translated (with a warning) */
+    static std::vector<IddObjectType> registeredIddObjectTypes();
+
+    /** Translation of an IddObjectType can be disabled, in which case objects of that type are skipped as if they were unknown
+     *  (silently) and neither them nor their children are translated. This is meant to translate a subset of a model (eg: debugging,
+     *  or profiling a single translator), use at your own risks: other translators may still translate objects of that type that they
+     *  reference directly. All types are enabled by default */
+    void setTranslationEnabled(const IddObjectType& iddObjectType, bool enabled);
+    bool isTranslationEnabled(const IddObjectType& iddObjectType) const;
+
+    /** Per IddObjectType statistics (count, wall time, IdfObjects created) of the last translation, sorted by decreasing self time.
+     *  Only objects that go through the translator registry are accounted for, objects translated directly by another translator
+     *  are part of that translator's self time */
+    std::vector<TranslationProfileEntry> translationProfile() const;
+
+    //@}
+
    private:
     REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
 
@@ -592,9 +615,26 @@ namespace energyplus {
     // Pick up the Zone, ZoneList, Space or SpaceList (if allowSpaceType is true) object for a given SpaceLoad (or SpaceLoadInstance)
     IdfObject getSpaceLoadParent(const model::SpaceLoad& sp, bool allowSpaceType = true);
 
-    // NOLINTBEGIN(readability-function-size, bugprone-branch-clone)
     boost::optional<IdfObject> translateAndMapModelObject(model::ModelObject& modelObject);
-    // NOLINTEND(readability-function-size, bugprone-branch-clone)
+
+    /** Entry of the registry used by translateAndMapModelObject to dispatch a ModelObject to its type specific translator */
+    struct ModelObjectTranslator
+    {
+      IddObjectType::domain iddObjectType;
+      // nullptr if objects of this type are not translated by themselves (eg: they are translated by the object that uses them)
+      boost::optional<IdfObject> (*translate)(ForwardTranslator& ft, model::ModelObject& modelObject);
+      // If false, the children of a ParentObject of this type are not translated either
+      bool translateChildren;
+    };
+
+    /** The translator registry, one entry per IddObjectType */
+    static const std::vector<ModelObjectTranslator>& modelObjectTranslators();
+
+    /** O(1) lookup in the registry, returns nullptr if there is no translator for this type */
+    static const ModelObjectTranslator* findModelObjectTranslator(const IddObjectType& iddObjectType);
+
+    /** Adapters from the type specific translators to ModelObjectTranslator::translate, defined along with the registry */
+    struct ModelObjectTranslatorAdapters;
 
     boost::optional<IdfObject> translateAirConditionerVariableRefrigerantFlow(model::AirConditionerVariableRefrigerantFlow& modelObject);
 
@@ -1693,6 +1733,10 @@ namespace energyplus {
 
     // ForwardTranslator options
     ForwardTranslatorOptions m_forwardTranslatorOptions;
+
+    std::set<IddObjectType> m_disabledIddObjectTypes;
+
+    detail::TranslationProfiler m_translationProfiler;
   };
 
 }  // namespace energyplus
@@ -11,6 +11,7 @@
 
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/WorkspaceObject.hpp"
+#include "../utilities/idf/Workspace_Impl.hpp"
 #include "../utilities/idf/ValidityReport.hpp"
 #include "../utilities/idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
@@ -135,6 +136,8 @@ namespace energyplus {
 
     m_untranslatedIdfObjects.clear();
 
+    m_translationProfiler.reset();
+
     // if multiple runperiod objects in idf, remove them all
     vector<WorkspaceObject> runPeriods = m_workspace.getObjectsByType(IddObjectType::RunPeriod);
     if (runPeriods.size() > 1) {
@@ -222,6 +225,10 @@ namespace energyplus {
     return m_untranslatedIdfObjects;
   }
 
+  std::vector<TranslationProfileEntry> ReverseTranslator::translationProfile() const {
+    return m_translationProfiler.profile();
+  }
+
   struct IdfObjectEqual
   {
     explicit IdfObjectEqual(const IdfObject& target) : m_target(target) {}
@@ -233,6 +240,216 @@ namespace energyplus {
     IdfObject m_target;
   };
 
+  const std::vector<ReverseTranslator::WorkspaceObjectTranslator>& ReverseTranslator::workspaceObjectTranslators() {
+    // Objects of any type not listed here are added to the untranslated objects
+    static const std::vector<WorkspaceObjectTranslator> translators{
+      // {openstudio::IddObjectType::AirLoopHVAC, &ReverseTranslator::translateAirLoopHVAC},
+      // {openstudio::IddObjectType::AirLoopHVAC_OutdoorAirSystem, &ReverseTranslator::translateAirLoopHVACOutdoorAirSystem},
+      // {openstudio::IddObjectType::AirLoopHVAC_DedicatedOutdoorAirSystem, &ReverseTranslator::translateAirLoopHVACDedicatedOutdoorAirSystem},
+      // {openstudio::IddObjectType::CoilSystem_Cooling_DX, &ReverseTranslator::translateCoilSystemCoolingDX},
+      {openstudio::IddObjectType::AirTerminal_SingleDuct_ConstantVolume_Reheat,
+       &ReverseTranslator::translateAirTerminalSingleDuctConstantVolumeReheat},
+      {openstudio::IddObjectType::AirTerminal_SingleDuct_ConstantVolume_NoReheat,
+       &ReverseTranslator::translateAirTerminalSingleDuctConstantVolumeNoReheat},
+      {openstudio::IddObjectType::AirTerminal_SingleDuct_VAV_NoReheat, &ReverseTranslator::translateAirTerminalSingleDuctVAVNoReheat},
+      // {openstudio::IddObjectType::AirTerminal_SingleDuct_VAV_Reheat, &ReverseTranslator::translateAirTerminalSingleDuctVAVReheat},
+      {openstudio::IddObjectType::BuildingSurface_Detailed, &ReverseTranslator::translateBuildingSurfaceDetailed},
+      {openstudio::IddObjectType::Building, &ReverseTranslator::translateBuilding},
+      {openstudio::IddObjectType::Chiller_Electric_ASHRAE205, &ReverseTranslator::translateChillerElectricASHRAE205},
+      // {openstudio::IddObjectType::Coil_Heating_Fuel, &ReverseTranslator::translateCoilHeatingGas},
+      {openstudio::IddObjectType::Coil_Cooling_DX, &ReverseTranslator::translateCoilCoolingDX},
+      {openstudio::IddObjectType::Coil_Cooling_DX_CurveFit_Performance, &ReverseTranslator::translateCoilCoolingDXCurveFitPerformance},
+      {openstudio::IddObjectType::Coil_Cooling_DX_CurveFit_OperatingMode, &ReverseTranslator::translateCoilCoolingDXCurveFitOperatingMode},
+      {openstudio::IddObjectType::Coil_Cooling_DX_CurveFit_Speed, &ReverseTranslator::translateCoilCoolingDXCurveFitSpeed},
+      // {openstudio::IddObjectType::Coil_Cooling_DX_SingleSpeed, &ReverseTranslator::translateCoilCoolingDXSingleSpeed},
+      {openstudio::IddObjectType::Construction, &ReverseTranslator::translateConstruction},
+      {openstudio::IddObjectType::Construction_AirBoundary, &ReverseTranslator::translateConstructionAirBoundary},
+      // E+ 9.5: Now translated via Construction object itself
+      {openstudio::IddObjectType::ConstructionProperty_InternalHeatSource, &ReverseTranslator::translateConstructionWithInternalSource},
+      // {openstudio::IddObjectType::Controller_OutdoorAir, &ReverseTranslator::translateControllerOutdoorAir},
+      {openstudio::IddObjectType::ConvergenceLimits, &ReverseTranslator::translateConvergenceLimits},
+      {openstudio::IddObjectType::Curve_Bicubic, &ReverseTranslator::translateCurveBicubic},
+      {openstudio::IddObjectType::Curve_Biquadratic, &ReverseTranslator::translateCurveBiquadratic},
+      {openstudio::IddObjectType::Curve_Cubic, &ReverseTranslator::translateCurveCubic},
+      {openstudio::IddObjectType::Curve_ExponentialDecay, &ReverseTranslator::translateCurveExponentialDecay},
+      {openstudio::IddObjectType::Curve_DoubleExponentialDecay, &ReverseTranslator::translateCurveDoubleExponentialDecay},
+      {openstudio::IddObjectType::Curve_ExponentialSkewNormal, &ReverseTranslator::translateCurveExponentialSkewNormal},
+      {openstudio::IddObjectType::Curve_FanPressureRise, &ReverseTranslator::translateCurveFanPressureRise},
+      {openstudio::IddObjectType::Curve_Functional_PressureDrop, &ReverseTranslator::translateCurveFunctionalPressureDrop},
+      {openstudio::IddObjectType::Curve_Linear, &ReverseTranslator::translateCurveLinear},
+      {openstudio::IddObjectType::Curve_QuadLinear, &ReverseTranslator::translateCurveQuadLinear},
+      {openstudio::IddObjectType::Curve_QuintLinear, &ReverseTranslator::translateCurveQuintLinear},
+      {openstudio::IddObjectType::Curve_Quadratic, &ReverseTranslator::translateCurveQuadratic},
+      {openstudio::IddObjectType::Curve_QuadraticLinear, &ReverseTranslator::translateCurveQuadraticLinear},
+      {openstudio::IddObjectType::Curve_Quartic, &ReverseTranslator::translateCurveQuartic},
+      {openstudio::IddObjectType::Curve_RectangularHyperbola1, &ReverseTranslator::translateCurveRectangularHyperbola1},
+      {openstudio::IddObjectType::Curve_RectangularHyperbola2, &ReverseTranslator::translateCurveRectangularHyperbola2},
+      {openstudio::IddObjectType::Curve_Sigmoid, &ReverseTranslator::translateCurveSigmoid},
+      {openstudio::IddObjectType::Curve_Triquadratic, &ReverseTranslator::translateCurveTriquadratic},
+      {openstudio::IddObjectType::Daylighting_Controls, &ReverseTranslator::translateDaylightingControls},
+      // {openstudio::IddObjectType::DesignSpecification_OutdoorAir, &ReverseTranslator::translateDesignSpecificationOutdoorAir},
+      {openstudio::IddObjectType::ElectricEquipment, &ReverseTranslator::translateElectricEquipment},
+      {openstudio::IddObjectType::Exterior_Lights, &ReverseTranslator::translateExteriorLights},
+      {openstudio::IddObjectType::Exterior_FuelEquipment, &ReverseTranslator::translateExteriorFuelEquipment},
+      {openstudio::IddObjectType::Exterior_WaterEquipment, &ReverseTranslator::translateExteriorWaterEquipment},
+      {openstudio::IddObjectType::ElectricLoadCenter_Storage_Simple, &ReverseTranslator::translateElectricLoadCenterStorageSimple},
+      {openstudio::IddObjectType::ElectricLoadCenter_Storage_Converter, &ReverseTranslator::translateElectricLoadCenterStorageConverter},
+      {openstudio::IddObjectType::ElectricLoadCenter_Storage_LiIonNMCBattery, &ReverseTranslator::translateElectricLoadCenterStorageLiIonNMCBattery},
+      {openstudio::IddObjectType::EnergyManagementSystem_Actuator, &ReverseTranslator::translateEnergyManagementSystemActuator},
+      {openstudio::IddObjectType::EnergyManagementSystem_ConstructionIndexVariable,
+       &ReverseTranslator::translateEnergyManagementSystemConstructionIndexVariable},
+      {openstudio::IddObjectType::EnergyManagementSystem_CurveOrTableIndexVariable,
+       &ReverseTranslator::translateEnergyManagementSystemCurveOrTableIndexVariable},
+      {openstudio::IddObjectType::EnergyManagementSystem_GlobalVariable, &ReverseTranslator::translateEnergyManagementSystemGlobalVariable},
+      {openstudio::IddObjectType::EnergyManagementSystem_InternalVariable, &ReverseTranslator::translateEnergyManagementSystemInternalVariable},
+      {openstudio::IddObjectType::EnergyManagementSystem_MeteredOutputVariable,
+       &ReverseTranslator::translateEnergyManagementSystemMeteredOutputVariable},
+      {openstudio::IddObjectType::EnergyManagementSystem_OutputVariable, &ReverseTranslator::translateEnergyManagementSystemOutputVariable},
+      {openstudio::IddObjectType::EnergyManagementSystem_Program, &ReverseTranslator::translateEnergyManagementSystemProgram},
+      {openstudio::IddObjectType::EnergyManagementSystem_ProgramCallingManager,
+       &ReverseTranslator::translateEnergyManagementSystemProgramCallingManager},
+      {openstudio::IddObjectType::EnergyManagementSystem_Sensor, &ReverseTranslator::translateEnergyManagementSystemSensor},
+      {openstudio::IddObjectType::EnergyManagementSystem_Subroutine, &ReverseTranslator::translateEnergyManagementSystemSubroutine},
+      {openstudio::IddObjectType::EnergyManagementSystem_TrendVariable, &ReverseTranslator::translateEnergyManagementSystemTrendVariable},
+      // {openstudio::IddObjectType::EvaporativeCooler_Direct_ResearchSpecial, &ReverseTranslator::translateEvaporativeCoolerDirectResearchSpecial},
+      {openstudio::IddObjectType::EvaporativeFluidCooler_SingleSpeed, &ReverseTranslator::translateEvaporativeFluidCoolerSingleSpeed},
+      {openstudio::IddObjectType::Fan_ComponentModel, &ReverseTranslator::translateFanComponentModel},
+      // {openstudio::IddObjectType::Fan_ConstantVolume, &ReverseTranslator::translateFanConstantVolume},
+      {openstudio::IddObjectType::Fan_SystemModel, &ReverseTranslator::translateFanSystemModel},
+      {openstudio::IddObjectType::FenestrationSurface_Detailed, &ReverseTranslator::translateFenestrationSurfaceDetailed},
+      {openstudio::IddObjectType::Foundation_Kiva, &ReverseTranslator::translateFoundationKiva},
+      {openstudio::IddObjectType::Foundation_Kiva_Settings, &ReverseTranslator::translateFoundationKivaSettings},
+      {openstudio::IddObjectType::Generator_MicroTurbine, &ReverseTranslator::translateGeneratorMicroTurbine},
+      {openstudio::IddObjectType::Generator_WindTurbine, &ReverseTranslator::translateGeneratorWindTurbine},
+      {openstudio::IddObjectType::GasEquipment, &ReverseTranslator::translateGasEquipment},
+      // {openstudio::IddObjectType::GroundHeatExchanger_System, &ReverseTranslator::translateGroundHeatExchangerVertical},
+      {openstudio::IddObjectType::HeatBalanceAlgorithm, &ReverseTranslator::translateHeatBalanceAlgorithm},
+      {openstudio::IddObjectType::HotWaterEquipment, &ReverseTranslator::translateHotWaterEquipment},
+      {openstudio::IddObjectType::InternalMass, &ReverseTranslator::translateInternalMass},
+      {openstudio::IddObjectType::Lights, &ReverseTranslator::translateLights},
+      {openstudio::IddObjectType::Material, &ReverseTranslator::translateMaterial},
+      {openstudio::IddObjectType::Material_AirGap, &ReverseTranslator::translateMaterialAirGap},
+      {openstudio::IddObjectType::Material_NoMass, &ReverseTranslator::translateMaterialNoMass},
+      {openstudio::IddObjectType::MaterialProperty_GlazingSpectralData, &ReverseTranslator::translateMaterialPropertyGlazingSpectralData},
+      {openstudio::IddObjectType::Meter_Custom, &ReverseTranslator::translateMeterCustom},
+      {openstudio::IddObjectType::Meter_CustomDecrement, &ReverseTranslator::translateMeterCustomDecrement},
+      {openstudio::IddObjectType::OtherEquipment, &ReverseTranslator::translateOtherEquipment},
+      {openstudio::IddObjectType::Output_DebuggingData, &ReverseTranslator::translateOutputDebuggingData},
+      {openstudio::IddObjectType::Output_Diagnostics, &ReverseTranslator::translateOutputDiagnostics},
+      {openstudio::IddObjectType::Output_EnergyManagementSystem, &ReverseTranslator::translateOutputEnergyManagementSystem},
+      {openstudio::IddObjectType::Output_JSON, &ReverseTranslator::translateOutputJSON},
+      {openstudio::IddObjectType::Output_SQLite, &ReverseTranslator::translateOutputSQLite},
+      {openstudio::IddObjectType::Output_EnvironmentalImpactFactors, &ReverseTranslator::translateOutputEnvironmentalImpactFactors},
+      {openstudio::IddObjectType::EnvironmentalImpactFactors, &ReverseTranslator::translateEnvironmentalImpactFactors},
+      {openstudio::IddObjectType::FuelFactors, &ReverseTranslator::translateFuelFactors},
+      {openstudio::IddObjectType::Output_IlluminanceMap, &ReverseTranslator::translateOutputIlluminanceMap},
+      {openstudio::IddObjectType::Output_Meter, &ReverseTranslator::translateOutputMeter},
+      {openstudio::IddObjectType::Output_Meter_Cumulative, &ReverseTranslator::translateOutputMeterCumulative},
+      {openstudio::IddObjectType::Output_Meter_Cumulative_MeterFileOnly, &ReverseTranslator::translateOutputMeterCumulativeMeterFileOnly},
+      {openstudio::IddObjectType::Output_Meter_MeterFileOnly, &ReverseTranslator::translateOutputMeterMeterFileOnly},
+      {openstudio::IddObjectType::Output_Table_SummaryReports, &ReverseTranslator::translateOutputTableSummaryReports},
+      {openstudio::IddObjectType::Output_Variable, &ReverseTranslator::translateOutputVariable},
+      {openstudio::IddObjectType::OutputControl_Files, &ReverseTranslator::translateOutputControlFiles},
+      {openstudio::IddObjectType::OutputControl_ReportingTolerances, &ReverseTranslator::translateOutputControlReportingTolerances},
+      {openstudio::IddObjectType::OutputControl_Table_Style, &ReverseTranslator::translateOutputControlTableStyle},
+      {openstudio::IddObjectType::OutputControl_Timestamp, &ReverseTranslator::translateOutputControlTimestamp},
+      {openstudio::IddObjectType::Output_Schedules, &ReverseTranslator::translateOutputSchedules},
+      {openstudio::IddObjectType::Output_Constructions, &ReverseTranslator::translateOutputConstructions},
+      {openstudio::IddObjectType::People, &ReverseTranslator::translatePeople},
+      {openstudio::IddObjectType::PerformancePrecisionTradeoffs, &ReverseTranslator::translatePerformancePrecisionTradeoffs},
+      {openstudio::IddObjectType::PhotovoltaicPerformance_Sandia, &ReverseTranslator::translatePhotovoltaicPerformanceSandia},
+      // {openstudio::IddObjectType::Refrigeration_Case, &ReverseTranslator::translateRefrigerationCase},
+      // {openstudio::IddObjectType::Refrigeration_Compressor, &ReverseTranslator::translateRefrigerationCompressor},
+      {openstudio::IddObjectType::RunPeriod, &ReverseTranslator::translateRunPeriod},
+      {openstudio::IddObjectType::RunPeriodControl_DaylightSavingTime, &ReverseTranslator::translateRunPeriodControlDaylightSavingTime},
+      {openstudio::IddObjectType::RunPeriodControl_SpecialDays, &ReverseTranslator::translateRunPeriodControlSpecialDays},
+      {openstudio::IddObjectType::Schedule_Compact, &ReverseTranslator::translateScheduleCompact},
+      {openstudio::IddObjectType::Schedule_Constant, &ReverseTranslator::translateScheduleConstant},
+      {openstudio::IddObjectType::Schedule_Day_Hourly, &ReverseTranslator::translateScheduleDayHourly},
+      {openstudio::IddObjectType::Schedule_File, &ReverseTranslator::translateScheduleFile},
+      {openstudio::IddObjectType::Schedule_Day_Interval, &ReverseTranslator::translateScheduleDayInterval},
+      {openstudio::IddObjectType::ScheduleTypeLimits, &ReverseTranslator::translateScheduleTypeLimits},
+      {openstudio::IddObjectType::Schedule_Week_Daily, &ReverseTranslator::translateScheduleWeekDaily},
+      {openstudio::IddObjectType::Schedule_Year, &ReverseTranslator::translateScheduleYear},
+      // {openstudio::IddObjectType::SetpointManager_MixedAir, &ReverseTranslator::translateSetpointManagerMixedAir},
+      // {openstudio::IddObjectType::SetpointManager_Scheduled, &ReverseTranslator::translateSetpointManagerScheduled},
+      // {openstudio::IddObjectType::SetpointManager_SingleZone_Reheat, &ReverseTranslator::translateSetpointManagerSingleZoneReheat},
+      // {openstudio::IddObjectType::SetpointManager_SystemNodeReset_Humidity, &ReverseTranslator::translateSetpointManagerSystemNodeResetHumidity},
+      // {openstudio::IddObjectType::SetpointManager_SystemNodeReset_Temperature,
+      //  &ReverseTranslator::translateSetpointManagerSystemNodeResetTemperature},
+      {openstudio::IddObjectType::Shading_Building_Detailed, &ReverseTranslator::translateShadingBuildingDetailed},
+      {openstudio::IddObjectType::Shading_Site_Detailed, &ReverseTranslator::translateShadingSiteDetailed},
+      {openstudio::IddObjectType::Shading_Zone_Detailed, &ReverseTranslator::translateShadingZoneDetailed},
+      {openstudio::IddObjectType::ShadowCalculation, &ReverseTranslator::translateShadowCalculation},
+      {openstudio::IddObjectType::SimulationControl, &ReverseTranslator::translateSimulationControl},
+      {openstudio::IddObjectType::Site_Location, &ReverseTranslator::translateSiteLocation},
+      // {openstudio::IddObjectType::Site_GroundReflectance, &ReverseTranslator::translateSiteGroundReflectance},
+      // {openstudio::IddObjectType::Site_GroundTemperature_BuildingSurface, &ReverseTranslator::translateSiteGroundTemperatureBuildingSurface},
+      // {openstudio::IddObjectType::Site_WaterMainsTemperature, &ReverseTranslator::translateSiteWaterMainsTemperature},
+      {openstudio::IddObjectType::Sizing_Parameters, &ReverseTranslator::translateSizingParameters},
+      {openstudio::IddObjectType::SizingPeriod_DesignDay, &ReverseTranslator::translateSizingPeriodDesignDay},
+      {openstudio::IddObjectType::SolarCollectorPerformance_PhotovoltaicThermal_BIPVT,
+       &ReverseTranslator::translateSolarCollectorPerformancePhotovoltaicThermalBIPVT},
+      // {openstudio::IddObjectType::Sizing_System, &ReverseTranslator::translateSizingSystem},
+      {openstudio::IddObjectType::Sizing_Zone, &ReverseTranslator::translateSizingZone},
+      {openstudio::IddObjectType::SteamEquipment, &ReverseTranslator::translateSteamEquipment},
+      {openstudio::IddObjectType::SurfaceControl_MovableInsulation, &ReverseTranslator::translateSurfaceControlMovableInsulation},
+      // {openstudio::IddObjectType::SurfaceConvectionAlgorithm_Inside, &ReverseTranslator::translateSurfaceConvectionAlgorithmInside},
+      // {openstudio::IddObjectType::SurfaceConvectionAlgorithm_Outside, &ReverseTranslator::translateSurfaceConvectionAlgorithmOutside},
+      {openstudio::IddObjectType::SurfaceProperty_ExposedFoundationPerimeter, &ReverseTranslator::translateSurfacePropertyExposedFoundationPerimeter},
+      {openstudio::IddObjectType::SurfaceProperty_GroundSurfaces, &ReverseTranslator::translateSurfacePropertyGroundSurfaces},
+      {openstudio::IddObjectType::SurfaceProperty_IncidentSolarMultiplier, &ReverseTranslator::translateSurfacePropertyIncidentSolarMultiplier},
+      {openstudio::IddObjectType::SurfaceProperty_LocalEnvironment, &ReverseTranslator::translateSurfacePropertyLocalEnvironment},
+      {openstudio::IddObjectType::SurfaceProperty_OtherSideConditionsModel, &ReverseTranslator::translateSurfacePropertyOtherSideConditionsModel},
+      {openstudio::IddObjectType::SurfaceProperty_SurroundingSurfaces, &ReverseTranslator::translateSurfacePropertySurroundingSurfaces},
+      // {openstudio::IddObjectType::SwimmingPool_Indoor, &ReverseTranslator::translateSwimmingPoolIndoor},
+      {openstudio::IddObjectType::Table_Lookup, &ReverseTranslator::translateTableLookup},
+      {openstudio::IddObjectType::ThermostatSetpoint_DualSetpoint, &ReverseTranslator::translateThermostatSetpointDualSetpoint},
+      {openstudio::IddObjectType::Timestep, &ReverseTranslator::translateTimestep},
+      {openstudio::IddObjectType::Version, &ReverseTranslator::translateVersion},
+      {openstudio::IddObjectType::WindowMaterial_Gas, &ReverseTranslator::translateWindowMaterialGas},
+      {openstudio::IddObjectType::WindowMaterial_Glazing, &ReverseTranslator::translateWindowMaterialGlazing},
+      {openstudio::IddObjectType::WindowMaterial_SimpleGlazingSystem, &ReverseTranslator::translateWindowMaterialSimpleGlazingSystem},
+      {openstudio::IddObjectType::WindowProperty_FrameAndDivider, &ReverseTranslator::translateWindowPropertyFrameAndDivider},
+      {openstudio::IddObjectType::WindowShadingControl, &ReverseTranslator::translateWindowShadingControl},
+      {openstudio::IddObjectType::Zone, &ReverseTranslator::translateZone},
+      {openstudio::IddObjectType::ZoneAirHeatBalanceAlgorithm, &ReverseTranslator::translateZoneAirHeatBalanceAlgorithm},
+      {openstudio::IddObjectType::ZoneAirMassFlowConservation, &ReverseTranslator::translateZoneAirMassFlowConservation},
+      {openstudio::IddObjectType::ZoneCrossMixing, &ReverseTranslator::translateZoneCrossMixing},
+      // {openstudio::IddObjectType::ZoneHVAC_EquipmentList, &ReverseTranslator::translateZoneHVACEquipmentList},
+      // {openstudio::IddObjectType::ZoneHVAC_IdealLoadsAirSystem, &ReverseTranslator::translateZoneHVACIdealLoadsAirSystem},
+      {openstudio::IddObjectType::ZoneInfiltration_DesignFlowRate, &ReverseTranslator::translateZoneInfiltrationDesignFlowRate},
+      {openstudio::IddObjectType::ZoneInfiltration_EffectiveLeakageArea, &ReverseTranslator::translateZoneInfiltrationEffectiveLeakageArea},
+      {openstudio::IddObjectType::ZoneInfiltration_FlowCoefficient, &ReverseTranslator::translateZoneInfiltrationFlowCoefficient},
+      {openstudio::IddObjectType::ZoneList, &ReverseTranslator::translateZoneList},
+      {openstudio::IddObjectType::ZoneMixing, &ReverseTranslator::translateZoneMixing},
+      {openstudio::IddObjectType::ZoneProperty_UserViewFactors_BySurfaceName, &ReverseTranslator::translateZonePropertyUserViewFactorsBySurfaceName},
+      {openstudio::IddObjectType::ZoneVentilation_DesignFlowRate, &ReverseTranslator::translateZoneVentilationDesignFlowRate},
+      {openstudio::IddObjectType::ZoneVentilation_WindandStackOpenArea, &ReverseTranslator::translateZoneVentilationWindandStackOpenArea},
+    };
+    return translators;
+  }
+
+  ReverseTranslator::WorkspaceObjectTranslator::TranslateFunction ReverseTranslator::findWorkspaceObjectTranslator(const IddObjectType& iddObjectType) {
+    // IddObjectType values are contiguous, so a vector indexed by value is a perfect hash of the registry
+    static const std::vector<WorkspaceObjectTranslator::TranslateFunction> lookup = [] {
+      const auto& values = IddObjectType::getValues();
+      std::vector<WorkspaceObjectTranslator::TranslateFunction> result(values.empty() ? 0 : *values.rbegin() + 1, nullptr);
+      for (const auto& translator : workspaceObjectTranslators()) {
+        OS_ASSERT(translator.iddObjectType >= 0 && static_cast<size_t>(translator.iddObjectType) < result.size());
+        OS_ASSERT(!result[translator.iddObjectType]);
+        result[translator.iddObjectType] = translator.translate;
+      }
+      return result;
+    }();
+
+    const int value = iddObjectType.value();
+    if (value < 0 || static_cast<size_t>(value) >= lookup.size()) {
+      return nullptr;
+    }
+    return lookup[value];
+  }
+
   boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject& workspaceObject) {
     auto i = m_workspaceToModelMap.find(workspaceObject.handle());
 
@@ -251,807 +468,16 @@ namespace energyplus {
 
     bool addToUntranslated = true;
 
-    switch (workspaceObject.iddObject().type().value()) {
-      case openstudio::IddObjectType::AirLoopHVAC: {
-        //modelObject = translateAirLoopHVAC(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::AirLoopHVAC_ControllerList: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::AirLoopHVAC_OutdoorAirSystem: {
-        //modelObject = translateAirLoopHVACOutdoorAirSystem(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::AirLoopHVAC_DedicatedOutdoorAirSystem: {
-        //modelObject = translateAirLoopHVACDedicatedOutdoorAirSystem(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::AirLoopHVAC_OutdoorAirSystem_EquipmentList: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::AirLoopHVAC_ReturnPath: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::CoilSystem_Cooling_DX: {
-        //modelObject = translateCoilSystemCoolingDX(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::AirLoopHVAC_ZoneSplitter: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::AirTerminal_SingleDuct_ConstantVolume_Reheat: {
-        modelObject = translateAirTerminalSingleDuctConstantVolumeReheat(workspaceObject);
-        break;
-      }
-
-      case openstudio::IddObjectType::AirTerminal_SingleDuct_ConstantVolume_NoReheat: {
-        modelObject = translateAirTerminalSingleDuctConstantVolumeNoReheat(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::AirTerminal_SingleDuct_VAV_NoReheat: {
-        modelObject = translateAirTerminalSingleDuctVAVNoReheat(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::AirTerminal_SingleDuct_VAV_Reheat: {
-        //modelObject = translateAirTerminalSingleDuctVAVReheat(workspaceObject );
-        break;
-      }
-      case openstudio::IddObjectType::AvailabilityManagerAssignmentList: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::Branch: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::BranchList: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::BuildingSurface_Detailed: {
-        modelObject = translateBuildingSurfaceDetailed(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Building: {
-        modelObject = translateBuilding(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Chiller_Electric_ASHRAE205: {
-        modelObject = translateChillerElectricASHRAE205(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Coil_Heating_Fuel: {
-        //modelObject = translateCoilHeatingGas(workspaceObject );
-        break;
-      }
-      case openstudio::IddObjectType::Coil_Cooling_DX: {
-        modelObject = translateCoilCoolingDX(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Coil_Cooling_DX_CurveFit_Performance: {
-        modelObject = translateCoilCoolingDXCurveFitPerformance(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Coil_Cooling_DX_CurveFit_OperatingMode: {
-        modelObject = translateCoilCoolingDXCurveFitOperatingMode(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Coil_Cooling_DX_CurveFit_Speed: {
-        modelObject = translateCoilCoolingDXCurveFitSpeed(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Coil_Cooling_DX_SingleSpeed: {
-        //modelObject = translateCoilCoolingDXSingleSpeed(workspaceObject );
-        break;
-      }
-      case openstudio::IddObjectType::CommentOnly: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::ComponentCost_LineItem: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::Connector_Mixer: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::Connector_Splitter: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::ConnectorList: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::Construction: {
-        modelObject = translateConstruction(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Construction_AirBoundary: {
-        modelObject = translateConstructionAirBoundary(workspaceObject);
-        break;
-      }
-      // E+ 9.5: Now translated via Construction object itself
-      case openstudio::IddObjectType::ConstructionProperty_InternalHeatSource: {
-        modelObject = translateConstructionWithInternalSource(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Controller_OutdoorAir: {
-        //modelObject = translateControllerOutdoorAir(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ConvergenceLimits: {
-        modelObject = translateConvergenceLimits(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Bicubic: {
-        modelObject = translateCurveBicubic(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Biquadratic: {
-        modelObject = translateCurveBiquadratic(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Cubic: {
-        modelObject = translateCurveCubic(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_ExponentialDecay: {
-        modelObject = translateCurveExponentialDecay(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_DoubleExponentialDecay: {
-        modelObject = translateCurveDoubleExponentialDecay(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_ExponentialSkewNormal: {
-        modelObject = translateCurveExponentialSkewNormal(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_FanPressureRise: {
-        modelObject = translateCurveFanPressureRise(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Functional_PressureDrop: {
-        modelObject = translateCurveFunctionalPressureDrop(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Linear: {
-        modelObject = translateCurveLinear(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_QuadLinear: {
-        modelObject = translateCurveQuadLinear(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_QuintLinear: {
-        modelObject = translateCurveQuintLinear(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Quadratic: {
-        modelObject = translateCurveQuadratic(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_QuadraticLinear: {
-        modelObject = translateCurveQuadraticLinear(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Quartic: {
-        modelObject = translateCurveQuartic(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_RectangularHyperbola1: {
-        modelObject = translateCurveRectangularHyperbola1(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_RectangularHyperbola2: {
-        modelObject = translateCurveRectangularHyperbola2(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Sigmoid: {
-        modelObject = translateCurveSigmoid(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Curve_Triquadratic: {
-        modelObject = translateCurveTriquadratic(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Daylighting_Controls: {
-        modelObject = translateDaylightingControls(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::DesignSpecification_OutdoorAir: {
-        // Call this directly because we don't want to translate all of them
-        // only those that are connected to the SizingZone object
-        //modelObject = translateDesignSpecificationOutdoorAir(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ElectricEquipment: {
-        modelObject = translateElectricEquipment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Exterior_Lights: {
-        modelObject = translateExteriorLights(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Exterior_FuelEquipment: {
-        modelObject = translateExteriorFuelEquipment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Exterior_WaterEquipment: {
-        modelObject = translateExteriorWaterEquipment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ElectricLoadCenter_Storage_Simple: {
-        modelObject = translateElectricLoadCenterStorageSimple(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ElectricLoadCenter_Storage_Converter: {
-        modelObject = translateElectricLoadCenterStorageConverter(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ElectricLoadCenter_Storage_LiIonNMCBattery: {
-        modelObject = translateElectricLoadCenterStorageLiIonNMCBattery(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_Actuator: {
-        modelObject = translateEnergyManagementSystemActuator(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_ConstructionIndexVariable: {
-        modelObject = translateEnergyManagementSystemConstructionIndexVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_CurveOrTableIndexVariable: {
-        modelObject = translateEnergyManagementSystemCurveOrTableIndexVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_GlobalVariable: {
-        modelObject = translateEnergyManagementSystemGlobalVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_InternalVariable: {
-        modelObject = translateEnergyManagementSystemInternalVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_MeteredOutputVariable: {
-        modelObject = translateEnergyManagementSystemMeteredOutputVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_OutputVariable: {
-        modelObject = translateEnergyManagementSystemOutputVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_Program: {
-        modelObject = translateEnergyManagementSystemProgram(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_ProgramCallingManager: {
-        modelObject = translateEnergyManagementSystemProgramCallingManager(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_Sensor: {
-        modelObject = translateEnergyManagementSystemSensor(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_Subroutine: {
-        modelObject = translateEnergyManagementSystemSubroutine(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnergyManagementSystem_TrendVariable: {
-        modelObject = translateEnergyManagementSystemTrendVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EvaporativeCooler_Direct_ResearchSpecial: {
-        //modelObject = translateEvaporativeCoolerDirectResearchSpecial(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EvaporativeFluidCooler_SingleSpeed: {
-        modelObject = translateEvaporativeFluidCoolerSingleSpeed(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Fan_ComponentModel: {
-        modelObject = translateFanComponentModel(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Fan_ConstantVolume: {
-        //modelObject = translateFanConstantVolume(workspaceObject );
-        break;
-      }
-      case openstudio::IddObjectType::Fan_SystemModel: {
-        modelObject = translateFanSystemModel(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::FenestrationSurface_Detailed: {
-        modelObject = translateFenestrationSurfaceDetailed(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Foundation_Kiva: {
-        modelObject = translateFoundationKiva(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Foundation_Kiva_Settings: {
-        modelObject = translateFoundationKivaSettings(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Generator_MicroTurbine: {
-        modelObject = translateGeneratorMicroTurbine(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Generator_WindTurbine: {
-        modelObject = translateGeneratorWindTurbine(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::GlobalGeometryRules: {
-        // added by geometry translator, do not add to untranslated objects
-        addToUntranslated = false;
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::GasEquipment: {
-        modelObject = translateGasEquipment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::GroundHeatExchanger_System: {
-        //modelObject = translateGroundHeatExchangerVertical(workspaceObject );
-        break;
-      }
-      case openstudio::IddObjectType::HeatBalanceAlgorithm: {
-        modelObject = translateHeatBalanceAlgorithm(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::HotWaterEquipment: {
-        modelObject = translateHotWaterEquipment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::HVACTemplate_Thermostat: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::InternalMass: {
-        modelObject = translateInternalMass(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Lights: {
-        modelObject = translateLights(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Material: {
-        modelObject = translateMaterial(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Material_AirGap: {
-        modelObject = translateMaterialAirGap(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Material_NoMass: {
-        modelObject = translateMaterialNoMass(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::MaterialProperty_GlazingSpectralData: {
-        modelObject = translateMaterialPropertyGlazingSpectralData(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Meter_Custom: {
-        modelObject = translateMeterCustom(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Meter_CustomDecrement: {
-        modelObject = translateMeterCustomDecrement(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::OtherEquipment: {
-        modelObject = translateOtherEquipment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::OutdoorAir_Mixer: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::OutdoorAir_Node: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::OutdoorAir_NodeList: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::Output_DebuggingData: {
-        modelObject = translateOutputDebuggingData(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Diagnostics: {
-        modelObject = translateOutputDiagnostics(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_EnergyManagementSystem: {
-        modelObject = translateOutputEnergyManagementSystem(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_JSON: {
-        modelObject = translateOutputJSON(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_SQLite: {
-        modelObject = translateOutputSQLite(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_EnvironmentalImpactFactors: {
-        modelObject = translateOutputEnvironmentalImpactFactors(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::EnvironmentalImpactFactors: {
-        modelObject = translateEnvironmentalImpactFactors(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::FuelFactors: {
-        modelObject = translateFuelFactors(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_IlluminanceMap: {
-        modelObject = translateOutputIlluminanceMap(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Meter: {
-        modelObject = translateOutputMeter(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Meter_Cumulative: {
-        modelObject = translateOutputMeterCumulative(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Meter_Cumulative_MeterFileOnly: {
-        modelObject = translateOutputMeterCumulativeMeterFileOnly(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Meter_MeterFileOnly: {
-        modelObject = translateOutputMeterMeterFileOnly(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Table_Monthly: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::Output_Table_SummaryReports: {
-        modelObject = translateOutputTableSummaryReports(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Variable: {
-        modelObject = translateOutputVariable(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::OutputControl_Files: {
-        modelObject = translateOutputControlFiles(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::OutputControl_ReportingTolerances: {
-        modelObject = translateOutputControlReportingTolerances(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::OutputControl_Table_Style: {
-        modelObject = translateOutputControlTableStyle(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::OutputControl_Timestamp: {
-        modelObject = translateOutputControlTimestamp(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Schedules: {
-        modelObject = translateOutputSchedules(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Output_Constructions: {
-        modelObject = translateOutputConstructions(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::People: {
-        modelObject = translatePeople(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::PerformancePrecisionTradeoffs: {
-        modelObject = translatePerformancePrecisionTradeoffs(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::PhotovoltaicPerformance_Sandia: {
-        modelObject = translatePhotovoltaicPerformanceSandia(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Refrigeration_Case: {
-        // modelObject = translateRefrigerationCase(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Refrigeration_Compressor: {
-        // modelObject = translateRefrigerationCompressor(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::RunPeriod: {
-        modelObject = translateRunPeriod(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::RunPeriodControl_DaylightSavingTime: {
-        modelObject = translateRunPeriodControlDaylightSavingTime(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::RunPeriodControl_SpecialDays: {
-        modelObject = translateRunPeriodControlSpecialDays(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Schedule_Compact: {
-        modelObject = translateScheduleCompact(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Schedule_Constant: {
-        modelObject = translateScheduleConstant(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Schedule_Day_Hourly: {
-        modelObject = translateScheduleDayHourly(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Schedule_File: {
-        modelObject = translateScheduleFile(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Schedule_Day_Interval: {
-        modelObject = translateScheduleDayInterval(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ScheduleTypeLimits: {
-        modelObject = translateScheduleTypeLimits(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Schedule_Week_Daily: {
-        modelObject = translateScheduleWeekDaily(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Schedule_Year: {
-        modelObject = translateScheduleYear(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SetpointManager_MixedAir: {
-        //modelObject = translateSetpointManagerMixedAir(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SetpointManager_Scheduled: {
-        //modelObject = translateSetpointManagerScheduled(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SetpointManager_SingleZone_Reheat: {
-        //modelObject = translateSetpointManagerSingleZoneReheat(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SetpointManager_SystemNodeReset_Humidity: {
-        //modelObject = translateSetpointManagerSystemNodeResetHumidity(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SetpointManager_SystemNodeReset_Temperature: {
-        //modelObject = translateSetpointManagerSystemNodeResetTemperature(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Shading_Building_Detailed: {
-        modelObject = translateShadingBuildingDetailed(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Shading_Site_Detailed: {
-        modelObject = translateShadingSiteDetailed(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Shading_Zone_Detailed: {
-        modelObject = translateShadingZoneDetailed(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ShadowCalculation: {
-        modelObject = translateShadowCalculation(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SimulationControl: {
-        modelObject = translateSimulationControl(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Site_Location: {
-        modelObject = translateSiteLocation(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Site_GroundReflectance: {
-        //modelObject = translateSiteGroundReflectance(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Site_GroundTemperature_BuildingSurface: {
-        //modelObject = translateSiteGroundTemperatureBuildingSurface(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Site_WaterMainsTemperature: {
-        //modelObject = translateSiteWaterMainsTemperature(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Sizing_Parameters: {
-        modelObject = translateSizingParameters(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SizingPeriod_DesignDay: {
-        modelObject = translateSizingPeriodDesignDay(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SolarCollectorPerformance_PhotovoltaicThermal_BIPVT: {
-        modelObject = translateSolarCollectorPerformancePhotovoltaicThermalBIPVT(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Sizing_System: {
-        //modelObject = translateSizingSystem(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Sizing_Zone: {
-        modelObject = translateSizingZone(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SteamEquipment: {
-        modelObject = translateSteamEquipment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceControl_MovableInsulation: {
-        modelObject = translateSurfaceControlMovableInsulation(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceConvectionAlgorithm_Inside: {
-        //modelObject = translateSurfaceConvectionAlgorithmInside(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceConvectionAlgorithm_Outside: {
-        //modelObject = translateSurfaceConvectionAlgorithmOutside(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceProperty_ExposedFoundationPerimeter: {
-        modelObject = translateSurfacePropertyExposedFoundationPerimeter(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceProperty_GroundSurfaces: {
-        modelObject = translateSurfacePropertyGroundSurfaces(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceProperty_IncidentSolarMultiplier: {
-        modelObject = translateSurfacePropertyIncidentSolarMultiplier(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceProperty_LocalEnvironment: {
-        modelObject = translateSurfacePropertyLocalEnvironment(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceProperty_OtherSideConditionsModel: {
-        modelObject = translateSurfacePropertyOtherSideConditionsModel(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SurfaceProperty_SurroundingSurfaces: {
-        modelObject = translateSurfacePropertySurroundingSurfaces(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::SwimmingPool_Indoor: {
-        // modelObject = translateSwimmingPoolIndoor(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Table_Lookup: {
-        modelObject = translateTableLookup(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Table_IndependentVariableList: {
-        break;  // Done via translateTableLookup
-      }
-      case openstudio::IddObjectType::Table_IndependentVariable: {
-        break;  // Done via translateTableLookup
-      }
-
-      case openstudio::IddObjectType::ThermostatSetpoint_DualSetpoint: {
-        modelObject = translateThermostatSetpointDualSetpoint(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Timestep: {
-        modelObject = translateTimestep(workspaceObject);
-        break;
-      }
-
-        // TODO: once UtilityCost objects are wrapped (and ReverseTranslated)
-        //case openstudio::IddObjectType::OS_UtilityCost_Charge_Block:
-        //{
-        //break; // no-op
-        //}
-        //case openstudio::IddObjectType::UtilityCost_Charge_Simple :
-        //{
-        //break; // no-op
-        //}
-        //case openstudio::IddObjectType::UtilityCost_Computation :
-        //{
-        //break; // no-op
-        //}
-        //case openstudio::IddObjectType::UtilityCost_Qualify :
-        //{
-        //break; // no-op
-        //}
-        //case openstudio::IddObjectType::UtilityCost_Ratchet :
-        //{
-        //break; // no-op
-        //}
-        //case openstudio::IddObjectType::UtilityCost_Tariff :
-        //{
-        //break; // no-op
-        //}
-        //case openstudio::IddObjectType::UtilityCost_Variable :
-        //{
-        //break; // no-op
-        //}
-
-      case openstudio::IddObjectType::Version: {
-        modelObject = translateVersion(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::WindowMaterial_Gas: {
-        modelObject = translateWindowMaterialGas(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::WindowMaterial_Glazing: {
-        modelObject = translateWindowMaterialGlazing(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::WindowMaterial_SimpleGlazingSystem: {
-        modelObject = translateWindowMaterialSimpleGlazingSystem(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::WindowProperty_FrameAndDivider: {
-        modelObject = translateWindowPropertyFrameAndDivider(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::WindowShadingControl: {
-        modelObject = translateWindowShadingControl(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::Zone: {
-        modelObject = translateZone(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneAirHeatBalanceAlgorithm: {
-        modelObject = translateZoneAirHeatBalanceAlgorithm(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneAirMassFlowConservation: {
-        modelObject = translateZoneAirMassFlowConservation(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneControl_Thermostat: {
-        break;  // no-op
-      }
-      case openstudio::IddObjectType::ZoneCrossMixing: {
-        modelObject = translateZoneCrossMixing(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneHVAC_EquipmentList: {
-        //modelObject = translateZoneHVACEquipmentList(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneHVAC_IdealLoadsAirSystem: {
-        //modelObject = translateZoneHVACIdealLoadsAirSystem(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneInfiltration_DesignFlowRate: {
-        modelObject = translateZoneInfiltrationDesignFlowRate(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneInfiltration_EffectiveLeakageArea: {
-        modelObject = translateZoneInfiltrationEffectiveLeakageArea(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneInfiltration_FlowCoefficient: {
-        modelObject = translateZoneInfiltrationFlowCoefficient(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneList: {
-        modelObject = translateZoneList(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneMixing: {
-        modelObject = translateZoneMixing(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneProperty_UserViewFactors_BySurfaceName: {
-        modelObject = translateZonePropertyUserViewFactorsBySurfaceName(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneVentilation_DesignFlowRate: {
-        modelObject = translateZoneVentilationDesignFlowRate(workspaceObject);
-        break;
-      }
-      case openstudio::IddObjectType::ZoneVentilation_WindandStackOpenArea: {
-        modelObject = translateZoneVentilationWindandStackOpenArea(workspaceObject);
-        break;
-      }
-      default: {
-        break;  // no-op
-      }
+    const IddObjectType iddObjectType = workspaceObject.iddObject().type();
+    if (auto translate = findWorkspaceObjectTranslator(iddObjectType)) {
+      // Model::numObjects builds the vector of objects, numAllObjects is a simple lookup
+      const auto* modelImpl = m_model.getImpl<openstudio::detail::Workspace_Impl>().get();
+      m_translationProfiler.start(iddObjectType, modelImpl->numAllObjects());
+      modelObject = (this->*translate)(workspaceObject);
+      m_translationProfiler.stop(modelImpl->numAllObjects());
+    } else if (iddObjectType == IddObjectType::GlobalGeometryRules) {
+      // added by geometry translator, do not add to untranslated objects
+      addToUntranslated = false;
     }
 
     if (modelObject) {
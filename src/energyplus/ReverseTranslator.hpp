@@ -7,6 +7,7 @@
 #define ENERGYPLUS_REVERSETRANSLATOR_HPP
 
 #include "EnergyPlusAPI.hpp"
+#include "TranslationProfile.hpp"
 #include "../model/Model.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
@@ -35,6 +36,9 @@ namespace energyplus {
     /** Get IdfObjects that were passed over by the last translation. */
     std::vector<IdfObject> untranslatedIdfObjects() const;
 
+    /** Per IddObjectType statistics (count, wall time, ModelObjects created) of the last translation, sorted by decreasing self time */
+    std::vector<TranslationProfileEntry> translationProfile() const;
+
    private:
     REGISTER_LOGGER("openstudio.energyplus.ReverseTranslator");
 
@@ -53,6 +57,21 @@ namespace energyplus {
    */
     boost::optional<model::ModelObject> translateAndMapWorkspaceObject(const WorkspaceObject& workspaceObject);
 
+    /** Entry of the registry used by translateAndMapWorkspaceObject to dispatch a WorkspaceObject to its type specific translator */
+    struct WorkspaceObjectTranslator
+    {
+      using TranslateFunction = boost::optional<model::ModelObject> (ReverseTranslator::*)(const WorkspaceObject& workspaceObject);
+
+      IddObjectType::domain iddObjectType;
+      TranslateFunction translate;
+    };
+
+    /** The translator registry, one entry per IddObjectType that is translated */
+    static const std::vector<WorkspaceObjectTranslator>& workspaceObjectTranslators();
+
+    /** O(1) lookup in the registry, returns nullptr if objects of this type are not translated */
+    static WorkspaceObjectTranslator::TranslateFunction findWorkspaceObjectTranslator(const IddObjectType& iddObjectType);
+
     boost::optional<model::ModelObject> translateAirLoopHVAC(const WorkspaceObject& workspaceObject);
 
     boost::optional<model::ModelObject> translateAirLoopHVACOutdoorAirSystem(const WorkspaceObject& workspaceObject);
@@ -416,6 +435,8 @@ namespace energyplus {
     StringStreamLogSink m_logSink;
 
     ProgressBar* m_progressBar;
+
+    detail::TranslationProfiler m_translationProfiler;
   };
 
   ENERGYPLUS_API boost::optional<openstudio::model::Model> loadAndTranslateIdf(const openstudio::path& path);
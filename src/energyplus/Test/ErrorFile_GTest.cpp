@@ -90,3 +90,51 @@ TEST_F(EnergyPlusFixture, ErrorFile_WarningsAndCrash) {
   EXPECT_FALSE(errorFile.completed());
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
+
+TEST_F(EnergyPlusFixture, ErrorFile_RepeatingWarnings) {
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile errorFile(path);
+  ASSERT_EQ(static_cast<unsigned>(52), errorFile.warnings().size());
+  EXPECT_EQ(static_cast<unsigned>(0), errorFile.severeErrors().size());
+  EXPECT_EQ(static_cast<unsigned>(0), errorFile.fatalErrors().size());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+
+  // Every warning is counted in exactly one record
+  std::vector<openstudio::energyplus::ErrorFileRecord> records = errorFile.records();
+  ASSERT_EQ(static_cast<unsigned>(12), records.size());
+  unsigned total = 0;
+  for (const auto& record : records) {
+    EXPECT_EQ(openstudio::energyplus::ErrorLevel::Warning, record.level.value());
+    total += record.count;
+  }
+  EXPECT_EQ(static_cast<unsigned>(52), total);
+
+  // Records keep the first occurrence, with its continuation lines
+  EXPECT_EQ("IP: Note -- Some missing fields have been filled with defaults. See the audit output file for details.", records[0].message);
+  EXPECT_TRUE(records[0].continuationLines.empty());
+  EXPECT_EQ(static_cast<unsigned>(1), records[0].count);
+  EXPECT_EQ("GetSurfaces: Surfaces with interface to Ground found but no \"Ground Temperatures\" were input.", records[1].message);
+  ASSERT_EQ(static_cast<unsigned>(2), records[1].continuationLines.size());
+  EXPECT_EQ(" Found first in surface=SURFACE 21", records[1].continuationLines[0]);
+  EXPECT_EQ(" Defaults, constant throughout the year of (18.0) will be used.", records[1].continuationLines[1]);
+
+  std::vector<openstudio::energyplus::ErrorFileRecord> repeated = errorFile.repeatedRecords(openstudio::energyplus::ErrorLevel::Warning);
+  ASSERT_EQ(static_cast<unsigned>(6), repeated.size());
+  EXPECT_EQ(static_cast<unsigned>(13), repeated[0].count);
+  EXPECT_EQ("SimHVAC: Maximum iterations (#) exceeded for all HVAC loops, at RUN PERIOD #, #/# #:# - #:#", repeated[0].messageTemplate);
+  EXPECT_EQ(static_cast<unsigned>(2), repeated.back().count);
+  EXPECT_EQ("Output:Meter: invalid Name=\"*\" - not found.", repeated.back().messageTemplate);
+
+  EXPECT_TRUE(errorFile.repeatedRecords(openstudio::energyplus::ErrorLevel::Severe).empty());
+}
+
+TEST_F(EnergyPlusFixture, ErrorFile_MessageTemplate) {
+  EXPECT_EQ("Out of range value Numeric Field## (Lighting Level), value=-#, range={>=#}, in LIGHTS=ZN_#_FLR_#_SEC_#_LIGHTS",
+            ErrorFile::messageTemplate(
+              "Out of range value Numeric Field#1 (Lighting Level), value=-1527598.22490, range={>=0}, in LIGHTS=ZN_1_FLR_1_SEC_1_LIGHTS"));
+  EXPECT_EQ("Latitude difference=[#] degrees, Longitude difference=[#] degrees.",
+            ErrorFile::messageTemplate("Latitude difference=[0.28] degrees, Longitude difference=[7.00E-002] degrees."));
+  EXPECT_EQ("Coil \"*\" and \"*\", unterminated \"quote", ErrorFile::messageTemplate("Coil \"COIL 1\" and \"\", unterminated \"quote"));
+}
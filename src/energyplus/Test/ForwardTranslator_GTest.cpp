@@ -29,6 +29,7 @@
 #include "../../model/ThermalZone.hpp"
 #include "../../model/Space.hpp"
 #include "../../model/Lights.hpp"
+#include "../../model/LightsDefinition.hpp"
 #include "../../model/AirLoopHVAC.hpp"
 #include "../../model/Schedule.hpp"
 #include "../../model/ScheduleCompact.hpp"
@@ -986,3 +987,92 @@ TEST_F(EnergyPlusFixture, NoUselessWarnings) {
                  [](const auto& logMessage) { return logMessage.logMessage(); });
   EXPECT_EQ(0, logMessages.size()) << fmt::format("Expected no messages logged, got: {}", logStrings);
 }
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslatorRegistry) {
+  std::vector<IddObjectType> registeredTypes = ForwardTranslator::registeredIddObjectTypes();
+  EXPECT_FALSE(registeredTypes.empty());
+  // One entry per type
+  std::set<IddObjectType> uniqueTypes(registeredTypes.begin(), registeredTypes.end());
+  EXPECT_EQ(registeredTypes.size(), uniqueTypes.size());
+  EXPECT_EQ(1u, uniqueTypes.count(IddObjectType::OS_Lights));
+  EXPECT_EQ(0u, uniqueTypes.count(IddObjectType::Lights));
+
+  Model m;
+  ThermalZone z(m);
+  Space space(m);
+  space.setThermalZone(z);
+  LightsDefinition lightsDefinition(m);
+  Lights lights(lightsDefinition);
+  lights.setSpace(space);
+
+  ForwardTranslator ft;
+  EXPECT_TRUE(ft.isTranslationEnabled(IddObjectType::OS_Lights));
+  Workspace w = ft.translateModel(m);
+  EXPECT_EQ(1u, w.getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_EQ(1u, w.getObjectsByType(IddObjectType::Lights).size());
+
+  ft.setTranslationEnabled(IddObjectType::OS_Lights, false);
+  EXPECT_FALSE(ft.isTranslationEnabled(IddObjectType::OS_Lights));
+  w = ft.translateModel(m);
+  EXPECT_EQ(1u, w.getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_EQ(0u, w.getObjectsByType(IddObjectType::Lights).size());
+
+  ft.setTranslationEnabled(IddObjectType::OS_Lights, true);
+  w = ft.translateModel(m);
+  EXPECT_EQ(1u, w.getObjectsByType(IddObjectType::Lights).size());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslationProfile) {
+  Model m;
+  ThermalZone z(m);
+  Space space(m);
+  space.setThermalZone(z);
+  LightsDefinition lightsDefinition(m);
+  Lights lights1(lightsDefinition);
+  lights1.setSpace(space);
+  Lights lights2(lightsDefinition);
+  lights2.setSpace(space);
+
+  ForwardTranslator ft;
+  EXPECT_TRUE(ft.translationProfile().empty());
+
+  Workspace w = ft.translateModel(m);
+  std::vector<TranslationProfileEntry> profile = ft.translationProfile();
+  ASSERT_FALSE(profile.empty());
+
+  auto findEntry = [&profile](IddObjectType iddObjectType) -> boost::optional<TranslationProfileEntry> {
+    auto it = std::find_if(profile.cbegin(), profile.cend(), [&iddObjectType](const auto& entry) { return entry.iddObjectType == iddObjectType; });
+    if (it == profile.cend()) {
+      return boost::none;
+    }
+    return *it;
+  };
+
+  auto lightsEntry = findEntry(IddObjectType::OS_Lights);
+  ASSERT_TRUE(lightsEntry);
+  EXPECT_EQ(2u, lightsEntry->count);
+  EXPECT_EQ(2u, lightsEntry->objectsCreated);
+
+  auto zoneEntry = findEntry(IddObjectType::OS_ThermalZone);
+  ASSERT_TRUE(zoneEntry);
+  EXPECT_EQ(1u, zoneEntry->count);
+
+  EXPECT_FALSE(findEntry(IddObjectType::Lights));
+
+  for (size_t i = 0; i < profile.size(); ++i) {
+    EXPECT_GT(profile[i].count, 0u);
+    EXPECT_GE(profile[i].selfTime, 0.0);
+    EXPECT_LE(profile[i].selfTime, profile[i].totalTime);
+    if (i > 0) {
+      // Sorted by decreasing self time
+      EXPECT_GE(profile[i - 1].selfTime, profile[i].selfTime);
+    }
+  }
+
+  // The profile is reset by each translation
+  ft.translateModel(m);
+  profile = ft.translationProfile();
+  lightsEntry = findEntry(IddObjectType::OS_Lights);
+  ASSERT_TRUE(lightsEntry);
+  EXPECT_EQ(2u, lightsEntry->count);
+}
@@ -0,0 +1,61 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "TranslationProfile.hpp"
+
+#include "../utilities/core/Assert.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+namespace energyplus {
+
+  namespace detail {
+
+    void TranslationProfiler::reset() {
+      m_stack.clear();
+      m_entries.clear();
+    }
+
+    void TranslationProfiler::start(const IddObjectType& iddObjectType, std::size_t numObjects) {
+      m_stack.push_back(Frame{iddObjectType.value(), Clock::now(), numObjects});
+    }
+
+    void TranslationProfiler::stop(std::size_t numObjects) {
+      OS_ASSERT(!m_stack.empty());
+
+      const Frame frame = m_stack.back();
+      m_stack.pop_back();
+
+      const Clock::duration duration = Clock::now() - frame.start;
+      // Objects may be removed during translation, don't let the counts wrap around
+      const std::size_t numCreated = (numObjects > frame.startNumObjects) ? (numObjects - frame.startNumObjects) : 0;
+
+      auto& entry = m_entries.try_emplace(frame.iddObjectType, IddObjectType(frame.iddObjectType)).first->second;
+      ++entry.count;
+      entry.totalTime += std::chrono::duration<double>(duration).count();
+      entry.selfTime += std::chrono::duration<double>(duration - frame.nestedDuration).count();
+      entry.objectsCreated += static_cast<unsigned>(numCreated - std::min(numCreated, frame.nestedNumObjects));
+
+      if (!m_stack.empty()) {
+        m_stack.back().nestedDuration += duration;
+        m_stack.back().nestedNumObjects += numCreated;
+      }
+    }
+
+    std::vector<TranslationProfileEntry> TranslationProfiler::profile() const {
+      std::vector<TranslationProfileEntry> result;
+      result.reserve(m_entries.size());
+      for (const auto& [value, entry] : m_entries) {
+        result.push_back(entry);
+      }
+      std::stable_sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) { return lhs.selfTime > rhs.selfTime; });
+      return result;
+    }
+
+  }  // namespace detail
+
+}  // namespace energyplus
+}  // namespace openstudio
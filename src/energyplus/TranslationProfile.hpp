@@ -0,0 +1,87 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef ENERGYPLUS_TRANSLATIONPROFILE_HPP
+#define ENERGYPLUS_TRANSLATIONPROFILE_HPP
+
+#include "EnergyPlusAPI.hpp"
+
+#include "../utilities/idd/IddEnums.hpp"
+#include <utilities/idd/IddEnums.hxx>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace openstudio {
+namespace energyplus {
+
+  /** Translation statistics for all the objects of a given IddObjectType, see ForwardTranslator::translationProfile and
+   *  ReverseTranslator::translationProfile */
+  struct ENERGYPLUS_API TranslationProfileEntry
+  {
+    TranslationProfileEntry() : iddObjectType(IddObjectType::Catchall) {}
+    explicit TranslationProfileEntry(const IddObjectType& t_iddObjectType) : iddObjectType(t_iddObjectType) {}
+
+    /** The IddObjectType of the translated objects (an OS: type for the ForwardTranslator, an EnergyPlus type for the ReverseTranslator) */
+    IddObjectType iddObjectType;
+
+    /** Number of objects of that type that were translated */
+    unsigned count = 0;
+
+    /** Cumulative wall time (in seconds) spent in the translator for that type, including the translation of related objects it triggered */
+    double totalTime = 0.0;
+
+    /** Same as totalTime, but excluding the time spent in the nested translations of related objects */
+    double selfTime = 0.0;
+
+    /** Number of objects (IdfObjects for the ForwardTranslator, ModelObjects for the ReverseTranslator) created by the translator for that
+     *  type, excluding those created by nested translations */
+    unsigned objectsCreated = 0;
+  };
+
+  namespace detail {
+
+    /** Accumulates TranslationProfileEntry as objects are translated. Translations can be nested (a translator calls
+     *  translateAndMapModelObject on related objects), each start must be matched by a stop. */
+    class ENERGYPLUS_API TranslationProfiler
+    {
+     public:
+      void reset();
+
+      /** Starts timing the translation of an object of type iddObjectType, numObjects is the current number of objects in the target */
+      void start(const IddObjectType& iddObjectType, std::size_t numObjects);
+
+      /** Stops timing the translation started by the matching start call */
+      void stop(std::size_t numObjects);
+
+      /** Entries for all types that were translated at least once, sorted by decreasing selfTime */
+      std::vector<TranslationProfileEntry> profile() const;
+
+     private:
+      using Clock = std::chrono::steady_clock;
+
+      struct Frame
+      {
+        int iddObjectType;
+        Clock::time_point start;
+        std::size_t startNumObjects;
+        Clock::duration nestedDuration{};
+        std::size_t nestedNumObjects = 0;
+      };
+
+      std::vector<Frame> m_stack;
+
+      // Keyed by IddObjectType value
+      std::map<int, TranslationProfileEntry> m_entries;
+    };
+
+  }  // namespace detail
+
+}  // namespace energyplus
+}  // namespace openstudio
+
+#endif  // ENERGYPLUS_TRANSLATIONPROFILE_HPP
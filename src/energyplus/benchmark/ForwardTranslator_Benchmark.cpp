@@ -58,6 +58,25 @@ static void BM_FT_ExampleModel_newFT(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// state.range(0): level of the log file, messages below it are not formatted since no enabled sink accepts them
+static void BM_FT_ExampleModel_LogLevel(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark_LogLevel.log"));
+  logFile.setLogLevel(static_cast<LogLevel>(state.range(0)));
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+
+  for (auto _ : state) {
+    Workspace workspace = forwardTranslator.translateModel(model);
+  }
+
+  // Don't leave a Trace sink enabled for the other benchmarks
+  logFile.disable();
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -71,3 +90,5 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_FT_ExampleModel_newFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
 
 BENCHMARK(BM_FT_ExampleModel_sameFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
+
+BENCHMARK(BM_FT_ExampleModel_LogLevel)->Unit(benchmark::kMillisecond)->Arg(Trace)->Arg(Debug)->Arg(Error);
@@ -11,6 +11,8 @@
 
 // You're better off just loading the json directly in the target language, so ignore
 %ignore openstudio::epJSON::loadJSON;
+%ignore openstudio::epJSON::visitJSONObjects;
+%ignore openstudio::epJSON::writeJSON;
 #ifdef SWIGCSHARP
 %ignore openstudio::epJSON::toJSON;
 #endif
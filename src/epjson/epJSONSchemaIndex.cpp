@@ -0,0 +1,183 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "epJSONSchemaIndex.hpp"
+#include "epJSONTranslator.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <json/json.h>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace openstudio::epJSON {
+
+namespace {
+
+  JSONValueType decodeType(const Json::Value& type) {
+    if (type.isNull() || !type.isString()) {
+      return JSONValueType::NumberOrString;
+    }
+
+    const std::string& typeStr = type.asString();
+    if (typeStr == "string") {
+      return JSONValueType::String;
+    } else if (typeStr == "number") {
+      return JSONValueType::Number;
+    } else if (typeStr == "integer") {
+      return JSONValueType::Integer;
+    } else if (typeStr == "object") {
+      return JSONValueType::Object;
+    } else if (typeStr == "array") {
+      return JSONValueType::Array;
+    }
+
+    return JSONValueType::NumberOrString;
+  }
+
+  void appendChoices(const Json::Value& enumOptions, std::vector<std::pair<std::string, std::string>>& choices) {
+    if (!enumOptions.isArray()) {
+      return;
+    }
+    for (const auto& enumOption : enumOptions) {
+      if (enumOption.isString()) {
+        const std::string& enumStr = enumOption.asString();
+        choices.emplace_back(boost::to_lower_copy(enumStr), enumStr);
+      }
+    }
+  }
+
+  SchemaFieldInfo makeFieldInfo(const Json::Value& fieldProperties) {
+    SchemaFieldInfo result;
+    if (!fieldProperties.isObject()) {
+      return result;
+    }
+
+    result.type = decodeType(fieldProperties["type"]);
+
+    const Json::Value& enumOptions = fieldProperties["enum"];
+    result.hasEnum = !enumOptions.isNull();
+    appendChoices(enumOptions, result.enumChoices);
+
+    const Json::Value& anyOf = fieldProperties["anyOf"];
+    if (anyOf.isArray()) {
+      for (const auto& possibleValues : anyOf) {
+        appendChoices(possibleValues["enum"], result.anyOfChoices);
+      }
+    }
+
+    return result;
+  }
+
+  std::unordered_map<std::string, SchemaFieldInfo> makeFieldInfos(const Json::Value& properties) {
+    std::unordered_map<std::string, SchemaFieldInfo> result;
+    if (!properties.isObject()) {
+      return result;
+    }
+    result.reserve(properties.size());
+    for (auto it = properties.begin(); it != properties.end(); ++it) {
+      result.emplace(it.name(), makeFieldInfo(*it));
+    }
+    return result;
+  }
+
+  /** schema root > properties > [type_description] (ObjectName) > patternProperties > "^.*\\S.*$" > properties */
+  SchemaObjectInfo makeObjectInfo(const Json::Value& objectSchema) {
+    SchemaObjectInfo result;
+
+    const Json::Value& patternProperties = objectSchema["patternProperties"];
+    if (!patternProperties.isObject() || patternProperties.empty()) {
+      return result;
+    }
+    result.found = true;
+
+    const Json::Value& objectProperties = (*patternProperties.begin())["properties"];
+    result.fields = makeFieldInfos(objectProperties);
+
+    // The extensible group is the first 'array' property (in member name order, like getMemberNames)
+    if (objectProperties.isObject()) {
+      for (const auto& propertyName : objectProperties.getMemberNames()) {
+        const Json::Value& property = objectProperties[propertyName];
+        const Json::Value& type = property["type"];
+        if (type.isString() && (type.asString() == "array")) {
+          result.groupName = propertyName;
+          result.isArrayGroup = true;
+          result.groupFields = makeFieldInfos(property["items"]["properties"]);
+          break;
+        }
+      }
+    }
+
+    const Json::Value& legacyFields = objectSchema["legacy_idd"]["fields"];
+    if (legacyFields.isArray()) {
+      result.legacyFieldNames.reserve(legacyFields.size());
+      for (const auto& legacyField : legacyFields) {
+        result.legacyFieldNames.emplace_back(legacyField.isString() ? legacyField.asString() : std::string());
+      }
+    }
+
+    return result;
+  }
+
+}  // namespace
+
+const SchemaFieldInfo* SchemaObjectInfo::field(const std::string& group_name, const std::string& field_name) const {
+  const auto& lookup = group_name.empty() ? fields : groupFields;
+  if (auto it = lookup.find(field_name); it != lookup.end()) {
+    return &it->second;
+  }
+  return nullptr;
+}
+
+SchemaIndex::SchemaIndex(const Json::Value& schema) {
+  const Json::Value& properties = schema["properties"];
+  if (!properties.isObject()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "epJSON schema has no 'properties', the SchemaIndex will be empty");
+    return;
+  }
+
+  m_objects.reserve(properties.size());
+  for (auto it = properties.begin(); it != properties.end(); ++it) {
+    m_objects.emplace(it.name(), makeObjectInfo(*it));
+  }
+}
+
+std::shared_ptr<const SchemaIndex> SchemaIndex::load(const openstudio::path& schemaPath) {
+  static std::mutex cacheMutex;
+  static std::map<openstudio::path, std::shared_ptr<const SchemaIndex>> cache;
+
+  const std::lock_guard<std::mutex> lock(cacheMutex);
+  if (auto it = cache.find(schemaPath); it != cache.end()) {
+    return it->second;
+  }
+
+  // The schema DOM is only alive while the index is being built
+  const Json::Value schema = loadJSON(schemaPath);
+  if (schema.isNull()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaPath);
+    return nullptr;
+  }
+
+  auto index = std::make_shared<const SchemaIndex>(schema);
+  cache.emplace(schemaPath, index);
+  return index;
+}
+
+const SchemaObjectInfo& SchemaIndex::object(const std::string& type_description) const {
+  static const SchemaObjectInfo notFound;
+  if (auto it = m_objects.find(type_description); it != m_objects.end()) {
+    return it->second;
+  }
+  return notFound;
+}
+
+std::size_t SchemaIndex::numObjects() const {
+  return m_objects.size();
+}
+
+}  // namespace openstudio::epJSON
@@ -0,0 +1,98 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef EPJSON_EPJSONSCHEMAINDEX_HPP
+#define EPJSON_EPJSONSCHEMAINDEX_HPP
+
+#include "epJSONAPI.hpp"
+
+#include "../utilities/core/Filesystem.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Json {
+class Value;
+}
+
+namespace openstudio::epJSON {
+
+enum class JSONValueType
+{
+  Number,
+  Integer,
+  String,
+  Array,
+  Object,
+  NumberOrString
+};
+
+/** Precompiled information about a single field of an epJSON schema object. */
+struct EPJSON_API SchemaFieldInfo
+{
+  /** The decoded 'type' property, NumberOrString if it is absent or unknown */
+  JSONValueType type = JSONValueType::NumberOrString;
+
+  /** Whether the field has an 'enum' property */
+  bool hasEnum = false;
+
+  /** Pairs of (lowercase, canonical) values from the 'enum' property, in schema order */
+  std::vector<std::pair<std::string, std::string>> enumChoices;
+
+  /** Pairs of (lowercase, canonical) values from all the 'anyOf' > 'enum' properties, in schema order (eg: 'Autosize', 'Autocalculate') */
+  std::vector<std::pair<std::string, std::string>> anyOfChoices;
+};
+
+/** Precompiled information about an epJSON schema object (eg: 'Zone', 'Coil:Cooling:DX:SingleSpeed') */
+struct EPJSON_API SchemaObjectInfo
+{
+  /** Whether the object was found in the schema at all */
+  bool found = false;
+
+  /** Non extensible fields, keyed by epJSON field name */
+  std::unordered_map<std::string, SchemaFieldInfo> fields;
+
+  /** Name of the first 'array' property of the object, which holds the extensible groups. Empty if there is none */
+  std::string groupName;
+  bool isArrayGroup = false;
+
+  /** Fields of the extensible group items (groupName > items > properties), keyed by epJSON field name */
+  std::unordered_map<std::string, SchemaFieldInfo> groupFields;
+
+  /** 'legacy_idd' > 'fields', used to map the IDD field index to the epJSON field name */
+  std::vector<std::string> legacyFieldNames;
+
+  /** Look up a field, in the extensible group if groupName is not empty. Returns nullptr if not found */
+  const SchemaFieldInfo* field(const std::string& group_name, const std::string& field_name) const;
+};
+
+/** SchemaIndex is a flattened, precompiled view of the epJSON schema (type > field > JSON type / enum choices)
+ *  so that translating an object does not have to walk nested string-keyed Json::Value maps for every field.
+ *  It is built once per schema file, see SchemaIndex::load. */
+class EPJSON_API SchemaIndex
+{
+ public:
+  /** Build the index from an already parsed schema */
+  explicit SchemaIndex(const Json::Value& schema);
+
+  /** Returns the (cached) index for the schema at schemaPath, parsing it only the first time it is requested.
+   *  Returns nullptr if the schema cannot be loaded. This is thread safe. */
+  static std::shared_ptr<const SchemaIndex> load(const openstudio::path& schemaPath);
+
+  /** Look up an object by its type description (eg: 'Zone'). Returns an empty SchemaObjectInfo (found = false) if not found */
+  const SchemaObjectInfo& object(const std::string& type_description) const;
+
+  std::size_t numObjects() const;
+
+ private:
+  std::unordered_map<std::string, SchemaObjectInfo> m_objects;
+};
+
+}  // namespace openstudio::epJSON
+
+#endif  // EPJSON_EPJSONSCHEMAINDEX_HPP
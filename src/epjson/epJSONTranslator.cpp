@@ -4,6 +4,7 @@
 ***********************************************************************************************************************/
 
 #include "epJSONTranslator.hpp"
+#include "epJSONSchemaIndex.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/idd/IddEnums.hpp"
@@ -18,49 +19,13 @@
 
 #include <json/json.h>
 #include <fmt/format.h>
+#include <fstream>
+#include <map>
 #include <vector>
 #include <string_view>
 
 namespace openstudio::epJSON {
 
-template <typename... KeyType>
-const Json::Value& safeLookupValue(const Json::Value& base, const KeyType&... keys) {
-  const Json::Value* obj = &base;
-  const Json::Value* last_found = &base;
-  const Json::Value* last_null = nullptr;
-
-  const auto lookupKey = [&obj, &last_found, &last_null](const auto& key) -> void {
-    if (!obj->isNull() && obj->isObject()) {
-      const Json::Value& next_obj = (*obj)[key];
-      if (!next_obj.isNull()) {
-        last_found = &next_obj;
-      } else {
-        last_null = &next_obj;
-      }
-      obj = &next_obj;
-    }
-  };
-
-  (lookupKey(keys), ...);
-
-  if (last_null != nullptr) {
-    return *last_null;
-  }
-
-  OS_ASSERT(last_found);
-  return *last_found;
-}
-
-enum class JSONValueType
-{
-  Number,
-  Integer,
-  String,
-  Array,
-  Object,
-  NumberOrString
-};
-
 const std::string& toJSONFieldName(std::map<std::string, std::string>& fieldNames, const std::string& fieldNameInput) {
 
   if (const auto& cached_value = fieldNames.find(fieldNameInput); cached_value != fieldNames.end()) {
@@ -112,70 +77,10 @@ const std::string& toJSONFieldName(std::map<std::string, std::string>& fieldName
   return cache_value(fieldNameInput, fieldName);
 }
 
-/** Locate the properties for a given object:
- *  schema root > properties > [type_description] (ObjectName) > patternProperties > "^.*\\S.*$" > properties */
-const Json::Value& getSchemaObjectProperties(const Json::Value& schema, const std::string& type_description) {
-  const auto& patternProperties = safeLookupValue(schema, "properties", type_description, "patternProperties");
-
-  if (!patternProperties.isObject()) {
-    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find epJSON schema object for patternProperties for " << type_description);
-    return patternProperties;
-  }
-
-  return safeLookupValue(patternProperties, patternProperties.getMemberNames()[0], "properties");
-}
-
-const Json::Value& getSchemaFieldNames(const Json::Value& schema, const std::string& type_description) {
-  return safeLookupValue(schema, "properties", type_description, "legacy_idd", "fields");
-}
-
-JSONValueType schemaPropertyTypeDecode(const Json::Value& type) {
-  if (type.isNull() || !type.isString()) {
-    // LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option");
-    return JSONValueType::NumberOrString;
-  }
-
-  if (type.asString() == "string") {
-    return JSONValueType::String;
-  } else if (type.asString() == "number") {
-    return JSONValueType::Number;
-  } else if (type.asString() == "integer") {
-    return JSONValueType::Integer;
-  } else if (type.asString() == "object") {
-    return JSONValueType::Object;
-  } else if (type.asString() == "array") {
-    return JSONValueType::Array;
-  }
-
-  return JSONValueType::NumberOrString;
-}
-
-/** Locate the properties for a given field of an object.
- * - group_name can be empty, or it's the name of the extensible group.
- * - field_name is the name of the field
- * - field_property_name is something like 'type', 'anyOf', or 'enum'
- *
- * if group_name is empty:
- *  getSchemaObjectProperties > [field_name] > [field_property_name]
- * else:
- *  getSchemaObjectProperties > [group_name] > items > properties > [field_name] > [field_property_name]
- */
-const Json::Value& getSchemaObjectFieldProperty(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                                const std::string& field_name, const std::string& field_property_name) {
-
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
-
-  if (group_name.empty()) {
-    return safeLookupValue(objectProperties, field_name, field_property_name);
-  } else {
-    return safeLookupValue(objectProperties, group_name, "items", "properties", field_name, field_property_name);
-  }
-}
-
-/** Find the 'type' property of a field and convert that to enum.*/
-JSONValueType getSchemaObjectFieldPropertyType(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                               const std::string& field_name) {
-  JSONValueType type = schemaPropertyTypeDecode(getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "type"));
+/** Find the 'type' property of a field. Fields that aren't in the schema are 'NumberOrString' */
+JSONValueType getSchemaFieldType(const SchemaFieldInfo* fieldInfo, const std::string& type_description, const std::string& group_name,
+                                 const std::string& field_name) {
+  const JSONValueType type = (fieldInfo != nullptr) ? fieldInfo->type : JSONValueType::NumberOrString;
   if (type == JSONValueType::NumberOrString) {
     LOG_FREE(LogLevel::Warn, "epJSONTranslator",
              "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option. "
@@ -187,24 +92,19 @@ JSONValueType getSchemaObjectFieldPropertyType(const Json::Value& schema, const
 /** epJSON (unlike IDF) is case sensitive, so this routine find the correct 'enum' choice casing
  * It applies to fieldType = 'ChoiceType' or 'RealType' (since RealType can also be `anyOf` with values like 'Autosize' 'Autocalculate'))
  * eg: if given value='autosize', will convert it to 'Autosize' so that EnergyPlus' InputParser does recognize it */
-std::string fixupEnumerationValue(const Json::Value& schema, const std::string& value, const std::string& type_description,
-                                  const std::string& group_name, const std::string& field_name, const openstudio::IddFieldType fieldType) {
+std::string fixupEnumerationValue(const SchemaFieldInfo* fieldInfo, const std::string& value, const std::string& group_name,
+                                  const std::string& field_name, const openstudio::IddFieldType fieldType) {
 
   if (fieldType == openstudio::IddFieldType::ChoiceType) {
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "enum");
-    const auto lower = boost::to_lower_copy(value);
-
-    if (fieldProperty.isNull()) {
+    if ((fieldInfo == nullptr) || !fieldInfo->hasEnum) {
       LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find enum value for " << value << " in " << group_name << "::" << field_name)
       return value;
     }
 
-    for (const auto& enumOption : fieldProperty) {
-      if (enumOption.isString()) {
-        const auto& enumStr = enumOption.asString();
-        if (boost::to_lower_copy(enumStr) == lower) {
-          return enumStr;
-        }
+    const auto lower = boost::to_lower_copy(value);
+    for (const auto& [lowerEnumStr, enumStr] : fieldInfo->enumChoices) {
+      if (lowerEnumStr == lower) {
+        return enumStr;
       }
     }
 
@@ -214,29 +114,17 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
 
   if (fieldType == openstudio::IddFieldType::RealType) {
 
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "anyOf");
-
-    if (fieldProperty.isArray()) {
+    if ((fieldInfo != nullptr) && !fieldInfo->anyOfChoices.empty()) {
       const auto lower = boost::to_lower_copy(value);
 
-      for (const auto& possibleValues : fieldProperty) {
-        const auto& enumOptions = possibleValues["enum"];
-        if (enumOptions.isArray()) {
-          for (const auto& enumOption : enumOptions) {
-            if (enumOption.isString()) {
-              const auto& enumStr = enumOption.asString();
-              const auto lowerEnumStr = boost::to_lower_copy(enumStr);
-
-              if (lowerEnumStr == lower) {
-                return enumStr;
-              }
-
-              if (lowerEnumStr.find("auto") == 0 && lower.find("auto") == 0) {
-                // it's the "auto" option, return it
-                return enumStr;
-              }
-            }
-          }
+      for (const auto& [lowerEnumStr, enumStr] : fieldInfo->anyOfChoices) {
+        if (lowerEnumStr == lower) {
+          return enumStr;
+        }
+
+        if (lowerEnumStr.find("auto") == 0 && lower.find("auto") == 0) {
+          // it's the "auto" option, return it
+          return enumStr;
         }
       }
     }
@@ -249,36 +137,6 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
   return value;
 }
 
-/* Find name of an extensible group and cache it */
-auto getGroupName(std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>>& group_names,
-                  std::map<std::string, std::string>& /*field_names*/, const Json::Value& schema, const std::string& type_description,
-                  const std::string& group_name) -> const auto& {
-
-  const auto key = std::pair{type_description, group_name};
-
-  if (const auto cached = group_names.find(key); cached != group_names.end()) {
-    return cached->second;
-  }
-
-  const auto cache_result = [&](const auto& name, const bool is_array) -> const auto& {
-    return group_names.emplace(key, std::pair{name, is_array}).first->second;
-  };
-
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
-
-  for (const auto& propertyName : objectProperties.getMemberNames()) {
-    const auto& type = safeLookupValue(objectProperties, propertyName, "type");
-    if (type.isString()) {
-      if (type.asString() == "array") {
-        return cache_result(propertyName, true);
-      }
-    }
-  }
-
-  // group name is irrelevant if it's not an array group
-  return cache_result("", false);
-}
-
 openstudio::path defaultSchemaPath(openstudio::IddFileType filetype) {
   openstudio::path schemaPath;
   if (filetype == openstudio::IddFileType::EnergyPlus) {
@@ -304,50 +162,188 @@ Json::Value loadJSON(const openstudio::path& path) {
   return root;
 }
 
-std::string getFieldName(const bool is_array, const IddObject& iddObject, const Json::Value& schema, const std::string& type_description,
-                         const std::size_t group_number, const std::size_t field_number, std::string_view field_name) {
+std::string getFieldName(const bool is_array, const IddObject& iddObject, const SchemaObjectInfo& objectInfo, const std::size_t group_number,
+                         const std::size_t field_number, std::string_view field_name) {
   if (is_array) {
     return std::string{field_name};
   }
 
-  // Legacy IDD field names
-  const auto& fieldNames = getSchemaFieldNames(schema, type_description);
-
   // use the index of the field inside of the IddObject to look up what its name should be
-  // inside of the epJSON schema
+  // inside of the epJSON schema (Legacy IDD field names)
   //
   // This is (partially) necessary because OpenStudio treats all groups as extensible.
-  const auto& lookedUpFieldName =
-    fieldNames[static_cast<int>((group_number - 1) * iddObject.extensibleGroup().size() + field_number + iddObject.nonextensibleFields().size())];
+  const auto legacyIndex = (group_number - 1) * iddObject.extensibleGroup().size() + field_number + iddObject.nonextensibleFields().size();
 
-  LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
-  OS_ASSERT(lookedUpFieldName.isString());
-  return lookedUpFieldName.asString();
+  if (legacyIndex >= objectInfo.legacyFieldNames.size() || objectInfo.legacyFieldNames[legacyIndex].empty()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
+  }
+  OS_ASSERT(legacyIndex < objectInfo.legacyFieldNames.size());
+  return objectInfo.legacyFieldNames[legacyIndex];
 }
 
-Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
+/** Name of the epJSON object: the IDF name when there is one, otherwise a generated '<type_description> <N>' */
+std::string getJSONObjectName(const openstudio::IdfObject& obj, const std::string& type_description, std::map<std::string, int>& type_counts) {
+  const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
 
+  if (!is_fluid_properties_name) {
+    if (const auto& name = obj.name()) {
+      return *name;
+    }
+    if (auto defaultedName = obj.nameString(true); !defaultedName.empty()) {
+      return defaultedName;
+    }
+  }
+  return fmt::format("{} {}", type_description, ++type_counts[type_description]);
+}
+
+/** Translate the fields of a single IdfObject, this is the content of the json_group[name] epJSON object */
+Json::Value toJSONObject(const openstudio::IdfObject& obj, const SchemaIndex& schemaIndex, std::map<std::string, std::string>& field_names) {
+
+  const auto& type_description = obj.iddObject().type().valueDescription();
+  const auto& objectInfo = schemaIndex.object(type_description);
+  if (!objectInfo.found) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find epJSON schema object for patternProperties for " << type_description);
+  }
+
+  Json::Value json_object(Json::objectValue);
+
+  if (const auto& name = obj.name()) {
+    if (type_description.find("FluidProperties:Name") != std::string::npos) {
+      json_object["fluid_name"] = *name;
+    } else if (type_description.find("LifeCycleCost:UsePriceEscalation") != std::string::npos) {
+      json_object["lcc_price_escalation_name"] = *name;
+    }
+  }
+
+  const auto visitField = [&objectInfo, &type_description](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
+                                                           const auto& fieldName, const auto& field, const auto idx) -> bool {
+    const SchemaFieldInfo* fieldInfo = objectInfo.field(group_name, fieldName);
+    const auto jsonFieldType = getSchemaFieldType(fieldInfo, type_description, group_name, fieldName);
+
+    switch (jsonFieldType) {
+      case JSONValueType::String: {
+        const auto fieldString = field.getString(idx);
+        if (fieldString && !fieldString->empty()) {
+          visitor(fixupEnumerationValue(fieldInfo, *fieldString, group_name, fieldName, iddField.properties().type));
+          return true;
+        }
+      }
+      case JSONValueType::Integer: {
+        const auto fieldInt = field.getInt(idx);
+        if (fieldInt) {
+          visitor(*fieldInt);
+          return true;
+        }
+      }
+      case JSONValueType::Number:
+      case JSONValueType::NumberOrString: {
+        const auto fieldDouble = field.getDouble(idx);
+
+        if (fieldDouble) {
+          const auto fieldInt = field.getInt(idx);
+
+          if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
+            if (iddField.name().find("Number") != std::string::npos) {
+              visitor(*fieldInt);
+              return true;
+            }
+          }
+
+          visitor(*fieldDouble);
+          return true;
+        }
+      }
+      case JSONValueType::Array:
+      case JSONValueType::Object:
+        break;
+    }
+
+    {
+      const auto fieldString = field.getString(idx);
+      if (fieldString && !fieldString->empty()) {
+        visitor(fixupEnumerationValue(fieldInfo, *fieldString, group_name, fieldName, iddField.properties().type));
+
+        return true;
+      }
+    }
+
+    return false;
+  };
+
+  std::size_t cur_group_number = 0;
+
+  // group name is irrelevant if it's not an array group
+  const std::string& group_name = objectInfo.groupName;
+  const bool is_array_group = objectInfo.isArrayGroup;
+
+  for (const auto& g : obj.extensibleGroups()) {
+    ++cur_group_number;
+
+    auto& containing_json = [&json_object, &group_name, is_array_group]() -> auto& {
+      if (is_array_group) {
+        auto& array_obj = json_object[group_name];
+        return array_obj.append(Json::Value{Json::objectValue});
+      } else {
+        return json_object;
+      }
+    }();
+
+    for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
+      const auto& iddField = obj.iddObject().extensibleGroup()[idx];
+
+      const auto fieldName =
+        getFieldName(is_array_group, obj.iddObject(), objectInfo, cur_group_number, idx, toJSONFieldName(field_names, iddField.name()));
+
+      [[maybe_unused]] const auto fieldAdded = visitField([&containing_json, &fieldName](const auto& value) { containing_json[fieldName] = value; },
+                                                          iddField, group_name, fieldName, g, idx);
+    }
+  }
+
+  for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
+    const auto& iddField = obj.iddObject().getField(idx);
+
+    const auto& fieldName = toJSONFieldName(field_names, iddField->name());
+
+    if (iddField->isNameField()) {
+      // skip name, we already got that
+      continue;
+    }
+
+    if (obj.iddObject().isExtensibleField(idx)) {
+      // skip extensible field, we already dealt with that
+      continue;
+    }
+
+    visitField([&json_object, &fieldName](const auto& value) { json_object[fieldName] = value; }, iddField.get(), "", fieldName, obj, idx);
+  }
+
+  return json_object;
+}
+
+std::shared_ptr<const SchemaIndex> loadSchemaIndex(const openstudio::path& schemaPath, openstudio::IddFileType iddFileType) {
   openstudio::path schemaToLoad = schemaPath;
   if (schemaToLoad.empty()) {
-    schemaToLoad = defaultSchemaPath(idf.iddFileType());
+    schemaToLoad = defaultSchemaPath(iddFileType);
     if (schemaToLoad.empty()) {
-      return Json::Value::null;
+      return nullptr;
     }
   }
 
-  std::map<std::string, int> type_counts;
-
-  Json::Value result;
+  return SchemaIndex::load(schemaToLoad);
+}
 
-  std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>> group_names;
-  std::map<std::string, std::string> field_names;
+Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
 
-  Json::Value schema = loadJSON(schemaToLoad);
-  if (schema.isNull()) {
-    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaToLoad);
+  const auto schemaIndex = loadSchemaIndex(schemaPath, idf.iddFileType());
+  if (!schemaIndex) {
     return Json::Value::null;
   }
 
+  std::map<std::string, int> type_counts;
+  std::map<std::string, std::string> field_names;
+
+  Json::Value result;
+
   result["Version"]["Version 1"]["version_identifier"] = fmt::format("{}.{}", idf.version().major(), idf.version().minor());
 
   for (const auto& obj : idf.objects()) {
@@ -357,151 +353,283 @@ Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schem
     }
 
     const auto& type_description = obj.iddObject().type().valueDescription();
+    const auto name = getJSONObjectName(obj, type_description, type_counts);
 
-    const auto& name = obj.name();
-    const auto& defaultedName = obj.nameString(true);
+    result[type_description][name] = toJSONObject(obj, *schemaIndex, field_names);
+  }
+  return result;
+}
 
-    auto& json_group = result[type_description];
+Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
+  return toJSON(workspace.toIdfFile(), schemaPath);
+}
 
-    const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
-    const bool is_lcc_use_price_escalation = type_description.find("LifeCycleCost:UsePriceEscalation") != std::string::npos;
+std::string toJSONString(const openstudio::IdfFile& inputFile, const openstudio::path& schemaPath) {
+  return toJSON(inputFile, schemaPath).toStyledString();
+}
 
-    const auto& usable_json_object_name = [&]() {
-      if (name && !is_fluid_properties_name) {
-        return *name;
-      } else {
-        if (!defaultedName.empty() && !is_fluid_properties_name) {
-          return defaultedName;
-        } else {
-          return fmt::format("{} {}", type_description, ++type_counts[type_description]);
-        }
-      }
-    }();
+std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
+  return toJSON(workspace, schemaPath).toStyledString();
+}
+
+/** Streaming counterpart of toJSON: only one translated object is held in memory at a time.
+ *  Objects are bucketed (by reference) per type and name first so that the output has the same content and ordering as toJSON */
+template <typename T>
+bool writeJSONObjects(const std::vector<T>& objects, const openstudio::VersionString& version, openstudio::IddFileType iddFileType, std::ostream& os,
+                      const openstudio::path& schemaPath) {
+
+  const auto schemaIndex = loadSchemaIndex(schemaPath, iddFileType);
+  if (!schemaIndex) {
+    return false;
+  }
+
+  std::map<std::string, int> type_counts;
+  std::map<std::string, std::string> field_names;
+
+  std::map<std::string, std::map<std::string, const openstudio::IdfObject*>> buckets;
+  for (const auto& obj : objects) {
+    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
+      continue;
+    }
+    const auto& type_description = obj.iddObject().type().valueDescription();
+    // Like result[type_description][name] = ..., the last object with a given name wins
+    buckets[type_description][getJSONObjectName(obj, type_description, type_counts)] = &obj;
+  }
+
+  Json::StreamWriterBuilder builder;
+  builder["indentation"] = "";
+  const std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+
+  os << "{\n  \"Version\": {\n    \"Version 1\": {\"version_identifier\":"
+     << Json::valueToQuotedString(fmt::format("{}.{}", version.major(), version.minor()).c_str()) << "}\n  }";
+
+  for (const auto& [type_description, namedObjects] : buckets) {
+    os << ",\n  " << Json::valueToQuotedString(type_description.c_str()) << ": {";
+    bool first = true;
+    for (const auto& [name, obj] : namedObjects) {
+      os << (first ? "\n    " : ",\n    ") << Json::valueToQuotedString(name.c_str()) << ": ";
+      writer->write(toJSONObject(*obj, *schemaIndex, field_names), &os);
+      first = false;
+    }
+    os << "\n  }";
+  }
+  os << "\n}\n";
+
+  return os.good();
+}
+
+bool writeJSON(const openstudio::IdfFile& idf, std::ostream& os, const openstudio::path& schemaPath) {
+  return writeJSONObjects(idf.objects(), idf.version(), idf.iddFileType(), os, schemaPath);
+}
+
+bool writeJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath) {
+  // WorkspaceObject::getString already returns the name of the pointed-to object, so there is no need to go through toIdfFile (copy)
+  return writeJSONObjects(workspace.objects(true), workspace.version(), workspace.iddFileType(), os, schemaPath);
+}
+
+bool saveJSON(const openstudio::IdfFile& idf, const openstudio::path& outputPath, const openstudio::path& schemaPath) {
+  std::ofstream ofs(openstudio::toString(outputPath), std::ofstream::trunc);
+  if (!ofs.is_open()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to open " << outputPath << " for writing");
+    return false;
+  }
+  return writeJSON(idf, ofs, schemaPath);
+}
+
+bool saveJSON(const openstudio::Workspace& workspace, const openstudio::path& outputPath, const openstudio::path& schemaPath) {
+  std::ofstream ofs(openstudio::toString(outputPath), std::ofstream::trunc);
+  if (!ofs.is_open()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to open " << outputPath << " for writing");
+    return false;
+  }
+  return writeJSON(workspace, ofs, schemaPath);
+}
 
-    auto& json_object = json_group[usable_json_object_name];
-    json_object = Json::Value(Json::objectValue);
+namespace {
 
-    if (name) {
-      if (is_fluid_properties_name) {
-        json_object["fluid_name"] = *name;
-      } else if (is_lcc_use_price_escalation) {
-        json_object["lcc_price_escalation_name"] = *name;
+  /** Minimal pull scanner over the epJSON top level structure: { "ObjectType": { "Name": {...}, ... }, ... }
+   *  It only tokenizes keys and captures the raw text of each object, which is then handed to Json::CharReader,
+   *  so the memory footprint is that of the largest single object */
+  class EpJSONStreamScanner
+  {
+   public:
+    explicit EpJSONStreamScanner(std::istream& is) : m_buf(is.rdbuf()) {}
+
+    int peekNonWhitespace() {
+      int c = m_buf->sgetc();
+      while (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        c = m_buf->snextc();
       }
+      return c;
     }
 
-    const auto visitField = [&schema, &type_description](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
-                                                         const auto& fieldName, const auto& field, const auto idx) -> bool {
-      const auto jsonFieldType = getSchemaObjectFieldPropertyType(schema, type_description, group_name, fieldName);
+    bool consume(char expected) {
+      if (peekNonWhitespace() != expected) {
+        return false;
+      }
+      m_buf->sbumpc();
+      return true;
+    }
 
-      switch (jsonFieldType) {
-        case JSONValueType::String: {
-          const auto fieldString = field.getString(idx);
-          if (fieldString && !fieldString->empty()) {
-            visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
-            return true;
-          }
+    /** Read a JSON string (including the quotes) into raw, returns whether it had escape sequences */
+    bool captureString(std::string& raw, bool& hasEscapes) {
+      if (peekNonWhitespace() != '"') {
+        return false;
+      }
+      raw.push_back(static_cast<char>(m_buf->sbumpc()));
+      while (true) {
+        const int c = m_buf->sbumpc();
+        if (c == std::char_traits<char>::eof()) {
+          return false;
         }
-        case JSONValueType::Integer: {
-          const auto fieldInt = field.getInt(idx);
-          if (fieldInt) {
-            visitor(*fieldInt);
-            return true;
+        raw.push_back(static_cast<char>(c));
+        if (c == '\\') {
+          hasEscapes = true;
+          const int escaped = m_buf->sbumpc();
+          if (escaped == std::char_traits<char>::eof()) {
+            return false;
           }
+          raw.push_back(static_cast<char>(escaped));
+        } else if (c == '"') {
+          return true;
         }
-        case JSONValueType::Number:
-        case JSONValueType::NumberOrString: {
-          const auto fieldDouble = field.getDouble(idx);
-
-          if (fieldDouble) {
-            const auto fieldInt = field.getInt(idx);
-
-            if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
-              if (iddField.name().find("Number") != std::string::npos) {
-                visitor(*fieldInt);
-                return true;
-              }
-            }
+      }
+    }
 
-            visitor(*fieldDouble);
-            return true;
-          }
-        }
-        case JSONValueType::Array:
-        case JSONValueType::Object:
-          break;
+    bool readKey(std::string& key) {
+      std::string raw;
+      bool hasEscapes = false;
+      if (!captureString(raw, hasEscapes) || !consume(':')) {
+        return false;
       }
+      if (!hasEscapes) {
+        key = raw.substr(1, raw.size() - 2);
+        return true;
+      }
+      Json::Value decoded;
+      if (!parse(raw, decoded) || !decoded.isString()) {
+        return false;
+      }
+      key = decoded.asString();
+      return true;
+    }
 
-      {
-        const auto fieldString = field.getString(idx);
-        if (fieldString && !fieldString->empty()) {
-          visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
+    /** Capture the raw text of the next JSON value (object, array, string or scalar) */
+    bool captureValue(std::string& raw) {
+      raw.clear();
+      const int first = peekNonWhitespace();
+      if (first == '"') {
+        bool hasEscapes = false;
+        return captureString(raw, hasEscapes);
+      }
 
-          return true;
+      if (first != '{' && first != '[') {
+        int c = m_buf->sgetc();
+        while (c != std::char_traits<char>::eof() && c != ',' && c != '}' && c != ']' && c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+          raw.push_back(static_cast<char>(c));
+          c = m_buf->snextc();
         }
+        return !raw.empty();
       }
 
-      return false;
-    };
-
-    std::size_t cur_group_number = 0;
-
-    for (const auto& g : obj.extensibleGroups()) {
-      ++cur_group_number;
-      // get first field and try to make a group name out of it
-      const auto& [group_name, is_array_group] =
-        openstudio::epJSON::getGroupName(group_names, field_names, schema, type_description, obj.iddObject().extensibleGroup()[0].name());
-
-      auto& containing_json = [&json_object, &group_name = group_name, is_array_group = is_array_group]() -> auto& {
-        if (is_array_group) {
-          auto& array_obj = json_object[group_name];
-          return array_obj.append(Json::Value{Json::objectValue});
-        } else {
-          return json_object;
+      int depth = 0;
+      while (true) {
+        const int c = m_buf->sgetc();
+        if (c == std::char_traits<char>::eof()) {
+          return false;
         }
-      }();
-
-      for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
-        const auto& iddField = obj.iddObject().extensibleGroup()[idx];
-
-        const auto fieldName = getFieldName(is_array_group, obj.iddObject(), schema, type_description, cur_group_number, idx,
-                                            toJSONFieldName(field_names, iddField.name()));
+        if (c == '"') {
+          bool hasEscapes = false;
+          if (!captureString(raw, hasEscapes)) {
+            return false;
+          }
+          continue;
+        }
+        raw.push_back(static_cast<char>(m_buf->sbumpc()));
+        if (c == '{' || c == '[') {
+          ++depth;
+        } else if (c == '}' || c == ']') {
+          if (--depth == 0) {
+            return true;
+          }
+        }
+      }
+    }
 
-        [[maybe_unused]] const auto fieldAdded = visitField([&containing_json, &fieldName](const auto& value) { containing_json[fieldName] = value; },
-                                                            iddField, group_name, fieldName, g, idx);
+    bool parse(const std::string& raw, Json::Value& value) {
+      JSONCPP_STRING errs;
+      if (!m_reader->parse(raw.data(), raw.data() + raw.size(), &value, &errs)) {
+        LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to parse epJSON value: " << errs);
+        return false;
       }
+      return true;
     }
 
-    for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
-      const auto& iddField = obj.iddObject().getField(idx);
+   private:
+    std::streambuf* m_buf;
+    std::unique_ptr<Json::CharReader> m_reader{Json::CharReaderBuilder().newCharReader()};
+  };
 
-      const auto& fieldName = toJSONFieldName(field_names, iddField->name());
+}  // namespace
 
-      if (iddField->isNameField()) {
-        // skip name, we already got that
-        continue;
-      }
+bool visitJSONObjects(std::istream& is, const EpJSONObjectVisitor& visitor) {
+  EpJSONStreamScanner scanner(is);
 
-      if (obj.iddObject().isExtensibleField(idx)) {
-        // skip extensible field, we already dealt with that
-        continue;
-      }
+  if (!scanner.consume('{')) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "epJSON root is not an object");
+    return false;
+  }
 
-      visitField([&json_object, &fieldName](const auto& value) { json_object[fieldName] = value; }, iddField.get(), "", fieldName, obj, idx);
-    }
+  if (scanner.consume('}')) {
+    return true;
   }
-  return result;
-}
 
-Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
-  return toJSON(workspace.toIdfFile(), schemaPath);
-}
+  std::string type_description;
+  std::string name;
+  std::string raw;
+  Json::Value fields;
 
-std::string toJSONString(const openstudio::IdfFile& inputFile, const openstudio::path& schemaPath) {
-  return toJSON(inputFile, schemaPath).toStyledString();
+  do {
+    if (!scanner.readKey(type_description)) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to read epJSON object type");
+      return false;
+    }
+
+    if (!scanner.consume('{')) {
+      // Not a 'type > name > fields' group, skip it
+      if (!scanner.captureValue(raw)) {
+        return false;
+      }
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Skipping top level epJSON member '" << type_description << "' which is not an object");
+      continue;
+    }
+
+    if (!scanner.consume('}')) {
+      do {
+        if (!scanner.readKey(name) || !scanner.captureValue(raw) || !scanner.parse(raw, fields)) {
+          LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to read epJSON object of type '" << type_description << "'");
+          return false;
+        }
+        visitor(type_description, name, fields);
+      } while (scanner.consume(','));
+
+      if (!scanner.consume('}')) {
+        LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unterminated epJSON group '" << type_description << "'");
+        return false;
+      }
+    }
+  } while (scanner.consume(','));
+
+  return scanner.consume('}');
 }
 
-std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
-  return toJSON(workspace, schemaPath).toStyledString();
+bool visitJSONObjects(const openstudio::path& path, const EpJSONObjectVisitor& visitor) {
+  std::ifstream ifs(openstudio::toString(path));
+  if (!ifs.is_open()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to open " << path);
+    return false;
+  }
+  return visitJSONObjects(ifs, visitor);
 }
 
 }  // namespace openstudio::epJSON
@@ -6,6 +6,8 @@
 #ifndef EPJSON_TRANSLATOR_HPP
 #define EPJSON_TRANSLATOR_HPP
 
+#include <functional>
+#include <iosfwd>
 #include <string>
 #include "epJSONAPI.hpp"
 
@@ -33,6 +35,24 @@ EPJSON_API std::string toJSONString(const openstudio::IdfFile& inputFile, const
 EPJSON_API Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 EPJSON_API std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 
+/** Streaming alternatives to toJSON/toJSONString: objects are translated and written one at a time, so no Json::Value DOM of the full model
+ *  is built. The content is identical to toJSON (only the whitespace differs). Returns false if the schema cannot be loaded or the write failed */
+EPJSON_API bool writeJSON(const openstudio::IdfFile& inputFile, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+EPJSON_API bool writeJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+
+EPJSON_API bool saveJSON(const openstudio::IdfFile& inputFile, const openstudio::path& outputPath,
+                         const openstudio::path& schemaPath = openstudio::path());
+EPJSON_API bool saveJSON(const openstudio::Workspace& workspace, const openstudio::path& outputPath,
+                         const openstudio::path& schemaPath = openstudio::path());
+
+/** Called for each epJSON object, eg ("Zone", "Zone 1", {"x_origin": 0.0, ...}) */
+using EpJSONObjectVisitor = std::function<void(const std::string& type_description, const std::string& name, const Json::Value& fields)>;
+
+/** SAX-style reader: walks an epJSON file and calls visitor for each object without parsing the whole file into a DOM like loadJSON does.
+ *  Returns false if the input is not a valid epJSON (objects visited before the error have already been passed to the visitor) */
+EPJSON_API bool visitJSONObjects(std::istream& is, const EpJSONObjectVisitor& visitor);
+EPJSON_API bool visitJSONObjects(const openstudio::path& path, const EpJSONObjectVisitor& visitor);
+
 }  // namespace openstudio::epJSON
 
 #endif
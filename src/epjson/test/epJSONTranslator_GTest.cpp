@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 #include "epJSONFixture.hpp"
 #include "../epJSONTranslator.hpp"
+#include "../epJSONSchemaIndex.hpp"
 
 #include "../../model/Model.hpp"
 
@@ -30,6 +31,7 @@
 #include <json/json.h>
 #include <resources.hxx>
 #include <algorithm>
+#include <sstream>
 
 TEST_F(epJSONFixture, TranslateIDFToEPJSON_RefBldgMediumOfficeNew2004_Chicago) {
   compareEPJSONTranslations("RefBldgMediumOfficeNew2004_Chicago.idf");
@@ -229,3 +231,99 @@ TEST_F(epJSONFixture, Autosize_case_sensitiveness) {
   const auto& flow_ratio = json_perf["flow_ratios"][0];
   EXPECT_EQ("Autosize", flow_ratio["heating_speed_supply_air_flow_ratio"].asString());
 }
+
+TEST_F(epJSONFixture, writeJSON_SameAsToJSON) {
+
+  const auto location = epJSONFixture::completeIDFPath("RefBldgMediumOfficeNew2004_Chicago.idf");
+  auto idf = openstudio::IdfFile::load(location);
+  ASSERT_TRUE(idf);
+
+  auto dom = openstudio::epJSON::toJSON(*idf);
+
+  std::stringstream ss;
+  ASSERT_TRUE(openstudio::epJSON::writeJSON(*idf, ss));
+
+  Json::Value streamed;
+  Json::CharReaderBuilder builder;
+  JSONCPP_STRING errs;
+  ASSERT_TRUE(Json::parseFromStream(builder, ss, &streamed, &errs)) << errs;
+
+  makeDoubles(dom);
+  makeDoubles(streamed);
+  EXPECT_EQ(dom, streamed);
+
+  // And the SAX-style reader gives back the same thing
+  ss.clear();
+  ss.seekg(0);
+  Json::Value visited;
+  std::size_t numObjects = 0;
+  EXPECT_TRUE(openstudio::epJSON::visitJSONObjects(ss, [&](const std::string& type_description, const std::string& name, const Json::Value& fields) {
+    visited[type_description][name] = fields;
+    ++numObjects;
+  }));
+  makeDoubles(visited);
+  EXPECT_EQ(streamed, visited);
+  EXPECT_EQ(idf->objects().size() + 1, numObjects);  // + Version
+}
+
+TEST_F(epJSONFixture, visitJSONObjects) {
+
+  std::stringstream ss(R"json(
+{
+  "Version": {"Version 1": {"version_identifier": "24.2"}},
+  "Empty": {},
+  "Zone": {
+    "Zone \"1\"": {"x_origin": 1.5, "multiplier": 2, "type": "Sub{Braces}"},
+    "Zone 2": {"vertices": [{"x": 0.0}, {"x": 1.0}]}
+  }
+}
+)json");
+
+  std::vector<std::pair<std::string, std::string>> visited;
+  Json::Value zone1;
+  EXPECT_TRUE(openstudio::epJSON::visitJSONObjects(ss, [&](const std::string& type_description, const std::string& name, const Json::Value& fields) {
+    visited.emplace_back(type_description, name);
+    if (name == "Zone \"1\"") {
+      zone1 = fields;
+    }
+  }));
+
+  ASSERT_EQ(3u, visited.size());
+  EXPECT_EQ("Version", visited[0].first);
+  EXPECT_EQ("Zone", visited[1].first);
+  EXPECT_EQ("Zone \"1\"", visited[1].second);
+  EXPECT_EQ("Zone 2", visited[2].second);
+  EXPECT_EQ(1.5, zone1["x_origin"].asDouble());
+  EXPECT_EQ(2, zone1["multiplier"].asInt());
+  EXPECT_EQ("Sub{Braces}", zone1["type"].asString());
+
+  std::stringstream truncated(R"json({"Zone": {"Zone 1": {"x_origin": 1.5)json");
+  EXPECT_FALSE(openstudio::epJSON::visitJSONObjects(truncated, [](const std::string&, const std::string&, const Json::Value&) {}));
+}
+
+TEST_F(epJSONFixture, SchemaIndex) {
+  const auto schemaIndex = openstudio::epJSON::SchemaIndex::load(openstudio::epJSON::defaultSchemaPath(openstudio::IddFileType::EnergyPlus));
+  ASSERT_TRUE(schemaIndex);
+  EXPECT_GT(schemaIndex->numObjects(), 100u);
+
+  // Cached: built only once per schema
+  EXPECT_EQ(schemaIndex, openstudio::epJSON::SchemaIndex::load(openstudio::epJSON::defaultSchemaPath(openstudio::IddFileType::EnergyPlus)));
+
+  EXPECT_FALSE(schemaIndex->object("NotAnObject").found);
+
+  const auto& perf = schemaIndex->object("UnitarySystemPerformance:Multispeed");
+  ASSERT_TRUE(perf.found);
+  EXPECT_TRUE(perf.isArrayGroup);
+  EXPECT_EQ("flow_ratios", perf.groupName);
+
+  const auto* flowRatio = perf.field("flow_ratios", "heating_speed_supply_air_flow_ratio");
+  ASSERT_NE(nullptr, flowRatio);
+  EXPECT_EQ(openstudio::epJSON::JSONValueType::NumberOrString, flowRatio->type);  // anyOf
+  EXPECT_TRUE(std::find_if(flowRatio->anyOfChoices.cbegin(), flowRatio->anyOfChoices.cend(), [](const auto& p) { return p.second == "Autosize"; })
+              != flowRatio->anyOfChoices.cend());
+
+  const auto* singleMode = perf.field("", "single_mode_operation");
+  ASSERT_NE(nullptr, singleMode);
+  EXPECT_EQ(openstudio::epJSON::JSONValueType::String, singleMode->type);
+  EXPECT_TRUE(singleMode->hasEnum);
+}
@@ -4,6 +4,7 @@
 ***********************************************************************************************************************/
 
 #include "ForwardTranslator.hpp"
+#include "XMLStreamWriter.hpp"
 
 #include "../model/Model.hpp"
 #include "../model/ModelObject.hpp"
@@ -89,13 +90,9 @@ namespace gbxml {
 
     m_logSink.resetStringStream();
 
-    pugi::xml_document doc;
-    //doc.createProcessingInstruction("xml", "version=\"1.0\" encoding=\"utf-8\"");
-    bool result = this->translateModel(model, doc);
-
     openstudio::filesystem::ofstream file(path, std::ios_base::binary);
     if (file.is_open()) {
-      doc.save(file, "  ");
+      bool result = this->translateModel(model, file);
       file.close();
 
       // validate the gbxml after forward translation
@@ -117,14 +114,10 @@ namespace gbxml {
 
     m_logSink.resetStringStream();
 
-    pugi::xml_document doc;
-    //doc.createProcessingInstruction("xml", "version=\"1.0\" encoding=\"utf-8\"");
-    bool result = this->translateModel(model, doc);
+    std::stringstream ss;
+    bool result = this->translateModel(model, ss);
 
     if (result) {
-      // doc.save allows any ostream, so use a stringstream
-      std::stringstream ss;
-      doc.save(ss, "  ");
       gbXML_str = ss.str();
     }
 
@@ -170,13 +163,19 @@ namespace gbxml {
     return result;
   }
 
-  bool ForwardTranslator::translateModel(const openstudio::model::Model& model, pugi::xml_document& document) {
+  bool ForwardTranslator::translateModel(const openstudio::model::Model& model, std::ostream& os) {
 
     // Clear the map & set
     m_translatedObjects.clear();
     m_materials.clear();
     m_placeholderShadingSurfaceConstructionAlreadyCreated = false;
 
+    // The DOM only holds the sections that are being translated, complete ones are handed off to the stream writer (which writes them
+    // on its own thread) and removed from the document
+    pugi::xml_document document;
+    detail::XMLStreamWriter streamWriter(os);
+    m_streamWriter = &streamWriter;
+
     auto gbXMLElement = document.append_child("gbXML");
     gbXMLElement.append_attribute("xmlns") = "http://www.gbxml.org/schema";
     gbXMLElement.append_attribute("xmlns:xhtml") = "http://www.w3.org/1999/xhtml";
@@ -191,8 +190,11 @@ namespace gbxml {
     gbXMLElement.append_attribute("version") = "7.03";
     gbXMLElement.append_attribute("SurfaceReferenceLocation") = "Centerline";
 
+    streamWriter.writeDeclaration();
+    streamWriter.writeStartElement(gbXMLElement, 0);
+
     // translateFacility is responsible to translate Surfaces, and calls translateBuilding, which is responsible to translate spaces
-    // so we do need to call it anyways.
+    // so we do need to call it anyways. It streams the Campus out as it goes
     translateFacility(model, gbXMLElement);
 
     // do constructions
@@ -216,6 +218,8 @@ namespace gbxml {
       }
     }
 
+    streamWriter.flushChildren(gbXMLElement, 1);
+
     // do materials
     if (m_progressBar) {
       m_progressBar->setWindowTitle(toString("Translating Materials"));
@@ -242,6 +246,8 @@ namespace gbxml {
       }
     }
 
+    streamWriter.flushChildren(gbXMLElement, 1);
+
     // do thermal zones
     std::vector<model::ThermalZone> thermalZones = model.getConcreteModelObjects<model::ThermalZone>();
     if (m_progressBar) {
@@ -259,6 +265,8 @@ namespace gbxml {
       }
     }
 
+    streamWriter.flushChildren(gbXMLElement, 1);
+
     // Document History
     auto documentHistoryElement = gbXMLElement.append_child("DocumentHistory");
 
@@ -410,7 +418,11 @@ namespace gbxml {
       }
     }
 
-    return true;
+    streamWriter.flushChildren(gbXMLElement, 1);
+    streamWriter.writeEndElement(gbXMLElement, 0);
+
+    m_streamWriter = nullptr;
+    return streamWriter.finish();
   }
 
   boost::optional<pugi::xml_node> ForwardTranslator::translateFacility(const openstudio::model::Model& model, pugi::xml_node& parent) {
@@ -440,6 +452,12 @@ namespace gbxml {
     // translate building: needs to be done even if not explicitly instantiated since that's what translates Spaces in particular.
     translateBuilding(model, result);
 
+    // The Campus holds the bulk of the document: write it out now, then stream the surfaces by batches
+    m_streamWriter->writeStartElement(result, 1);
+    m_streamWriter->flushChildren(result, 2);
+    constexpr size_t surfacesPerBatch = 64;
+    size_t numSurfacesInBatch = 0;
+
     // translate surfaces
     // TODO: JM 2020-06-18 Why is translateSpace not responsible to call this one?
     std::vector<model::Surface> surfaces = model.getConcreteModelObjects<model::Surface>();
@@ -457,9 +475,13 @@ namespace gbxml {
       std::sort(spaceSurfaces.begin(), spaceSurfaces.end(), WorkspaceObjectNameLess());
 
       for (const model::Surface& surface : spaceSurfaces) {
-        std::string name = surface.name().value();
         translateSurface(surface, result);
 
+        if (++numSurfacesInBatch == surfacesPerBatch) {
+          m_streamWriter->flushChildren(result, 2);
+          numSurfacesInBatch = 0;
+        }
+
         if (m_progressBar) {
           m_progressBar->setValue(m_progressBar->value() + 1);
         }
@@ -480,12 +502,22 @@ namespace gbxml {
     for (const model::ShadingSurface& shadingSurface : shadingSurfaces) {
       translateShadingSurface(shadingSurface, result);
 
+      if (++numSurfacesInBatch == surfacesPerBatch) {
+        m_streamWriter->flushChildren(result, 2);
+        numSurfacesInBatch = 0;
+      }
+
       if (m_progressBar) {
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
 
-    return result;
+    m_streamWriter->flushChildren(result, 2);
+    m_streamWriter->writeEndElement(result, 1);
+
+    // Nothing is left of the Campus in the DOM
+    parent.remove_child(result);
+    return boost::none;
   }
 
   boost::optional<pugi::xml_node> ForwardTranslator::translateBuilding(const openstudio::model::Model& model, pugi::xml_node& parent) {
@@ -19,6 +19,7 @@
 #include "../model/ModelObject.hpp"
 
 #include <map>
+#include <ostream>
 
 namespace pugi {
 class xml_node;
@@ -47,6 +48,10 @@ namespace model {
 
 namespace gbxml {
 
+  namespace detail {
+    class XMLStreamWriter;
+  }  // namespace detail
+
   class GBXML_API ForwardTranslator
   {
    public:
@@ -70,7 +75,8 @@ namespace gbxml {
     std::string escapeName(const std::string& name);
 
     // listed in translation order
-    bool translateModel(const openstudio::model::Model& model, pugi::xml_document& document);
+    // The gbXML is streamed to os as it is translated: each section is written out (and removed from the DOM) as soon as it is complete
+    bool translateModel(const openstudio::model::Model& model, std::ostream& os);
 
     // Facility and Building could not be explicitly instantiated in the model, but the functions still need to be called so that Spaces and surfaces
     // are translated. Facility and Building both are UniqueModelObjects, so passing model here as an argument is harmless
@@ -99,6 +105,7 @@ namespace gbxml {
     /** Set the CADObjectId as the CADObjectId additional property if it exists. */
     boost::optional<pugi::xml_node> translateCADObjectId(const openstudio::model::ModelObject& modelObject, pugi::xml_node& parentElement);
 
+    // Only used to know which objects were translated: nodes that were streamed out are no longer valid
     std::map<openstudio::Handle, pugi::xml_node> m_translatedObjects;
 
     std::set<openstudio::model::Material, openstudio::IdfObjectImplLess> m_materials;
@@ -110,6 +117,9 @@ namespace gbxml {
 
     ProgressBar* m_progressBar;
 
+    // Set during translateModel
+    detail::XMLStreamWriter* m_streamWriter = nullptr;
+
     REGISTER_LOGGER("openstudio.gbxml.ForwardTranslator");
   };
 
@@ -45,10 +45,12 @@
 #include "../utilities/plot/ProgressBar.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/xml/XMLValidator.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 #include <resources.hxx>
 
+#include <stdexcept>
 #include <thread>
 
 #include <pugixml.hpp>
@@ -65,6 +67,138 @@ namespace gbxml {
     return os;
   }
 
+  namespace detail {
+
+    // Plain data decoded from the XML, which can be done concurrently, unlike creating the model objects
+
+    struct DecodedCADObjectId
+    {
+      std::string cadObjectId;
+      boost::optional<std::string> programIdRef;
+    };
+
+    struct DecodedOpening
+    {
+      pugi::xml_node element;
+      // false if the geometry could not be decoded
+      bool valid = true;
+      std::vector<openstudio::Point3d> vertices;
+      std::string id;
+      boost::optional<std::string> name;
+      std::string openingType;
+      std::string constructionIdRef;
+      std::vector<DecodedCADObjectId> cadObjectIds;
+    };
+
+    struct DecodedAdjacentSpace
+    {
+      std::string spaceIdRef;
+      std::string surfaceType;
+    };
+
+    struct DecodedSurface
+    {
+      pugi::xml_node element;
+      // false if the geometry could not be decoded
+      bool valid = true;
+      std::vector<openstudio::Point3d> vertices;
+      std::string id;
+      boost::optional<std::string> name;
+      std::string surfaceType;
+      std::string exposedToSun;
+      std::string constructionIdRef;
+      std::vector<DecodedAdjacentSpace> adjacentSpaces;
+      std::vector<DecodedOpening> openings;
+      std::vector<DecodedCADObjectId> cadObjectIds;
+    };
+
+  }  // namespace detail
+
+  namespace {
+
+    // PlanarGeometry > PolyLoop > CartesianPoint > Coordinate, converted to meters. Returns false if a CartesianPoint does not have 3 Coordinates
+    bool decodePlanarGeometry(const pugi::xml_node& element, double lengthMultiplier, std::vector<openstudio::Point3d>& vertices) {
+      auto cartesianPointElements = element.child("PlanarGeometry").child("PolyLoop").children("CartesianPoint");
+      for (const auto& cart_el : cartesianPointElements) {
+        // Calling unit conversions for every coordinate is unnecessarily slow, m_lengthMultiplier is computed once
+        std::array<double, 3> coords{{0.0, 0.0, 0.0}};
+        size_t i{0};
+        for (const auto& el : cart_el.children("Coordinate")) {
+          if (i == 3) {
+            return false;
+          }
+          coords[i] = lengthMultiplier * el.text().as_double();
+          ++i;
+        }
+        if (i != 3) {
+          return false;
+        }
+        vertices.emplace_back(coords[0], coords[1], coords[2]);
+      }
+      return true;
+    }
+
+    boost::optional<std::string> decodeName(const pugi::xml_node& element) {
+      auto name = element.child("Name").text();
+      if (name.empty()) {
+        return boost::none;
+      }
+      return std::string{name.as_string()};
+    }
+
+    std::vector<detail::DecodedCADObjectId> decodeCADObjectIds(const pugi::xml_node& element) {
+      std::vector<detail::DecodedCADObjectId> result;
+      for (const auto& cadObjectIdElement : element.children("CADObjectId")) {
+        auto cadObjectId = cadObjectIdElement.text();
+        if (cadObjectId.empty()) {
+          continue;
+        }
+        detail::DecodedCADObjectId decoded;
+        decoded.cadObjectId = cadObjectId.as_string();
+        if (auto programIdRef = cadObjectIdElement.attribute("programIdRef")) {
+          decoded.programIdRef = std::string{programIdRef.value()};
+        }
+        result.push_back(std::move(decoded));
+      }
+      return result;
+    }
+
+    detail::DecodedOpening decodeOpening(const pugi::xml_node& element, double lengthMultiplier) {
+      detail::DecodedOpening result;
+      result.element = element;
+      result.valid = decodePlanarGeometry(element, lengthMultiplier, result.vertices);
+      result.id = element.attribute("id").value();
+      result.name = decodeName(element);
+      result.openingType = element.attribute("openingType").value();
+      result.constructionIdRef = element.attribute("constructionIdRef").value();
+      if (result.constructionIdRef.empty()) {
+        result.constructionIdRef = element.attribute("windowTypeIdRef").value();
+      }
+      result.cadObjectIds = decodeCADObjectIds(element);
+      return result;
+    }
+
+    detail::DecodedSurface decodeSurface(const pugi::xml_node& element, double lengthMultiplier) {
+      detail::DecodedSurface result;
+      result.element = element;
+      result.valid = decodePlanarGeometry(element, lengthMultiplier, result.vertices);
+      result.id = element.attribute("id").value();
+      result.name = decodeName(element);
+      result.surfaceType = element.attribute("surfaceType").value();
+      result.exposedToSun = element.attribute("exposedToSun").value();
+      result.constructionIdRef = element.attribute("constructionIdRef").value();
+      for (const auto& adj : element.children("AdjacentSpaceId")) {
+        result.adjacentSpaces.push_back({adj.attribute("spaceIdRef").value(), adj.attribute("surfaceType").value()});
+      }
+      for (const auto& opening : element.children("Opening")) {
+        result.openings.push_back(decodeOpening(opening, lengthMultiplier));
+      }
+      result.cadObjectIds = decodeCADObjectIds(element);
+      return result;
+    }
+
+  }  // namespace
+
   ReverseTranslator::ReverseTranslator() : m_nonBaseMultiplier(1.0), m_lengthMultiplier(1.0) {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.gbxml\\.ReverseTranslator"));
@@ -73,6 +207,14 @@ namespace gbxml {
 
   ReverseTranslator::~ReverseTranslator() = default;
 
+  unsigned ReverseTranslator::numberOfThreads() const {
+    return m_numberOfThreads;
+  }
+
+  void ReverseTranslator::setNumberOfThreads(unsigned numberOfThreads) {
+    m_numberOfThreads = numberOfThreads;
+  }
+
   boost::optional<openstudio::model::Model> ReverseTranslator::loadModel(const openstudio::path& path, ProgressBar* progressBar) {
     m_progressBar = progressBar;
 
@@ -417,19 +559,27 @@ namespace gbxml {
     boost::optional<model::ModelObject> building = translateBuilding(buildingElement, model);
     OS_ASSERT(building);
 
-    auto surfaceElements = element.children("Surface");
+    auto surfaceElementsRange = element.children("Surface");
+    const std::vector<pugi::xml_node> surfaceElements(surfaceElementsRange.begin(), surfaceElementsRange.end());
     if (m_progressBar) {
       m_progressBar->setWindowTitle(toString("Translating Surfaces"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum((int)std::distance(surfaceElements.begin(), surfaceElements.end()));
+      m_progressBar->setMaximum((int)surfaceElements.size());
       m_progressBar->setValue(0);
     }
 
-    for (auto& surfEl : surfaceElements) {
+    // Phase 1: decode the geometry and attributes of all surfaces concurrently, this only reads the (const) XML tree
+    std::vector<detail::DecodedSurface> decodedSurfaces(surfaceElements.size());
+    const double lengthMultiplier = m_lengthMultiplier;
+    openstudio::parallelFor(
+      surfaceElements.size(), [&](size_t i) { decodedSurfaces[i] = decodeSurface(surfaceElements[i], lengthMultiplier); }, m_numberOfThreads);
+
+    // Phase 2: create the model objects serially, in document order
+    for (const auto& decodedSurface : decodedSurfaces) {
       try {
-        boost::optional<model::ModelObject> surface = translateSurface(surfEl, model);
+        boost::optional<model::ModelObject> surface = translateSurface(decodedSurface, model);
       } catch (const std::exception&) {
-        LOG(Error, "Could not translate surface " << surfEl);
+        LOG(Error, "Could not translate surface " << decodedSurface.element);
       }
 
       if (m_progressBar) {
@@ -590,50 +740,22 @@ namespace gbxml {
     return space;
   }
 
-  boost::optional<model::ModelObject> ReverseTranslator::translateSurface(const pugi::xml_node& element, openstudio::model::Model& model) {
+  boost::optional<model::ModelObject> ReverseTranslator::translateSurface(const detail::DecodedSurface& decodedSurface,
+                                                                          openstudio::model::Model& model) {
     boost::optional<model::ModelObject> result;
-    std::vector<openstudio::Point3d> vertices;
-
-    auto planarGeometryElement = element.child("PlanarGeometry");
-    auto polyLoopElement = planarGeometryElement.child("PolyLoop");
-    auto cartesianPointElements = polyLoopElement.children("CartesianPoint");
-
-    for (auto& cart_el : cartesianPointElements) {
-      auto coordinateElements = cart_el.children("Coordinate");
-      OS_ASSERT(std::distance(coordinateElements.begin(), coordinateElements.end()) == 3);
-
-      /* Calling these conversions every time is unnecessarily slow
-
-      Unit targetUnit = UnitFactory::instance().createUnit("m").get();
-      Quantity xQuantity(coordinateElements.at(0).toElement().text().toDouble(), m_lengthUnit);
-      Quantity yQuantity(coordinateElements.at(1).toElement().text().toDouble(), m_lengthUnit);
-      Quantity zQuantity(coordinateElements.at(2).toElement().text().toDouble(), m_lengthUnit);
-
-      double x = QuantityConverter::instance().convert(xQuantity, targetUnit)->value();
-      double y = QuantityConverter::instance().convert(yQuantity, targetUnit)->value();
-      double z = QuantityConverter::instance().convert(zQuantity, targetUnit)->value();
-      */
-
-      std::array<double, 3> coords{{0.0, 0.0, 0.0}};
-      size_t i{0};
-      for (auto& el : coordinateElements) {
-        coords[i] = m_lengthMultiplier * el.text().as_double();
-        ++i;
-        if (i == 3) {
-          break;
-        }
-      }
 
-      vertices.emplace_back(coords[0], coords[1], coords[2]);
+    if (!decodedSurface.valid) {
+      throw std::runtime_error("Expected 3 Coordinates per CartesianPoint");
     }
+    const std::vector<openstudio::Point3d>& vertices = decodedSurface.vertices;
 
-    std::string surfaceType = element.attribute("surfaceType").value();
+    const std::string& surfaceType = decodedSurface.surfaceType;
     if (surfaceType.find("Shade") != std::string::npos) {
 
       openstudio::model::ShadingSurface shadingSurface(vertices, model);
 
-      translateId(element, shadingSurface);
-      translateName(element, shadingSurface);
+      translateId(decodedSurface.id, shadingSurface);
+      translateName(decodedSurface.name, shadingSurface);
 
       openstudio::model::Building building = model.getUniqueModelObject<openstudio::model::Building>();
 
@@ -654,18 +776,14 @@ namespace gbxml {
 
     } else {
 
-      // The rest of the function wants array-type access to the elements, so create that
-      std::vector<pugi::xml_node> adjacentSpaceElements;
-      for (auto& adj : element.children("AdjacentSpaceId")) {
-        adjacentSpaceElements.push_back(adj);
-      }
+      const std::vector<detail::DecodedAdjacentSpace>& adjacentSpaceElements = decodedSurface.adjacentSpaces;
 
       if (adjacentSpaceElements.empty()) {
         LOG(Warn, "Surface has no adjacent spaces, will not be translated.");
         return boost::none;
       } else if (adjacentSpaceElements.size() == 2) {
-        std::string spaceId1 = adjacentSpaceElements.at(0).attribute("spaceIdRef").value();
-        std::string spaceId2 = adjacentSpaceElements.at(1).attribute("spaceIdRef").value();
+        std::string spaceId1 = adjacentSpaceElements.at(0).spaceIdRef;
+        std::string spaceId2 = adjacentSpaceElements.at(1).spaceIdRef;
         if (spaceId1 == spaceId2) {
           LOG(Warn, "Surface has two adjacent spaces which are the same space '" << spaceId2 << "', will not be translated.");
           return boost::none;
@@ -677,10 +795,10 @@ namespace gbxml {
 
       openstudio::model::Surface surface(vertices, model);
 
-      translateId(element, surface);
-      translateName(element, surface);
+      translateId(decodedSurface.id, surface);
+      translateName(decodedSurface.name, surface);
 
-      std::string exposedToSun = element.attribute("exposedToSun").value();
+      const std::string& exposedToSun = decodedSurface.exposedToSun;
 
       // set surface type
       // wall types
@@ -756,8 +874,7 @@ namespace gbxml {
         // not air wall
 
         // translate construction
-        std::string constructionIdRef = element.attribute("constructionIdRef").value();
-        auto constructionIt = m_idToObjectMap.find(constructionIdRef);
+        auto constructionIt = m_idToObjectMap.find(decodedSurface.constructionIdRef);
         if (constructionIt != m_idToObjectMap.end()) {
           boost::optional<model::ConstructionBase> construction = constructionIt->second.optionalCast<model::ConstructionBase>();
           if (construction) {
@@ -766,17 +883,17 @@ namespace gbxml {
         }
 
         // translate subSurfaces
-        for (auto& subsurf : element.children("Opening")) {
+        for (const auto& decodedOpening : decodedSurface.openings) {
           try {
-            boost::optional<model::ModelObject> subSurface = translateSubSurface(subsurf, surface);
+            boost::optional<model::ModelObject> subSurface = translateSubSurface(decodedOpening, surface);
           } catch (const std::exception&) {
-            LOG(Error, "Could not translate sub surface " << subsurf);
+            LOG(Error, "Could not translate sub surface " << decodedOpening.element);
           }
         }
       }
 
       // adjacent surfaces
-      std::string spaceId = adjacentSpaceElements.at(0).attribute("spaceIdRef").value();
+      std::string spaceId = adjacentSpaceElements.at(0).spaceIdRef;
       auto spaceIt = m_idToObjectMap.find(spaceId);
       if (spaceIt != m_idToObjectMap.end()) {
         boost::optional<model::Space> space = spaceIt->second.optionalCast<openstudio::model::Space>();
@@ -806,7 +923,7 @@ namespace gbxml {
         // If not present, the surface type can be assumed based on the description of the surface type enums. When the surfaceTypeEnum is provided and the
         // surface attributes (i.e. adjacency, tilt angle) do not match the enumeration's description, the enumeration should have precedence.
 
-        std::string adjacentSpaceId = adjacentSpaceElements.at(1).attribute("spaceIdRef").value();
+        std::string adjacentSpaceId = adjacentSpaceElements.at(1).spaceIdRef;
         auto adjacentSpaceIt = m_idToObjectMap.find(adjacentSpaceId);
         if (adjacentSpaceIt != m_idToObjectMap.end()) {
           boost::optional<model::Space> adjacentSpace = adjacentSpaceIt->second.optionalCast<openstudio::model::Space>();
@@ -831,10 +948,10 @@ namespace gbxml {
             std::string currentSurfaceType = surface.surfaceType();
 
             // spaceSurfaceType is the surfaceType that should be in the first space
-            std::string spaceSurfaceType = adjacentSpaceElements.at(0).attribute("surfaceType").value();
+            std::string spaceSurfaceType = adjacentSpaceElements.at(0).surfaceType;
 
             // spaceSurfaceType is the surfaceType that should be in the second space
-            std::string adjacentSpaceSurfaceType = adjacentSpaceElements.at(1).attribute("surfaceType").value();
+            std::string adjacentSpaceSurfaceType = adjacentSpaceElements.at(1).surfaceType;
 
             // we will mark figuredOut as true if we are sure of our assignment, otherwise we will log a warning
             bool figuredOut = false;
@@ -964,7 +1081,7 @@ namespace gbxml {
     OS_ASSERT(result);
 
     // import CADObjectId
-    for (auto& cadObjectId : element.children("CADObjectId")) {
+    for (const auto& cadObjectId : decodedSurface.cadObjectIds) {
       translateCADObjectId(cadObjectId, *result);
     }
 
@@ -993,56 +1110,27 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateSubSurface(const pugi::xml_node& element,
+  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateSubSurface(const detail::DecodedOpening& decodedOpening,
                                                                                          openstudio::model::Surface& surface) {
     openstudio::model::Model model = surface.model();
 
     boost::optional<model::ModelObject> result;
 
-    std::vector<openstudio::Point3d> vertices;
-
-    auto planarGeometryElement = element.child("PlanarGeometry");
-    auto polyLoopElement = planarGeometryElement.child("PolyLoop");
-    auto cartesianPointElements = polyLoopElement.children("CartesianPoint");
-
-    for (auto& cart_el : cartesianPointElements) {
-      auto coordinateElements = cart_el.children("Coordinate");
-      OS_ASSERT(std::distance(coordinateElements.begin(), coordinateElements.end()) == 3);
-
-      /* Calling these conversions every time is unnecessarily slow
-
-      Unit targetUnit = UnitFactory::instance().createUnit("m").get();
-      Quantity xQuantity(coordinateElements.at(0).toElement().text().toDouble(), m_lengthUnit);
-      Quantity yQuantity(coordinateElements.at(1).toElement().text().toDouble(), m_lengthUnit);
-      Quantity zQuantity(coordinateElements.at(2).toElement().text().toDouble(), m_lengthUnit);
-
-      double x = QuantityConverter::instance().convert(xQuantity, targetUnit)->value();
-      double y = QuantityConverter::instance().convert(yQuantity, targetUnit)->value();
-      double z = QuantityConverter::instance().convert(zQuantity, targetUnit)->value();
-      */
-      std::array<double, 3> coords{{0.0, 0.0, 0.0}};
-      size_t i{0};
-      for (auto& el : coordinateElements) {
-        coords[i] = m_lengthMultiplier * el.text().as_double();
-        ++i;
-        if (i == 3) {
-          break;
-        }
-      }
-
-      vertices.emplace_back(coords[0], coords[1], coords[2]);
+    if (!decodedOpening.valid) {
+      throw std::runtime_error("Expected 3 Coordinates per CartesianPoint");
     }
+    const std::vector<openstudio::Point3d>& vertices = decodedOpening.vertices;
 
     openstudio::model::SubSurface subSurface(vertices, model);
     subSurface.setSurface(surface);
 
-    translateId(element, subSurface);
-    translateName(element, subSurface);
+    translateId(decodedOpening.id, subSurface);
+    translateName(decodedOpening.name, subSurface);
 
     result = subSurface;
 
     // translate openingType
-    std::string openingType = element.attribute("openingType").value();
+    const std::string& openingType = decodedOpening.openingType;
     if (openingType.find("FixedWindow") != std::string::npos) {
       subSurface.setSubSurfaceType("FixedWindow");
     } else if (openingType.find("OperableWindow") != std::string::npos) {
@@ -1075,11 +1163,8 @@ namespace gbxml {
     } else {
 
       // translate construction
-      std::string constructionIdRef = element.attribute("constructionIdRef").value();
-      if (constructionIdRef.empty()) {
-        constructionIdRef = element.attribute("windowTypeIdRef").value();
-      }
-      auto constructionIt = m_idToObjectMap.find(constructionIdRef);
+      // constructionIdRef, or windowTypeIdRef if empty
+      auto constructionIt = m_idToObjectMap.find(decodedOpening.constructionIdRef);
       if (constructionIt != m_idToObjectMap.end()) {
         boost::optional<model::ConstructionBase> construction = constructionIt->second.optionalCast<model::ConstructionBase>();
         if (construction) {
@@ -1091,7 +1176,7 @@ namespace gbxml {
     // todo: translate "interiorShadeType", "exteriorShadeType", and other properties of the opening
 
     // import CADObjectId
-    for (auto& cadObjectId : element.children("CADObjectId")) {
+    for (const auto& cadObjectId : decodedOpening.cadObjectIds) {
       translateCADObjectId(cadObjectId, subSurface);
     }
 
@@ -1099,17 +1184,22 @@ namespace gbxml {
   }
 
   void ReverseTranslator::translateId(const pugi::xml_node& element, openstudio::model::ModelObject& modelObject) {
-    std::string id = element.attribute("id").value();
+    translateId(std::string{element.attribute("id").value()}, modelObject);
+  }
+
+  void ReverseTranslator::translateId(const std::string& id, openstudio::model::ModelObject& modelObject) {
     m_idToObjectMap.insert(std::make_pair(id, modelObject));
     modelObject.setName(id);
     modelObject.setGBXMLId(id);
   }
 
   void ReverseTranslator::translateName(const pugi::xml_node& element, openstudio::model::ModelObject& modelObject) {
+    translateName(decodeName(element), modelObject);
+  }
 
-    auto name = element.child("Name").text();
-    if (!name.empty()) {
-      modelObject.setDisplayName(name.as_string());
+  void ReverseTranslator::translateName(const boost::optional<std::string>& name, openstudio::model::ModelObject& modelObject) {
+    if (name) {
+      modelObject.setDisplayName(*name);
     }
   }
 
@@ -1127,5 +1217,13 @@ namespace gbxml {
     }
   }
 
+  void ReverseTranslator::translateCADObjectId(const detail::DecodedCADObjectId& decodedCADObjectId, openstudio::model::ModelObject& modelObject) {
+    modelObject.setCADObjectId(decodedCADObjectId.cadObjectId);
+    if (decodedCADObjectId.programIdRef) {
+      model::AdditionalProperties result = modelObject.additionalProperties();
+      result.setFeature("programIdRef", *decodedCADObjectId.programIdRef);
+    }
+  }
+
 }  // namespace gbxml
 }  // namespace openstudio
@@ -35,6 +35,12 @@ namespace model {
 
 namespace gbxml {
 
+  namespace detail {
+    struct DecodedCADObjectId;
+    struct DecodedOpening;
+    struct DecodedSurface;
+  }  // namespace detail
+
   class GBXML_API ReverseTranslator
   {
    public:
@@ -50,6 +56,12 @@ namespace gbxml {
     /** Get error messages generated by the last translation. */
     std::vector<LogMessage> errors() const;
 
+    /** The geometry, ids and attributes of all Surfaces and their Openings are first decoded from the XML using up to numberOfThreads
+     *  threads (0, the default, means one per hardware thread), then the model objects are created serially in document order so the
+     *  resulting model does not depend on the number of threads. */
+    unsigned numberOfThreads() const;
+    void setNumberOfThreads(unsigned numberOfThreads);
+
    private:
     openstudio::Unit m_temperatureUnit;
     openstudio::Unit m_lengthUnit;
@@ -73,17 +85,21 @@ namespace gbxml {
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateThermalZone(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateSpace(const pugi::xml_node& element, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateSurface(const pugi::xml_node& element, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateSubSurface(const pugi::xml_node& element, openstudio::model::Surface& surface);
+    boost::optional<openstudio::model::ModelObject> translateSurface(const detail::DecodedSurface& decodedSurface, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateSubSurface(const detail::DecodedOpening& decodedOpening,
+                                                                        openstudio::model::Surface& surface);
 
     /** Set the model object Name and gbXMLId additional property as the id. */
     void translateId(const pugi::xml_node& element, openstudio::model::ModelObject& modelObject);
+    void translateId(const std::string& id, openstudio::model::ModelObject& modelObject);
 
     /** Set the model object displayName additional property as the Name. */
     void translateName(const pugi::xml_node& element, openstudio::model::ModelObject& modelObject);
+    static void translateName(const boost::optional<std::string>& name, openstudio::model::ModelObject& modelObject);
 
     /** Set the model object CADObjectId additional property as the CADObjectId. */
     void translateCADObjectId(const pugi::xml_node& element, openstudio::model::ModelObject& modelObject);
+    static void translateCADObjectId(const detail::DecodedCADObjectId& decodedCADObjectId, openstudio::model::ModelObject& modelObject);
 
     // In MapSchedules.cpp
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const pugi::xml_node& element, openstudio::model::Model& model);
@@ -105,6 +121,8 @@ namespace gbxml {
 
     ProgressBar* m_progressBar;
 
+    unsigned m_numberOfThreads = 0;
+
     REGISTER_LOGGER("openstudio.gbxml.ReverseTranslator");
   };
 
@@ -34,6 +34,8 @@
 #include "../../model/ScheduleYear_Impl.hpp"
 #include "../../model/ShadingSurface.hpp"
 #include "../../model/ShadingSurface_Impl.hpp"
+#include "../../model/ShadingSurfaceGroup.hpp"
+#include "../../model/ShadingSurfaceGroup_Impl.hpp"
 #include "../../model/Space.hpp"
 #include "../../model/Space_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
@@ -1049,3 +1051,80 @@ TEST_F(gbXMLFixture, ForwardTranslator_spaceVolume) {
     EXPECT_FALSE(ospace2->isVolumeAutocalculated());
   }
 }
+
+TEST_F(gbXMLFixture, ForwardTranslator_Streaming) {
+  Model model = exampleModel();
+
+  // Enough shading surfaces for the Campus to be written in several batches
+  ShadingSurfaceGroup shadingSurfaceGroup(model);
+  for (int i = 0; i < 150; ++i) {
+    const double x = 30.0 + i;
+    std::vector<Point3d> vertices{{x, 0, 10}, {x, 0, 0}, {x + 1, 0, 0}, {x + 1, 0, 10}};
+    ShadingSurface shadingSurface(vertices, model);
+    shadingSurface.setShadingSurfaceGroup(shadingSurfaceGroup);
+  }
+
+  ForwardTranslator forwardTranslator;
+  std::string gbXML_str = forwardTranslator.modelToGbXMLString(model);
+  ASSERT_FALSE(gbXML_str.empty());
+
+  // Same document whether it is streamed to a file or to a string
+  path p = resourcesPath() / openstudio::toPath("gbxml/ForwardTranslator_Streaming.xml");
+  EXPECT_TRUE(forwardTranslator.modelToGbXML(model, p));
+  EXPECT_EQ(gbXML_str.size(), openstudio::filesystem::file_size(p));
+
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_string(gbXML_str.c_str()));
+
+  pugi::xml_node root = doc.child("gbXML");
+  ASSERT_TRUE(root);
+  EXPECT_EQ(std::string("Campus"), root.first_child().name());
+  EXPECT_EQ(std::string("DocumentHistory"), root.last_child().name());
+
+  pugi::xml_node campus = root.child("Campus");
+  EXPECT_EQ(std::string("Name"), campus.first_child().name());
+
+  auto spaces = campus.child("Building").children("Space");
+  EXPECT_EQ(model.getConcreteModelObjects<Space>().size(), static_cast<size_t>(std::distance(spaces.begin(), spaces.end())));
+
+  size_t numShadingSurfaces = 0;
+  for (const auto& surface : campus.children("Surface")) {
+    if (std::string(surface.attribute("surfaceType").value()) == "Shade") {
+      ++numShadingSurfaces;
+    }
+  }
+  EXPECT_EQ(model.getConcreteModelObjects<ShadingSurface>().size(), numShadingSurfaces);
+
+  // Streamed sections are indented like pugixml indents the whole document, the round trip through the DOM must give the same bytes
+  std::ostringstream ss;
+  doc.save(ss, "  ");
+  EXPECT_EQ(ss.str(), gbXML_str);
+}
+
+TEST_F(gbXMLFixture, ForwardTranslator_Streaming_SameAsDOM) {
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  std::string gbXML_str = forwardTranslator.modelToGbXMLString(model);
+  ASSERT_FALSE(gbXML_str.empty());
+
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_string(gbXML_str.c_str()));
+
+  std::ostringstream ss;
+  doc.save(ss, "  ");
+  std::string saved_str = ss.str();
+  ASSERT_EQ(saved_str.size(), gbXML_str.size());
+  EXPECT_EQ(saved_str, gbXML_str);
+
+  // No line is indented more than its parent plus one level
+  std::istringstream lines(gbXML_str);
+  std::string line;
+  size_t previousIndent = 0;
+  while (std::getline(lines, line)) {
+    const size_t indent = line.find_first_not_of(' ');
+    ASSERT_NE(std::string::npos, indent);
+    EXPECT_LE(indent, previousIndent + 2) << line;
+    previousIndent = indent;
+  }
+}
@@ -49,6 +49,7 @@
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
+#include "../../utilities/geometry/Geometry.hpp"
 #include "../../utilities/geometry/Plane.hpp"
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/xml/XMLValidator.hpp"
@@ -481,6 +482,45 @@ TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane) {
   EXPECT_TRUE(test);
 }
 
+TEST_F(gbXMLFixture, ReverseTranslator_NumberOfThreads) {
+  // Surfaces are decoded in parallel but created serially, the resulting model must not depend on the number of threads
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TwoStoryOffice_Trane.xml");
+
+  openstudio::gbxml::ReverseTranslator serialTranslator;
+  EXPECT_EQ(0u, serialTranslator.numberOfThreads());
+  serialTranslator.setNumberOfThreads(1);
+  EXPECT_EQ(1u, serialTranslator.numberOfThreads());
+  boost::optional<openstudio::model::Model> serialModel = serialTranslator.loadModel(inputPath);
+  ASSERT_TRUE(serialModel);
+
+  openstudio::gbxml::ReverseTranslator parallelTranslator;
+  parallelTranslator.setNumberOfThreads(4);
+  boost::optional<openstudio::model::Model> parallelModel = parallelTranslator.loadModel(inputPath);
+  ASSERT_TRUE(parallelModel);
+
+  EXPECT_EQ(serialTranslator.errors().size(), parallelTranslator.errors().size());
+  EXPECT_EQ(serialTranslator.warnings().size(), parallelTranslator.warnings().size());
+
+  auto serialSurfaces = serialModel->getConcreteModelObjects<Surface>();
+  auto parallelSurfaces = parallelModel->getConcreteModelObjects<Surface>();
+  ASSERT_FALSE(serialSurfaces.empty());
+  ASSERT_EQ(serialSurfaces.size(), parallelSurfaces.size());
+  EXPECT_EQ(serialModel->getConcreteModelObjects<SubSurface>().size(), parallelModel->getConcreteModelObjects<SubSurface>().size());
+  EXPECT_EQ(serialModel->getConcreteModelObjects<ShadingSurface>().size(), parallelModel->getConcreteModelObjects<ShadingSurface>().size());
+
+  for (const auto& serialSurface : serialSurfaces) {
+    auto parallelSurface = parallelModel->getConcreteModelObjectByName<Surface>(serialSurface.nameString());
+    ASSERT_TRUE(parallelSurface) << serialSurface.nameString();
+    EXPECT_EQ(serialSurface.surfaceType(), parallelSurface->surfaceType());
+    EXPECT_EQ(serialSurface.outsideBoundaryCondition(), parallelSurface->outsideBoundaryCondition());
+    EXPECT_EQ(serialSurface.subSurfaces().size(), parallelSurface->subSurfaces().size());
+    ASSERT_TRUE(serialSurface.space());
+    ASSERT_TRUE(parallelSurface->space());
+    EXPECT_EQ(serialSurface.space()->nameString(), parallelSurface->space()->nameString());
+    EXPECT_TRUE(circularEqual(serialSurface.vertices(), parallelSurface->vertices()));
+  }
+}
+
 TEST_F(gbXMLFixture, ReverseTranslator_3951_Surface) {
 
   openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/3951_Geometry_bug.xml");
@@ -0,0 +1,121 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "XMLStreamWriter.hpp"
+
+#include <pugixml.hpp>
+
+#include <sstream>
+
+namespace openstudio {
+namespace gbxml {
+  namespace detail {
+
+    namespace {
+
+      constexpr const char* indentation = "  ";
+
+      // Max number of sections waiting to be written
+      constexpr size_t maxPendingSections = 64;
+
+      std::string indent(unsigned depth) {
+        std::string result;
+        for (unsigned i = 0; i < depth; ++i) {
+          result += indentation;
+        }
+        return result;
+      }
+
+    }  // namespace
+
+    XMLStreamWriter::XMLStreamWriter(std::ostream& os) : m_os(os), m_thread([this]() { run(); }) {}
+
+    XMLStreamWriter::~XMLStreamWriter() {
+      finish();
+    }
+
+    void XMLStreamWriter::writeDeclaration() {
+      push(Section{"<?xml version=\"1.0\"?>\n", nullptr, 0});
+    }
+
+    void XMLStreamWriter::writeStartElement(const pugi::xml_node& element, unsigned depth) {
+      // Print a childless copy as <name attributes...></name> and drop the end tag, so pugixml takes care of escaping the attributes
+      pugi::xml_document doc;
+      auto copy = doc.append_child(element.name());
+      for (const auto& attribute : element.attributes()) {
+        copy.append_copy(attribute);
+      }
+      std::ostringstream ss;
+      doc.print(ss, "", pugi::format_raw | pugi::format_no_empty_element_tags);
+      std::string startTag = ss.str();
+      startTag.resize(startTag.size() - (std::char_traits<char>::length(element.name()) + 3));
+
+      push(Section{indent(depth) + startTag + "\n", nullptr, 0});
+    }
+
+    void XMLStreamWriter::writeEndElement(const pugi::xml_node& element, unsigned depth) {
+      push(Section{indent(depth) + "</" + element.name() + ">\n", nullptr, 0});
+    }
+
+    void XMLStreamWriter::flushChildren(pugi::xml_node& parent, unsigned depth) {
+      if (!parent.first_child()) {
+        return;
+      }
+      auto doc = std::make_unique<pugi::xml_document>();
+      while (auto child = parent.first_child()) {
+        doc->append_copy(child);
+        parent.remove_child(child);
+      }
+      push(Section{std::string(), std::move(doc), depth});
+    }
+
+    bool XMLStreamWriter::finish() {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_done = true;
+      }
+      m_sectionPushed.notify_one();
+      if (m_thread.joinable()) {
+        m_thread.join();
+      }
+      m_os.flush();
+      return m_os.good();
+    }
+
+    void XMLStreamWriter::push(Section section) {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_sectionPopped.wait(lock, [this]() { return m_sections.size() < maxPendingSections; });
+      m_sections.push_back(std::move(section));
+      lock.unlock();
+      m_sectionPushed.notify_one();
+    }
+
+    void XMLStreamWriter::run() {
+      while (true) {
+        Section section;
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_sectionPushed.wait(lock, [this]() { return m_done || !m_sections.empty(); });
+          if (m_sections.empty()) {
+            return;
+          }
+          section = std::move(m_sections.front());
+          m_sections.pop_front();
+        }
+        m_sectionPopped.notify_one();
+
+        m_os << section.text;
+        if (section.document) {
+          // Printing the document node itself would indent its first child twice, print the children at the right depth instead
+          for (const auto& child : section.document->children()) {
+            child.print(m_os, indentation, pugi::format_default, pugi::encoding_auto, section.depth);
+          }
+        }
+      }
+    }
+
+  }  // namespace detail
+}  // namespace gbxml
+}  // namespace openstudio
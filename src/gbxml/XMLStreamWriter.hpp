@@ -0,0 +1,85 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef GBXML_XMLSTREAMWRITER_HPP
+#define GBXML_XMLSTREAMWRITER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace pugi {
+class xml_node;
+class xml_document;
+}  // namespace pugi
+
+namespace openstudio {
+namespace gbxml {
+  namespace detail {
+
+    /** Writes an XML document to a stream section by section, so that the pugixml DOM only ever holds the elements that are being
+     *  translated. The output is identical to pugi::xml_document::save(os, "  ") on the whole DOM.
+     *
+     *  Elements that have children still to come are opened with writeStartElement and closed with writeEndElement. Complete elements
+     *  are handed off with flushChildren, which moves them out of the DOM: they are printed and written by a writer thread, so
+     *  serialization overlaps translation. The number of pending sections is bounded so memory stays flat if the stream is slower. */
+    class XMLStreamWriter
+    {
+     public:
+      explicit XMLStreamWriter(std::ostream& os);
+
+      /** Calls finish */
+      ~XMLStreamWriter();
+
+      XMLStreamWriter(const XMLStreamWriter&) = delete;
+      XMLStreamWriter& operator=(const XMLStreamWriter&) = delete;
+
+      /** Writes the xml declaration, same as the one pugixml writes by default */
+      void writeDeclaration();
+
+      /** Writes the start tag (with attributes) of element, at the given depth of indentation. The children are not written */
+      void writeStartElement(const pugi::xml_node& element, unsigned depth);
+
+      /** Writes the end tag of element, at the given depth of indentation */
+      void writeEndElement(const pugi::xml_node& element, unsigned depth);
+
+      /** Writes all children of parent (which is at depth - 1) at the given depth, and removes them from parent */
+      void flushChildren(pugi::xml_node& parent, unsigned depth);
+
+      /** Waits for everything to be written. Returns false if the stream failed */
+      bool finish();
+
+     private:
+      struct Section
+      {
+        std::string text;
+        // If not null, printed at depth after text
+        std::unique_ptr<pugi::xml_document> document;
+        unsigned depth = 0;
+      };
+
+      void push(Section section);
+      void run();
+
+      std::ostream& m_os;
+
+      std::mutex m_mutex;
+      std::condition_variable m_sectionPushed;
+      std::condition_variable m_sectionPopped;
+      std::deque<Section> m_sections;
+      bool m_done = false;
+
+      std::thread m_thread;
+    };
+
+  }  // namespace detail
+}  // namespace gbxml
+}  // namespace openstudio
+
+#endif  // GBXML_XMLSTREAMWRITER_HPP
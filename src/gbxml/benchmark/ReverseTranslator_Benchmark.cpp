@@ -0,0 +1,121 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../ReverseTranslator.hpp"
+
+#include "../../model/Model.hpp"
+
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace openstudio;
+
+// Writes a synthetic gbXML with a grid of nSpaces boxes (3m x 3m x 3m) on a single story: each space has 6 surfaces and one window per wall
+static openstudio::path writeSyntheticGbXML(int nSpaces) {
+  const openstudio::path p = toPath(fmt::format("./ReverseTranslator_Benchmark_{}.xml", nSpaces));
+  if (openstudio::filesystem::exists(p)) {
+    return p;
+  }
+
+  auto polyLoop = [](const std::vector<std::array<double, 3>>& points) {
+    std::string result = "<PlanarGeometry><PolyLoop>";
+    for (const auto& pt : points) {
+      result += fmt::format("<CartesianPoint><Coordinate>{}</Coordinate><Coordinate>{}</Coordinate><Coordinate>{}</Coordinate></CartesianPoint>",
+                            pt[0], pt[1], pt[2]);
+    }
+    result += "</PolyLoop></PlanarGeometry>";
+    return result;
+  };
+
+  const int nPerRow = std::max(1, static_cast<int>(std::sqrt(nSpaces)));
+  const double s = 3.0;
+
+  std::string spaces;
+  std::string surfaces;
+  for (int i = 0; i < nSpaces; ++i) {
+    const double x = s * (i % nPerRow);
+    const double y = s * (i / nPerRow);
+    const std::string spaceId = fmt::format("space_{}", i);
+    spaces += fmt::format(R"(<Space id="{0}" buildingStoreyIdRef="story_1"><Name>Space {1}</Name></Space>)", spaceId, i);
+
+    const std::vector<std::pair<std::string, std::vector<std::array<double, 3>>>> faces{
+      {"SlabOnGrade", {{x, y, 0}, {x, y + s, 0}, {x + s, y + s, 0}, {x + s, y, 0}}},
+      {"Roof", {{x, y, s}, {x + s, y, s}, {x + s, y + s, s}, {x, y + s, s}}},
+      {"ExteriorWall", {{x, y, s}, {x, y, 0}, {x + s, y, 0}, {x + s, y, s}}},
+      {"ExteriorWall", {{x + s, y, s}, {x + s, y, 0}, {x + s, y + s, 0}, {x + s, y + s, s}}},
+      {"ExteriorWall", {{x + s, y + s, s}, {x + s, y + s, 0}, {x, y + s, 0}, {x, y + s, s}}},
+      {"ExteriorWall", {{x, y + s, s}, {x, y + s, 0}, {x, y, 0}, {x, y, s}}},
+    };
+
+    for (size_t f = 0; f < faces.size(); ++f) {
+      const auto& [surfaceType, points] = faces[f];
+      const std::string surfaceId = fmt::format("{}_surface_{}", spaceId, f);
+      std::string opening;
+      if (surfaceType == "ExteriorWall") {
+        // Window inset by 0.5m in the plane of the wall
+        const auto& p0 = points[0];
+        const auto& p2 = points[2];
+        auto lerp = [](double a, double b, double t) { return a + (b - a) * t; };
+        std::vector<std::array<double, 3>> windowPoints{
+          {lerp(p0[0], p2[0], 1.0 / 6.0), lerp(p0[1], p2[1], 1.0 / 6.0), s - 0.5},
+          {lerp(p0[0], p2[0], 1.0 / 6.0), lerp(p0[1], p2[1], 1.0 / 6.0), 0.5},
+          {lerp(p0[0], p2[0], 5.0 / 6.0), lerp(p0[1], p2[1], 5.0 / 6.0), 0.5},
+          {lerp(p0[0], p2[0], 5.0 / 6.0), lerp(p0[1], p2[1], 5.0 / 6.0), s - 0.5},
+        };
+        opening = fmt::format(R"(<Opening id="{0}_window" openingType="FixedWindow">{1}<CADObjectId>Window [{0}]</CADObjectId></Opening>)", surfaceId,
+                              polyLoop(windowPoints));
+      }
+      surfaces += fmt::format(
+        R"(<Surface id="{0}" surfaceType="{1}" exposedToSun="{2}"><AdjacentSpaceId spaceIdRef="{3}"/>{4}{5}<CADObjectId>Surface [{0}]</CADObjectId></Surface>)",
+        surfaceId, surfaceType, (surfaceType == "SlabOnGrade") ? "false" : "true", spaceId, polyLoop(points), opening);
+    }
+  }
+
+  // A version other than 7.03 skips the schema validation, which is not what is being benchmarked here
+  openstudio::filesystem::ofstream file(p);
+  file << R"(<?xml version="1.0" encoding="UTF-8"?>)" << '\n'
+       << R"(<gbXML xmlns="http://www.gbxml.org/schema" temperatureUnit="C" lengthUnit="Meters" areaUnit="SquareMeters" )"
+       << R"(volumeUnit="CubicMeters" useSIUnitsForResults="true" version="6.01">)"
+       << R"(<Campus id="campus"><Building id="building" buildingType="Office"><BuildingStorey id="story_1"><Level>0</Level></BuildingStorey>)"
+       << spaces << "</Building>" << surfaces << "</Campus></gbXML>\n";
+  file.close();
+
+  return p;
+}
+
+static void BM_gbXML_RT_Synthetic(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ReverseTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  const openstudio::path p = writeSyntheticGbXML(static_cast<int>(state.range(0)));
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  reverseTranslator.setNumberOfThreads(static_cast<unsigned>(state.range(1)));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(p);
+    benchmark::DoNotOptimize(model);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Second argument is the number of threads: 1 (serial decoding) or 0 (one per hardware thread)
+BENCHMARK(BM_gbXML_RT_Synthetic)->Unit(benchmark::kMillisecond)->ArgsProduct({{64, 512, 4096}, {1, 0}});
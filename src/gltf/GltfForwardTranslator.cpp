@@ -57,6 +57,7 @@
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Polygon3d.hpp"
+#include "../utilities/geometry/TriangulationCache.hpp"
 
 #define TINYGLTF_IMPLEMENTATION
 #define STB_IMAGE_IMPLEMENTATION
@@ -64,19 +65,31 @@
 
 #include <tiny_gltf.h>
 
+#include <json/json.h>
+
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <numeric>
+#include <set>
 #include <type_traits>
 
 namespace openstudio {
 namespace gltf {
 
-  GltfForwardTranslator::GltfForwardTranslator() {
+  GltfForwardTranslator::GltfForwardTranslator() : m_triangulationCache(std::make_shared<TriangulationCache>()) {
     m_logSink.setLogLevel(Warn);
     m_logSink.setThreadId(std::this_thread::get_id());
   }
 
+  unsigned GltfForwardTranslator::numThreads() const {
+    return m_numThreads;
+  }
+
+  void GltfForwardTranslator::setNumThreads(unsigned numThreads) {
+    m_numThreads = numThreads;
+  }
+
   std::vector<LogMessage> GltfForwardTranslator::warnings() const {
     std::vector<LogMessage> result;
     for (const auto& logMessage : m_logSink.logMessages()) {
@@ -139,6 +152,62 @@ namespace gltf {
     return objects;
   }
 
+  size_t GltfForwardTranslator::getOrCreateMaterialIndex(const std::string& matName, const std::vector<GltfMaterialData>& allMaterials,
+                                                        std::vector<tinygltf::Material>& materials) {
+    auto it = std::find_if(materials.cbegin(), materials.cend(), [&matName](const auto& mat) { return mat.name == matName; });
+    if (it != materials.cend()) {
+      return std::distance(materials.cbegin(), it);
+    }
+    auto it2 = std::find_if(allMaterials.cbegin(), allMaterials.cend(), [&matName](const auto& mat) { return mat.materialName() == matName; });
+    if (it2 == allMaterials.cend()) {
+      it2 = allMaterials.cbegin();  // This is always the "Undefined" material
+    }
+    // add to gltfModel
+    materials.emplace_back(it2->toGltf());
+    return materials.size() - 1;
+  }
+
+  // Gather the face vertices (in the face coordinates) of all surfaces and of their sub surfaces
+  void gatherPlanarSurfaces(const std::vector<model::PlanarSurface>& planarSurfaces, std::vector<Transformation>& faceTransformations,
+                            std::vector<TriangulationInput>& triangulationInputs) {
+    faceTransformations.clear();
+    faceTransformations.reserve(planarSurfaces.size());
+    triangulationInputs.clear();
+    triangulationInputs.reserve(planarSurfaces.size());
+    for (const auto& planarSurface : planarSurfaces) {
+      Point3dVector vertices = planarSurface.vertices();
+      Transformation& t = faceTransformations.emplace_back(Transformation::alignFace(vertices));
+      Transformation tInv = t.inverse();
+
+      TriangulationInput& triangulationInput = triangulationInputs.emplace_back();
+      triangulationInput.handle = planarSurface.handle();
+      triangulationInput.vertices = reverse(tInv * vertices);
+      // get vertices of all sub surfaces
+      if (auto surface_ = planarSurface.optionalCast<model::Surface>()) {
+        for (const auto& subSurface : surface_->subSurfaces()) {
+          triangulationInput.holes.push_back(reverse(tInv * subSurface.vertices()));
+        }
+      }
+    }
+  }
+
+  std::vector<Point3dVectorVector> GltfForwardTranslator::triangulatePlanarSurfaces(const std::vector<model::PlanarSurface>& planarSurfaces,
+                                                                                   std::vector<Transformation>& faceTransformations,
+                                                                                   std::vector<TriangulationInput>& triangulationInputs) {
+    // Gather the face vertices of all surfaces (model access is serial), then triangulate them in parallel,
+    // reusing the cached triangulations of surfaces that did not change since the last translation
+    gatherPlanarSurfaces(planarSurfaces, faceTransformations, triangulationInputs);
+
+    std::set<UUID> planarSurfaceHandles;
+    for (const auto& triangulationInput : triangulationInputs) {
+      planarSurfaceHandles.insert(triangulationInput.handle);
+    }
+
+    std::vector<Point3dVectorVector> triangulations = m_triangulationCache->triangulate(triangulationInputs, m_numThreads);
+    m_triangulationCache->retain(planarSurfaceHandles);
+    return triangulations;
+  }
+
   boost::optional<tinygltf::Model> GltfForwardTranslator::toGltfModel(const model::Model& model, std::function<void(double)> updatePercentage) {
     // MAIN PIPELINE TO TRANSLATE OPENSTUDIO MODEL -> GLTF MODEL
 
@@ -226,8 +295,6 @@ namespace gltf {
     // add model specific materials
     // End Region CREATE MATERIALS
 
-    TransformationVector transformStack{Transformation{}};
-
     std::vector<double> matrixDefaultTransformation{1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0};
 
     // We prepare a vector of Materials
@@ -236,7 +303,17 @@ namespace gltf {
     // TODO: make it deterministic by sorting!
     // std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
 
-    for (const auto& planarSurface : planarSurfaces) {
+    std::vector<Transformation> faceTransformations;
+    std::vector<TriangulationInput> triangulationInputs;
+    std::vector<Point3dVectorVector> triangulations;
+    if (triangulateSurfaces) {
+      triangulations = triangulatePlanarSurfaces(planarSurfaces, faceTransformations, triangulationInputs);
+    } else {
+      gatherPlanarSurfaces(planarSurfaces, faceTransformations, triangulationInputs);
+    }
+
+    for (size_t surfaceIndex = 0; surfaceIndex < planarSurfaces.size(); ++surfaceIndex) {
+      const auto& planarSurface = planarSurfaces[surfaceIndex];
       // Start Region MAIN LOOP
       //
       // TODO: MOVE THAT ENTIRE LOGIC TO THE GltfUserData file? (and rename to GltfPlanarSurfaceData and make it export a Node directly)
@@ -250,11 +327,9 @@ namespace gltf {
       if (boost::optional<model::PlanarSurfaceGroup> planarSurfaceGroup_ = planarSurface.planarSurfaceGroup()) {
         buildingTransformation = planarSurfaceGroup_->buildingTransformation();
       }
-      // get the vertices
-      Point3dVector vertices = planarSurface.vertices();
-      Transformation& t = transformStack.emplace_back(Transformation::alignFace(vertices));
-      Transformation tInv = t.inverse();
-      Point3dVector faceVertices = reverse(tInv * vertices);
+      const Transformation& t = faceTransformations[surfaceIndex];
+      const Point3dVector& faceVertices = triangulationInputs[surfaceIndex].vertices;
+      const Point3dVectorVector& faceSubVertices = triangulationInputs[surfaceIndex].holes;
       std::vector<double> matrix = openstudio::toStandardVector(buildingTransformation.vector());
 
       // Adding a check to avoid warning "NODE_MATRIX_DEFAULT"  <Do not specify default transform matrix>.
@@ -275,32 +350,11 @@ namespace gltf {
       tinygltf::Mesh& targetMesh = meshes.emplace_back();
       targetMesh.name = planarSurfaceName;
 
-      auto matName = glTFUserData.surfaceTypeMaterialName();
-      size_t materialIndex = 0;
-      auto it = std::find_if(materials.cbegin(), materials.cend(), [&matName](const auto& mat) { return mat.name == matName; });
-      if (it != materials.cend()) {
-        materialIndex = std::distance(materials.cbegin(), it);
-      } else {
-        auto it2 = std::find_if(allMaterials.cbegin(), allMaterials.cend(), [&matName](const auto& mat) { return mat.materialName() == matName; });
-        if (it2 == allMaterials.cend()) {
-          it2 = allMaterials.cbegin();  // This is always the "Undefined" material
-        }
-        materialIndex = materials.size();
-        // add to gltfModel
-        materials.emplace_back(it2->toGltf());
-      }
-
-      // get vertices of all sub surfaces
-      Point3dVectorVector faceSubVertices;
-      if (auto surface_ = planarSurface.optionalCast<model::Surface>()) {
-        for (const auto& subSurface : surface_->subSurfaces()) {
-          faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
-        }
-      }
+      size_t materialIndex = getOrCreateMaterialIndex(glTFUserData.surfaceTypeMaterialName(), allMaterials, materials);
 
       Point3dVectorVector finalFaceVertices;
       if (triangulateSurfaces) {
-        finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+        finalFaceVertices = triangulations[surfaceIndex];
         if (finalFaceVertices.empty()) {
           LOG_FREE(Error, "modelToGLTF",
                    "Failed to triangulate surface " << planarSurfaceName << " with " << faceSubVertices.size() << " sub surfaces");
@@ -334,6 +388,8 @@ namespace gltf {
       thisPrimitive.material = static_cast<int>(materialIndex);
       thisPrimitive.mode = TINYGLTF_MODE_TRIANGLES;
 
+      glTFUserData.setDrawRange(node.mesh, 0, static_cast<int>(faceIndices.size()));
+
       // TODO: Based on a flag override UserData attribute
       // Addition of UserData as Extras to the node
       node.extras = tinygltf::Value(glTFUserData.toExtras());
@@ -439,6 +495,244 @@ namespace gltf {
     return ret;
   }
 
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, const path& outputPath) {
+    return modelToGLB(model, [](double percentage) {}, outputPath);
+  }
+
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath) {
+    updatePercentage(0.0);
+
+    auto planarSurfaces = getObjectsAndSort<model::PlanarSurface>(model);
+    std::vector<GltfMaterialData> allMaterials = GltfMaterialData::buildMaterials(model);
+
+    std::vector<Transformation> faceTransformations;
+    std::vector<TriangulationInput> triangulationInputs;
+    std::vector<Point3dVectorVector> triangulations = triangulatePlanarSurfaces(planarSurfaces, faceTransformations, triangulationInputs);
+
+    tinygltf::Model gltfModel;
+    gltfModel.asset.version = "2.0";
+    gltfModel.asset.generator = "OpenStudio";
+
+    // One merged primitive per material: primitives[i] is drawn with gltfModel.materials[i]
+    std::vector<detail::MergedPrimitive> primitives;
+    std::vector<std::vector<int>> surfaceNodesPerPrimitive;
+    std::vector<tinygltf::Node> surfaceNodes;
+    std::vector<int> surfaceNodesWithoutGeometry;
+    surfaceNodes.reserve(planarSurfaces.size());
+
+    const double N = planarSurfaces.size() + 1;
+    for (size_t surfaceIndex = 0; surfaceIndex < planarSurfaces.size(); ++surfaceIndex) {
+      const auto& planarSurface = planarSurfaces[surfaceIndex];
+      GltfUserData glTFUserData(planarSurface);
+
+      tinygltf::Node& node = surfaceNodes.emplace_back();
+      node.name = planarSurface.nameString();
+      const int surfaceNodeIndex = static_cast<int>(surfaceNodes.size() - 1);
+
+      const Point3dVectorVector& triangles = triangulations[surfaceIndex];
+      if (triangles.empty()) {
+        LOG(Error, "Failed to triangulate surface " << node.name << " with " << triangulationInputs[surfaceIndex].holes.size() << " sub surfaces");
+        surfaceNodesWithoutGeometry.push_back(surfaceNodeIndex);
+      } else {
+        // The primitive is shared between several surfaces so the building transformation can't be set on a node, it is baked in the vertices instead
+        Transformation buildingTransformation;
+        if (boost::optional<model::PlanarSurfaceGroup> planarSurfaceGroup_ = planarSurface.planarSurfaceGroup()) {
+          buildingTransformation = planarSurfaceGroup_->buildingTransformation();
+        }
+        const Transformation t = buildingTransformation * faceTransformations[surfaceIndex];
+        const Point3d origin;
+        Vector3d outwardNormal = (buildingTransformation * (origin + planarSurface.outwardNormal())) - (buildingTransformation * origin);
+        outwardNormal.normalize();
+
+        const size_t materialIndex = getOrCreateMaterialIndex(glTFUserData.surfaceTypeMaterialName(), allMaterials, gltfModel.materials);
+        if (materialIndex == primitives.size()) {
+          primitives.emplace_back();
+          surfaceNodesPerPrimitive.emplace_back();
+        }
+        detail::MergedPrimitive& primitive = primitives[materialIndex];
+        surfaceNodesPerPrimitive[materialIndex].push_back(surfaceNodeIndex);
+
+        const size_t drawRangeStart = primitive.indices.size();
+        for (const auto& triangle : triangles) {
+          Point3dVector finalVerts = t * triangle;
+          for (auto it = finalVerts.rbegin(); it != finalVerts.rend(); ++it) {
+            primitive.addVertex(*it, outwardNormal);
+          }
+        }
+        glTFUserData.setDrawRange(static_cast<int>(materialIndex), static_cast<int>(drawRangeStart),
+                                  static_cast<int>(primitive.indices.size() - drawRangeStart));
+      }
+
+      node.extras = tinygltf::Value(glTFUserData.toExtras());
+
+      updatePercentage(100.0 * (surfaceIndex + 1) / N);
+    }
+
+    if (primitives.empty()) {
+      LOG(Error, "Failed to prepare GLB model, there is no geometry to export");
+      return false;
+    }
+
+    // Lay out the binary chunk: for each primitive, its positions, normals and indices, each in their own 4-byte aligned buffer view
+    size_t binByteLength = 0;
+    auto addBufferView = [&gltfModel, &binByteLength](size_t byteLength, int target, int byteStride) {
+      tinygltf::BufferView& bufferView = gltfModel.bufferViews.emplace_back();
+      bufferView.buffer = 0;
+      bufferView.byteOffset = binByteLength;
+      bufferView.byteLength = byteLength;
+      bufferView.byteStride = byteStride;
+      bufferView.target = target;
+      binByteLength += detail::paddedByteLength(byteLength);
+      return static_cast<int>(gltfModel.bufferViews.size() - 1);
+    };
+
+    auto addAccessor = [&gltfModel](int bufferView, int componentType, int type, size_t count) -> tinygltf::Accessor& {
+      tinygltf::Accessor& accessor = gltfModel.accessors.emplace_back();
+      accessor.bufferView = bufferView;
+      accessor.byteOffset = 0;
+      accessor.componentType = componentType;
+      accessor.normalized = false;
+      accessor.type = type;
+      accessor.count = count;
+      return accessor;
+    };
+
+    for (size_t primitiveIndex = 0; primitiveIndex < primitives.size(); ++primitiveIndex) {
+      const detail::MergedPrimitive& primitive = primitives[primitiveIndex];
+      const size_t numVertices = primitive.numVertices();
+
+      tinygltf::Mesh& mesh = gltfModel.meshes.emplace_back();
+      mesh.name = gltfModel.materials[primitiveIndex].name;
+      tinygltf::Primitive& thisPrimitive = mesh.primitives.emplace_back();
+      thisPrimitive.material = static_cast<int>(primitiveIndex);
+      thisPrimitive.mode = TINYGLTF_MODE_TRIANGLES;
+
+      int bufferView = addBufferView(numVertices * 3 * sizeof(float), TINYGLTF_TARGET_ARRAY_BUFFER, 12);
+      tinygltf::Accessor& positionAccessor = addAccessor(bufferView, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, numVertices);
+      positionAccessor.minValues.assign(primitive.minPosition.begin(), primitive.minPosition.end());
+      positionAccessor.maxValues.assign(primitive.maxPosition.begin(), primitive.maxPosition.end());
+      thisPrimitive.attributes["POSITION"] = static_cast<int>(gltfModel.accessors.size() - 1);
+
+      bufferView = addBufferView(numVertices * 3 * sizeof(float), TINYGLTF_TARGET_ARRAY_BUFFER, 12);
+      addAccessor(bufferView, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, numVertices);
+      thisPrimitive.attributes["NORMAL"] = static_cast<int>(gltfModel.accessors.size() - 1);
+
+      bufferView = addBufferView(primitive.indexByteLength(), TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER, 0);
+      addAccessor(bufferView,
+                  primitive.useShortIndices() ? TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT : TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT,
+                  TINYGLTF_TYPE_SCALAR, primitive.indices.size());
+      thisPrimitive.indices = static_cast<int>(gltfModel.accessors.size() - 1);
+    }
+
+    // Nodes: the Z_UP top node, then one node per merged mesh, then the surface nodes as children of the mesh they're drawn in
+    const int numMeshes = static_cast<int>(primitives.size());
+    const int firstSurfaceNode = 1 + numMeshes;
+    std::vector<tinygltf::Node>& nodes = gltfModel.nodes;
+    nodes.reserve(firstSurfaceNode + surfaceNodes.size());
+    {
+      tinygltf::Node& topNode = nodes.emplace_back();
+      topNode.name = "Z_UP";
+      topNode.matrix = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+      for (int meshIndex = 0; meshIndex < numMeshes; ++meshIndex) {
+        topNode.children.push_back(1 + meshIndex);
+      }
+      for (int surfaceNodeIndex : surfaceNodesWithoutGeometry) {
+        topNode.children.push_back(firstSurfaceNode + surfaceNodeIndex);
+      }
+    }
+    for (int meshIndex = 0; meshIndex < numMeshes; ++meshIndex) {
+      tinygltf::Node& meshNode = nodes.emplace_back();
+      meshNode.name = gltfModel.meshes[meshIndex].name;
+      meshNode.mesh = meshIndex;
+      for (int surfaceNodeIndex : surfaceNodesPerPrimitive[meshIndex]) {
+        meshNode.children.push_back(firstSurfaceNode + surfaceNodeIndex);
+      }
+    }
+    std::move(surfaceNodes.begin(), surfaceNodes.end(), std::back_inserter(nodes));
+
+    tinygltf::Scene& scene = gltfModel.scenes.emplace_back();
+    scene.nodes = {0};
+    scene.extras = tinygltf::Value(GltfMetaData(model).toExtras());
+
+    // Serialize everything but the buffer with tinygltf (it would otherwise need the whole binary blob in memory), then declare the
+    // buffer: in a GLB the first buffer has no uri, it is the BIN chunk
+    std::string jsonChunk;
+    {
+      tinygltf::TinyGLTF ctx;
+      ctx.SetStoreOriginalJSONForExtrasAndExtensions(true);
+      std::stringstream ss;
+      if (!ctx.WriteGltfSceneToStream(&gltfModel, ss, false, false)) {
+        LOG(Error, "Writing GLB failed, could not serialize the glTF JSON");
+        return false;
+      }
+
+      Json::Value root;
+      Json::CharReaderBuilder rbuilder;
+      std::string formattedErrors;
+      if (!Json::parseFromStream(rbuilder, ss, &root, &formattedErrors)) {
+        LOG(Error, "Writing GLB failed, could not parse the glTF JSON: " << formattedErrors);
+        return false;
+      }
+      Json::Value buffer(Json::objectValue);
+      buffer["byteLength"] = Json::UInt64(binByteLength);
+      root["buffers"].append(buffer);
+
+      Json::StreamWriterBuilder wbuilder;
+      wbuilder["indentation"] = "";
+      jsonChunk = Json::writeString(wbuilder, root);
+    }
+    // The JSON chunk is padded with spaces
+    jsonChunk.resize(detail::paddedByteLength(jsonChunk.size()), ' ');
+
+    openstudio::filesystem::ofstream file(outputPath, std::ios_base::binary);
+    if (!file.is_open()) {
+      LOG(Error, "Writing GLB failed, cannot open '" << toString(outputPath) << "' for writing");
+      return false;
+    }
+
+    // GLB is little endian, like all the platforms we support
+    auto writeUint32 = [&file](uint32_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+    auto writePadding = [&file](size_t byteLength) {
+      static constexpr std::array<char, 4> zeros{};
+      file.write(zeros.data(), detail::paddedByteLength(byteLength) - byteLength);
+    };
+
+    // Header: magic, version, total length
+    writeUint32(0x46546C67);  // "glTF"
+    writeUint32(2);
+    writeUint32(static_cast<uint32_t>(12 + 8 + jsonChunk.size() + 8 + binByteLength));
+
+    writeUint32(static_cast<uint32_t>(jsonChunk.size()));
+    writeUint32(0x4E4F534A);  // "JSON"
+    file.write(jsonChunk.data(), jsonChunk.size());
+
+    writeUint32(static_cast<uint32_t>(binByteLength));
+    writeUint32(0x004E4942);  // "BIN\0"
+    std::vector<uint16_t> shortIndices;
+    for (auto& primitive : primitives) {
+      file.write(reinterpret_cast<const char*>(primitive.positions.data()), primitive.positions.size() * sizeof(float));
+      file.write(reinterpret_cast<const char*>(primitive.normals.data()), primitive.normals.size() * sizeof(float));
+      if (primitive.useShortIndices()) {
+        shortIndices.assign(primitive.indices.begin(), primitive.indices.end());
+        file.write(reinterpret_cast<const char*>(shortIndices.data()), shortIndices.size() * sizeof(uint16_t));
+      } else {
+        file.write(reinterpret_cast<const char*>(primitive.indices.data()), primitive.indices.size() * sizeof(uint32_t));
+      }
+      writePadding(primitive.indexByteLength());
+      // Release the memory as soon as a primitive is written
+      primitive = detail::MergedPrimitive();
+    }
+
+    file.close();
+    updatePercentage(100.0);
+
+    if (file.fail()) {
+      LOG(Error, "Writing GLB failed, error while writing to '" << toString(outputPath) << "'");
+      return false;
+    }
+    return true;
+  }
+
   // TODO: either rename, or properly populate the model...
   // To populate a GLTF Model from an existing GLTF file.
   // also exports a gltf file with a .bin file (non embeded version).
@@ -479,7 +773,12 @@ namespace gltf {
     std::string err;
     std::string warning;
     std::string fileName = toString(inputPath);
-    bool ret = loader.LoadASCIIFromFile(&gltf_Model, &err, &warning, fileName);
+    bool ret = false;
+    if (istringEqual(toString(inputPath.extension()), ".glb")) {
+      ret = loader.LoadBinaryFromFile(&gltf_Model, &err, &warning, fileName);
+    } else {
+      ret = loader.LoadASCIIFromFile(&gltf_Model, &err, &warning, fileName);
+    }
     if (!err.empty()) {
       LOG(Error, "Error loading GLTF: " << err);
       //ret = false;
@@ -501,6 +800,10 @@ namespace gltf {
           isTopNode = false;
           continue;
         }
+        // Nodes of the merged meshes in a GLB do not carry any user data
+        if (!node.extras.IsObject()) {
+          continue;
+        }
         m_userDataCollection.emplace_back(GltfUserData(node.extras));
       }
 
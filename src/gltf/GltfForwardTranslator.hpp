@@ -15,17 +15,29 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <memory>
+
 namespace tinygltf {
 class Model;
+struct Material;
 }
 
 namespace openstudio {
+
+class Point3d;
+class Transformation;
+class TriangulationCache;
+struct TriangulationInput;
+
 namespace model {
   class Model;
+  class PlanarSurface;
 }
 
 namespace gltf {
 
+  class GltfMaterialData;
+
   // TODO: update this docstring, it's always been out of sync
 
   /** GltfForwardTranslator converts an OpenStudio Model to GLTF format. There are two variations of the GLTF format,
@@ -46,11 +58,24 @@ namespace gltf {
     /** Convert an OpenStudio Model to Gltf format but as a JSON string */
     std::string modelToGLTFString(const model::Model& model);
 
+    /** Convert an OpenStudio Model to binary glTF (GLB). The binary buffer is streamed to outputPath instead of being base64 encoded,
+     *  and surfaces that share a material are merged into a single primitive with deduplicated vertices, so the file is much smaller
+     *  and faster to render. Each surface is kept as a node (without a mesh) whose extras hold its GltfUserData, including the
+     *  draw range of its triangles in the merged primitive. loadGLTF can read the result back */
+    bool modelToGLB(const model::Model& model, const path& outputPath);
+    bool modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath);
+
+    /** Surface triangulations are cached (keyed by surface handle and a checksum of its vertices and sub surface vertices) and reused
+     *  by subsequent translations with this translator. Cache misses are triangulated in parallel on numThreads threads
+     *  (0, the default, means one per hardware thread, 1 is serial) */
+    unsigned numThreads() const;
+    void setNumThreads(unsigned numThreads);
+
     /** @name QA / QC convenience methods */
     //@{
     /** load minimal gltf for QA/QC */
     bool loadGLTF(const path& inputPath, const path& inputNonEmbededpath);
-    /** load minimal gltf for QA/QC */
+    /** load minimal gltf (or glb) for QA/QC */
     bool loadGLTF(const path& inputPath);
 
     GltfMetaData getMetaData() const;
@@ -67,10 +92,21 @@ namespace gltf {
    private:
     boost::optional<tinygltf::Model> toGltfModel(const model::Model& model, std::function<void(double)> updatePercentage);
 
+    std::vector<std::vector<std::vector<Point3d>>> triangulatePlanarSurfaces(const std::vector<model::PlanarSurface>& planarSurfaces,
+                                                                            std::vector<Transformation>& faceTransformations,
+                                                                            std::vector<TriangulationInput>& triangulationInputs);
+
+    // Finds the index of the material in the gltf materials, adding it (from allMaterials) if it's not there yet
+    static size_t getOrCreateMaterialIndex(const std::string& matName, const std::vector<GltfMaterialData>& allMaterials,
+                                           std::vector<tinygltf::Material>& materials);
+
     REGISTER_LOGGER("openstudio.gltf.GltfForwardTranslator");
 
     StringStreamLogSink m_logSink;
 
+    unsigned m_numThreads = 0;
+    std::shared_ptr<TriangulationCache> m_triangulationCache;
+
     GltfMetaData m_gltfMetaData;
     std::vector<GltfUserData> m_userDataCollection;
 
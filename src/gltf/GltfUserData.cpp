@@ -548,6 +548,24 @@ namespace gltf {
     m_airLoopHVACMaterialNames.emplace_back(std::move(airLoopHVACMaterialName));
   }
 
+  int GltfUserData::drawRangeMeshIndex() const {
+    return m_drawRangeMeshIndex;
+  }
+
+  int GltfUserData::drawRangeStart() const {
+    return m_drawRangeStart;
+  }
+
+  int GltfUserData::drawRangeCount() const {
+    return m_drawRangeCount;
+  }
+
+  void GltfUserData::setDrawRange(int meshIndex, int start, int count) {
+    m_drawRangeMeshIndex = meshIndex;
+    m_drawRangeStart = start;
+    m_drawRangeCount = count;
+  }
+
   std::map<std::string, tinygltf::Value> GltfUserData::toExtras() const {
     // TODO: probably make the airloopHVAC stuff a single object with multiple properties
     // But in any case, we want Arrays not a useless map<std::string(int), std::string>
@@ -604,6 +622,9 @@ namespace gltf {
       {"airLoopHVACNames", tinygltf::Value(airLoopHVACNamesObject)},
       {"airLoopHVACHandles", tinygltf::Value(airLoopHVACHandlesObject)},
       {"airLoopHVACMaterialNames", tinygltf::Value(airLoopHVACMaterialNamesObject)},
+      {"drawRangeMeshIndex", tinygltf::Value(m_drawRangeMeshIndex)},
+      {"drawRangeStart", tinygltf::Value(m_drawRangeStart)},
+      {"drawRangeCount", tinygltf::Value(m_drawRangeCount)},
     };
   }
 
@@ -1091,6 +1112,39 @@ namespace gltf {
     } else {
       LOG(Debug, "userDataObj is missing the key 'airLoopHVACMaterialNames'");
     }
+
+    if (userDataObj.Has("drawRangeMeshIndex")) {
+      auto val = userDataObj.Get("drawRangeMeshIndex");
+      if (val.IsInt()) {
+        m_drawRangeMeshIndex = val.Get<int>();
+      } else {
+        LOG(Warn, "userDataObj has the key 'drawRangeMeshIndex' but it is not an int");
+      }
+    } else {
+      LOG(Debug, "userDataObj is missing the key 'drawRangeMeshIndex'");
+    }
+
+    if (userDataObj.Has("drawRangeStart")) {
+      auto val = userDataObj.Get("drawRangeStart");
+      if (val.IsInt()) {
+        m_drawRangeStart = val.Get<int>();
+      } else {
+        LOG(Warn, "userDataObj has the key 'drawRangeStart' but it is not an int");
+      }
+    } else {
+      LOG(Debug, "userDataObj is missing the key 'drawRangeStart'");
+    }
+
+    if (userDataObj.Has("drawRangeCount")) {
+      auto val = userDataObj.Get("drawRangeCount");
+      if (val.IsInt()) {
+        m_drawRangeCount = val.Get<int>();
+      } else {
+        LOG(Warn, "userDataObj has the key 'drawRangeCount' but it is not an int");
+      }
+    } else {
+      LOG(Debug, "userDataObj is missing the key 'drawRangeCount'");
+    }
   }
 
 }  // namespace gltf
@@ -168,6 +168,19 @@ namespace gltf {
     void setAirLoopHVACMaterialNames(const std::vector<std::string>& airLoopHVACMaterialNames);
     void addAirLoopHVACMaterialName(std::string airLoopHVACMaterialName);
 
+    //@}
+    /** @name Draw range
+     *
+     *  Where this surface's triangles live: the glTF mesh index, and the range [drawRangeStart, drawRangeStart + drawRangeCount)
+     *  of its primitive's indices. With GltfForwardTranslator::modelToGLB, surfaces sharing a material are merged into a single
+     *  primitive, so this is the only way to map a picked triangle back to a surface. drawRangeMeshIndex is -1 if not set. */
+    //@{
+
+    int drawRangeMeshIndex() const;
+    int drawRangeStart() const;
+    int drawRangeCount() const;
+    void setDrawRange(int meshIndex, int start, int count);
+
     //@}
     /** @name Other */
     //@{
@@ -230,6 +243,9 @@ namespace gltf {
     std::string m_windExposure;
     double m_illuminanceSetpoint = 0.0;
     bool m_airWall = false;
+    int m_drawRangeMeshIndex = -1;
+    int m_drawRangeStart = 0;
+    int m_drawRangeCount = 0;
 
     // TODO: replace with a struct to avoid having to keep indices in line?
     std::vector<std::string> m_airLoopHVACNames;
@@ -13,6 +13,9 @@
 
 #include <tiny_gltf.h>
 
+#include <boost/functional/hash.hpp>
+
+#include <cmath>
 #include <limits>
 #include <type_traits>
 #include <vector>
@@ -200,6 +203,47 @@ namespace gltf {
       verticesAccessorId = addCoordinates(allVertices, coordinatesBuffer, accessors);
       normalsAccessorId = addNormals(normalVectors, coordinatesBuffer, accessors);
     }
+    MergedPrimitive::MergedPrimitive()
+      : minPosition{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()},
+        maxPosition{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()} {}
+
+    size_t MergedPrimitive::VertexKeyHash::operator()(const std::array<int64_t, 6>& key) const {
+      return boost::hash_range(key.begin(), key.end());
+    }
+
+    uint32_t MergedPrimitive::addVertex(const Point3d& position, const Vector3d& normal) {
+      const std::array<int64_t, 6> key{std::llround(position.x() * 1000.0), std::llround(position.y() * 1000.0),
+                                       std::llround(position.z() * 1000.0), std::llround(normal.x() * 1.0e6),
+                                       std::llround(normal.y() * 1.0e6),    std::llround(normal.z() * 1.0e6)};
+      auto [it, inserted] = m_lookup.try_emplace(key, static_cast<uint32_t>(numVertices()));
+      if (inserted) {
+        const std::array<float, 3> p{static_cast<float>(position.x()), static_cast<float>(position.y()), static_cast<float>(position.z())};
+        for (size_t i = 0; i < 3; ++i) {
+          positions.push_back(p[i]);
+          minPosition[i] = std::min(minPosition[i], p[i]);
+          maxPosition[i] = std::max(maxPosition[i], p[i]);
+        }
+        normals.push_back(static_cast<float>(normal.x()));
+        normals.push_back(static_cast<float>(normal.y()));
+        normals.push_back(static_cast<float>(normal.z()));
+      }
+      indices.push_back(it->second);
+      return it->second;
+    }
+
+    size_t MergedPrimitive::numVertices() const {
+      return positions.size() / 3;
+    }
+
+    bool MergedPrimitive::useShortIndices() const {
+      // 65535 is reserved as the primitive restart value
+      return numVertices() < std::numeric_limits<uint16_t>::max();
+    }
+
+    size_t MergedPrimitive::indexByteLength() const {
+      return indices.size() * (useShortIndices() ? sizeof(uint16_t) : sizeof(uint32_t));
+    }
+
   }  // namespace detail
 
   // Gets GLTF Material name on the basis of idd Object Type and Name
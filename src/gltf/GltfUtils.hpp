@@ -10,7 +10,10 @@
 
 #include "../utilities/core/Path.hpp"
 
+#include <array>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace tinygltf {
@@ -60,6 +63,41 @@ namespace gltf {
       //                std::vector<tinygltf::Accessor>& accessors);
       // int createBuffers(const std::vector<float>& values, std::vector<unsigned char>& coordinatesBuffer, std::vector<tinygltf::Accessor>& accessors);
     };
+
+    // Geometry of all the surfaces sharing a material, merged into a single primitive (used by the GLB export).
+    // Vertices are deduplicated on their (position, normal) pair, positions are compared with the same 1 mm tolerance as the GLTF export
+    struct MergedPrimitive
+    {
+      std::vector<float> positions;
+      std::vector<float> normals;
+      std::vector<uint32_t> indices;
+      std::array<float, 3> minPosition;
+      std::array<float, 3> maxPosition;
+
+      MergedPrimitive();
+
+      // Returns the index of the vertex, adding it if there isn't an identical one already
+      uint32_t addVertex(const Point3d& position, const Vector3d& normal);
+
+      size_t numVertices() const;
+
+      // Indices are written as unsigned short when possible, as unsigned int otherwise
+      bool useShortIndices() const;
+      size_t indexByteLength() const;
+
+     private:
+      struct VertexKeyHash
+      {
+        size_t operator()(const std::array<int64_t, 6>& key) const;
+      };
+
+      std::unordered_map<std::array<int64_t, 6>, uint32_t, VertexKeyHash> m_lookup;
+    };
+
+    // Size of the data rounded up to the 4 bytes alignment required between GLB chunks and buffer views
+    constexpr size_t paddedByteLength(size_t byteLength) {
+      return (byteLength + 3) & ~static_cast<size_t>(3);
+    }
   }  // namespace detail
 
 }  // namespace gltf
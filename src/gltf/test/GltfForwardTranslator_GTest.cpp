@@ -906,3 +906,62 @@ TEST_F(GltfFixture, GltfForwardTranslator_TwoStoryOffice_Trane) {
   /*bool result = ft.modelToGLTF(model.get(), output);
   ASSERT_TRUE(result);*/
 }
+
+TEST_F(GltfFixture, GltfForwardTranslator_ExampleModel_GLB) {
+  Model model = exampleModel();
+
+  GltfForwardTranslator ft;
+  openstudio::path gltfPath = resourcesPath() / toPath("utilities/Geometry/exampleModel_GLB.gltf");
+  openstudio::path glbPath = resourcesPath() / toPath("utilities/Geometry/exampleModel.glb");
+  ASSERT_TRUE(ft.modelToGLTF(model, gltfPath));
+  ASSERT_TRUE(ft.modelToGLB(model, glbPath));
+  ASSERT_TRUE(openstudio::filesystem::exists(glbPath));
+  EXPECT_LT(openstudio::filesystem::file_size(glbPath), openstudio::filesystem::file_size(gltfPath));
+
+  {
+    openstudio::filesystem::ifstream file(glbPath, std::ios_base::binary);
+    std::array<char, 4> magic{};
+    file.read(magic.data(), magic.size());
+    EXPECT_EQ("glTF", std::string(magic.data(), magic.size()));
+  }
+
+  ASSERT_TRUE(ft.loadGLTF(glbPath));
+  EXPECT_EQ(openStudioVersion(), ft.getMetaData().version());
+
+  std::vector<GltfUserData> glbUserDatas = ft.getUserDataCollection();
+  ASSERT_EQ(30, glbUserDatas.size());
+
+  // Surfaces sharing a material are drawn in the same merged mesh, with non overlapping draw ranges
+  std::map<std::string, int> meshIndexByMaterial;
+  std::map<int, std::vector<std::pair<int, int>>> drawRangesByMesh;
+  for (const auto& userData : glbUserDatas) {
+    EXPECT_GE(userData.drawRangeMeshIndex(), 0) << userData.name();
+    EXPECT_GT(userData.drawRangeCount(), 0) << userData.name();
+    EXPECT_EQ(0, userData.drawRangeCount() % 3) << userData.name();
+    auto [it, inserted] = meshIndexByMaterial.emplace(userData.surfaceTypeMaterialName(), userData.drawRangeMeshIndex());
+    EXPECT_EQ(it->second, userData.drawRangeMeshIndex()) << userData.name();
+    drawRangesByMesh[userData.drawRangeMeshIndex()].emplace_back(userData.drawRangeStart(), userData.drawRangeCount());
+  }
+  EXPECT_EQ(meshIndexByMaterial.size(), drawRangesByMesh.size());
+  for (auto& [meshIndex, drawRanges] : drawRangesByMesh) {
+    std::sort(drawRanges.begin(), drawRanges.end());
+    int expectedStart = 0;
+    for (const auto& [start, count] : drawRanges) {
+      EXPECT_EQ(expectedStart, start) << "mesh " << meshIndex;
+      expectedStart = start + count;
+    }
+  }
+
+  // The user data is otherwise the same as with the GLTF export, where each surface is its own mesh
+  boost::optional<GltfUserData> glbUserData = ft.getUserDataBySurfaceName("Surface 1");
+  ASSERT_TRUE(glbUserData);
+  ASSERT_TRUE(ft.loadGLTF(gltfPath));
+  boost::optional<GltfUserData> gltfUserData = ft.getUserDataBySurfaceName("Surface 1");
+  ASSERT_TRUE(gltfUserData);
+  EXPECT_EQ(gltfUserData->handle(), glbUserData->handle());
+  EXPECT_EQ(gltfUserData->surfaceType(), glbUserData->surfaceType());
+  EXPECT_EQ(gltfUserData->constructionMaterialName(), glbUserData->constructionMaterialName());
+  EXPECT_EQ(gltfUserData->thermalZoneName(), glbUserData->thermalZoneName());
+  EXPECT_EQ(gltfUserData->drawRangeCount(), glbUserData->drawRangeCount());
+  EXPECT_EQ(0, gltfUserData->drawRangeStart());
+}
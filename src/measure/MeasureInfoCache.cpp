@@ -0,0 +1,131 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "MeasureInfoCache.hpp"
+
+#include "../utilities/bcl/BCLMeasure.hpp"
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/UUID.hpp"
+
+#include <OpenStudio.hxx>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace openstudio {
+namespace measure {
+
+  MeasureInfoCache::MeasureInfoCache(const openstudio::path& directory) : m_directory(directory) {}
+
+  openstudio::path MeasureInfoCache::directory() const {
+    return m_directory;
+  }
+
+  std::string MeasureInfoCache::key(const BCLMeasure& measure, const openstudio::path& osmOrIdfPath) {
+    boost::optional<openstudio::path> scriptPath_ = measure.primaryScriptPath();
+    if (!scriptPath_) {
+      return {};
+    }
+
+    // Every file of the measure as found on disk (measure.xml, resources, any other file the script may load), but the tests and docs which
+    // can't change the measure's information. Sorted so the key doesn't depend on the directory iteration order
+    const openstudio::path measureDir = measure.directory();
+    std::vector<openstudio::path> filePaths;
+    for (auto it = openstudio::filesystem::recursive_directory_iterator(measureDir); it != openstudio::filesystem::recursive_directory_iterator();
+         ++it) {
+      const openstudio::path& p = it->path();
+      const std::string fileName = toString(p.filename());
+      if (openstudio::filesystem::is_directory(p)) {
+        if (BCLMeasure::isIgnoredFileName(fileName) || fileName == "__pycache__"
+            || (p.parent_path() == measureDir && (fileName == "tests" || fileName == "docs"))) {
+          it.disable_recursion_pending();
+        }
+      } else if (openstudio::filesystem::is_regular_file(p) && !BCLMeasure::isIgnoredFileName(fileName)) {
+        filePaths.push_back(p);
+      }
+    }
+    std::sort(filePaths.begin(), filePaths.end());
+
+    std::string filesChecksums;
+    for (const auto& filePath : filePaths) {
+      filesChecksums += openstudio::filesystem::relative(filePath, measureDir).generic_string();
+      filesChecksums += ":" + openstudio::checksum(filePath) + "\n";
+    }
+
+    std::string result = measure.measureLanguage().valueName();
+    result += "-" + openstudio::checksum(*scriptPath_);
+    result += openstudio::checksum(filesChecksums);
+    if (!osmOrIdfPath.empty()) {
+      result += openstudio::checksum(osmOrIdfPath);
+    }
+    result += openstudio::checksum(openStudioLongVersion());
+    return result;
+  }
+
+  openstudio::path MeasureInfoCache::entryPath(const std::string& key) const {
+    return m_directory / toPath(key + ".json");
+  }
+
+  boost::optional<OSMeasureInfo> MeasureInfoCache::get(const std::string& key) const {
+    if (key.empty()) {
+      return boost::none;
+    }
+
+    const openstudio::path p = entryPath(key);
+    openstudio::filesystem::ifstream ifs(p, std::ios_base::binary);
+    if (!ifs) {
+      return boost::none;
+    }
+
+    Json::CharReaderBuilder rbuilder;
+    std::string formattedErrors;
+    Json::Value root;
+    if (!Json::parseFromStream(rbuilder, ifs, &root, &formattedErrors)) {
+      LOG(Warn, "Ignoring unreadable measure info cache entry '" << toString(p) << "': " << formattedErrors);
+      return boost::none;
+    }
+
+    boost::optional<OSMeasureInfo> result = OSMeasureInfo::fromJSON(root);
+    if (!result) {
+      LOG(Warn, "Ignoring invalid measure info cache entry '" << toString(p) << "'");
+    }
+    return result;
+  }
+
+  bool MeasureInfoCache::put(const std::string& key, const OSMeasureInfo& info) const {
+    if (key.empty()) {
+      return false;
+    }
+
+    // Write to a temporary file then rename it, so that other processes sharing the directory never read a partial entry
+    const openstudio::path p = entryPath(key);
+    const openstudio::path tempPath = m_directory / toPath(key + "." + removeBraces(createUUID()) + ".tmp");
+    try {
+      openstudio::filesystem::create_directories(m_directory);
+      {
+        openstudio::filesystem::ofstream ofs(tempPath, std::ios_base::binary);
+        if (!ofs) {
+          LOG(Warn, "Cannot write measure info cache entry '" << toString(tempPath) << "'");
+          return false;
+        }
+        Json::StreamWriterBuilder wbuilder;
+        wbuilder["indentation"] = "";
+        ofs << Json::writeString(wbuilder, info.toJSON());
+      }
+      openstudio::filesystem::rename(tempPath, p);
+    } catch (const std::exception& e) {
+      LOG(Warn, "Cannot write measure info cache entry '" << toString(p) << "': " << e.what());
+      boost::system::error_code ec;
+      openstudio::filesystem::remove(tempPath, ec);
+      return false;
+    }
+    return true;
+  }
+
+}  // namespace measure
+}  // namespace openstudio
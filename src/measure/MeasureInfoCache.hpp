@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef MEASURE_MEASUREINFOCACHE_HPP
+#define MEASURE_MEASUREINFOCACHE_HPP
+
+#include "MeasureAPI.hpp"
+
+#include "OSMeasureInfoGetter.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <string>
+
+namespace openstudio {
+
+class BCLMeasure;
+
+namespace measure {
+
+  /** MeasureInfoCache stores the OSMeasureInfo computed for measures in a directory on disk, so that they can be reused by later processes
+   *  without loading the measures in a script engine again. An entry is keyed by the checksums of all the measure's files (script,
+   *  measure.xml, resources...), of the model or workspace the information was computed with (if any), and by the OpenStudio version.
+   *  Changing any of these gives a new key, so outdated entries are never returned. */
+  class MEASURE_API MeasureInfoCache
+  {
+   public:
+    /** The directory is created when the first entry is stored. */
+    explicit MeasureInfoCache(const openstudio::path& directory);
+
+    openstudio::path directory() const;
+
+    /** Returns the key for the information of measure computed with the model or workspace at osmOrIdfPath, which may be empty. Returns an
+     *  empty string if the measure has no primary script. */
+    static std::string key(const BCLMeasure& measure, const openstudio::path& osmOrIdfPath = openstudio::path());
+
+    /** Returns the stored information for key, if any. */
+    boost::optional<OSMeasureInfo> get(const std::string& key) const;
+
+    /** Stores info under key, replacing any previous entry. Returns false if the entry could not be written. */
+    bool put(const std::string& key, const OSMeasureInfo& info) const;
+
+   private:
+    REGISTER_LOGGER("openstudio.measure.MeasureInfoCache");
+
+    openstudio::path entryPath(const std::string& key) const;
+
+    openstudio::path m_directory;
+  };
+
+}  // namespace measure
+}  // namespace openstudio
+
+#endif  // MEASURE_MEASUREINFOCACHE_HPP
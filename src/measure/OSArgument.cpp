@@ -97,6 +97,99 @@ namespace measure {
     return result;
   }
 
+  boost::optional<OSArgument> OSArgument::fromJSON(const Json::Value& value) {
+    if (!value.isObject() || !value["name"].isString() || !value["type"].isString()) {
+      return boost::none;
+    }
+
+    OSArgumentType type;
+    try {
+      type = OSArgumentType(value["type"].asString());
+    } catch (const std::exception&) {
+      return boost::none;
+    }
+
+    const std::string name = value["name"].asString();
+    const bool required = value.get("required", true).asBool();
+    const bool modelDependent = value.get("model_dependent", false).asBool();
+
+    boost::optional<OSArgument> result;
+    if (type == OSArgumentType::Boolean) {
+      result = makeBoolArgument(name, required, modelDependent);
+    } else if (type == OSArgumentType::Double) {
+      result = makeDoubleArgument(name, required, modelDependent);
+    } else if (type == OSArgumentType::Integer) {
+      result = makeIntegerArgument(name, required, modelDependent);
+    } else if (type == OSArgumentType::String) {
+      result = makeStringArgument(name, required, modelDependent);
+    } else if (type == OSArgumentType::Choice) {
+      std::vector<std::string> choices;
+      for (const auto& choice : value["choice_values"]) {
+        choices.push_back(choice.asString());
+      }
+      std::vector<std::string> displayNames;
+      for (const auto& displayName : value["choice_display_names"]) {
+        displayNames.push_back(displayName.asString());
+      }
+      result = makeChoiceArgument(name, choices, displayNames, required, modelDependent);
+    } else if (type == OSArgumentType::Path) {
+      result = makePathArgument(name, value.get("is_read", true).asBool(), value.get("extension", "").asString(), required, modelDependent);
+    } else if (type == OSArgumentType::Separator) {
+      result = makeSeparatorArgument(name, modelDependent);
+    } else {
+      return boost::none;
+    }
+
+    if (value["display_name"].isString()) {
+      result->setDisplayName(value["display_name"].asString());
+    }
+    if (value["description"].isString()) {
+      result->setDescription(value["description"].asString());
+    }
+    if (value["units"].isString()) {
+      result->setUnits(value["units"].asString());
+    }
+
+    if (type == OSArgumentType::Double) {
+      if (value["min_value"].isNumeric() && !result->setMinValue(value["min_value"].asDouble())) {
+        return boost::none;
+      }
+      if (value["max_value"].isNumeric() && !result->setMaxValue(value["max_value"].asDouble())) {
+        return boost::none;
+      }
+    } else if (type == OSArgumentType::Integer) {
+      if (value["min_value"].isInt() && !result->setMinValue(value["min_value"].asInt())) {
+        return boost::none;
+      }
+      if (value["max_value"].isInt() && !result->setMaxValue(value["max_value"].asInt())) {
+        return boost::none;
+      }
+    }
+
+    // Sets the value or default value, returns false if it can't be
+    auto setFromJSON = [&result, &type](const Json::Value& v, bool isDefault) -> bool {
+      if (v.isNull()) {
+        return true;
+      }
+      auto set = [&result, isDefault](const auto& t) { return isDefault ? result->setDefaultValue(t) : result->setValue(t); };
+      if (type == OSArgumentType::Boolean) {
+        return v.isBool() && set(v.asBool());
+      } else if (type == OSArgumentType::Double) {
+        return v.isNumeric() && set(v.asDouble());
+      } else if (type == OSArgumentType::Integer) {
+        return v.isInt() && set(v.asInt());
+      } else if (type == OSArgumentType::Path) {
+        return v.isString() && set(toPath(v.asString()));
+      }
+      return v.isString() && set(v.asString());
+    };
+    if (!setFromJSON(value["default_value"], true) || !setFromJSON(value["value"], false)) {
+      return boost::none;
+    }
+
+    return result;
+  }
+
   //openstudio::UUID OSArgument::uuid() const {
   //  return m_uuid;
   //}
@@ -1202,6 +1295,8 @@ namespace measure {
       }
 
     } else if (m_type == OSArgumentType::Path) {
+      root["is_read"] = m_isRead;
+      root["extension"] = m_extension;
       if (hasDefaultValue()) {
         root["default_value"] = openstudio::toString(defaultValueAsPath());
       }
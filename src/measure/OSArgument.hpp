@@ -135,6 +135,10 @@ OPENSTUDIO_ENUM( OSDomainType,
     /** Creates a separator OSArgument, cannot be used to store a value, cannot be required. */
     static OSArgument makeSeparatorArgument(const std::string& name, bool modelDependent = false);
 
+    /** Creates an OSArgument from the output of toJSON. Returns boost::none if value does not describe a valid argument. Deprecated
+   *  OSArgumentType::Quantity arguments are not supported. */
+    static boost::optional<OSArgument> fromJSON(const Json::Value& value);
+
     //@}
 
     /** @name Getters */
@@ -11,6 +11,8 @@
 #include "../utilities/bcl/BCLMeasure.hpp"
 #include "../utilities/core/StringHelpers.hpp"
 
+#include <json/json.h>
+
 #include <sstream>
 
 namespace openstudio {
@@ -62,6 +64,70 @@ namespace measure {
     return m_arguments;
   }
 
+  Json::Value OSMeasureInfo::toJSON() const {
+    Json::Value root;
+    if (m_error) {
+      root["error"] = *m_error;
+      return root;
+    }
+    root["measure_type"] = m_measureType.valueName();
+    root["class_name"] = m_className;
+    root["name"] = m_name;
+    root["description"] = m_description;
+    root["taxonomy"] = m_taxonomy;
+    root["modeler_description"] = m_modelerDescription;
+    auto& arguments = root["arguments"];
+    arguments = Json::arrayValue;
+    for (const OSArgument& argument : m_arguments) {
+      arguments.append(argument.toJSON());
+    }
+    auto& outputs = root["outputs"];
+    outputs = Json::arrayValue;
+    for (const OSOutput& output : m_outputs) {
+      outputs.append(output.toJSON());
+    }
+    return root;
+  }
+
+  boost::optional<OSMeasureInfo> OSMeasureInfo::fromJSON(const Json::Value& value) {
+    if (!value.isObject()) {
+      return boost::none;
+    }
+    if (value["error"].isString()) {
+      return OSMeasureInfo(value["error"].asString());
+    }
+    if (!value["measure_type"].isString() || !value["arguments"].isArray() || !value["outputs"].isArray()) {
+      return boost::none;
+    }
+
+    MeasureType measureType;
+    try {
+      measureType = MeasureType(value["measure_type"].asString());
+    } catch (const std::exception&) {
+      return boost::none;
+    }
+
+    std::vector<OSArgument> arguments;
+    for (const auto& argumentValue : value["arguments"]) {
+      if (auto argument_ = OSArgument::fromJSON(argumentValue)) {
+        arguments.push_back(std::move(*argument_));
+      } else {
+        return boost::none;
+      }
+    }
+    std::vector<OSOutput> outputs;
+    for (const auto& outputValue : value["outputs"]) {
+      if (auto output_ = OSOutput::fromJSON(outputValue)) {
+        outputs.push_back(std::move(*output_));
+      } else {
+        return boost::none;
+      }
+    }
+
+    return OSMeasureInfo(measureType, value["class_name"].asString(), value["name"].asString(), value["description"].asString(),
+                         value["taxonomy"].asString(), value["modeler_description"].asString(), arguments, outputs);
+  }
+
   std::vector<BCLMeasureArgument> OSMeasureInfo::bclMeasureArguments() const {
     unsigned n = m_arguments.size();
     std::vector<BCLMeasureArgument> bclArguments;
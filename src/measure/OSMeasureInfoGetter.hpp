@@ -73,6 +73,12 @@ namespace measure {
     /// Updates the measure if needed, returns true if an update was performed
     bool update(BCLMeasure& measure) const;
 
+    /// Serializes the information, or the error
+    Json::Value toJSON() const;
+
+    /// Creates an OSMeasureInfo from the output of toJSON, returns boost::none if value can't be read
+    static boost::optional<OSMeasureInfo> fromJSON(const Json::Value& value);
+
    private:
     REGISTER_LOGGER("openstudio.measure.OSMeasureInfo");
 
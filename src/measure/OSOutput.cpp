@@ -34,6 +34,34 @@ namespace measure {
     return result;
   }
 
+  boost::optional<OSOutput> OSOutput::fromJSON(const Json::Value& value) {
+    if (!value.isObject() || !value["name"].isString() || !value["type"].isString()) {
+      return boost::none;
+    }
+
+    OSOutputType type;
+    try {
+      type = OSOutputType(value["type"].asString());
+    } catch (const std::exception&) {
+      return boost::none;
+    }
+
+    OSOutput result(value["name"].asString(), type, value.get("model_dependent", false).asBool());
+    if (value["display_name"].isString()) {
+      result.setDisplayName(value["display_name"].asString());
+    }
+    if (value["m_shortName"].isString()) {
+      result.setShortName(value["m_shortName"].asString());
+    }
+    if (value["description"].isString()) {
+      result.setDescription(value["description"].asString());
+    }
+    if (value["units"].isString()) {
+      result.setUnits(value["units"].asString());
+    }
+    return result;
+  }
+
   std::string OSOutput::name() const {
     return m_name;
   }
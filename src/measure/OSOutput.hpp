@@ -68,6 +68,9 @@ OPENSTUDIO_ENUM(OSOutputType,
     /** Creates an OSOutput for string values. */
     static OSOutput makeStringOutput(const std::string& name, bool modelDependent = false);
 
+    /** Creates an OSOutput from the output of toJSON. Returns boost::none if value does not describe a valid output. */
+    static boost::optional<OSOutput> fromJSON(const Json::Value& value);
+
     /** @name Getters */
     //@{
 
@@ -0,0 +1,138 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "MeasureFixture.hpp"
+
+#include "../MeasureInfoCache.hpp"
+#include "../OSArgument.hpp"
+#include "../OSOutput.hpp"
+
+#include "../../utilities/bcl/BCLMeasure.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <json/json.h>
+
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::measure;
+
+TEST_F(MeasureFixture, OSArgument_fromJSON) {
+  std::vector<OSArgument> arguments;
+
+  OSArgument boolArgument = OSArgument::makeBoolArgument("bool", false);
+  boolArgument.setDefaultValue(true);
+  arguments.push_back(boolArgument);
+
+  OSArgument doubleArgument = OSArgument::makeDoubleArgument("double", true, true);
+  doubleArgument.setDisplayName("Double");
+  doubleArgument.setDescription("A double");
+  doubleArgument.setUnits("m");
+  doubleArgument.setMinValue(0.5);
+  doubleArgument.setDefaultValue(1.5);
+  doubleArgument.setValue(2.0);
+  arguments.push_back(doubleArgument);
+
+  OSArgument integerArgument = OSArgument::makeIntegerArgument("integer");
+  integerArgument.setMaxValue(10);
+  integerArgument.setValue(3);
+  arguments.push_back(integerArgument);
+
+  OSArgument stringArgument = OSArgument::makeStringArgument("string");
+  stringArgument.setDefaultValue("hello");
+  arguments.push_back(stringArgument);
+
+  OSArgument choiceArgument = OSArgument::makeChoiceArgument("choice", {"a", "b"}, {"A", "B"});
+  choiceArgument.setDefaultValue("b");
+  arguments.push_back(choiceArgument);
+
+  OSArgument pathArgument = OSArgument::makePathArgument("path", false, "csv");
+  pathArgument.setValue(toPath("out.csv"));
+  arguments.push_back(pathArgument);
+
+  arguments.push_back(OSArgument::makeSeparatorArgument("separator"));
+
+  for (const OSArgument& argument : arguments) {
+    boost::optional<OSArgument> roundTripped = OSArgument::fromJSON(argument.toJSON());
+    ASSERT_TRUE(roundTripped) << argument.name();
+    EXPECT_EQ(argument.toJSON(), roundTripped->toJSON()) << argument.name();
+    EXPECT_EQ(argument.isRead(), roundTripped->isRead());
+    EXPECT_EQ(argument.extension(), roundTripped->extension());
+  }
+
+  EXPECT_FALSE(OSArgument::fromJSON(Json::Value("double")));
+  Json::Value badValue = doubleArgument.toJSON();
+  badValue["value"] = "not a double";
+  EXPECT_FALSE(OSArgument::fromJSON(badValue));
+}
+
+TEST_F(MeasureFixture, MeasureInfoCache) {
+  openstudio::path dir = scratchDir / toPath("MeasureInfoCache");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::path measureDir = dir / toPath("CachedMeasure");
+  openstudio::path cacheDir = dir / toPath("cache");
+
+  BCLMeasure measure("Cached Measure", "CachedMeasure", measureDir, "Envelope.Fenestration", MeasureType::ModelMeasure, "Description",
+                     "Modeler Description");
+
+  OSArgument argument = OSArgument::makeDoubleArgument("double");
+  argument.setDefaultValue(1.0);
+  OSOutput output = OSOutput::makeStringOutput("string");
+  output.setUnits("m");
+  OSMeasureInfo info(MeasureType::ModelMeasure, "CachedMeasure", "Cached Measure", "Description", "Envelope.Fenestration", "Modeler Description",
+                     {argument}, {output});
+
+  MeasureInfoCache cache(cacheDir);
+  const std::string key = MeasureInfoCache::key(measure);
+  ASSERT_FALSE(key.empty());
+  EXPECT_FALSE(cache.get(key));
+
+  EXPECT_TRUE(cache.put(key, info));
+  boost::optional<OSMeasureInfo> cached = cache.get(key);
+  ASSERT_TRUE(cached);
+  EXPECT_FALSE(cached->error());
+  EXPECT_EQ(info.toJSON(), cached->toJSON());
+
+  // Errors are cached as well
+  const std::string errorKey = MeasureInfoCache::key(measure, measureDir / toPath("measure.xml"));
+  EXPECT_NE(key, errorKey);
+  EXPECT_TRUE(cache.put(errorKey, OSMeasureInfo("Failed")));
+  cached = cache.get(errorKey);
+  ASSERT_TRUE(cached);
+  ASSERT_TRUE(cached->error());
+  EXPECT_EQ("Failed", cached->error().get());
+
+  // Changing the measure script changes the key
+  {
+    openstudio::filesystem::ofstream ofs(*measure.primaryScriptPath(), std::ios_base::app);
+    ofs << "\n# changed\n";
+  }
+  const std::string newKey = MeasureInfoCache::key(measure);
+  EXPECT_NE(key, newKey);
+  EXPECT_FALSE(cache.get(newKey));
+  EXPECT_TRUE(cache.put(newKey, info));
+
+  // So does changing any other file of the measure, eg a resource the arguments come from
+  const openstudio::path resourcesDir = measureDir / toPath("resources");
+  openstudio::filesystem::create_directories(resourcesDir);
+  {
+    openstudio::filesystem::ofstream ofs(resourcesDir / toPath("helpers.rb"));
+    ofs << "DEFAULT_VALUE = 1.0\n";
+  }
+  const std::string resourceKey = MeasureInfoCache::key(measure);
+  EXPECT_NE(newKey, resourceKey);
+  EXPECT_FALSE(cache.get(resourceKey));
+  EXPECT_TRUE(cache.put(resourceKey, info));
+  EXPECT_EQ(resourceKey, MeasureInfoCache::key(measure));
+
+  {
+    openstudio::filesystem::ofstream ofs(resourcesDir / toPath("helpers.rb"));
+    ofs << "DEFAULT_VALUE = 2.0\n";
+  }
+  const std::string editedResourceKey = MeasureInfoCache::key(measure);
+  EXPECT_NE(resourceKey, editedResourceKey);
+  EXPECT_FALSE(cache.get(editedResourceKey));
+}
@@ -47,7 +47,11 @@
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/ThreeJS.hpp"
+#include "../utilities/geometry/TriangulationCache.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <set>
 #include <thread>
 
 #include <cmath>
@@ -312,42 +316,76 @@ namespace model {
     }
   }
 
-  void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas,
-                      bool triangulateSurfaces, bool includeGeometryDiagnostics) {
-    std::string name = planarSurface.nameString();
-    boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
-    boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
+  /// Plain geometry inputs of a planar surface, gathered serially from the model so that the triangulation can run in parallel
+  struct PlanarSurfaceGeometry
+  {
+    Transformation buildingTransformation;
+    Transformation t;
+    Point3dVector vertices;
+    TriangulationInput triangulationInput;
+  };
+
+  PlanarSurfaceGeometry getPlanarSurfaceGeometry(const PlanarSurface& planarSurface) {
+    PlanarSurfaceGeometry result;
 
     // get the transformation to site coordinates
-    Transformation buildingTransformation;
-    if (planarSurfaceGroup) {
-      buildingTransformation = planarSurfaceGroup->buildingTransformation();
+    if (boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup()) {
+      result.buildingTransformation = planarSurfaceGroup->buildingTransformation();
     }
 
     // get the vertices
-    Point3dVector vertices = planarSurface.vertices();
-    Transformation t = Transformation::alignFace(vertices);
+    result.vertices = planarSurface.vertices();
+    result.t = Transformation::alignFace(result.vertices);
     //Transformation r = t.rotationMatrix();
-    Transformation tInv = t.inverse();
-    Point3dVector faceVertices = reverse(tInv * vertices);
+    Transformation tInv = result.t.inverse();
+
+    result.triangulationInput.handle = planarSurface.handle();
+    result.triangulationInput.vertices = reverse(tInv * result.vertices);
 
     // get vertices of all sub surfaces
-    Point3dVectorVector faceSubVertices;
-    if (surface) {
+    if (boost::optional<Surface> surface = planarSurface.optionalCast<Surface>()) {
       for (const auto& subSurface : surface->subSurfaces()) {
-        faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
+        result.triangulationInput.holes.push_back(reverse(tInv * subSurface.vertices()));
       }
     }
 
+    return result;
+  }
+
+  /// Signature of what gets emitted for a surface, used to find the changed surfaces
+  std::size_t getEmittedSignature(const PlanarSurfaceGeometry& surfaceGeometry, const ThreeUserData& userData, bool triangulateSurfaces) {
+    std::size_t seed = TriangulationCache::checksum(surfaceGeometry.triangulationInput.vertices, surfaceGeometry.triangulationInput.holes);
+    boost::hash_combine(seed, triangulateSurfaces);
+    for (const double d : surfaceGeometry.buildingTransformation.vector()) {
+      boost::hash_combine(seed, d);
+    }
+    // The triangulation input is face aligned, a surface that is only translated or rotated keeps the same one
+    for (const double d : surfaceGeometry.t.vector()) {
+      boost::hash_combine(seed, d);
+    }
+    boost::hash_combine(seed, userData.toJSON());
+    return seed;
+  }
+
+  void makeGeometries(const PlanarSurface& planarSurface, const PlanarSurfaceGeometry& surfaceGeometry,
+                      const Point3dVectorVector& triangulatedFaceVertices, std::vector<ThreeGeometry>& geometries,
+                      std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces, bool includeGeometryDiagnostics) {
+    std::string name = planarSurface.nameString();
+
+    const Transformation& buildingTransformation = surfaceGeometry.buildingTransformation;
+    const Transformation& t = surfaceGeometry.t;
+    const Point3dVector& vertices = surfaceGeometry.vertices;
+
     Point3dVectorVector finalFaceVertices;
     if (triangulateSurfaces) {
-      finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+      finalFaceVertices = triangulatedFaceVertices;
       if (finalFaceVertices.empty()) {
-        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
+        LOG_FREE(Error, "modelToThreeJS",
+                 "Failed to triangulate surface " << name << " with " << surfaceGeometry.triangulationInput.holes.size() << " sub surfaces");
         return;
       }
     } else {
-      finalFaceVertices.push_back(faceVertices);
+      finalFaceVertices.push_back(surfaceGeometry.triangulationInput.vertices);
     }
 
     Point3dVector allVertices;
@@ -413,7 +451,7 @@ namespace model {
     userDatas.push_back(userData);
   }
 
-  ThreeJSForwardTranslator::ThreeJSForwardTranslator() {
+  ThreeJSForwardTranslator::ThreeJSForwardTranslator() : m_triangulationCache(std::make_shared<TriangulationCache>()) {
     m_logSink.setLogLevel(Warn);
     //m_logSink.setChannelRegex(boost::regex("openstudio\\.model\\.ThreeJSForwardTranslator"));
     m_logSink.setThreadId(std::this_thread::get_id());
@@ -427,6 +465,33 @@ namespace model {
     m_includeGeometryDiagnostics = includeGeometryDiagnostics;
   }
 
+  unsigned ThreeJSForwardTranslator::numThreads() const {
+    return m_numThreads;
+  }
+
+  void ThreeJSForwardTranslator::setNumThreads(unsigned numThreads) {
+    m_numThreads = numThreads;
+  }
+
+  std::size_t ThreeJSForwardTranslator::triangulationCacheHits() const {
+    return m_triangulationCache->hits();
+  }
+
+  std::size_t ThreeJSForwardTranslator::triangulationCacheMisses() const {
+    return m_triangulationCache->misses();
+  }
+
+  void ThreeJSForwardTranslator::clearCache() {
+    m_triangulationCache->clear();
+    m_triangulationCache->resetStatistics();
+    m_emittedSignatures.clear();
+    m_removedSurfaceHandles.clear();
+  }
+
+  std::vector<std::string> ThreeJSForwardTranslator::removedSurfaceHandles() const {
+    return m_removedSurfaceHandles;
+  }
+
   std::vector<LogMessage> ThreeJSForwardTranslator::warnings() const {
     std::vector<LogMessage> result = m_logSink.logMessages();
     result.erase(std::remove_if(result.begin(), result.end(), [](const auto& logMessage) { return logMessage.logLevel() != Warn; }), result.end());
@@ -444,8 +509,18 @@ namespace model {
   }
 
   ThreeScene ThreeJSForwardTranslator::modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage) {
+    return modelToThreeJS(model, triangulateSurfaces, std::move(updatePercentage), false);
+  }
+
+  ThreeScene ThreeJSForwardTranslator::modelToThreeJSChanges(const Model& model, bool triangulateSurfaces) {
+    return modelToThreeJS(model, triangulateSurfaces, [](double percentage) {}, true);
+  }
+
+  ThreeScene ThreeJSForwardTranslator::modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage,
+                                                      bool changesOnly) {
     m_logSink.setThreadId(std::this_thread::get_id());
     m_logSink.resetStringStream();
+    m_triangulationCache->resetStatistics();
 
     updatePercentage(0.0);
 
@@ -488,15 +563,51 @@ namespace model {
       }
     }
 
-    // loop over all surfaces
+    // gather the geometry of all surfaces, then triangulate them in parallel (reusing the cached triangulations of unchanged surfaces)
+    std::vector<PlanarSurfaceGeometry> surfaceGeometries;
+    surfaceGeometries.reserve(planarSurfaces.size());
     for (const auto& planarSurface : planarSurfaces) {
+      surfaceGeometries.push_back(getPlanarSurfaceGeometry(planarSurface));
+    }
+
+    std::vector<Point3dVectorVector> triangulations(planarSurfaces.size());
+    if (triangulateSurfaces) {
+      std::vector<TriangulationInput> triangulationInputs;
+      triangulationInputs.reserve(surfaceGeometries.size());
+      for (const auto& surfaceGeometry : surfaceGeometries) {
+        triangulationInputs.push_back(surfaceGeometry.triangulationInput);
+      }
+      triangulations = m_triangulationCache->triangulate(triangulationInputs, m_numThreads);
+
+      std::set<UUID> handles;
+      for (const auto& planarSurface : planarSurfaces) {
+        handles.insert(planarSurface.handle());
+      }
+      m_triangulationCache->retain(handles);
+    }
+
+    std::map<UUID, std::size_t> emittedSignatures;
+
+    // loop over all surfaces
+    for (size_t surfaceIndex = 0; surfaceIndex < planarSurfaces.size(); ++surfaceIndex) {
+      const auto& planarSurface = planarSurfaces[surfaceIndex];
+
       std::vector<ThreeGeometry> geometries;
       std::vector<ThreeUserData> userDatas;
-      makeGeometries(planarSurface, geometries, userDatas, triangulateSurfaces, m_includeGeometryDiagnostics);
+      makeGeometries(planarSurface, surfaceGeometries[surfaceIndex], triangulations[surfaceIndex], geometries, userDatas, triangulateSurfaces,
+                     m_includeGeometryDiagnostics);
       OS_ASSERT(geometries.size() == userDatas.size());
 
-      size_t n = geometries.size();
-      for (size_t i = 0; i < n; ++i) {
+      bool emit = true;
+      if (!userDatas.empty()) {
+        const std::size_t signature = getEmittedSignature(surfaceGeometries[surfaceIndex], userDatas.front(), triangulateSurfaces);
+        const auto previous = m_emittedSignatures.find(planarSurface.handle());
+        emit = !changesOnly || (previous == m_emittedSignatures.end()) || (previous->second != signature);
+        emittedSignatures[planarSurface.handle()] = signature;
+      }
+
+      const size_t nEmitted = emit ? geometries.size() : 0;
+      for (size_t i = 0; i < nEmitted; ++i) {
 
         allGeometries.push_back(geometries[i]);
 
@@ -512,6 +623,14 @@ namespace model {
       updatePercentage(100.0 * n / N);
     }
 
+    m_removedSurfaceHandles.clear();
+    for (const auto& [handle, signature] : m_emittedSignatures) {
+      if (emittedSignatures.find(handle) == emittedSignatures.end()) {
+        m_removedSurfaceHandles.push_back(toThreeUUID(toString(handle)));
+      }
+    }
+    m_emittedSignatures = std::move(emittedSignatures);
+
     if (m_includeGeometryDiagnostics) {
       for (auto& space : spaces) {
         space.resetCachedGeometryDiagnostics();
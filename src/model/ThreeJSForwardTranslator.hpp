@@ -14,7 +14,12 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <memory>
+
 namespace openstudio {
+
+class TriangulationCache;
+
 namespace model {
 
   /** ThreeJSForwardTranslator converts an OpenStudio Model to ThreeJS format. There are two variations of the ThreeJS format,
@@ -34,6 +39,27 @@ namespace model {
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces);
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage);
 
+    /// Incremental variant of modelToThreeJS for viewers that keep the previous scene around: the returned scene only has geometries and
+    /// scene children for the surfaces that are new or changed (geometry or user data) since the previous call to modelToThreeJS or
+    /// modelToThreeJSChanges on this translator. Materials and metadata are always complete.
+    ThreeScene modelToThreeJSChanges(const Model& model, bool triangulateSurfaces);
+
+    /// Handles (in ThreeJS UUID format) of the surfaces that were emitted before but no longer exist, as of the last translation
+    std::vector<std::string> removedSurfaceHandles() const;
+
+    /// Triangulations are cached per surface (keyed by handle and a checksum of its vertices and sub surface vertices) and reused
+    /// by subsequent translations with this translator. Cache misses are triangulated in parallel on numThreads threads
+    /// (0, the default, means one per hardware thread, 1 is serial)
+    unsigned numThreads() const;
+    void setNumThreads(unsigned numThreads);
+
+    /// Number of surfaces whose triangulation was reused from / added to the cache during the last translation
+    std::size_t triangulationCacheHits() const;
+    std::size_t triangulationCacheMisses() const;
+
+    /// Forget the cached triangulations and the surfaces emitted previously, the next modelToThreeJSChanges will emit all surfaces
+    void clearCache();
+
     /// Get warning messages generated by the last translation.
     std::vector<LogMessage> warnings() const;
 
@@ -46,10 +72,18 @@ namespace model {
     void setIncludeGeometryDiagnostics(bool includeGeometryDiagnostics);
 
    private:
+    ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage, bool changesOnly);
+
     REGISTER_LOGGER("openstudio.model.ThreeJSForwardTranslator");
 
     StringStreamLogSink m_logSink;
     bool m_includeGeometryDiagnostics = false;
+    unsigned m_numThreads = 0;
+
+    std::shared_ptr<TriangulationCache> m_triangulationCache;
+    // surface handle => signature of what was last emitted for it
+    std::map<UUID, std::size_t> m_emittedSignatures;
+    std::vector<std::string> m_removedSurfaceHandles;
   };
 
 }  // namespace model
@@ -17,6 +17,10 @@
 #include "../SubSurface.hpp"
 #include "../SubSurface_Impl.hpp"
 #include "../ConstructionAirBoundary.hpp"
+#include "../InteriorPartitionSurface.hpp"
+#include "../InteriorPartitionSurface_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
 #include "../Construction.hpp"
 #include "../../osversion/VersionTranslator.hpp"
 #include "../../utilities/geometry/ThreeJS.hpp"
@@ -378,3 +382,105 @@ TEST_F(ModelFixture, ThreeJSForwardTranslator_ConstructionAirBoundary) {
   EXPECT_FALSE(checkIfMaterialExist(materials, "Construction_Air_Boundary"));  // Instead it should have been skipped to be replace by "AirWall"
   EXPECT_TRUE(checkIfMaterialExist(materials, "AirWall"));
 }
+
+TEST_F(ModelFixture, ThreeJSForwardTranslator_CachedAndIncremental) {
+
+  Model model = exampleModel();
+  const size_t numPlanarSurfaces = model.getModelObjects<PlanarSurface>().size();
+
+  ThreeJSForwardTranslator ft;
+  ft.setNumThreads(4);
+
+  ThreeScene scene = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+  EXPECT_EQ(0u, ft.triangulationCacheHits());
+  EXPECT_EQ(numPlanarSurfaces, ft.triangulationCacheMisses());
+
+  // Nothing changed: every triangulation comes from the cache, and the result is the same
+  ThreeScene scene2 = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(numPlanarSurfaces, ft.triangulationCacheHits());
+  EXPECT_EQ(0u, ft.triangulationCacheMisses());
+  ASSERT_EQ(scene.geometries().size(), scene2.geometries().size());
+  for (size_t i = 0; i < scene.geometries().size(); ++i) {
+    EXPECT_EQ(scene.geometries()[i].uuid(), scene2.geometries()[i].uuid());
+    EXPECT_EQ(scene.geometries()[i].data().vertices(), scene2.geometries()[i].data().vertices());
+    EXPECT_EQ(scene.geometries()[i].data().faces(), scene2.geometries()[i].data().faces());
+  }
+
+  // Same model: nothing to re-emit
+  ThreeScene changes = ft.modelToThreeJSChanges(model, true);
+  EXPECT_EQ(0u, changes.geometries().size());
+  EXPECT_EQ(0u, changes.object().children().size());
+  EXPECT_EQ(0u, ft.removedSurfaceHandles().size());
+  // But materials are always complete
+  EXPECT_EQ(scene.materials().size(), changes.materials().size());
+
+  auto desks = model.getConcreteModelObjects<InteriorPartitionSurface>();
+  ASSERT_EQ(1u, desks.size());
+  InteriorPartitionSurface desk = desks.front();
+
+  // Moving the desk: only that one is re-emitted, its face aligned triangulation may be reused
+  auto deskVertices = desk.vertices();
+  for (auto& v : deskVertices) {
+    v = Point3d(v.x() + 1.0, v.y(), v.z());
+  }
+  EXPECT_TRUE(desk.setVertices(deskVertices));
+  changes = ft.modelToThreeJSChanges(model, true);
+  ASSERT_EQ(1u, changes.geometries().size());
+  EXPECT_EQ(toThreeUUID(toString(desk.handle())), changes.geometries()[0].uuid());
+  EXPECT_LE(ft.triangulationCacheMisses(), 1u);
+  EXPECT_GE(ft.triangulationCacheHits(), numPlanarSurfaces - 1);
+
+  // Renaming it: re-emitted, but the triangulation is reused
+  desk.setName("Moved Desk");
+  changes = ft.modelToThreeJSChanges(model, true);
+  ASSERT_EQ(1u, changes.geometries().size());
+  EXPECT_EQ(0u, ft.triangulationCacheMisses());
+
+  // Removing it
+  const std::string deskHandle = toThreeUUID(toString(desk.handle()));
+  desk.remove();
+  changes = ft.modelToThreeJSChanges(model, true);
+  EXPECT_EQ(0u, changes.geometries().size());
+  ASSERT_EQ(1u, ft.removedSurfaceHandles().size());
+  EXPECT_EQ(deskHandle, ft.removedSurfaceHandles()[0]);
+
+  // After clearing the cache, everything is emitted again
+  ft.clearCache();
+  changes = ft.modelToThreeJSChanges(model, true);
+  EXPECT_EQ(numPlanarSurfaces - 1, changes.geometries().size());
+}
+
+TEST_F(ModelFixture, ThreeJSForwardTranslator_Changes_PureTranslation) {
+  Model model;
+  Space space(model);
+
+  // Integer coordinates, so the translated surface has exactly the same face aligned vertices
+  const Point3dVector floorVertices{{0, 0, 0}, {0, 10, 0}, {10, 10, 0}, {10, 0, 0}};
+  const Point3dVector wallVertices{{0, 0, 3}, {0, 0, 0}, {10, 0, 0}, {10, 0, 3}};
+  Surface floor(floorVertices, model);
+  floor.setSpace(space);
+  Surface wall(wallVertices, model);
+  wall.setSpace(space);
+
+  ThreeJSForwardTranslator ft;
+  ThreeScene changes = ft.modelToThreeJSChanges(model, true);
+  EXPECT_EQ(2u, changes.geometries().size());
+
+  Point3dVector translatedVertices;
+  for (const auto& v : wallVertices) {
+    translatedVertices.emplace_back(v.x() + 5.0, v.y() + 2.0, v.z());
+  }
+  ASSERT_TRUE(wall.setVertices(translatedVertices));
+
+  changes = ft.modelToThreeJSChanges(model, true);
+  ASSERT_EQ(1u, changes.geometries().size());
+  EXPECT_EQ(toThreeUUID(toString(wall.handle())), changes.geometries()[0].uuid());
+  EXPECT_TRUE(ft.removedSurfaceHandles().empty());
+
+  // The re-emitted geometry is at the new location
+  const std::vector<double> emittedVertices = changes.geometries()[0].data().vertices();
+  ASSERT_FALSE(emittedVertices.empty());
+  const double maxX = *std::max_element(emittedVertices.begin(), emittedVertices.end());
+  EXPECT_GT(maxX, 10.0);
+}
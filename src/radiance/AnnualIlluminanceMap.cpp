@@ -6,15 +6,15 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
-#include <iostream>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
 #include <fstream>
+#include <iostream>
+#include <limits>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
 #include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
 
 using namespace std;
 using namespace boost;
@@ -31,6 +31,26 @@ namespace radiance {
     init(path);
   }
 
+  namespace {
+
+    // conversion from footcandles to lux
+    constexpr double footcandlesToLux = 10.76;
+
+    // first bytes of a sidecar file, the last character is the version of the format
+    constexpr std::array<char, 8> sidecarMagic{'O', 'S', 'A', 'N', 'N', 'I', 'L', '1'};
+
+    template <typename T>
+    void writeBinary(std::ostream& os, const T& value) {
+      os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool readBinary(std::istream& is, T& value) {
+      return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+  }  // namespace
+
   void AnnualIlluminanceMap::init(const openstudio::path& path) {
     // file must exist
     if (!exists(path)) {
@@ -45,24 +65,14 @@ namespace radiance {
     unsigned lineNum = 0;
 
     // keep track of matrix size
-    unsigned M = 0;
-    unsigned N = 0;
+    std::size_t M = 0;
+    std::size_t N = 0;
 
     // temp string to read file
     string line;
 
-    // lines 1 and 2 are the header lines
+    // line 1 is the first header line
     string line1;
-    string line2;
-
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
-    // conversion from footcandles to lux
-    const double footcandlesToLux(10.76);
 
     // read the rest of the file line by line
     while (getline(file, line)) {
@@ -75,11 +85,8 @@ namespace radiance {
 
       } else if (lineNum == 2) {
 
-        // save line 2
-        line2 = line;
-
-        // create the header info
-        HeaderInfo headerInfo(line1, line2);
+        // create the header info from line 1 and 2
+        HeaderInfo headerInfo(line1, line);
 
         // we can now initialize x and y vectors
         m_xVector = headerInfo.xVector();
@@ -90,64 +97,244 @@ namespace radiance {
 
       } else {
 
+        if (boost::all(line, boost::is_space())) {
+          continue;
+        }
+
         // each line contains the month, day, time (in hours),
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
-        // followed by M*N illuminance points
-
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string> tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string>::iterator it(tk.begin()); it != tk.end(); ++it) {
-          lineVector.push_back(*it);
+        // followed by M*N illuminance points, which are converted in place at the end of m_values
+        std::array<double, 6> standardValues{};
+        std::size_t numStandardValues = 0;
+        std::size_t numValues = 0;
+        const std::size_t start = m_values.size();
+        m_values.resize(start + M * N);
+
+        const char* p = line.c_str();
+        char* end = nullptr;
+        while (true) {
+          const double value = std::strtod(p, &end);
+          if (end == p) {
+            break;
+          }
+          p = end;
+          if (numStandardValues < standardValues.size()) {
+            standardValues[numStandardValues++] = value;
+          } else {
+            if (numValues < M * N) {
+              m_values[start + numValues] = static_cast<float>(footcandlesToLux * value);
+            }
+            ++numValues;
+          }
         }
 
-        // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
-
-        if (numValues != M * N) {
+        if ((numStandardValues != standardValues.size()) || (numValues != M * N)) {
+          m_values.resize(start);
+          m_values.shrink_to_fit();
           LOG(Fatal, "Incorrect number of illuminance values read " << numValues << ", expecting " << M * N << ".");
           return;
-        } else {
+        }
 
-          MonthOfYear thisMonth = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          auto day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+        MonthOfYear thisMonth = monthOfYear(static_cast<unsigned>(standardValues[0]));
+        auto day = static_cast<unsigned>(standardValues[1]);
+        double fracDays = standardValues[2] / 24.0;
 
-          // ignore solar angles and global horizontal for now
+        // ignore solar angles and global horizontal for now
 
-          // make the date time
-          DateTime dateTime(Date(thisMonth, day), Time(fracDays));
+        // make the date time
+        addTimestep(DateTime(Date(thisMonth, day), Time(fracDays)));
+      }
+    }
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M, N);
+    // close file
+    file.close();
 
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j) {
-            for (unsigned i = 0; i < M; ++i) {
-              illuminanceMap(i, j) = footcandlesToLux * lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
-          }
+    m_values.shrink_to_fit();
+  }
 
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
+  void AnnualIlluminanceMap::addTimestep(const openstudio::DateTime& dateTime) {
+    m_dateTimeIndex[dateTime] = m_dateTimes.size();
+    m_dateTimes.push_back(dateTime);
+  }
+
+  /// get the illuminance map in lux corresponding to date and time
+  openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const {
+    auto it = m_dateTimeIndex.find(dateTime);
+    if (it == m_dateTimeIndex.end()) {
+      return m_nullIlluminanceMap;
+    }
+
+    const std::size_t M = m_xVector.size();
+    const std::size_t N = m_yVector.size();
+
+    std::vector<float> buffer;
+    const float* values = nullptr;
+    if (m_sidecarPath.empty()) {
+      values = m_values.data() + it->second * M * N;
+    } else {
+      buffer.resize(M * N);
+      openstudio::filesystem::ifstream file(m_sidecarPath, std::ios_base::binary);
+      file.seekg(m_sidecarValuesOffset + static_cast<std::streamoff>(it->second * M * N * sizeof(float)));
+      if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(float)))) {
+        LOG(Error, "Cannot read illuminance map for " << dateTime << " from '" << toString(m_sidecarPath) << "'");
+        return m_nullIlluminanceMap;
+      }
+      values = buffer.data();
+    }
+
+    Matrix result(M, N);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        result(i, j) = *values;
+        ++values;
+      }
+    }
+    return result;
+  }
+
+  void AnnualIlluminanceMap::forEachTimestep(const std::function<void(const float*)>& f) const {
+    const std::size_t size = m_xVector.size() * m_yVector.size();
+
+    if (m_sidecarPath.empty()) {
+      for (std::size_t t = 0; t < m_dateTimes.size(); ++t) {
+        f(m_values.data() + t * size);
+      }
+      return;
+    }
+
+    std::vector<float> buffer(size);
+    openstudio::filesystem::ifstream file(m_sidecarPath, std::ios_base::binary);
+    file.seekg(m_sidecarValuesOffset);
+    for (std::size_t t = 0; t < m_dateTimes.size(); ++t) {
+      if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size * sizeof(float)))) {
+        LOG(Error, "Cannot read illuminance map " << t << " from '" << toString(m_sidecarPath) << "'");
+        return;
+      }
+      f(buffer.data());
+    }
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::fractionOfTimesteps(double lower, double upper) const {
+    const std::size_t M = m_xVector.size();
+    const std::size_t N = m_yVector.size();
+
+    std::vector<unsigned> counts(M * N, 0);
+    forEachTimestep([&counts, lower, upper](const float* values) {
+      for (std::size_t k = 0; k < counts.size(); ++k) {
+        if ((values[k] >= lower) && (values[k] <= upper)) {
+          ++counts[k];
         }
       }
+    });
+
+    Matrix result(M, N, 0.0);
+    if (m_dateTimes.empty()) {
+      return result;
     }
+    const auto numTimesteps = static_cast<double>(m_dateTimes.size());
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        result(i, j) = counts[j * M + i] / numTimesteps;
+      }
+    }
+    return result;
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::daylightAutonomy(double threshold) const {
+    return fractionOfTimesteps(threshold, std::numeric_limits<double>::infinity());
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::usefulDaylightIlluminance(double lowerThreshold, double upperThreshold) const {
+    return fractionOfTimesteps(lowerThreshold, upperThreshold);
+  }
+
+  bool AnnualIlluminanceMap::saveSidecar(const openstudio::path& sidecarPath) const {
+    openstudio::filesystem::ofstream file(sidecarPath, std::ios_base::binary | std::ios_base::trunc);
+    if (!file) {
+      LOG(Error, "Cannot open '" << toString(sidecarPath) << "' for writing");
+      return false;
+    }
+
+    // header: M, N and number of timesteps, x and y vectors
+    file.write(sidecarMagic.data(), sidecarMagic.size());
+    writeBinary(file, static_cast<std::uint64_t>(m_xVector.size()));
+    writeBinary(file, static_cast<std::uint64_t>(m_yVector.size()));
+    writeBinary(file, static_cast<std::uint64_t>(m_dateTimes.size()));
+    for (double x : m_xVector) {
+      writeBinary(file, x);
+    }
+    for (double y : m_yVector) {
+      writeBinary(file, y);
+    }
+
+    // index: month, day and time in seconds of each timestep
+    for (const DateTime& dateTime : m_dateTimes) {
+      writeBinary(file, static_cast<std::int32_t>(dateTime.date().monthOfYear().value()));
+      writeBinary(file, static_cast<std::int32_t>(dateTime.date().dayOfMonth()));
+      writeBinary(file, static_cast<std::int32_t>(dateTime.time().totalSeconds()));
+    }
+
+    // values: M*N floats per timestep
+    const std::size_t size = m_xVector.size() * m_yVector.size();
+    forEachTimestep([&file, size](const float* values) {
+      file.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(size * sizeof(float)));
+    });
 
-    // close file
     file.close();
+    return !file.fail();
   }
 
-  /// get the illuminance map in lux corresponding to date and time
-  openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()) {
-      return it->second;
+  AnnualIlluminanceMap AnnualIlluminanceMap::loadSidecar(const openstudio::path& sidecarPath) {
+    AnnualIlluminanceMap result;
+
+    openstudio::filesystem::ifstream file(sidecarPath, std::ios_base::binary);
+    std::array<char, 8> magic{};
+    if (!file || !file.read(magic.data(), magic.size()) || (magic != sidecarMagic)) {
+      LOG(Error, "'" << toString(sidecarPath) << "' is not an illuminance map sidecar file");
+      return result;
+    }
+
+    std::uint64_t M = 0;
+    std::uint64_t N = 0;
+    std::uint64_t numTimesteps = 0;
+    if (!readBinary(file, M) || !readBinary(file, N) || !readBinary(file, numTimesteps)) {
+      LOG(Error, "Cannot read header of '" << toString(sidecarPath) << "'");
+      return result;
+    }
+
+    Vector xVector(M);
+    Vector yVector(N);
+    bool ok = true;
+    for (std::uint64_t i = 0; ok && (i < M); ++i) {
+      ok = readBinary(file, xVector(i));
+    }
+    for (std::uint64_t j = 0; ok && (j < N); ++j) {
+      ok = readBinary(file, yVector(j));
+    }
+
+    for (std::uint64_t t = 0; ok && (t < numTimesteps); ++t) {
+      std::int32_t month = 0;
+      std::int32_t day = 0;
+      std::int32_t seconds = 0;
+      ok = readBinary(file, month) && readBinary(file, day) && readBinary(file, seconds);
+      if (ok) {
+        result.addTimestep(DateTime(Date(monthOfYear(static_cast<unsigned>(month)), static_cast<unsigned>(day)), Time(0, 0, 0, seconds)));
+      }
+    }
+
+    const std::streamoff valuesOffset = file.tellg();
+    file.seekg(0, std::ios_base::end);
+    const std::streamoff expectedSize = valuesOffset + static_cast<std::streamoff>(numTimesteps * M * N * sizeof(float));
+    if (!ok || (file.tellg() < expectedSize)) {
+      LOG(Error, "'" << toString(sidecarPath) << "' is truncated");
+      return {};
     }
 
-    return m_nullIlluminanceMap;
+    result.m_xVector = xVector;
+    result.m_yVector = yVector;
+    result.m_sidecarPath = sidecarPath;
+    result.m_sidecarValuesOffset = valuesOffset;
+    return result;
   }
 
 }  // namespace radiance
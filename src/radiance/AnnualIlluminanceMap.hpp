@@ -14,18 +14,27 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <functional>
+#include <ios>
+#include <map>
+#include <vector>
+
 namespace openstudio {
 namespace radiance {
 
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   The illuminance values of all timesteps are stored in a single contiguous array of floats, illuminance maps are only
+  *   created as Matrix when requested. A map can also be saved to a binary sidecar file (see saveSidecar), which can be reopened
+  *   without parsing the text file and without loading the values: each timestep is then read from the sidecar on demand.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
    private:
-    // map of DateTime to Matrix (illuminance map)
-    using DateTimeIlluminanceMap = std::map<openstudio::DateTime, openstudio::Matrix>;
+    // map of DateTime to timestep index
+    using DateTimeIndexMap = std::map<openstudio::DateTime, std::size_t>;
 
    public:
     /// default constructor
@@ -56,16 +65,45 @@ namespace radiance {
     /// get the illuminance map in lux corresponding to date and time
     openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+    /// get the fraction of timesteps for which the illuminance at each point is at least threshold (in lux), same dimensions as
+    /// illuminanceMap
+    openstudio::Matrix daylightAutonomy(double threshold) const;
+
+    /// get the fraction of timesteps for which the illuminance at each point is between lowerThreshold and upperThreshold (in lux),
+    /// i.e. the Useful Daylight Illuminance, same dimensions as illuminanceMap
+    openstudio::Matrix usefulDaylightIlluminance(double lowerThreshold = 100.0, double upperThreshold = 2000.0) const;
+
+    /// save the grid, dates and times and illuminance values to a binary sidecar file, in the byte order of this machine
+    bool saveSidecar(const openstudio::path& sidecarPath) const;
+
+    /// open a sidecar file written by saveSidecar, illuminance maps are read from the file on demand
+    static AnnualIlluminanceMap loadSidecar(const openstudio::path& sidecarPath);
+
    private:
     REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
     void init(const openstudio::path& path);
 
+    void addTimestep(const openstudio::DateTime& dateTime);
+
+    // calls f with the M*N values of each timestep in turn, without keeping more than one timestep in memory
+    void forEachTimestep(const std::function<void(const float*)>& f) const;
+
+    // fraction of timesteps for which the illuminance at each point is in [lower, upper]
+    openstudio::Matrix fractionOfTimesteps(double lower, double upper) const;
+
     openstudio::DateTimeVector m_dateTimes;
     openstudio::Vector m_xVector;
     openstudio::Vector m_yVector;
     openstudio::Matrix m_nullIlluminanceMap;  // used when there is no data
-    DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+    DateTimeIndexMap m_dateTimeIndex;
+
+    // illuminance values in lux, M*N values per timestep (x index varying fastest, as in the input file)
+    std::vector<float> m_values;
+
+    // when opened with loadSidecar, the values are read from the sidecar instead of m_values
+    openstudio::path m_sidecarPath;
+    std::streamoff m_sidecarValuesOffset = 0;
   };
 
 }  // namespace radiance
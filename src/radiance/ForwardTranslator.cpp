@@ -51,6 +51,7 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Transformation.hpp"
@@ -132,6 +133,71 @@ namespace radiance {
     return boost::lexical_cast<std::string>(t);
   }
 
+  namespace {
+
+    // concatenates a set of material definitions, in the order they are written to the materials files
+    std::string joinLines(const std::set<std::string>& lines) {
+      std::string result;
+      for (const auto& line : lines) {
+        result += line;
+      }
+      return result;
+    }
+
+    // Files generated by buildingSpaces, kept in memory and written all at once at the end so that each file is written once
+    class FileWriteQueue
+    {
+     public:
+      // adding a path again replaces its content, as if the file was overwritten
+      void add(const openstudio::path& path, std::string content) {
+        auto [it, inserted] = m_index.try_emplace(path, m_files.size());
+        if (inserted) {
+          m_files.push_back({path, std::move(content)});
+        } else {
+          m_files[it->second].second = std::move(content);
+        }
+        m_order.push_back(it->second);
+      }
+
+      // writes the files using up to numThreads threads, t_outfiles gets one entry per call to add for each file that could be written,
+      // returns the files that could not be opened
+      std::vector<openstudio::path> write(unsigned numThreads, std::vector<openstudio::path>& t_outfiles) const {
+        // not std::vector<bool>, which cannot be written concurrently
+        std::vector<char> written(m_files.size(), 0);
+        openstudio::parallelFor(
+          m_files.size(),
+          [this, &written](size_t i) {
+            OFSTREAM file(m_files[i].first);
+            if (file.is_open()) {
+              file << m_files[i].second;
+              written[i] = 1;
+            }
+          },
+          numThreads);
+
+        for (size_t i : m_order) {
+          if (written[i] != 0) {
+            t_outfiles.push_back(m_files[i].first);
+          }
+        }
+
+        std::vector<openstudio::path> result;
+        for (size_t i = 0; i < m_files.size(); ++i) {
+          if (written[i] == 0) {
+            result.push_back(m_files[i].first);
+          }
+        }
+        return result;
+      }
+
+     private:
+      std::vector<std::pair<openstudio::path, std::string>> m_files;
+      std::map<openstudio::path, size_t> m_index;
+      std::vector<size_t> m_order;
+    };
+
+  }  // namespace
+
   // basic constructor
   ForwardTranslator::ForwardTranslator()
     : m_windowGroupId(1)  // m_windowGroupId is reserved for uncontrolled
@@ -141,6 +207,14 @@ namespace radiance {
     m_logSink.setThreadId(std::this_thread::get_id());
   }
 
+  unsigned ForwardTranslator::numberOfThreads() const {
+    return m_numberOfThreads;
+  }
+
+  void ForwardTranslator::setNumberOfThreads(unsigned numberOfThreads) {
+    m_numberOfThreads = numberOfThreads;
+  }
+
   std::vector<openstudio::path> ForwardTranslator::translateModel(const openstudio::path& outPath, const openstudio::model::Model& model) {
     m_model = model.clone(true).cast<openstudio::model::Model>();
 
@@ -782,10 +856,6 @@ namespace radiance {
 
     m_radSceneFiles.clear();
 
-    m_radSpaces.clear();
-    m_radSensors.clear();
-    m_radGlareSensors.clear();
-    m_radMaps.clear();
     m_radMapHandles.clear();
     m_radViewPoints.clear();
     m_radWindowGroups.clear();
@@ -990,6 +1060,10 @@ namespace radiance {
                                          std::vector<openstudio::path>& t_outfiles) {
     std::vector<std::string> space_names;
 
+    // geometry, sensors and views are generated for each space in turn (the model cannot be read concurrently), the files are written
+    // at the end
+    FileWriteQueue files;
+
     for (const auto& space : t_spaces) {
       std::string space_name = cleanName(space.name().get());
 
@@ -997,7 +1071,7 @@ namespace radiance {
       LOG(Debug, "Processing space: " << space_name);
 
       // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+      std::string radSpace = "#\n# geometry file for space: " + space_name + "\n#\n\n";
 
       // loop over surfaces in space
 
@@ -1013,11 +1087,11 @@ namespace radiance {
         std::string surface_name = cleanName(surface.name().get());
 
         // add surface to space geometry
-        m_radSpaces[space_name] += "# surface: " + surface_name + "\n";
+        radSpace += "# surface: " + surface_name + "\n";
 
         // set construction of surface
         std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+        radSpace += "# construction: " + constructionName + "\n";
 
         // get reflectances
         double interiorVisibleReflectance = 0.5;  // default for space surfaces
@@ -1039,8 +1113,8 @@ namespace radiance {
             // 2-sided material
 
             // header
-            m_radSpaces[space_name] += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3)
-                                       + "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+            radSpace += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3)
+                        + "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
 
             // material definition
 
@@ -1058,14 +1132,14 @@ namespace radiance {
                                      + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
             // polygon reference
-            m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                       + formatString(exteriorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
-                                       + formatString(polygon.size() * 3) + "\n";
+            radSpace += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
+                        + formatString(exteriorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
+                        + formatString(polygon.size() * 3) + "\n";
           } else {
             // interior-only material
 
             // header
-            m_radSpaces[space_name] += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+            radSpace += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
             // material definition
             m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
@@ -1073,15 +1147,15 @@ namespace radiance {
                                   + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
 
             // polygon reference
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
-                                       + formatString(polygon.size() * 3) + "\n";
+            radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
+                        + formatString(polygon.size() * 3) + "\n";
           };
 
           // add polygon vertices
           for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
+          radSpace += "\n";
         }
         // end(surface)
 
@@ -1327,20 +1401,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                         + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
                                         + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] +=
+                  radSpace +=
                     "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 // make interior sill/reveal surfaces
@@ -1357,20 +1431,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                         + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                         + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] +=
+                  radSpace +=
                     "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 if (insideSillDepth && (*insideSillDepth > 0.0)) {
@@ -1386,20 +1460,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                         + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                         + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] +=
+                  radSpace +=
                     "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
               }
             }
@@ -1440,24 +1514,12 @@ namespace radiance {
                   switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n";
 
                   openstudio::path filename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_clear.mat");
-                  OFSTREAM file(filename);
-                  if (file.is_open()) {
-                    t_outfiles.push_back(filename);
-                    file << switchableGroup_wgMats;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-                  }
+                  files.add(filename, switchableGroup_wgMats);
 
                   switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "_TINTED\n" + matStringTinted + "\n\nvoid alias "
                                            + windowGroup_name + " " + windowGroup_name + "_TINTED " + "\n\n";
                   openstudio::path filename2 = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_tinted.mat");
-                  OFSTREAM file2(filename2);
-                  if (file2.is_open()) {
-                    t_outfiles.push_back(filename2);
-                    file2 << switchableGroup_wgMats;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(filename2) << "' for writing");
-                  }
+                  files.add(filename2, switchableGroup_wgMats);
 
                 } else {
 
@@ -1465,13 +1527,7 @@ namespace radiance {
                   std::string wgMat = "";
                   wgMat = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n\n";
                   openstudio::path wgSingleFilename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + ".mat");
-                  OFSTREAM wgSingleFile(wgSingleFilename);
-                  if (wgSingleFile.is_open()) {
-                    t_outfiles.push_back(wgSingleFilename);
-                    wgSingleFile << wgMat;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
-                  }
+                  files.add(wgSingleFilename, wgMat);
                 }
               }
               // write the polygon
@@ -1537,13 +1593,7 @@ namespace radiance {
                   wgShadeMat = "void " + rMaterial + " " + windowGroup_name + "_SHADE\n" + matString + "\n\n";
                   openstudio::path wgSingleFilename =
                     t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_SHADE.mat");
-                  OFSTREAM wgSingleFile(wgSingleFilename);
-                  if (wgSingleFile.is_open()) {
-                    t_outfiles.push_back(wgSingleFilename);
-                    wgSingleFile << wgShadeMat;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
-                  }
+                  files.add(wgSingleFilename, wgShadeMat);
 
                   // shade BSDF stuff
 
@@ -1629,18 +1679,18 @@ namespace radiance {
             double interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
             double exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
             //polygon header
-            m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-            m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+            radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+            radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
             // write material
             m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                   + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                   + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
             // write polygon
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-            m_radSpaces[space_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
+            radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+            radSpace += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
 
             for (const auto& vertex : polygon) {
-              m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+              radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
             }
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDOME") {
@@ -1665,11 +1715,11 @@ namespace radiance {
           std::string shadingSurface_name = cleanName(shadingSurface.name().get());
 
           // add surface to zone geometry
-          m_radSpaces[space_name] += "# surface: " + shadingSurface_name + "\n";
+          radSpace += "# surface: " + shadingSurface_name + "\n";
 
           // set construction of space shadingSurface
           std::string constructionName = shadingSurface.getString(2).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          radSpace += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.25;  // default for space shading surfaces
@@ -1700,20 +1750,20 @@ namespace radiance {
                                    + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon header
-          m_radSpaces[space_name] += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          radSpace += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
+          radSpace += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                     + formatString(exteriorVisibleReflectance, 3) + " polygon " + shadingSurface_name + "\n0\n0\n"
-                                     + formatString(polygon.size() * 3) + "\n";
+          radSpace += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
+                      + formatString(exteriorVisibleReflectance, 3) + " polygon " + shadingSurface_name + "\n0\n0\n"
+                      + formatString(polygon.size() * 3) + "\n";
 
           for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            radSpace += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
+          radSpace += "\n";
         }
       }  // end shading surfaces
 
@@ -1740,11 +1790,11 @@ namespace radiance {
 
           // add surface to zone geometry
 
-          m_radSpaces[space_name] += "# surface: " + interiorPartitionSurface_name + "\n";
+          radSpace += "# surface: " + interiorPartitionSurface_name + "\n";
 
           // set construction of interiorPartitionSurface
           std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          radSpace += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.5;  // set some default
@@ -1764,15 +1814,15 @@ namespace radiance {
                                 + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                 + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
           // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+          radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+          radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + interiorPartitionSurface_name + "\n0\n0\n"
-                                     + formatString(polygon.size() * 3) + "\n";
+          radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + interiorPartitionSurface_name + "\n0\n0\n"
+                      + formatString(polygon.size() * 3) + "\n";
           for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+            radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
           }
         }
       }  // end interior partitions
@@ -1790,39 +1840,27 @@ namespace radiance {
       std::vector<openstudio::model::DaylightingControl> daylightingControls = space.daylightingControls();
       for (const auto& control : daylightingControls) {
 
-        m_radSensors[space_name] = "";
+        std::string radSensor;
 
         openstudio::Point3d sensor_point = openstudio::radiance::ForwardTranslator::getReferencePoint(control);
         openstudio::Vector3d sensor_aimVector = openstudio::radiance::ForwardTranslator::getSensorVector(control);
-        m_radSensors[space_name] += formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
-                                    + formatString(sensor_point.z(), 3) + " " + formatString(sensor_aimVector.x(), 3) + " "
-                                    + formatString(sensor_aimVector.y(), 3) + " " + formatString(sensor_aimVector.z(), 3) + "\n";
+        radSensor += formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
+                     + formatString(sensor_point.z(), 3) + " " + formatString(sensor_aimVector.x(), 3) + " "
+                     + formatString(sensor_aimVector.y(), 3) + " " + formatString(sensor_aimVector.z(), 3) + "\n";
 
         // write daylighting controls
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".sns");
-        OFSTREAM file(filename);
-        if (file.is_open()) {
-          t_outfiles.push_back(filename);
-          file << m_radSensors[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        files.add(filename, radSensor);
 
         // write daylighting control view file
-        m_radSensorViews[space_name] = "";
-        m_radSensorViews[space_name] += "rvu -vth -vp " + formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
-                                        + formatString(sensor_point.z(), 3) + " -vd " + formatString(sensor_aimVector.x(), 3) + " "
-                                        + formatString(sensor_aimVector.y(), 3) + " " + formatString(sensor_aimVector.z(), 3)
-                                        + " -vu 0 1 0 -vh 180 -vv 180 -vo 0 -vs 0 -vl 0\n";
+        std::string radSensorView;
+        radSensorView += "rvu -vth -vp " + formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
+                         + formatString(sensor_point.z(), 3) + " -vd " + formatString(sensor_aimVector.x(), 3) + " "
+                         + formatString(sensor_aimVector.y(), 3) + " " + formatString(sensor_aimVector.z(), 3)
+                         + " -vu 0 1 0 -vh 180 -vv 180 -vo 0 -vs 0 -vl 0\n";
 
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_dc.vfh");
-        OFSTREAM file2(filename);
-        if (file2.is_open()) {
-          t_outfiles.push_back(filename);
-          file2 << m_radSensorViews[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        files.add(filename, radSensorView);
 
         LOG(Debug, "Wrote " << space_name << "_dc.vfh");
 
@@ -1831,9 +1869,9 @@ namespace radiance {
       // get glare sensors
       std::vector<openstudio::model::GlareSensor> glareSensors = space.glareSensors();
       for (const auto& sensor : glareSensors) {
-        m_radGlareSensors[space_name] = "";
-        m_radGlareSensorViewsVTV[space_name] = "";
-        m_radGlareSensorViewsVTA[space_name] = "";
+        std::string radGlareSensor;
+        std::string radGlareSensorViewVTV;
+        std::string radGlareSensorViewVTA;
 
         std::string sensor_name;
         if (sensor.name()) {
@@ -1849,56 +1887,38 @@ namespace radiance {
         for (const Vector3d& viewVector : viewVectors) {
 
           // glare sensor points
-          m_radGlareSensors[space_name] += formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
-                                           + formatString(sensor_point.z(), 3) + " " + formatString(viewVector.x(), 3) + " "
-                                           + formatString(viewVector.y(), 3) + " " + formatString(viewVector.z(), 3) + "\n";
+          radGlareSensor += formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
+                            + formatString(sensor_point.z(), 3) + " " + formatString(viewVector.x(), 3) + " "
+                            + formatString(viewVector.y(), 3) + " " + formatString(viewVector.z(), 3) + "\n";
 
           // glare sensor views (perspective)
-          m_radGlareSensorViewsVTV[space_name] += "rvu -vtv -vp " + formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
-                                                  + formatString(sensor_point.z(), 3) + " -vd " + formatString(viewVector.x(), 3) + " "
-                                                  + formatString(viewVector.y(), 3) + " " + formatString(viewVector.z(), 3)
-                                                  + " -vu 0 0 1 -vh 90 -vv 60 -vo 0 -vs 0 -vl 0\n";
+          radGlareSensorViewVTV += "rvu -vtv -vp " + formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
+                                   + formatString(sensor_point.z(), 3) + " -vd " + formatString(viewVector.x(), 3) + " "
+                                   + formatString(viewVector.y(), 3) + " " + formatString(viewVector.z(), 3)
+                                   + " -vu 0 0 1 -vh 90 -vv 60 -vo 0 -vs 0 -vl 0\n";
 
           // glare sensor views (fisheye)
-          m_radGlareSensorViewsVTA[space_name] += "rvu -vth -vp " + formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
-                                                  + formatString(sensor_point.z(), 3) + " -vd " + formatString(viewVector.x(), 3) + " "
-                                                  + formatString(viewVector.y(), 3) + " " + formatString(viewVector.z(), 3)
-                                                  + " -vu 0 0 1 -vh 180 -vv 180 -vo 0 -vs 0 -vl 0\n";
+          radGlareSensorViewVTA += "rvu -vth -vp " + formatString(sensor_point.x(), 3) + " " + formatString(sensor_point.y(), 3) + " "
+                                   + formatString(sensor_point.z(), 3) + " -vd " + formatString(viewVector.x(), 3) + " "
+                                   + formatString(viewVector.y(), 3) + " " + formatString(viewVector.z(), 3)
+                                   + " -vu 0 0 1 -vh 180 -vv 180 -vo 0 -vs 0 -vl 0\n";
         }
 
         // write glare sensors
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + "_" + sensor_name + ".glr");
-        OFSTREAM file(filename);
-        if (file.is_open()) {
-          t_outfiles.push_back(filename);
-          file << m_radGlareSensors[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        files.add(filename, radGlareSensor);
 
         LOG(Debug, "Wrote " << space_name << ".glr");
 
         // write glare sensor views (perspective)
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_" + sensor_name + "_gs.vfv");
-        OFSTREAM file2(filename);
-        if (file2.is_open()) {
-          t_outfiles.push_back(filename);
-          file2 << m_radGlareSensorViewsVTV[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        files.add(filename, radGlareSensorViewVTV);
 
         LOG(Debug, "Wrote " << space_name << "_" << sensor_name << "_gs.vfv");
 
         // write glare sensor views (fisheye)
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_" + sensor_name + "_gs.vfh");
-        OFSTREAM file3(filename);
-        if (file3.is_open()) {
-          t_outfiles.push_back(filename);
-          file3 << m_radGlareSensorViewsVTA[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        files.add(filename, radGlareSensorViewVTA);
 
         LOG(Debug, "Wrote " << space_name << "_" << sensor_name << "_gs.vfh");
 
@@ -1907,181 +1927,105 @@ namespace radiance {
       // get illuminance map points, write to file
       std::vector<openstudio::model::IlluminanceMap> illuminanceMaps = space.illuminanceMaps();
       for (const auto& map : illuminanceMaps) {
-        m_radMaps[space_name] = "";
+        std::string radMap;
         m_radMapHandles[space_name] = map.handle();
 
         // write map file
-        openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".map");
-        OFSTREAM file(filename);
-        if (file.is_open()) {
-          t_outfiles.push_back(filename);
-
-          std::vector<Point3d> referencePoints = openstudio::radiance::ForwardTranslator::getReferencePoints(map);
-          for (const auto& point : referencePoints) {
-            m_radMaps[space_name] +=
-              "" + formatString(point.x(), 3) + " " + formatString(point.y(), 3) + " " + formatString(point.z(), 3) + " 0.000 0.000 1.000\n";
-          }
-          file << m_radMaps[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
+        std::vector<Point3d> referencePoints = openstudio::radiance::ForwardTranslator::getReferencePoints(map);
+        for (const auto& point : referencePoints) {
+          radMap += "" + formatString(point.x(), 3) + " " + formatString(point.y(), 3) + " " + formatString(point.z(), 3) + " 0.000 0.000 1.000\n";
         }
+        openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".map");
+        files.add(filename, radMap);
 
         LOG(Debug, "wrote " << space_name << ".map");
       }  //end illuminance map
 
       // write geometry
       openstudio::path filename = t_radDir / openstudio::toPath("scene") / openstudio::toPath(space_name + ".rad");
-      OFSTREAM file(filename);
-      if (file.is_open()) {
-        t_outfiles.push_back(filename);
-        m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
-      } else {
-        LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-      }
-
-      for (const auto& windowGroup : m_windowGroups) {
-        std::string windowGroup_name = windowGroup.name();
-
-        //write windows (and glazed doors)
-        if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end()) {
-
-          // get the Radiance parameters... so we have them.
-          auto radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
-          if (windowGroup_name != "WG0") {
-            if (radianceParameters.skyDiscretizationResolution() == "146") {
-              LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
-            } else if (radianceParameters.skyDiscretizationResolution() == "578") {
-              LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-            } else if (radianceParameters.skyDiscretizationResolution() == "2306") {
-              LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-            }
-          }
-
-          openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
-          OFSTREAM glazefile(glazefilename);
-          if (glazefile.is_open()) {
-            t_outfiles.push_back(glazefilename);
-            m_radSceneFiles.push_back(glazefilename);
-            glazefile << m_radWindowGroups[windowGroup_name];
-          } else {
-            LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
-          }
-
-          if (windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()) {
-            openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
-            OFSTREAM shadefile(shadefilename);
-            if (shadefile.is_open()) {
-              t_outfiles.push_back(shadefilename);
-              m_radSceneFiles.push_back(shadefilename);
-              shadefile << m_radWindowGroupShades[windowGroup_name];
-            } else {
-              LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
-            }
-          }
-
-          // write window group control points
-          // only write for controlled window groups
-          if (windowGroup_name != "WG0") {
-            openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
-            OFSTREAM file(filename);
-            if (file.is_open()) {
-              t_outfiles.push_back(filename);
-              file << windowGroup.windowGroupPoints();
-            } else {
-              LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-            }
+      files.add(filename, radSpace);
+      m_radSceneFiles.push_back(filename);
+
+    }  // end spaces
+
+    for (const auto& windowGroup : m_windowGroups) {
+      std::string windowGroup_name = windowGroup.name();
+
+      //write windows (and glazed doors)
+      if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end()) {
+
+        // get the Radiance parameters... so we have them.
+        auto radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
+        if (windowGroup_name != "WG0") {
+          if (radianceParameters.skyDiscretizationResolution() == "146") {
+            LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
+          } else if (radianceParameters.skyDiscretizationResolution() == "578") {
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
+          } else if (radianceParameters.skyDiscretizationResolution() == "2306") {
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
           }
         }
-      }
-
-      // write radiance materials file
-      m_radMaterials.insert("# OpenStudio Materials File\n\n");
-      openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
-      OFSTREAM materialsfile(materialsfilename);
-      if (materialsfile.is_open()) {
-        t_outfiles.push_back(materialsfilename);
-        for (const auto& line : m_radMaterials) {
-          materialsfile << line;
-        };
-        for (const auto& line : m_radMixMaterials) {
-          materialsfile << line;
-        };
-      } else {
-        LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
-      }
 
-      // write radiance DC vmx materials (lights) file
-      m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic "
-                              "WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
-      OFSTREAM materials_vmxfile(materials_vmxfilename);
-      if (materials_vmxfile.is_open()) {
-        t_outfiles.push_back(materials_vmxfilename);
-        for (const auto& line : m_radMaterialsDC) {
-          materials_vmxfile << line;
-        };
-      } else {
-        LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
-      }
+        openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
+        files.add(glazefilename, m_radWindowGroups[windowGroup_name]);
+        m_radSceneFiles.push_back(glazefilename);
 
-      // write radiance WG0 vmx materials file (blacks out controlled window groups)
-      m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
-      openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
-      OFSTREAM materials_WG0file(materials_WG0filename);
-      if (materials_WG0file.is_open()) {
-        t_outfiles.push_back(materials_WG0filename);
-        for (const auto& line : m_radMaterialsWG0) {
-          materials_WG0file << line;
-        };
-      } else {
-        LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
-      }
-
-      // write radiance blackout materials file (blacks out everything)
-      m_radMaterialsSwitchableBase.insert(
-        "# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
-      OFSTREAM materials_SwitchableBasefile(materials_SwitchableBasefilename);
-      if (materials_SwitchableBasefile.is_open()) {
-        t_outfiles.push_back(materials_SwitchableBasefilename);
-        for (const auto& line : m_radMaterialsSwitchableBase) {
-          materials_SwitchableBasefile << line;
-        };
-      } else {
-        LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
-      }
+        if (windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()) {
+          openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
+          files.add(shadefilename, m_radWindowGroupShades[windowGroup_name]);
+          m_radSceneFiles.push_back(shadefilename);
+        }
 
-      // write radiance vmx materials list
-      // format of this file is: window group, bsdf, bsdf
-      m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control "
-                         "setpoint,unshaded bsdf,shaded bsdf\n");
-      openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
-      OFSTREAM materials_dcfile(materials_dcfilename);
-      if (materials_dcfile.is_open()) {
-        t_outfiles.push_back(materials_dcfilename);
-        for (const auto& line : m_radDCmats) {
-          materials_dcfile << line;
-        };
-      } else {
-        LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
+        // write window group control points
+        // only write for controlled window groups
+        if (windowGroup_name != "WG0") {
+          openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
+          files.add(filename, windowGroup.windowGroupPoints());
+        }
       }
+    }
 
-      // write complete scene
-      openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
-      OFSTREAM modelfile(modelfilename);
-
-      if (modelfile.is_open()) {
-        t_outfiles.push_back(modelfilename);
-
-        std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
+    // write radiance materials file
+    m_radMaterials.insert("# OpenStudio Materials File\n\n");
+    openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
+    files.add(materialsfilename, joinLines(m_radMaterials) + joinLines(m_radMixMaterials));
+
+    // write radiance DC vmx materials (lights) file
+    m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic "
+                            "WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
+    files.add(materials_vmxfilename, joinLines(m_radMaterialsDC));
+
+    // write radiance WG0 vmx materials file (blacks out controlled window groups)
+    m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
+    openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
+    files.add(materials_WG0filename, joinLines(m_radMaterialsWG0));
+
+    // write radiance blackout materials file (blacks out everything)
+    m_radMaterialsSwitchableBase.insert(
+      "# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
+    files.add(materials_SwitchableBasefilename, joinLines(m_radMaterialsSwitchableBase));
+
+    // write radiance vmx materials list
+    // format of this file is: window group, bsdf, bsdf
+    m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control "
+                       "setpoint,unshaded bsdf,shaded bsdf\n");
+    openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
+    files.add(materials_dcfilename, joinLines(m_radDCmats));
+
+    // write complete scene
+    openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
+    std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
+    std::string modelScene;
+    for (const auto& filename : uniquePaths) {
+      modelScene += "!xform ./" + openstudio::toString(openstudio::relativePath(filename, t_radDir)) + '\n';
+    }
+    files.add(modelfilename, modelScene);
 
-        for (const auto& filename : uniquePaths) {
-          modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << '\n';
-        }
-      } else {
-        LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
-      }
+    // write all the files, there are several per space so this is done in parallel
+    for (const auto& path : files.write(m_numberOfThreads, t_outfiles)) {
+      LOG(Error, "Cannot open file '" << toString(path) << "' for writing");
     }
   }
 
@@ -51,6 +51,12 @@ namespace radiance {
      */
     std::vector<LogMessage> errors() const;
 
+    /** The geometry, sensors and views of each Space are generated in turn into per Space buffers, then all the files are written using
+     *  up to numberOfThreads threads (0, the default, means one per hardware thread). The output does not depend on the number of
+     *  threads. */
+    unsigned numberOfThreads() const;
+    void setNumberOfThreads(unsigned numberOfThreads);
+
     // for now just implement some functionality and let the Ruby script
     // be the main driver
 
@@ -118,14 +124,7 @@ namespace radiance {
     // scene files
     std::vector<openstudio::path> m_radSceneFiles;
 
-    // create space geometry, hashes of space name to file contents
-    std::map<std::string, std::string> m_radSpaces;
-    std::map<std::string, std::string> m_radSensors;
-    std::map<std::string, std::string> m_radSensorViews;
-    std::map<std::string, std::string> m_radGlareSensors;
-    std::map<std::string, std::string> m_radGlareSensorViewsVTA;
-    std::map<std::string, std::string> m_radGlareSensorViewsVTV;
-    std::map<std::string, std::string> m_radMaps;
+    // hashes of space or window group name to map handle or file contents, the files of each space are generated in buildingSpaces
     std::map<std::string, openstudio::Handle> m_radMapHandles;
     std::map<std::string, std::string> m_radViewPoints;
     std::map<std::string, std::string> m_radWindowGroups;
@@ -133,6 +132,8 @@ namespace radiance {
     int m_windowGroupId;
     std::string shadeBSDF;
 
+    unsigned m_numberOfThreads = 0;
+
     // get window group
     WindowGroup getWindowGroup(const openstudio::Vector3d& outwardNormal, const model::Space& space, const model::ConstructionBase& construction,
                                const boost::optional<model::ShadingControl>& shadingControl, const openstudio::Point3dVector& polygon);
@@ -13,6 +13,7 @@ using namespace std;
 using namespace boost;
 using namespace openstudio::radiance;
 using openstudio::toPath;
+using openstudio::operator==;
 
 ///////////////////////////////////////////////////////////////////////////////
 // *** BEGIN FIXTURE ***
@@ -49,3 +50,61 @@ AnnualIlluminanceMap RadAnnualIlluminanceMapFixture::outFile;
 ///////////////////////////////////////////////////////////////////////////////
 
 TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap) {}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Synthetic) {
+  // 3 x 2 grid, 3 timesteps, illuminance in footcandles
+  openstudio::path path = openstudio::tempDir() / toPath("AnnualIlluminanceMap_Synthetic.ill");
+  {
+    openstudio::filesystem::ofstream file(path);
+    file << "0 0 0 2 0 0 0 1 0\n";
+    file << "1 1 0\n";
+    file << "1 1 12.0 0 30 1000 5 20 300 20 20 5\n";
+    file << "1 1 13.0 0 30 1000 20 20 20 300 300 300\n";
+    file << "6 21 9.5 0 60 2000 5\t5\t5\t5\t5\t5\n";
+  }
+
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(3u, map.xVector().size());
+  ASSERT_EQ(2u, map.yVector().size());
+  ASSERT_EQ(3u, map.dateTimes().size());
+
+  openstudio::DateTime dateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 13));
+  EXPECT_EQ(dateTime, map.dateTimes()[1]);
+  openstudio::Matrix illuminance = map.illuminanceMap(dateTime);
+  ASSERT_EQ(3u, illuminance.size1());
+  ASSERT_EQ(2u, illuminance.size2());
+  EXPECT_NEAR(20 * 10.76, illuminance(2, 0), 0.001);
+  EXPECT_NEAR(300 * 10.76, illuminance(0, 1), 0.001);
+  EXPECT_EQ(0u, map.illuminanceMap(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Feb, 1), openstudio::Time(0, 13))).size1());
+
+  // 200 lux is reached by 20 fc and 300 fc, useful daylight is between 100 and 2000 lux i.e. only 20 fc
+  openstudio::Matrix da = map.daylightAutonomy(200.0);
+  ASSERT_EQ(3u, da.size1());
+  ASSERT_EQ(2u, da.size2());
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, da(0, 0));
+  EXPECT_DOUBLE_EQ(2.0 / 3.0, da(1, 0));
+  EXPECT_DOUBLE_EQ(2.0 / 3.0, da(2, 0));
+  EXPECT_DOUBLE_EQ(2.0 / 3.0, da(0, 1));
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, da(2, 1));
+  openstudio::Matrix udi = map.usefulDaylightIlluminance();
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, udi(0, 0));
+  EXPECT_DOUBLE_EQ(2.0 / 3.0, udi(1, 0));
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, udi(0, 1));
+  EXPECT_DOUBLE_EQ(0.0, udi(2, 1));
+
+  // The sidecar gives the same results, reading the values from disk
+  openstudio::path sidecarPath = openstudio::tempDir() / toPath("AnnualIlluminanceMap_Synthetic.bin");
+  ASSERT_TRUE(map.saveSidecar(sidecarPath));
+  AnnualIlluminanceMap sidecar = AnnualIlluminanceMap::loadSidecar(sidecarPath);
+  EXPECT_EQ(map.dateTimes(), sidecar.dateTimes());
+  EXPECT_TRUE(map.xVector() == sidecar.xVector());
+  EXPECT_TRUE(map.yVector() == sidecar.yVector());
+  for (const auto& t : map.dateTimes()) {
+    EXPECT_TRUE(map.illuminanceMap(t) == sidecar.illuminanceMap(t));
+  }
+  EXPECT_TRUE(da == sidecar.daylightAutonomy(200.0));
+  EXPECT_TRUE(udi == sidecar.usefulDaylightIlluminance());
+
+  // Not a sidecar
+  EXPECT_TRUE(AnnualIlluminanceMap::loadSidecar(path).dateTimes().empty());
+}
@@ -29,6 +29,7 @@
 #include "../../utilities/geometry/Point3d.hpp"
 #include "../../utilities/geometry/Geometry.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
@@ -231,6 +232,51 @@ TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl) {
   EXPECT_TRUE(ft.warnings().empty()) << printLogMessages(ft.warnings());
 }
 
+TEST(Radiance, ForwardTranslator_NumberOfThreads) {
+  Model model = exampleModel();
+  Construction shadedConstruction(model);
+
+  model::ShadingControl shadingControl(shadedConstruction);
+  for (auto& subSurface : model.getConcreteModelObjects<model::SubSurface>()) {
+    if (istringEqual(subSurface.subSurfaceType(), "FixedWindow") || istringEqual(subSurface.subSurfaceType(), "OperableWindow")) {
+      subSurface.addShadingControl(shadingControl);
+    }
+  }
+
+  auto readFile = [](const openstudio::path& p) {
+    openstudio::filesystem::ifstream file(p);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+  };
+
+  // Translate serially, then with several threads writing the files: the output must be the same
+  openstudio::path serialOutpath = toPath("./ForwardTranslator_NumberOfThreads_1");
+  openstudio::path parallelOutpath = toPath("./ForwardTranslator_NumberOfThreads_4");
+  openstudio::filesystem::remove_all(serialOutpath);
+  openstudio::filesystem::remove_all(parallelOutpath);
+
+  ForwardTranslator ft;
+  EXPECT_EQ(0u, ft.numberOfThreads());
+
+  ft.setNumberOfThreads(1);
+  EXPECT_EQ(1u, ft.numberOfThreads());
+  std::vector<path> serialOutpaths = ft.translateModel(serialOutpath, model);
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+
+  ft.setNumberOfThreads(4);
+  EXPECT_EQ(4u, ft.numberOfThreads());
+  std::vector<path> parallelOutpaths = ft.translateModel(parallelOutpath, model);
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+
+  ASSERT_FALSE(serialOutpaths.empty());
+  ASSERT_EQ(serialOutpaths.size(), parallelOutpaths.size()) << printPaths(serialOutpaths) << printPaths(parallelOutpaths);
+  for (size_t i = 0; i < serialOutpaths.size(); ++i) {
+    EXPECT_EQ(relativePath(serialOutpaths[i], serialOutpath), relativePath(parallelOutpaths[i], parallelOutpath));
+    EXPECT_EQ(readFile(serialOutpaths[i]), readFile(parallelOutpaths[i])) << toString(serialOutpaths[i]);
+  }
+}
+
 TEST(Radiance, ForwardTranslator_ExampleModel_NoIllumMaps) {
   Model model = exampleModel();
 
@@ -9,11 +9,16 @@
 #include "../time/DateTime.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/FilesystemHelpers.hpp"
+#include "../core/Checksum.hpp"
 
 #include <sqlite3.h>
 
+#include <boost/algorithm/string/case_conv.hpp>
 #include <boost/algorithm/string/replace.hpp>
 
+#include <algorithm>
+#include <sstream>
+
 namespace openstudio {
 
 LocalBCL::LocalBCL(const path& libraryPath)
@@ -33,7 +38,7 @@ LocalBCL::LocalBCL(const path& libraryPath)
   bool initschema = !openstudio::filesystem::exists(m_sqliteFilePath);
 
   // Open the database
-  int success = sqlite3_open_v2(m_sqliteFilename.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+  int success = sqlite3_open_v2(m_sqliteFilename.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr);
   if (success != SQLITE_OK) {
     LOG_AND_THROW("Unable to open connection for LocalBCL at '" << m_sqliteFilename << "'.");
   } else {
@@ -631,145 +636,96 @@ bool LocalBCL::updateLocalDb() {
   return false;
 }
 
-/// Inherited members
-
-boost::optional<BCLComponent> LocalBCL::getComponent(const std::string& uid, const std::string& versionId) const {
-  boost::optional<BCLComponent> result;
-
-  if (m_db) {
+/// In-memory index
 
-    if (versionId.empty()) {
+namespace {
 
-      std::string statement = "SELECT version_id FROM Components WHERE uid='" + escape(uid) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-        LOG(Error, "Unable to prepare version_id Statement");
-        sqlite3_finalize(sqlStmtPtr);  // No-op
-        return boost::none;
-      }
-
-      if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        result = boost::optional<BCLComponent>(m_libraryPath / uid / version_id);
-      }
-      // Finalize statement to prevent memory leak
-      sqlite3_finalize(sqlStmtPtr);
-    } else {
-      std::string statement = "SELECT version_id FROM Components WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-        LOG(Error, "Unable to prepare version_id Statement from uid and versionId.");
-        sqlite3_finalize(sqlStmtPtr);  // No-op
-        return boost::none;
-      }
-
-      if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        result = boost::optional<BCLComponent>(m_libraryPath / uid / version_id);
-      }
-      // Finalize statement to prevent memory leak
-      sqlite3_finalize(sqlStmtPtr);
+  std::vector<std::string> searchWords(const std::string& searchTerm) {
+    std::vector<std::string> words;
+    std::istringstream ss(boost::algorithm::to_lower_copy(searchTerm));
+    std::string word;
+    while (ss >> word) {
+      words.push_back(word);
     }
+    return words;
   }
 
-  return result;
-}
-
-boost::optional<BCLMeasure> LocalBCL::getMeasure(const std::string& uid, const std::string& versionId) const {
-  boost::optional<BCLMeasure> result;
-
-  if (m_db) {
-
-    if (versionId.empty()) {
-
-      std::string statement = "SELECT version_id FROM Measures WHERE uid='" + escape(uid) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-      if (code != SQLITE_OK) {
-        LOG(Error, "Unable to prepare version_id Statement: " << statement);
-        sqlite3_finalize(sqlStmtPtr);  // No-op
-        return boost::none;
-      }
+  // All words must be found in searchText, an empty search matches everything
+  bool matchesSearchWords(const std::string& searchText, const std::vector<std::string>& words) {
+    return std::all_of(words.cbegin(), words.cend(), [&searchText](const std::string& word) { return searchText.find(word) != std::string::npos; });
+  }
 
-      // We seek the most recent modified one in case we find several, so store that
-      boost::optional<DateTime> mostRecentModified;
+  std::string xmlChecksum(const openstudio::path& xmlPath) {
+    if (!openstudio::filesystem::is_regular_file(xmlPath)) {
+      return {};
+    }
+    return checksum(xmlPath);
+  }
 
-      // Loop until done (or failed)
-      while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-      {
-        code = sqlite3_step(sqlStmtPtr);
-        if (code == SQLITE_ROW) {
-          // Get values from SELECT
-          std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-
-          try {
-            BCLMeasure measure(m_libraryPath / uid / version_id);
-
-            boost::optional<DateTime> versionModified = measure.versionModified();
-            if (mostRecentModified) {
-              if (versionModified && versionModified.get() > mostRecentModified.get()) {
-                mostRecentModified = versionModified;
-                result = measure;
-              }
-            } else {
-              mostRecentModified = versionModified;
-              result = measure;
-            }
-          } catch (const std::exception& e) {
-            LOG(Error, "Cannot find BCL measure at '" << m_libraryPath / uid / version_id << "': " << e.what());
-          }
+}  // namespace
 
-        } else  // i didn't get a row.  something is wrong so set the exit condition.
-        {       // should never get here since i test for all documented return states above
-          code = SQLITE_DONE;
-        }
-      }  // End loop on each match
+std::pair<std::string, std::string> LocalBCL::attributeValueAndType(const Attribute& attribute) {
+  if (attribute.valueType().value() == AttributeValueType::Boolean) {
+    return {boost::lexical_cast<std::string>(attribute.valueAsBoolean()), "boolean"};
+  } else if (attribute.valueType().value() == AttributeValueType::Integer) {
+    return {boost::lexical_cast<std::string>(attribute.valueAsInteger()), "int"};
+  } else if (attribute.valueType().value() == AttributeValueType::Double) {
+    return {formatString(attribute.valueAsDouble()), "float"};
+  }
+  return {attribute.valueAsString(), "string"};
+}
 
-      // Finalize statement whether it suceeded or not
-      sqlite3_finalize(sqlStmtPtr);
+LocalBCL::IndexEntry<BCLComponent> LocalBCL::indexComponent(const std::string& uid, const std::string& versionId) const {
+  IndexEntry<BCLComponent> entry;
+  openstudio::path dir = m_libraryPath / uid / versionId;
+  entry.xmlChecksum = xmlChecksum(dir / toPath("component.xml"));
 
-    } else {
+  entry.item = BCLComponent(dir);
+  entry.searchText = boost::algorithm::to_lower_copy(entry.item->name() + "\n" + entry.item->description());
+  for (const Attribute& attribute : entry.item->attributes()) {
+    entry.attributes.emplace_back(boost::algorithm::to_lower_copy(attribute.name()),
+                                  boost::algorithm::to_lower_copy(attributeValueAndType(attribute).first));
+  }
+  return entry;
+}
 
-      std::string statement = "SELECT version_id FROM Measures WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-        sqlite3_finalize(sqlStmtPtr);  // No-op
-        LOG(Error, "Unable to prepare version_id Statement");
-      }
+LocalBCL::IndexEntry<BCLMeasure> LocalBCL::indexMeasure(const std::string& uid, const std::string& versionId) const {
+  IndexEntry<BCLMeasure> entry;
+  openstudio::path dir = m_libraryPath / uid / versionId;
+  entry.xmlChecksum = xmlChecksum(dir / toPath("measure.xml"));
 
-      if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        try {
-          result = boost::optional<BCLMeasure>(m_libraryPath / uid / version_id);
-        } catch (const std::exception& e) {
-          LOG(Error, "Cannot find BCL measure at '" << m_libraryPath / uid / version_id << "': " << e.what());
-        }
-      }
-      // Finalize statement to prevent memory leak
-      sqlite3_finalize(sqlStmtPtr);
-    }
+  try {
+    entry.item = BCLMeasure(dir);
+  } catch (const std::exception& e) {
+    LOG(Error, "Cannot find BCL measure at '" << dir << "': " << e.what());
+    return entry;
   }
-
-  return result;
+  entry.searchText = boost::algorithm::to_lower_copy(entry.item->name() + "\n" + entry.item->displayName() + "\n" + entry.item->description() + "\n"
+                                                     + entry.item->modelerDescription());
+  for (const Attribute& attribute : entry.item->attributes()) {
+    entry.attributes.emplace_back(boost::algorithm::to_lower_copy(attribute.name()),
+                                  boost::algorithm::to_lower_copy(attributeValueAndType(attribute).first));
+  }
+  return entry;
 }
 
-std::vector<BCLComponent> LocalBCL::components() const {
-  std::vector<BCLComponent> allComponents;
+void LocalBCL::loadIndex() const {
+  m_componentIndex.clear();
+  m_measureIndex.clear();
+  m_indexLoaded = true;
 
-  if (m_db) {
-    std::string statement = "SELECT uid, version_id FROM Components";
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare components Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return allComponents;
-    }
+  if (!m_db) {
+    return;
+  }
 
+  for (const std::string tableName : {"Components", "Measures"}) {
+    std::string statement = "SELECT uid, version_id FROM " + tableName;
+    sqlite3_stmt* sqlStmtPtr;
     int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
     if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare components Statement: " << statement);
+      LOG(Error, "Unable to prepare index Statement: " << statement);
       sqlite3_finalize(sqlStmtPtr);  // No-op
-      return allComponents;
+      continue;
     }
 
     // Loop until done (or failed)
@@ -781,11 +737,11 @@ std::vector<BCLComponent> LocalBCL::components() const {
         std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
         std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
 
-        boost::optional<BCLComponent> current(m_libraryPath / uid / version_id);
-        if (current) {
-          allComponents.push_back(current.get());
+        if (tableName == "Components") {
+          m_componentIndex[{uid, version_id}] = indexComponent(uid, version_id);
+        } else {
+          m_measureIndex[{uid, version_id}] = indexMeasure(uid, version_id);
         }
-
       } else  // i didn't get a row.  something is wrong so set the exit condition.
       {       // should never get here since i test for all documented return states above
         code = SQLITE_DONE;
@@ -795,138 +751,141 @@ std::vector<BCLComponent> LocalBCL::components() const {
     // Finalize statement to prevent memory leak
     sqlite3_finalize(sqlStmtPtr);
   }
-  return allComponents;
 }
 
-std::vector<BCLMeasure> LocalBCL::measures() const {
-  std::vector<BCLMeasure> allMeasures;
+std::shared_lock<std::shared_mutex> LocalBCL::readIndex() const {
+  {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if (m_indexLoaded) {
+      return lock;
+    }
+  }
+  {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_indexLoaded) {
+      loadIndex();
+    }
+  }
+  return std::shared_lock<std::shared_mutex>(m_mutex);
+}
 
-  if (m_db) {
-    std::string statement = "SELECT uid, version_id FROM Measures";
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare measures Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return allMeasures;
+size_t LocalBCL::refreshIndex() {
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  if (!m_indexLoaded) {
+    loadIndex();
+    return m_componentIndex.size() + m_measureIndex.size();
+  }
+
+  size_t result = 0;
+  for (auto& [key, entry] : m_componentIndex) {
+    if (xmlChecksum(m_libraryPath / key.first / key.second / toPath("component.xml")) != entry.xmlChecksum) {
+      entry = indexComponent(key.first, key.second);
+      ++result;
     }
+  }
+  for (auto& [key, entry] : m_measureIndex) {
+    if (xmlChecksum(m_libraryPath / key.first / key.second / toPath("measure.xml")) != entry.xmlChecksum) {
+      entry = indexMeasure(key.first, key.second);
+      ++result;
+    }
+  }
+  return result;
+}
 
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare measures Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return allMeasures;
+/// Inherited members
+
+boost::optional<BCLComponent> LocalBCL::getComponent(const std::string& uid, const std::string& versionId) const {
+  auto lock = readIndex();
+
+  if (versionId.empty()) {
+    auto it = m_componentIndex.lower_bound({uid, ""});
+    if (it != m_componentIndex.end() && it->first.first == uid) {
+      return it->second.item;
     }
+    return boost::none;
+  }
 
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
+  auto it = m_componentIndex.find({uid, versionId});
+  if (it != m_componentIndex.end()) {
+    return it->second.item;
+  }
+  return boost::none;
+}
 
-        boost::optional<BCLMeasure> current = BCLMeasure::load(m_libraryPath / uid / version_id);
-        if (current) {
-          allMeasures.push_back(current.get());
-        }
+boost::optional<BCLMeasure> LocalBCL::getMeasure(const std::string& uid, const std::string& versionId) const {
+  auto lock = readIndex();
 
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
+  if (versionId.empty()) {
+    boost::optional<BCLMeasure> result;
 
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
+    // We seek the most recent modified one in case we find several
+    boost::optional<DateTime> mostRecentModified;
+    for (auto it = m_measureIndex.lower_bound({uid, ""}); it != m_measureIndex.end() && it->first.first == uid; ++it) {
+      if (!it->second.item) {
+        continue;
+      }
+      boost::optional<DateTime> versionModified = it->second.item->versionModified();
+      if (!mostRecentModified || (versionModified && versionModified.get() > mostRecentModified.get())) {
+        mostRecentModified = versionModified;
+        result = it->second.item;
+      }
+    }
+    return result;
   }
 
-  return allMeasures;
+  auto it = m_measureIndex.find({uid, versionId});
+  if (it != m_measureIndex.end()) {
+    return it->second.item;
+  }
+  return boost::none;
 }
 
-std::vector<std::string> LocalBCL::measureUids() const {
-  std::vector<std::string> uids;
+std::vector<BCLComponent> LocalBCL::components() const {
+  auto lock = readIndex();
 
-  if (m_db) {
-    std::string statement = "SELECT DISTINCT uid FROM Measures";
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare measureUids Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return uids;
+  std::vector<BCLComponent> allComponents;
+  for (const auto& [key, entry] : m_componentIndex) {
+    if (entry.item) {
+      allComponents.push_back(entry.item.get());
     }
+  }
+  return allComponents;
+}
 
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare measureUids Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return uids;
+std::vector<BCLMeasure> LocalBCL::measures() const {
+  auto lock = readIndex();
+
+  std::vector<BCLMeasure> allMeasures;
+  for (const auto& [key, entry] : m_measureIndex) {
+    if (entry.item) {
+      allMeasures.push_back(entry.item.get());
     }
+  }
+  return allMeasures;
+}
 
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        uids.push_back(columnText(sqlite3_column_text(sqlStmtPtr, 0)));
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
+std::vector<std::string> LocalBCL::measureUids() const {
+  auto lock = readIndex();
 
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
+  std::vector<std::string> uids;
+  for (const auto& [key, entry] : m_measureIndex) {
+    if (uids.empty() || uids.back() != key.first) {
+      uids.push_back(key.first);
+    }
   }
-
   return uids;
 }
 
 std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const std::string& /*componentType*/) const {
-  std::vector<BCLComponent> results;
+  const std::vector<std::string> words = searchWords(searchTerm);
+  auto lock = readIndex();
 
-  if (m_db) {
-    std::string statement("SELECT uid, version_id FROM Components where name"
-                          "  LIKE \"%"
-                          + searchTerm + "%\" OR description LIKE \"%" + searchTerm + "%\"");
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchComponents Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
-    }
-
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchComponents Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
+  std::vector<BCLComponent> results;
+  for (const auto& [key, entry] : m_componentIndex) {
+    if (entry.item && matchesSearchWords(entry.searchText, words)) {
+      results.push_back(entry.item.get());
     }
-
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-        boost::optional<BCLComponent> current(m_libraryPath / uid / version_id);
-        if (current) {
-          results.push_back(current.get());
-        }
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
-
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
   }
-
   return results;
 }
 
@@ -935,51 +894,15 @@ std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTe
 }
 
 std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const std::string& /*componentType*/) const {
+  const std::vector<std::string> words = searchWords(searchTerm);
+  auto lock = readIndex();
 
   std::vector<BCLMeasure> results;
-
-  if (m_db) {
-    std::string statement("SELECT uid, version_id FROM Measures where name LIKE \"%" + searchTerm
-                          + "%\""
-                            "  OR description LIKE \"%"
-                          + searchTerm + "%\" OR modeler_description LIKE \"%" + searchTerm + "%\"");
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchMeasures Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
+  for (const auto& [key, entry] : m_measureIndex) {
+    if (entry.item && matchesSearchWords(entry.searchText, words)) {
+      results.push_back(entry.item.get());
     }
-
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchMeasures Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
-    }
-
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-        boost::optional<BCLMeasure> current = BCLMeasure::load(m_libraryPath / uid / version_id);
-        if (current) {
-          results.push_back(current.get());
-        }
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
-
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
   }
-
   return results;
 }
 
@@ -994,6 +917,8 @@ bool LocalBCL::addComponent(BCLComponent& component) {
   //Check for uid
   if ((m_db != nullptr) && !component.uid().empty() && !component.versionId().empty()) {
 
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
     // Start a transaction, so we can handle failures without messing up the database
     if (!beginTransaction()) {
       return false;
@@ -1063,21 +988,7 @@ bool LocalBCL::addComponent(BCLComponent& component) {
     }
 
     for (const Attribute& attribute : component.attributes()) {
-      std::string dataValue;
-      std::string dataType;
-      if (attribute.valueType().value() == AttributeValueType::Boolean) {
-        dataValue = boost::lexical_cast<std::string>(attribute.valueAsBoolean());
-        dataType = "boolean";
-      } else if (attribute.valueType().value() == AttributeValueType::Integer) {
-        dataValue = boost::lexical_cast<std::string>(attribute.valueAsInteger());
-        dataType = "int";
-      } else if (attribute.valueType().value() == AttributeValueType::Double) {
-        dataValue = formatString(attribute.valueAsDouble());
-        dataType = "float";
-      } else {
-        dataValue = attribute.valueAsString();
-        dataType = "string";
-      }
+      const auto [dataValue, dataType] = attributeValueAndType(attribute);
 
       std::stringstream ss;
       ss << "INSERT INTO Attributes (uid, version_id, name, value, units, type) " << "VALUES('" << escape(uid) << "', '" << escape(versionId)
@@ -1095,7 +1006,14 @@ bool LocalBCL::addComponent(BCLComponent& component) {
     }  // End insert each attribute
 
     // Commit changes now that everything went well
-    return commitTransaction();
+    if (!commitTransaction()) {
+      return false;
+    }
+
+    if (m_indexLoaded) {
+      m_componentIndex[{uid, versionId}] = indexComponent(uid, versionId);
+    }
+    return true;
 
   }  // End check uid
 
@@ -1109,6 +1027,8 @@ bool LocalBCL::removeComponent(BCLComponent& component) {
     return false;
   }
 
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+
   // Start by deleting stuff from the SQL file
   // We don't expect any of these to fail really, if it isn't present, then it still returns OK
   // But let's be prudent and still start a transaction
@@ -1140,6 +1060,7 @@ bool LocalBCL::removeComponent(BCLComponent& component) {
     LOG(Error, "Transaction commit failed, will not remove Component from disk.");
     return false;
   }
+  m_componentIndex.erase({uid, versionId});
 
   // proceed deleting component on disk
   openstudio::path pathToRemove = m_libraryPath / uid / versionId;
@@ -1182,6 +1103,8 @@ bool LocalBCL::addMeasure(BCLMeasure& measure) {
     return false;
   }
 
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+
   // Start a transaction, so we can handle failures without messing up the database
   if (!beginTransaction()) {
     return false;
@@ -1249,21 +1172,7 @@ bool LocalBCL::addMeasure(BCLMeasure& measure) {
   }
 
   for (const Attribute& attribute : measure.attributes()) {
-    std::string dataValue;
-    std::string dataType;
-    if (attribute.valueType().value() == AttributeValueType::Boolean) {
-      dataValue = boost::lexical_cast<std::string>(attribute.valueAsBoolean());
-      dataType = "boolean";
-    } else if (attribute.valueType().value() == AttributeValueType::Integer) {
-      dataValue = boost::lexical_cast<std::string>(attribute.valueAsInteger());
-      dataType = "int";
-    } else if (attribute.valueType().value() == AttributeValueType::Double) {
-      dataValue = formatString(attribute.valueAsDouble());
-      dataType = "float";
-    } else {
-      dataValue = attribute.valueAsString();
-      dataType = "string";
-    }
+    const auto [dataValue, dataType] = attributeValueAndType(attribute);
 
     std::stringstream ss;
     ss << "INSERT INTO Attributes (uid, version_id, name, value, units, type) " << "VALUES('" << escape(uid) << "', '" << escape(versionId) << "', '"
@@ -1281,7 +1190,14 @@ bool LocalBCL::addMeasure(BCLMeasure& measure) {
   }  // End insert each attribute
 
   // Commit changes now that everything went well
-  return commitTransaction();
+  if (!commitTransaction()) {
+    return false;
+  }
+
+  if (m_indexLoaded) {
+    m_measureIndex[{uid, versionId}] = indexMeasure(uid, versionId);
+  }
+  return true;
 }
 
 // cppcheck-suppress constParameterReference
@@ -1291,6 +1207,8 @@ bool LocalBCL::removeMeasure(BCLMeasure& measure) {
     return false;
   }
 
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+
   // TODO: JM 2018-11-14 Check if Measure is actually part of the SQL database first?
 
   // Start by deleting stuff from the SQL file
@@ -1324,6 +1242,7 @@ bool LocalBCL::removeMeasure(BCLMeasure& measure) {
     LOG(Error, "Transaction commit failed, will not remove Measure from disk.");
     return false;
   }
+  m_measureIndex.erase({uid, versionId});
 
   // proceed deleting component on disk
   openstudio::path pathToRemove = m_libraryPath / uid / versionId;
@@ -1380,158 +1299,44 @@ size_t LocalBCL::removeOutdatedLocalMeasures(const std::string& uid, const std::
   return num_removed;
 }
 
-std::vector<BCLComponent> LocalBCL::componentAttributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms) const {
-  auto uids = attributeSearch(searchTerms, "component");
-  if (uids.empty()) {
-    return {};
+namespace {
+
+  template <class T>
+  bool matchesAttributeSearch(const T& entry, const std::vector<std::pair<std::string, std::string>>& searchTerms) {
+    return std::all_of(searchTerms.cbegin(), searchTerms.cend(), [&entry](const auto& searchTerm) {
+      const std::string name = boost::algorithm::to_lower_copy(searchTerm.first);
+      const std::string value = boost::algorithm::to_lower_copy(searchTerm.second);
+      return std::any_of(entry.attributes.cbegin(), entry.attributes.cend(),
+                         [&name, &value](const auto& attribute) { return attribute.first == name && attribute.second == value; });
+    });
   }
 
+}  // namespace
+
+std::vector<BCLComponent> LocalBCL::componentAttributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms) const {
+  auto lock = readIndex();
+
   std::vector<BCLComponent> result;
-  for (const auto& uid : uids) {
-    boost::optional<BCLComponent> component = getComponent(uid.first, uid.second);
-    if (component) {
-      result.push_back(*component);
+  for (const auto& [key, entry] : m_componentIndex) {
+    if (entry.item && matchesAttributeSearch(entry, searchTerms)) {
+      result.push_back(entry.item.get());
     }
   }
-
   return result;
 }
 
 std::vector<BCLMeasure> LocalBCL::measureAttributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms) const {
-  auto uids = this->attributeSearch(searchTerms, "measure");
-  if (uids.empty()) {
-    return {};
-  }
+  auto lock = readIndex();
 
   std::vector<BCLMeasure> result;
-  for (const auto& uid : uids) {
-    boost::optional<BCLMeasure> measure = getMeasure(uid.first, uid.second);
-    if (measure) {
-      result.push_back(*measure);
+  for (const auto& [key, entry] : m_measureIndex) {
+    if (entry.item && matchesAttributeSearch(entry, searchTerms)) {
+      result.push_back(entry.item.get());
     }
   }
-
   return result;
 }
 
-std::set<std::pair<std::string, std::string>> LocalBCL::attributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms,
-                                                                        const std::string& componentType) const {
-  using UidsVecType = std::vector<std::pair<std::string, std::string>>;
-  using UidsType = std::set<std::pair<std::string, std::string>>;
-
-  UidsType uids;
-
-  if (!m_db) {
-    return uids;
-  }
-
-  // Make pairs of (uid, version_id)
-  {
-    std::string tableName = (componentType == "component") ? "Components" : ((componentType == "measure") ? "Measures" : "");
-
-    std::string statement = "SELECT DISTINCT uid, version_id FROM " + tableName;
-    sqlite3_stmt* sqlStmtPtr;
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Cannot prepare statement (in searchTerms): " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return {};
-    }
-
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-        uids.insert(make_pair(uid, version_id));
-
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
-
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
-  }
-
-  // Loop on search terms
-  {
-
-    // Prepare a statement that we'll bind
-    // (Note: do not do name='?', it won't think it's a bind parameter)
-    std::string statement = "SELECT uid, version_id FROM Attributes WHERE name=? COLLATE NOCASE AND value=? COLLATE NOCASE";
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Cannot prepare statement (in searchTerms): " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return {};
-    }
-
-    for (const auto& searchTerm : searchTerms) {
-
-      UidsType theseUids;
-
-      // Reset the statement to allow binding variables on the next iteration
-      sqlite3_reset(sqlStmtPtr);
-
-      // Bind the values now
-      std::string name = escape(searchTerm.first);
-      std::string value = escape(searchTerm.second);
-
-      if (sqlite3_bind_text(sqlStmtPtr, 1, name.c_str(), name.size(), SQLITE_TRANSIENT) != SQLITE_OK) {
-        LOG(Error, "Error binding to the 1st parameter (in searchTerms), name: " << name);
-        sqlite3_finalize(sqlStmtPtr);
-        return {};
-      } else if (sqlite3_bind_text(sqlStmtPtr, 2, value.c_str(), value.size(), SQLITE_TRANSIENT) != SQLITE_OK) {
-        LOG(Error, "Error binding to the 2nd parameter (in searchTerms), value: " << value);
-        sqlite3_finalize(sqlStmtPtr);
-        return {};
-      }
-
-      int code = SQLITE_OK;
-
-      // Loop until done (or failed)
-      while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-      {
-        code = sqlite3_step(sqlStmtPtr);
-        if (code == SQLITE_ROW) {
-          // Get values from SELECT
-          std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-          std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-          theseUids.insert(make_pair(uid, version_id));
-
-        } else  // i didn't get a row.  something is wrong so set the exit condition.
-        {       // should never get here since i test for all documented return states above
-          code = SQLITE_DONE;
-        }
-      }  // End loop on each match
-
-      UidsVecType newUids(std::max(uids.size(), theseUids.size()));
-      auto insertEnd = std::set_intersection(uids.begin(), uids.end(), theseUids.begin(), theseUids.end(), newUids.begin());
-
-      uids.clear();
-      uids.insert(newUids.begin(), insertEnd);
-
-      if (uids.empty()) {
-        sqlite3_finalize(sqlStmtPtr);
-        return {};
-      }
-
-    }  // End loop on searchTerms
-
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
-  }  // End Loop on search terms
-
-  return uids;
-}
-
 std::string LocalBCL::formatString(double d, unsigned prec) {
   std::stringstream ss;
   ss << std::setprecision(prec) << std::showpoint << d;
@@ -1552,6 +1357,7 @@ std::string LocalBCL::formatString(double d, unsigned prec) {
 }
 
 std::string LocalBCL::prodAuthKey() const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
   return m_prodAuthKey;
 }
 
@@ -1566,6 +1372,8 @@ bool LocalBCL::setProdAuthKey(const std::string& prodAuthKey) {
     return false;
   }
 
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+
   // Overwrite prodAuthKey in database
 
   // Start a transaction, so we can handle failures without messing up the database
@@ -1589,6 +1397,7 @@ bool LocalBCL::setProdAuthKey(const std::string& prodAuthKey) {
 }
 
 std::string LocalBCL::devAuthKey() const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
   return m_devAuthKey;
 }
 
@@ -1604,6 +1413,8 @@ bool LocalBCL::setDevAuthKey(const std::string& devAuthKey) {
     LOG(Error, "devAuthKey was rejected by RemoteBCL.");
     return false;
   }
+
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
   // Store key
   m_devAuthKey = devAuthKey;
 
@@ -10,7 +10,10 @@
 #include "../core/Optional.hpp"
 #include "../core/Path.hpp"
 
+#include <map>
+#include <shared_mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 struct sqlite3;
@@ -110,6 +113,11 @@ class UTILITIES_API LocalBCL : public BCL
   /// Search for measures with attributes matching those in searchTerms
   std::vector<BCLMeasure> measureAttributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms) const;
 
+  /// The library is indexed in memory the first time it is queried, queries then read neither the database nor the xml files and
+  /// may be run from several threads. Reloads the components and measures whose component.xml or measure.xml changed on disk
+  /// since they were indexed (compared by checksum), returns the number of components and measures that were reloaded
+  size_t refreshIndex();
+
   /// Return production OAuth key
   std::string prodAuthKey() const;
 
@@ -149,13 +157,36 @@ class UTILITIES_API LocalBCL : public BCL
 
   static std::string escape(const std::string& s);
 
-  std::set<std::pair<std::string, std::string>> attributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms,
-                                                                const std::string& componentType) const;
 
   static std::string formatString(double d, unsigned prec = 15);
 
   static std::shared_ptr<LocalBCL>& instanceInternal();
 
+  static std::pair<std::string, std::string> attributeValueAndType(const Attribute& attribute);
+
+  // One component or measure of the in-memory index, item is empty if it could not be loaded from disk
+  template <class T>
+  struct IndexEntry
+  {
+    boost::optional<T> item;
+    // Checksum of component.xml or measure.xml when item was loaded
+    std::string xmlChecksum;
+    // Lower case names and descriptions, separated by new lines
+    std::string searchText;
+    // Lower case attribute names and values, formatted as in the Attributes table
+    std::vector<std::pair<std::string, std::string>> attributes;
+  };
+
+  // Key is (uid, version_id) as in the database
+  using IndexKey = std::pair<std::string, std::string>;
+
+  // Returns a shared lock on the index, loads the index first if needed
+  std::shared_lock<std::shared_mutex> readIndex() const;
+  // Loads the index from the database, the mutex must be locked exclusively
+  void loadIndex() const;
+  IndexEntry<BCLComponent> indexComponent(const std::string& uid, const std::string& versionId) const;
+  IndexEntry<BCLMeasure> indexMeasure(const std::string& uid, const std::string& versionId) const;
+
   bool closeConnection();
 
   openstudio::path m_libraryPath;
@@ -170,6 +201,12 @@ class UTILITIES_API LocalBCL : public BCL
   openstudio::path m_sqliteFilePath;
   std::string m_sqliteFilename;
 
+  // Guards the index and the database: queries take a shared lock, changes to the library take an exclusive lock
+  mutable std::shared_mutex m_mutex;
+  mutable bool m_indexLoaded = false;
+  mutable std::map<IndexKey, IndexEntry<BCLComponent>> m_componentIndex;
+  mutable std::map<IndexKey, IndexEntry<BCLMeasure>> m_measureIndex;
+
   // Helper function to retrieve a string
   static std::string columnText(const unsigned char* column);
 
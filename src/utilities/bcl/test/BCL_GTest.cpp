@@ -12,6 +12,8 @@
 #include "../../idf/IdfFile.hpp"
 #include "../../idf/Workspace.hpp"
 #include "../../core/FilesystemHelpers.hpp"
+#include "../../core/ParallelFor.hpp"
+#include "../../core/PathHelpers.hpp"
 
 using namespace openstudio;
 
@@ -459,3 +461,49 @@ TEST_F(BCLFixture, RemoteBCL_BCLSearchResult) {
   const openstudio::DateTime dateTime(Date(MonthOfYear::Nov, 14, 2022));
   EXPECT_GT(*dt_, dateTime);
 }
+
+TEST_F(BCLFixture, LocalBCL_Index) {
+  LocalBCL& bcl = LocalBCL::instance();
+  EXPECT_TRUE(bcl.measures().empty());
+
+  openstudio::path newDir = currentLocalBCLPath / toPath("NewMeasure");
+  BCLMeasure newMeasure("Index Test Measure", "IndexTestMeasure", newDir, "Envelope.Fenestration", MeasureType::ModelMeasure,
+                        "Adds shading to the south windows", "Loops over the sub surfaces");
+  openstudio::path dir = currentLocalBCLPath / toPath(newMeasure.uid()) / toPath(newMeasure.versionId());
+  ASSERT_TRUE(copyDirectory(newDir, dir));
+
+  BCLMeasure measure(dir);
+  ASSERT_TRUE(bcl.addMeasure(measure));
+  EXPECT_EQ(1u, bcl.measures().size());
+  EXPECT_EQ(std::vector<std::string>{measure.uid()}, bcl.measureUids());
+  ASSERT_TRUE(bcl.getMeasure(measure.uid()));
+  EXPECT_EQ(measure.versionId(), bcl.getMeasure(measure.uid())->versionId());
+
+  // Searches are case insensitive, every word must be found in the names or descriptions
+  EXPECT_EQ(1u, bcl.searchMeasures("index test", "").size());
+  EXPECT_EQ(1u, bcl.searchMeasures("SOUTH shading", "").size());
+  EXPECT_EQ(1u, bcl.searchMeasures("sub surfaces", "").size());
+  EXPECT_TRUE(bcl.searchMeasures("north shading", "").empty());
+  EXPECT_EQ(1u, bcl.searchMeasures("", "").size());
+
+  // Nothing changed on disk
+  EXPECT_EQ(0u, bcl.refreshIndex());
+
+  measure.setDescription("Adds overhangs to the south windows");
+  ASSERT_TRUE(measure.save());
+  EXPECT_TRUE(bcl.searchMeasures("overhangs", "").empty());
+  EXPECT_EQ(1u, bcl.refreshIndex());
+  EXPECT_EQ(0u, bcl.refreshIndex());
+  EXPECT_EQ(1u, bcl.searchMeasures("overhangs", "").size());
+  EXPECT_TRUE(bcl.searchMeasures("shading", "").empty());
+
+  std::vector<size_t> found(16, 0);
+  parallelFor(
+    found.size(), [&bcl, &found](size_t i) { found[i] = bcl.searchMeasures("overhangs", "").size() + bcl.measures().size(); }, 4);
+  EXPECT_EQ(std::vector<size_t>(16, 2), found);
+
+  ASSERT_TRUE(bcl.removeMeasure(measure));
+  EXPECT_TRUE(bcl.measures().empty());
+  EXPECT_FALSE(bcl.getMeasure(measure.uid()));
+  EXPECT_TRUE(bcl.searchMeasures("overhangs", "").empty());
+}
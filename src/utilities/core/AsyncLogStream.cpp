@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "AsyncLogStream.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+
+namespace detail {
+
+  AsyncLogStream::RecordBuffer::RecordBuffer(AsyncLogStream& stream) : m_stream(stream) {}
+
+  AsyncLogStream::RecordBuffer::int_type AsyncLogStream::RecordBuffer::overflow(int_type c) {
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      m_record.push_back(traits_type::to_char_type(c));
+    }
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize AsyncLogStream::RecordBuffer::xsputn(const char* s, std::streamsize n) {
+    m_record.append(s, static_cast<size_t>(n));
+    return n;
+  }
+
+  int AsyncLogStream::RecordBuffer::sync() {
+    if (!m_record.empty()) {
+      m_stream.push(m_record);
+      m_record.clear();
+    }
+    return 0;
+  }
+
+  AsyncLogStream::AsyncLogStream(boost::shared_ptr<std::ostream> os, size_t capacity, LogOverflowPolicy overflowPolicy)
+    : std::ostream(nullptr), m_os(std::move(os)), m_overflowPolicy(overflowPolicy), m_recordBuffer(*this), m_ring(std::max<size_t>(capacity, 1)) {
+    rdbuf(&m_recordBuffer);
+    m_thread = std::thread([this]() { run(); });
+  }
+
+  AsyncLogStream::~AsyncLogStream() {
+    flush();
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_done = true;
+    }
+    m_recordPushed.notify_one();
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  boost::shared_ptr<std::ostream> AsyncLogStream::stream() const {
+    return m_os;
+  }
+
+  void AsyncLogStream::drain() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_recordsPopped.wait(lock, [this]() { return m_size == 0 && !m_writing; });
+  }
+
+  std::unique_lock<std::mutex> AsyncLogStream::drainAndLock() {
+    drain();
+    return std::unique_lock<std::mutex>(m_writeMutex);
+  }
+
+  size_t AsyncLogStream::droppedRecords() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_droppedRecords;
+  }
+
+  void AsyncLogStream::push(std::string& record) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_size == m_ring.size()) {
+      if (m_overflowPolicy == LogOverflowPolicy::Drop) {
+        ++m_droppedRecords;
+        return;
+      }
+      m_recordsPopped.wait(lock, [this]() { return m_size < m_ring.size(); });
+    }
+    // Swap rather than copy, so the slots keep reusing the same string buffers
+    m_ring[(m_head + m_size) % m_ring.size()].swap(record);
+    ++m_size;
+    // Only wake the writer thread when it is idle, a busy writer picks the record up with the rest of the next batch
+    const bool wake = m_writerIdle;
+    m_writerIdle = false;
+    lock.unlock();
+    if (wake) {
+      m_recordPushed.notify_one();
+    }
+  }
+
+  void AsyncLogStream::run() {
+    std::vector<std::string> records;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_writerIdle = (m_size == 0);
+        m_recordPushed.wait(lock, [this]() { return m_done || m_size > 0; });
+        if (m_size == 0) {
+          return;
+        }
+        records.resize(m_size);
+        for (size_t i = 0; i < m_size; ++i) {
+          records[i].swap(m_ring[(m_head + i) % m_ring.size()]);
+        }
+        m_head = (m_head + m_size) % m_ring.size();
+        m_size = 0;
+        m_writing = true;
+      }
+      m_recordsPopped.notify_all();
+
+      {
+        std::lock_guard<std::mutex> writeLock(m_writeMutex);
+        for (std::string& record : records) {
+          m_os->write(record.data(), static_cast<std::streamsize>(record.size()));
+          record.clear();
+        }
+        m_os->flush();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_writing = false;
+      }
+      m_recordsPopped.notify_all();
+    }
+  }
+
+}  // namespace detail
+
+}  // namespace openstudio
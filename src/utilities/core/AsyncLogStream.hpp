@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_ASYNCLOGSTREAM_HPP
+#define UTILITIES_CORE_ASYNCLOGSTREAM_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "LogSink.hpp"
+
+#include <boost/shared_ptr.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openstudio {
+
+namespace detail {
+
+  /** Output stream that a LogSink writes to in asynchronous mode. The sink flushes the stream after every record, each flush moves the
+   *  record into a bounded ring buffer and a writer thread writes the buffered records, in order, to the wrapped stream. When the ring
+   *  buffer is full the record is dropped or the logging thread waits, depending on the LogOverflowPolicy. */
+  class UTILITIES_API AsyncLogStream : public std::ostream
+  {
+   public:
+    AsyncLogStream(boost::shared_ptr<std::ostream> os, size_t capacity, LogOverflowPolicy overflowPolicy);
+
+    /** Writes the buffered records and stops the writer thread */
+    virtual ~AsyncLogStream() override;
+
+    AsyncLogStream(const AsyncLogStream&) = delete;
+    AsyncLogStream& operator=(const AsyncLogStream&) = delete;
+
+    /** The wrapped stream */
+    boost::shared_ptr<std::ostream> stream() const;
+
+    /** Waits until every buffered record has been written to the wrapped stream */
+    void drain();
+
+    /** Same as drain, then keeps the writer thread from touching the wrapped stream until the returned lock is released */
+    std::unique_lock<std::mutex> drainAndLock();
+
+    /** Number of records dropped because the ring buffer was full */
+    size_t droppedRecords() const;
+
+   private:
+    class RecordBuffer : public std::streambuf
+    {
+     public:
+      explicit RecordBuffer(AsyncLogStream& stream);
+
+     protected:
+      virtual int_type overflow(int_type c) override;
+      virtual std::streamsize xsputn(const char* s, std::streamsize n) override;
+      virtual int sync() override;
+
+     private:
+      AsyncLogStream& m_stream;
+      std::string m_record;
+    };
+
+    void push(std::string& record);
+    void run();
+
+    boost::shared_ptr<std::ostream> m_os;
+    const LogOverflowPolicy m_overflowPolicy;
+    RecordBuffer m_recordBuffer;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_recordPushed;
+    std::condition_variable m_recordsPopped;
+    std::vector<std::string> m_ring;
+    size_t m_head = 0;
+    size_t m_size = 0;
+    size_t m_droppedRecords = 0;
+    bool m_writing = false;
+    bool m_writerIdle = false;
+    bool m_done = false;
+
+    // Held by the writer thread while it writes to m_os
+    std::mutex m_writeMutex;
+
+    std::thread m_thread;
+  };
+
+}  // namespace detail
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_ASYNCLOGSTREAM_HPP
@@ -32,6 +32,7 @@ namespace detail {
   }
 
   std::vector<LogMessage> FileLogSink_Impl::logMessages() const {
+    auto streamLock = lockStream();
     openstudio::filesystem::ifstream ifs(m_path);
     std::string line;
     std::string text;
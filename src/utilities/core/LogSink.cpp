@@ -8,6 +8,7 @@
 
 #include "Logger.hpp"
 #include "LogMessage.hpp"
+#include "AsyncLogStream.hpp"
 
 #include <boost/log/support/regex.hpp>
 #include <boost/log/expressions.hpp>
@@ -42,6 +43,10 @@ namespace detail {
       // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
       m_formatter{expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> " << expr::smessage} {}
 
+  LogSink_Impl::~LogSink_Impl() {
+    Logger::removeSinkFilter(m_sink.get());
+  }
+
   void LogSink_Impl::setFormatter(const boost::log::formatter& fmter) {
     std::unique_lock l{m_mutex};
     m_formatter = fmter;
@@ -139,7 +144,8 @@ namespace detail {
 
     m_autoFlush = autoFlush;
 
-    m_sink->locked_backend()->auto_flush(autoFlush);
+    // In asynchronous mode the backend must flush each record to hand it to the writer thread
+    m_sink->locked_backend()->auto_flush(autoFlush || m_asyncStream);
   }
 
   std::thread::id LogSink_Impl::threadId() const {
@@ -167,6 +173,7 @@ namespace detail {
   void LogSink_Impl::setStream(boost::shared_ptr<std::ostream> os) {
     std::unique_lock l{m_mutex};
 
+    m_stream = os;
     m_sink->locked_backend()->add_stream(os);
 
     m_sink->set_formatter(m_formatter);
@@ -184,6 +191,84 @@ namespace detail {
     this->setAutoFlush(true);
   }
 
+  bool LogSink_Impl::isAsync() const {
+    std::shared_lock l{m_mutex};
+
+    return m_asyncStream != nullptr;
+  }
+
+  void LogSink_Impl::setAsync(size_t capacity, LogOverflowPolicy overflowPolicy) {
+    std::unique_lock l{m_mutex};
+
+    if (!m_stream) {
+      return;
+    }
+
+    boost::shared_ptr<AsyncLogStream> asyncStream(new AsyncLogStream(m_stream, capacity, overflowPolicy));
+    std::swap(m_asyncStream, asyncStream);
+
+    // Logging threads write to the streams while holding the backend lock: the previous asynchronous stream, if any, must write its buffered
+    // records and stop its writer thread before then, or it would write to m_stream at the same time as the new one
+    auto backend = m_sink->locked_backend();
+    if (asyncStream) {
+      backend->remove_stream(asyncStream);
+      asyncStream->drain();
+      asyncStream.reset();
+    } else {
+      backend->remove_stream(m_stream);
+    }
+    backend->add_stream(m_asyncStream);
+    backend->auto_flush(true);
+  }
+
+  void LogSink_Impl::resetAsync() {
+    std::unique_lock l{m_mutex};
+
+    if (!m_asyncStream) {
+      return;
+    }
+
+    boost::shared_ptr<AsyncLogStream> asyncStream;
+    std::swap(m_asyncStream, asyncStream);
+
+    // Write the buffered records and stop the writer thread before any logging thread can write to m_stream directly
+    auto backend = m_sink->locked_backend();
+    backend->remove_stream(asyncStream);
+    asyncStream->drain();
+    asyncStream.reset();
+    backend->add_stream(m_stream);
+    backend->auto_flush(m_autoFlush);
+  }
+
+  void LogSink_Impl::flush() {
+    m_sink->flush();
+
+    std::shared_lock l{m_mutex};
+    boost::shared_ptr<AsyncLogStream> asyncStream = m_asyncStream;
+    l.unlock();
+
+    if (asyncStream) {
+      asyncStream->drain();
+    }
+  }
+
+  size_t LogSink_Impl::droppedRecords() const {
+    std::shared_lock l{m_mutex};
+
+    return m_asyncStream ? m_asyncStream->droppedRecords() : 0;
+  }
+
+  std::unique_lock<std::mutex> LogSink_Impl::lockStream() const {
+    std::shared_lock l{m_mutex};
+    boost::shared_ptr<AsyncLogStream> asyncStream = m_asyncStream;
+    l.unlock();
+
+    if (asyncStream) {
+      return asyncStream->drainAndLock();
+    }
+    return {};
+  }
+
   boost::shared_ptr<LogSinkBackend> LogSink_Impl::sink() const {
     std::shared_lock l{m_mutex};
 
@@ -209,6 +294,8 @@ namespace detail {
     } else {
       m_sink->set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
     }
+
+    Logger::setSinkFilter(m_sink.get(), filterLogLevel, m_channelRegex);
   }
 
 }  // namespace detail
@@ -285,6 +372,26 @@ boost::shared_ptr<LogSinkBackend> LogSink::sink() const {
   return m_impl->sink();
 }
 
+bool LogSink::isAsync() const {
+  return m_impl->isAsync();
+}
+
+void LogSink::setAsync(size_t capacity, LogOverflowPolicy overflowPolicy) {
+  m_impl->setAsync(capacity, overflowPolicy);
+}
+
+void LogSink::resetAsync() {
+  m_impl->resetAsync();
+}
+
+void LogSink::flush() {
+  m_impl->flush();
+}
+
+size_t LogSink::droppedRecords() const {
+  return m_impl->droppedRecords();
+}
+
 void LogSink::useWorkflowGemFormatter(bool use, bool include_channel) {
   m_impl->useWorkflowGemFormatter(use, include_channel);
 }
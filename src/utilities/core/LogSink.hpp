@@ -24,6 +24,13 @@ namespace detail {
   class LogSink_Impl;
 }  // namespace detail
 
+/// what an asynchronous LogSink does with a record when its buffer is full
+enum class LogOverflowPolicy
+{
+  Block,  // the logging thread waits for the writer thread
+  Drop    // the record is dropped
+};
+
 /// LogSink is a class for managing sinks for log messages, e.g. files, streams, etc.
 class UTILITIES_API LogSink
 {
@@ -73,6 +80,23 @@ class UTILITIES_API LogSink
   /// reset the thread id that messages are filtered by
   void resetThreadId();
 
+  /// is the sink asynchronous
+  bool isAsync() const;
+
+  /// make the sink asynchronous: records are formatted on the logging thread and buffered, a background thread writes them
+  /// records keep their order, capacity is the number of records that can be buffered
+  /// the buffered records are written when the sink is destroyed or made synchronous again
+  void setAsync(size_t capacity = 8192, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block);
+
+  /// make the sink synchronous again, after writing the buffered records
+  void resetAsync();
+
+  /// wait for the buffered records to be written and flush the stream
+  void flush();
+
+  /// number of records dropped since the sink was made asynchronous
+  size_t droppedRecords() const;
+
   void useWorkflowGemFormatter(bool use, bool include_channel = true);
 
   void setFormatter(const boost::log::formatter& fmter);
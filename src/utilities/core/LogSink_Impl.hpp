@@ -13,18 +13,21 @@
 
 #include <boost/optional.hpp>
 
+#include <mutex>
 #include <shared_mutex>
 
 namespace openstudio {
 
 namespace detail {
 
+  class AsyncLogStream;
+
   /// LogSink is a class for managing sinks for log messages, e.g. files, streams, etc.
   class UTILITIES_API LogSink_Impl
   {
    public:
     /// destructor
-    virtual ~LogSink_Impl() = default;
+    virtual ~LogSink_Impl();
 
     /// is the sink enabled
     bool isEnabled() const;
@@ -73,6 +76,21 @@ namespace detail {
     /// reset the thread id that messages are filtered by
     void resetThreadId();
 
+    /// is the sink asynchronous
+    bool isAsync() const;
+
+    /// make the sink asynchronous
+    void setAsync(size_t capacity, LogOverflowPolicy overflowPolicy);
+
+    /// make the sink synchronous again
+    void resetAsync();
+
+    /// wait for the buffered records to be written and flush the stream
+    void flush();
+
+    /// number of records dropped since the sink was made asynchronous
+    size_t droppedRecords() const;
+
     void setFormatter(const boost::log::formatter& fmter);
 
     void useWorkflowGemFormatter(bool use, bool include_channel = false);
@@ -89,6 +107,10 @@ namespace detail {
     // for adding cout and cerr sinks to logger
     boost::shared_ptr<LogSinkBackend> sink() const;
 
+    // in asynchronous mode, waits for the buffered records to be written and keeps the writer thread from writing to the stream
+    // until the lock is released, so the stream can be read; does nothing in synchronous mode
+    std::unique_lock<std::mutex> lockStream() const;
+
     mutable std::shared_mutex m_mutex;
 
    private:
@@ -99,6 +121,8 @@ namespace detail {
     bool m_autoFlush = false;
     std::thread::id m_threadId;
     boost::shared_ptr<LogSinkBackend> m_sink;
+    boost::shared_ptr<std::ostream> m_stream;
+    boost::shared_ptr<AsyncLogStream> m_asyncStream;
     boost::log::formatter m_formatter;
   };
 
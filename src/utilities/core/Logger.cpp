@@ -11,12 +11,72 @@
 
 #include <boost/core/null_deleter.hpp>
 
+#include <atomic>
+#include <unordered_map>
 #include <utility>
 
 namespace openstudio {
 
+namespace {
+
+  // No enabled sink accepts anything
+  constexpr int noLogLevel = Fatal + 1;
+
+  struct SinkFilter
+  {
+    LogLevel logLevel = Trace;
+    boost::optional<boost::regex> channelRegex;
+  };
+
+  // Filters of the sinks and which sinks are enabled, summarized in the lowest level accepted overall and per channel
+  struct LogFilters
+  {
+    std::shared_mutex mutex;
+    std::map<const LogSinkBackend*, SinkFilter> sinkFilters;
+    std::set<const LogSinkBackend*> enabledSinks;
+    std::unordered_map<std::string, int> channelLogLevels;
+    std::atomic<int> minimumLogLevel{noLogLevel};
+
+    // Must be called with the mutex locked exclusively
+    void update() {
+      channelLogLevels.clear();
+      int result = noLogLevel;
+      for (const LogSinkBackend* sink : enabledSinks) {
+        auto it = sinkFilters.find(sink);
+        // A sink without a known filter accepts everything
+        result = std::min(result, static_cast<int>(it == sinkFilters.end() ? Trace : it->second.logLevel));
+      }
+      minimumLogLevel.store(result, std::memory_order_relaxed);
+    }
+
+    // Must be called with the mutex locked
+    int channelLogLevel(const std::string& channel) const {
+      int result = noLogLevel;
+      for (const LogSinkBackend* sink : enabledSinks) {
+        auto it = sinkFilters.find(sink);
+        if (it == sinkFilters.end()) {
+          return Trace;
+        }
+        if (!it->second.channelRegex || boost::regex_match(channel, *it->second.channelRegex)) {
+          result = std::min(result, static_cast<int>(it->second.logLevel));
+        }
+      }
+      return result;
+    }
+  };
+
+  LogFilters& logFilters() {
+    static LogFilters filters;
+    return filters;
+  }
+
+}  // namespace
+
 /// convenience function for SWIG, prefer macros in C++
 void logFree(LogLevel level, const std::string& channel, const std::string& message) {
+  if (!Logger::isLevelEnabled(level) || !Logger::isChannelEnabled(level, channel)) {
+    return;
+  }
   BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
 }
 
@@ -27,6 +87,9 @@ Logger& Logger::instance() {
 }
 
 Logger::Logger() {
+  // Make sure the filters outlive the Logger
+  logFilters();
+
   // Make current thread id attribute available to logging
   boost::log::core::get()->add_global_attribute("ThreadId", boost::log::attributes::make_function(&std::this_thread::get_id));
 
@@ -75,6 +138,45 @@ LoggerType& Logger::loggerFromChannel(const LogChannel& logChannel) {
   return it->second;
 }
 
+bool Logger::isLevelEnabled(LogLevel logLevel) {
+  // Make sure the standard out sink is registered
+  instance();
+  return static_cast<int>(logLevel) >= logFilters().minimumLogLevel.load(std::memory_order_relaxed);
+}
+
+bool Logger::isChannelEnabled(LogLevel logLevel, const LogChannel& logChannel) {
+  LogFilters& filters = logFilters();
+
+  std::shared_lock l{filters.mutex};
+  auto it = filters.channelLogLevels.find(logChannel);
+  if (it != filters.channelLogLevels.end()) {
+    return static_cast<int>(logLevel) >= it->second;
+  }
+  l.unlock();
+
+  std::unique_lock l2{filters.mutex};
+  int channelLogLevel = filters.channelLogLevel(logChannel);
+  filters.channelLogLevels.emplace(logChannel, channelLogLevel);
+  return static_cast<int>(logLevel) >= channelLogLevel;
+}
+
+void Logger::setSinkFilter(const LogSinkBackend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex) {
+  LogFilters& filters = logFilters();
+
+  std::unique_lock l{filters.mutex};
+  filters.sinkFilters[sink] = SinkFilter{logLevel, channelRegex};
+  filters.update();
+}
+
+void Logger::removeSinkFilter(const LogSinkBackend* sink) {
+  LogFilters& filters = logFilters();
+
+  std::unique_lock l{filters.mutex};
+  if (filters.enabledSinks.find(sink) == filters.enabledSinks.end()) {
+    filters.sinkFilters.erase(sink);
+  }
+}
+
 bool Logger::findSink(boost::shared_ptr<LogSinkBackend> sink) {
   std::unique_lock l{m_mutex};
 
@@ -98,6 +200,11 @@ void Logger::addSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->add_sink(sink);
+
+    LogFilters& filters = logFilters();
+    std::unique_lock l3{filters.mutex};
+    filters.enabledSinks.insert(sink.get());
+    filters.update();
   }
 }
 
@@ -116,6 +223,11 @@ void Logger::removeSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->remove_sink(sink);
+
+    LogFilters& filters = logFilters();
+    std::unique_lock l3{filters.mutex};
+    filters.enabledSinks.erase(sink.get());
+    filters.update();
   }
 }
 
@@ -33,12 +33,17 @@
 /// log a message from within a registered class and throw an exception
 #define LOG_AND_THROW(__message__) LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
-#define LOG_FREE(__level__, __channel__, __message__)        \
-  {                                                          \
-    std::stringstream _ss1;                                  \
-    _ss1 << __message__;                                     \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+/// log a message from outside a registered class, the message is only formatted if an enabled sink accepts its level and channel
+#define LOG_FREE(__level__, __channel__, __message__)                   \
+  {                                                                     \
+    if (openstudio::Logger::isLevelEnabled(__level__)) {                \
+      const openstudio::LogChannel _channel1(__channel__);              \
+      if (openstudio::Logger::isChannelEnabled(__level__, _channel1)) { \
+        std::stringstream _ss1;                                         \
+        _ss1 << __message__;                                            \
+        openstudio::logFree(__level__, _channel1, _ss1.str());          \
+      }                                                                 \
+    }                                                                   \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -81,6 +86,15 @@ class UTILITIES_API Logger
   /// exist a new logger will be set up at the default level
   LoggerType& loggerFromChannel(const LogChannel& logChannel);
 
+  /// returns false if no enabled sink accepts messages at logLevel, whatever their channel
+  /// this is a single atomic load, checked by the LOG macros before anything else
+  static bool isLevelEnabled(LogLevel logLevel);
+
+  /// returns false if no enabled sink accepts messages at logLevel on logChannel
+  /// the result is cached per channel until a sink is enabled, disabled or has its filter changed
+  /// sinks filtered by thread id are assumed to accept messages from any thread
+  static bool isChannelEnabled(LogLevel logLevel, const LogChannel& logChannel);
+
  protected:
   friend class detail::LogSink_Impl;
   friend class openstudio::OSWorkflow;
@@ -97,6 +111,13 @@ class UTILITIES_API Logger
   // cppcheck-suppress functionConst
   void addTimeStampToLogger();
 
+  /// records the filter of a sink, used by isLevelEnabled and isChannelEnabled
+  /// static since the standard out sink sets its filter while the Logger is being constructed
+  static void setSinkFilter(const LogSinkBackend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex);
+
+  /// forgets the filter of a sink that is being destroyed, unless the sink is still enabled
+  static void removeSinkFilter(const LogSinkBackend* sink);
+
  private:
   Logger();
   ~Logger() = default;
@@ -0,0 +1,84 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PARALLELFOR_HPP
+#define UTILITIES_CORE_PARALLELFOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace openstudio {
+
+/** Number of threads used by parallelFor when numThreads is 0 */
+inline unsigned defaultNumberOfThreads() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/** Calls func(i) for every i in [0, n) using up to numThreads threads (0 means one per hardware thread), the calling thread included.
+ *  Indices are handed out one at a time so uneven work is balanced, and results should be written to a pre-sized container at index i
+ *  to keep the output deterministic. func must be safe to call concurrently for different indices: in particular it must not touch
+ *  a Model or Workspace, which are not thread safe, so gather plain data first and do the model work serially afterwards.
+ *  Messages logged from the worker threads are not seen by thread-filtered sinks (eg: a translator's StringStreamLogSink).
+ *  If func throws, the remaining indices are skipped and the first exception is rethrown on the calling thread. */
+template <typename Func>
+void parallelFor(std::size_t n, Func&& func, unsigned numThreads = 0) {
+  if (numThreads == 0) {
+    numThreads = defaultNumberOfThreads();
+  }
+  numThreads = static_cast<unsigned>(std::min<std::size_t>(numThreads, n));
+
+  if (numThreads <= 1) {
+    for (std::size_t i = 0; i < n; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex errorMutex;
+
+  auto worker = [&]() {
+    while (!failed) {
+      const std::size_t i = next.fetch_add(1);
+      if (i >= n) {
+        return;
+      }
+      try {
+        func(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (unsigned t = 1; t < numThreads; ++t) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_PARALLELFOR_HPP
@@ -25,6 +25,7 @@ namespace detail {
   }
 
   std::string StringStreamLogSink_Impl::string() const {
+    auto streamLock = lockStream();
     std::shared_lock l{m_mutex};
 
     return m_stringstream->str();
@@ -35,6 +36,7 @@ namespace detail {
   }
 
   void StringStreamLogSink_Impl::resetStringStream() {
+    auto streamLock = lockStream();
     std::unique_lock l{m_mutex};
 
     m_stringstream->str("");
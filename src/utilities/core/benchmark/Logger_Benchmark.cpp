@@ -0,0 +1,74 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Logger.hpp"
+#include "../FileLogSink.hpp"
+#include "../StringStreamLogSink.hpp"
+
+using namespace openstudio;
+
+class LoggingClass
+{
+ public:
+  explicit LoggingClass(double value) : m_value(value) {}
+
+  void logDebug() const {
+    LOG(Debug, "Value is " << m_value << " after " << m_value * 2.0 << " iterations");
+  }
+
+  void logInfo() const {
+    LOG(Info, "Value is " << m_value << " after " << m_value * 2.0 << " iterations");
+  }
+
+ private:
+  double m_value;
+
+  REGISTER_LOGGER("openstudio.benchmark.LoggingClass");
+};
+
+// state.range(0): level of the only enabled sink, state.range(1): 0 if the sink accepts the channel, 1 if it does not
+static void BM_Logger_LOG_Debug(benchmark::State& state) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(static_cast<LogLevel>(state.range(0)));
+  if (state.range(1) != 0) {
+    sink.setChannelRegex("openstudio\\.model\\..*");
+  }
+
+  LoggingClass loggingClass(3.14);
+  size_t n = 0;
+  for (auto _ : state) {
+    loggingClass.logDebug();
+    // Don't let the stream grow forever
+    if (++n % 10000 == 0) {
+      sink.resetStringStream();
+    }
+  }
+}
+
+BENCHMARK(BM_Logger_LOG_Debug)->Args({Debug, 0})->Args({Error, 0})->Args({Debug, 1});
+
+// state.range(0): 0 for a synchronous file sink, 1 for an asynchronous one (the file is written by a background thread)
+static void BM_Logger_FileLogSink(benchmark::State& state) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  FileLogSink sink(toPath("./Logger_Benchmark.log"));
+  sink.setLogLevel(Info);
+  if (state.range(0) != 0) {
+    sink.setAsync();
+  }
+
+  LoggingClass loggingClass(3.14);
+  for (auto _ : state) {
+    loggingClass.logInfo();
+  }
+  sink.flush();
+  sink.disable();
+}
+
+BENCHMARK(BM_Logger_FileLogSink)->Arg(0)->Arg(1);
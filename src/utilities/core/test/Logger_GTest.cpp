@@ -10,6 +10,8 @@
 #include "../StringStreamLogSink.hpp"
 
 #include <sstream>
+#include <thread>
+#include <vector>
 
 using openstudio::toPath;
 using openstudio::Logger;
@@ -317,3 +319,167 @@ TEST(LoggerTest, file_logger_disable) {
   EXPECT_NO_THROW(openstudio::filesystem::remove(path));
 }
 }  // namespace
+
+TEST(LoggerTest, level_gating) {
+  // Only the sink below is enabled, so nothing else accepts the messages that it filters out
+  openstudio::Logger::instance().standardOutLogger().disable();
+  openstudio::Logger::instance().standardErrLogger().disable();
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Info);
+  sink.setChannelRegex(boost::regex("gating\\.on"));
+  EXPECT_TRUE(Logger::isLevelEnabled(Info));
+  EXPECT_TRUE(Logger::isChannelEnabled(Info, "gating.on"));
+  EXPECT_TRUE(Logger::isChannelEnabled(Error, "gating.on"));
+  EXPECT_FALSE(Logger::isChannelEnabled(Debug, "gating.on"));
+  EXPECT_FALSE(Logger::isChannelEnabled(Info, "gating.off"));
+  EXPECT_FALSE(Logger::isChannelEnabled(Debug, "gating.off"));
+
+  int formatted = 0;
+  auto format = [&formatted]() { return ++formatted; };
+
+  LOG_FREE(Info, "gating.on", "Message " << format());
+  EXPECT_EQ(1, formatted);
+  ASSERT_EQ(1u, sink.logMessages().size());
+  EXPECT_EQ("Message 1", sink.logMessages()[0].logMessage());
+
+  // Messages that no sink accepts are not even formatted
+  LOG_FREE(Debug, "gating.on", "Message " << format());
+  LOG_FREE(Info, "gating.off", "Message " << format());
+  LOG_FREE(Debug, "gating.off", "Message " << format());
+  EXPECT_EQ(1, formatted);
+  EXPECT_EQ(1u, sink.logMessages().size());
+
+  // The cached channel levels follow the sink filters
+  sink.setLogLevel(Debug);
+  EXPECT_TRUE(Logger::isLevelEnabled(Debug));
+  EXPECT_TRUE(Logger::isChannelEnabled(Debug, "gating.on"));
+  EXPECT_FALSE(Logger::isChannelEnabled(Debug, "gating.off"));
+  sink.resetChannelRegex();
+  EXPECT_TRUE(Logger::isChannelEnabled(Debug, "gating.off"));
+
+  sink.resetStringStream();
+  LOG_FREE(Debug, "gating.off", "Message " << format());
+  EXPECT_EQ(2, formatted);
+  ASSERT_EQ(1u, sink.logMessages().size());
+  EXPECT_EQ("Message 2", sink.logMessages()[0].logMessage());
+
+  // And so does disabling the sink
+  sink.disable();
+  EXPECT_FALSE(Logger::isChannelEnabled(Debug, "gating.off"));
+  LOG_FREE(Error, "gating.off", "Message " << format());
+  EXPECT_EQ(2, formatted);
+
+  openstudio::Logger::instance().standardOutLogger().enable();
+  openstudio::Logger::instance().standardErrLogger().enable();
+}
+
+TEST(LoggerTest, async_sink) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Info);
+  sink.setChannelRegex(boost::regex("async\\.channel"));
+  EXPECT_FALSE(sink.isAsync());
+  sink.setAsync(16, openstudio::LogOverflowPolicy::Block);
+  EXPECT_TRUE(sink.isAsync());
+
+  constexpr int nThreads = 4;
+  constexpr int nMessages = 500;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThreads; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < nMessages; ++i) {
+        LOG_FREE(Info, "async.channel", t << " " << i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Reading the messages waits for the buffered records to be written, each thread's records are in order
+  std::vector<LogMessage> logMessages = sink.logMessages();
+  ASSERT_EQ(static_cast<size_t>(nThreads * nMessages), logMessages.size());
+  std::vector<int> next(nThreads, 0);
+  for (const LogMessage& logMessage : logMessages) {
+    std::istringstream ss(logMessage.logMessage());
+    int t = -1;
+    int i = -1;
+    ss >> t >> i;
+    ASSERT_GE(t, 0);
+    ASSERT_LT(t, nThreads);
+    EXPECT_EQ(next[t], i);
+    next[t] = i + 1;
+  }
+  EXPECT_EQ(0u, sink.droppedRecords());
+
+  // Dropped records are counted, the others are written
+  sink.resetStringStream();
+  sink.setAsync(1, openstudio::LogOverflowPolicy::Drop);
+  for (int i = 0; i < nMessages; ++i) {
+    LOG_FREE(Info, "async.channel", "Drop " << i);
+  }
+  sink.flush();
+  EXPECT_EQ(static_cast<size_t>(nMessages), sink.logMessages().size() + sink.droppedRecords());
+
+  // Back to synchronous, records are written on the logging thread
+  sink.resetAsync();
+  EXPECT_FALSE(sink.isAsync());
+  EXPECT_EQ(0u, sink.droppedRecords());
+  sink.resetStringStream();
+  LOG_FREE(Info, "async.channel", "Sync");
+  ASSERT_EQ(1u, sink.logMessages().size());
+  EXPECT_EQ("Sync", sink.logMessages()[0].logMessage());
+
+  openstudio::Logger::instance().standardOutLogger().enable();
+}
+
+TEST(LoggerTest, async_sink_switch_while_logging) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Info);
+  sink.setChannelRegex(boost::regex("async\\.switch"));
+
+  // Other threads keep logging while the sink goes back and forth between synchronous and asynchronous: the buffered records of the
+  // previous asynchronous stream must be written before anything else writes to the string stream
+  constexpr int nThreads = 4;
+  constexpr int nMessages = 2000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThreads; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < nMessages; ++i) {
+        LOG_FREE(Info, "async.switch", t << " " << i);
+      }
+    });
+  }
+  for (int n = 0; n < 50; ++n) {
+    sink.setAsync(256, openstudio::LogOverflowPolicy::Block);
+    std::this_thread::yield();
+    sink.setAsync(512, openstudio::LogOverflowPolicy::Block);
+    std::this_thread::yield();
+    sink.resetAsync();
+    std::this_thread::yield();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(sink.isAsync());
+
+  std::vector<LogMessage> logMessages = sink.logMessages();
+  ASSERT_EQ(static_cast<size_t>(nThreads * nMessages), logMessages.size());
+  std::vector<int> next(nThreads, 0);
+  for (const LogMessage& logMessage : logMessages) {
+    std::istringstream ss(logMessage.logMessage());
+    int t = -1;
+    int i = -1;
+    ss >> t >> i;
+    ASSERT_GE(t, 0);
+    ASSERT_LT(t, nThreads);
+    EXPECT_EQ(next[t], i);
+    next[t] = i + 1;
+  }
+
+  openstudio::Logger::instance().standardOutLogger().enable();
+}
@@ -0,0 +1,38 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../ParallelFor.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(ParallelFor, AllIndicesVisitedOnce) {
+  for (unsigned numThreads : {0u, 1u, 3u, 64u}) {
+    std::vector<int> visits(1000, 0);
+    openstudio::parallelFor(
+      visits.size(), [&visits](std::size_t i) { visits[i] += static_cast<int>(i); }, numThreads);
+    std::vector<int> expected(1000);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(expected, visits) << "numThreads=" << numThreads;
+  }
+
+  // Nothing to do
+  openstudio::parallelFor(0, [](std::size_t) { FAIL(); });
+}
+
+TEST(ParallelFor, RethrowsException) {
+  EXPECT_THROW(openstudio::parallelFor(
+                 100,
+                 [](std::size_t i) {
+                   if (i == 42) {
+                     throw std::runtime_error("boom");
+                   }
+                 },
+                 4),
+               std::runtime_error);
+}
@@ -20,6 +20,8 @@
 
   // Ignore Json::Value return type (toJSON / fromJSON are globally ignored already)
   %ignore openstudio::StandardsJSON::getPrimaryKey;
+  %ignore openstudio::WorkflowJSON::telemetry;
+  %ignore openstudio::WorkflowJSON::setTelemetry;
 
   %ignore openstudio::CustomOutputAdapter::CustomOutputAdapter;
   %ignore openstudio::CustomOutputAdapter::optionsJSON;
@@ -199,6 +199,7 @@ namespace detail {
     m_value.removeMember("completed_at");
     m_value.removeMember("completed_status");
     m_value.removeMember("current_step");
+    m_value.removeMember("telemetry");
     onUpdate();
   }
 
@@ -306,6 +307,15 @@ namespace detail {
     onUpdate();
   }
 
+  Json::Value WorkflowJSON_Impl::telemetry() const {
+    return m_value.get("telemetry", Json::Value());
+  }
+
+  void WorkflowJSON_Impl::setTelemetry(const Json::Value& telemetry) {
+    m_value["telemetry"] = telemetry;
+    onUpdate();
+  }
+
   boost::optional<openstudio::path> WorkflowJSON_Impl::oswPath() const {
     if (m_oswFilename.empty() || m_oswDir.empty()) {
       return boost::none;
@@ -367,6 +377,12 @@ namespace detail {
     return result;
   }
 
+  bool WorkflowJSON_Impl::setRunDir(const openstudio::path& path) {
+    m_value["run_directory"] = toString(path);
+    onUpdate();
+    return true;
+  }
+
   openstudio::path WorkflowJSON_Impl::outPath() const {
     Json::Value defaultValue("out.osw");
     Json::Value path = m_value.get("out_name", defaultValue);
@@ -381,6 +397,12 @@ namespace detail {
     return result;
   }
 
+  bool WorkflowJSON_Impl::setOutPath(const openstudio::path& path) {
+    m_value["out_name"] = toString(path);
+    onUpdate();
+    return true;
+  }
+
   std::vector<openstudio::path> WorkflowJSON_Impl::filePaths() const {
     std::vector<openstudio::path> result;
 
@@ -1027,6 +1049,14 @@ void WorkflowJSON::setEplusoutErr(const std::string& eplusoutErr) {
   getImpl<detail::WorkflowJSON_Impl>()->setEplusoutErr(eplusoutErr);
 }
 
+Json::Value WorkflowJSON::telemetry() const {
+  return getImpl<detail::WorkflowJSON_Impl>()->telemetry();
+}
+
+void WorkflowJSON::setTelemetry(const Json::Value& telemetry) {
+  getImpl<detail::WorkflowJSON_Impl>()->setTelemetry(telemetry);
+}
+
 boost::optional<openstudio::path> WorkflowJSON::oswPath() const {
   return getImpl<detail::WorkflowJSON_Impl>()->oswPath();
 }
@@ -1059,6 +1089,10 @@ openstudio::path WorkflowJSON::absoluteRunDir() const {
   return getImpl<detail::WorkflowJSON_Impl>()->absoluteRunDir();
 }
 
+bool WorkflowJSON::setRunDir(const openstudio::path& path) {
+  return getImpl<detail::WorkflowJSON_Impl>()->setRunDir(path);
+}
+
 openstudio::path WorkflowJSON::outPath() const {
   return getImpl<detail::WorkflowJSON_Impl>()->outPath();
 }
@@ -1067,6 +1101,10 @@ openstudio::path WorkflowJSON::absoluteOutPath() const {
   return getImpl<detail::WorkflowJSON_Impl>()->absoluteOutPath();
 }
 
+bool WorkflowJSON::setOutPath(const openstudio::path& path) {
+  return getImpl<detail::WorkflowJSON_Impl>()->setOutPath(path);
+}
+
 std::vector<openstudio::path> WorkflowJSON::filePaths() const {
   return getImpl<detail::WorkflowJSON_Impl>()->filePaths();
 }
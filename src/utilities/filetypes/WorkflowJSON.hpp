@@ -122,6 +122,12 @@ class UTILITIES_API WorkflowJSON
   /** Sets the content of eplusout.err file. */
   void setEplusoutErr(const std::string& eplusoutErr);
 
+  /** Returns the resource usage telemetry recorded during the run (cf `openstudio run --telemetry`), null if none was recorded. */
+  Json::Value telemetry() const;
+
+  /** Sets the resource usage telemetry recorded during the run. */
+  void setTelemetry(const Json::Value& telemetry);
+
   /** Returns the absolute path this workflow was loaded from or saved to, empty for new WorkflowJSON. */
   boost::optional<openstudio::path> oswPath() const;
 
@@ -142,10 +148,16 @@ class UTILITIES_API WorkflowJSON
   openstudio::path runDir() const;
   openstudio::path absoluteRunDir() const;
 
+  /** Sets the run directory. */
+  bool setRunDir(const openstudio::path& path);
+
   /** Returns the path to write output OSW, default value is 'out.osw'. Evaluated relative to oswDir to ensure relative paths remain valid. */
   openstudio::path outPath() const;
   openstudio::path absoluteOutPath() const;
 
+  /** Sets the path to write output OSW. */
+  bool setOutPath(const openstudio::path& path);
+
   /** Returns the paths that will be searched in order for files, default value is './files/'. Evaluated relative to rootDir if not absolute. */
   std::vector<openstudio::path> filePaths() const;
   std::vector<openstudio::path> absoluteFilePaths() const;
@@ -79,6 +79,10 @@ namespace detail {
 
     void setEplusoutErr(const std::string& eplusoutErr);
 
+    Json::Value telemetry() const;
+
+    void setTelemetry(const Json::Value& telemetry);
+
     boost::optional<openstudio::path> oswPath() const;
 
     bool setOswPath(const openstudio::path& path, bool emitChange);
@@ -93,9 +97,13 @@ namespace detail {
     openstudio::path runDir() const;
     openstudio::path absoluteRunDir() const;
 
+    bool setRunDir(const openstudio::path& path);
+
     openstudio::path outPath() const;
     openstudio::path absoluteOutPath() const;
 
+    bool setOutPath(const openstudio::path& path);
+
     std::vector<openstudio::path> filePaths() const;
     std::vector<openstudio::path> absoluteFilePaths() const;
 
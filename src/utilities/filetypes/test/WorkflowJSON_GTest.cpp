@@ -1483,3 +1483,40 @@ TEST(Filetypes, WorkflowJSON_ValidateMeasures_WrongOrder) {
 
   EXPECT_EQ("OpenStudio measure 'FakeModelMeasure' called after Energyplus simulation.", sink.logMessages()[0].logMessage());
 }
+
+TEST(Filetypes, WorkflowJSON_SetRunDirAndOutPath) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/min.osw");
+  WorkflowJSON workflow(p);
+  EXPECT_EQ(toString(p.parent_path() / toPath("run")), toString(workflow.absoluteRunDir()));
+  EXPECT_EQ(toString(p.parent_path() / toPath("out.osw")), toString(workflow.absoluteOutPath()));
+
+  EXPECT_TRUE(workflow.setRunDir(toPath("run_min")));
+  EXPECT_EQ(toString(toPath("run_min")), toString(workflow.runDir()));
+  EXPECT_EQ(toString(p.parent_path() / toPath("run_min")), toString(workflow.absoluteRunDir()));
+
+  EXPECT_TRUE(workflow.setOutPath(toPath("min_out.osw")));
+  EXPECT_EQ(toString(toPath("min_out.osw")), toString(workflow.outPath()));
+  EXPECT_EQ(toString(p.parent_path() / toPath("min_out.osw")), toString(workflow.absoluteOutPath()));
+
+  WorkflowJSON roundTripped(workflow.string());
+  EXPECT_EQ(toString(workflow.runDir()), toString(roundTripped.runDir()));
+  EXPECT_EQ(toString(workflow.outPath()), toString(roundTripped.outPath()));
+}
+
+TEST(Filetypes, WorkflowJSON_Telemetry) {
+  WorkflowJSON workflow;
+  EXPECT_TRUE(workflow.telemetry().isNull());
+
+  Json::Value telemetry(Json::objectValue);
+  telemetry["elapsed"] = 1.5;
+  telemetry["spans"] = Json::Value(Json::arrayValue);
+  workflow.setTelemetry(telemetry);
+  EXPECT_EQ(telemetry, workflow.telemetry());
+
+  WorkflowJSON roundTripped(workflow.string());
+  EXPECT_EQ(telemetry, roundTripped.telemetry());
+
+  // Telemetry is about a given run
+  workflow.reset();
+  EXPECT_TRUE(workflow.telemetry().isNull());
+}
@@ -0,0 +1,64 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../TriangulationCache.hpp"
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+
+using namespace openstudio;
+
+TEST_F(GeometryFixture, TriangulationCache) {
+  // Clockwise rectangle on z = 0 plane, with a hole in the middle
+  const std::vector<Point3d> points{{0, 4, 0}, {4, 4, 0}, {4, 0, 0}, {0, 0, 0}};
+  const std::vector<std::vector<Point3d>> holes{{{1, 2, 0}, {2, 2, 0}, {2, 1, 0}, {1, 1, 0}}};
+
+  TriangulationCache cache;
+  const UUID handle = createUUID();
+
+  auto triangles = cache.triangulate(handle, points, holes);
+  EXPECT_EQ(computeTriangulation(points, holes), triangles);
+  EXPECT_EQ(0u, cache.hits());
+  EXPECT_EQ(1u, cache.misses());
+  EXPECT_TRUE(cache.contains(handle, points, holes));
+
+  // Same inputs: served from the cache
+  EXPECT_EQ(triangles, cache.triangulate(handle, points, holes));
+  EXPECT_EQ(1u, cache.hits());
+  EXPECT_EQ(1u, cache.misses());
+
+  // Removing the hole invalidates the entry
+  EXPECT_FALSE(cache.contains(handle, points, {}));
+  auto noHole = cache.triangulate(handle, points, {});
+  EXPECT_EQ(computeTriangulation(points, {}), noHole);
+  EXPECT_EQ(2u, cache.misses());
+  EXPECT_EQ(1u, cache.size());
+
+  // Batch, in parallel
+  std::vector<TriangulationInput> inputs;
+  for (int i = 0; i < 50; ++i) {
+    inputs.push_back(TriangulationInput{createUUID(), points, (i % 2 == 0) ? holes : std::vector<std::vector<Point3d>>{}});
+  }
+  cache.resetStatistics();
+  auto results = cache.triangulate(inputs, 4);
+  ASSERT_EQ(inputs.size(), results.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_EQ(computeTriangulation(inputs[i].vertices, inputs[i].holes), results[i]);
+  }
+  EXPECT_EQ(0u, cache.hits());
+  EXPECT_EQ(50u, cache.misses());
+  EXPECT_EQ(51u, cache.size());
+
+  results = cache.triangulate(inputs, 4);
+  EXPECT_EQ(50u, cache.hits());
+
+  cache.retain({handle});
+  EXPECT_EQ(1u, cache.size());
+
+  cache.clear();
+  EXPECT_EQ(0u, cache.size());
+}
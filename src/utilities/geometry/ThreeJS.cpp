@@ -763,6 +763,13 @@ ThreeUserData::ThreeUserData(const Json::Value& value) {
   }
 }
 
+std::string ThreeUserData::toJSON() const {
+  Json::StreamWriterBuilder wbuilder;
+  wbuilder["commentStyle"] = "None";
+  wbuilder["indentation"] = "";
+  return Json::writeString(wbuilder, toJsonValue());
+}
+
 Json::Value ThreeUserData::toJsonValue() const {
   Json::Value result(Json::objectValue);
 
@@ -308,6 +308,9 @@ class UTILITIES_API ThreeUserData
   bool correctlyOriented() const;
   void setCorrectlyOriented(bool b);
 
+  /// compact JSON representation, as it appears in the scene
+  std::string toJSON() const;
+
  private:
   friend class ThreeSceneChild;
   ThreeUserData(const Json::Value& value);
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "TriangulationCache.hpp"
+#include "Geometry.hpp"
+
+#include "../core/ParallelFor.hpp"
+
+#include <mutex>
+
+namespace openstudio {
+
+std::size_t TriangulationCache::checksum(const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d>>& holes) {
+  std::size_t seed = 0;
+  const auto hashPoints = [&seed](const std::vector<Point3d>& points) {
+    boost::hash_combine(seed, points.size());
+    for (const auto& point : points) {
+      boost::hash_combine(seed, point.x());
+      boost::hash_combine(seed, point.y());
+      boost::hash_combine(seed, point.z());
+    }
+  };
+  hashPoints(vertices);
+  boost::hash_combine(seed, holes.size());
+  for (const auto& hole : holes) {
+    hashPoints(hole);
+  }
+  return seed;
+}
+
+bool TriangulationCache::lookup(const UUID& handle, std::size_t checksum, std::vector<std::vector<Point3d>>& triangles) const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  auto it = m_entries.find(handle);
+  if (it == m_entries.end() || it->second.checksum != checksum) {
+    return false;
+  }
+  triangles = it->second.triangles;
+  return true;
+}
+
+void TriangulationCache::store(const UUID& handle, std::size_t checksum, const std::vector<std::vector<Point3d>>& triangles) {
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  m_entries[handle] = Entry{checksum, triangles};
+}
+
+std::vector<std::vector<Point3d>> TriangulationCache::triangulate(const UUID& handle, const std::vector<Point3d>& vertices,
+                                                                  const std::vector<std::vector<Point3d>>& holes) {
+  const std::size_t inputChecksum = checksum(vertices, holes);
+
+  std::vector<std::vector<Point3d>> result;
+  if (lookup(handle, inputChecksum, result)) {
+    ++m_hits;
+    return result;
+  }
+
+  ++m_misses;
+  result = computeTriangulation(vertices, holes);
+  store(handle, inputChecksum, result);
+  return result;
+}
+
+std::vector<std::vector<std::vector<Point3d>>> TriangulationCache::triangulate(const std::vector<TriangulationInput>& inputs, unsigned numThreads) {
+  std::vector<std::vector<std::vector<Point3d>>> result(inputs.size());
+  parallelFor(
+    inputs.size(), [this, &inputs, &result](std::size_t i) { result[i] = triangulate(inputs[i].handle, inputs[i].vertices, inputs[i].holes); },
+    numThreads);
+  return result;
+}
+
+bool TriangulationCache::contains(const UUID& handle, const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d>>& holes) const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  auto it = m_entries.find(handle);
+  return (it != m_entries.end()) && (it->second.checksum == checksum(vertices, holes));
+}
+
+void TriangulationCache::retain(const std::set<UUID>& handles) {
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    if (handles.find(it->first) == handles.end()) {
+      it = m_entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void TriangulationCache::clear() {
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+std::size_t TriangulationCache::size() const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+std::size_t TriangulationCache::hits() const {
+  return m_hits;
+}
+
+std::size_t TriangulationCache::misses() const {
+  return m_misses;
+}
+
+void TriangulationCache::resetStatistics() {
+  m_hits = 0;
+  m_misses = 0;
+}
+
+}  // namespace openstudio
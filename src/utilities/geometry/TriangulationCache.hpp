@@ -0,0 +1,84 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_TRIANGULATIONCACHE_HPP
+#define UTILITIES_GEOMETRY_TRIANGULATIONCACHE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Point3d.hpp"
+#include "../core/UUID.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio {
+
+/** Inputs to computeTriangulation for one planar surface: the face vertices and the holes (sub surfaces), already in face coordinates */
+struct UTILITIES_API TriangulationInput
+{
+  UUID handle;
+  std::vector<Point3d> vertices;
+  std::vector<std::vector<Point3d>> holes;
+};
+
+/** TriangulationCache memoizes computeTriangulation per surface handle. An entry is reused as long as the checksum of its
+ *  inputs (vertices and holes) is unchanged, so regenerating a scene after a small model edit only re-triangulates the edited surfaces.
+ *  All methods are thread safe. */
+class UTILITIES_API TriangulationCache
+{
+ public:
+  /** Returns the triangulation of vertices with holes, computing it only if the inputs changed since the last call for this handle.
+   *  Like computeTriangulation, returns an empty vector if the triangulation failed (failures are cached too) */
+  std::vector<std::vector<Point3d>> triangulate(const UUID& handle, const std::vector<Point3d>& vertices,
+                                                const std::vector<std::vector<Point3d>>& holes);
+
+  /** Triangulates all inputs, cache misses are computed in parallel on up to numThreads threads (0 = one per hardware thread).
+   *  Results are in the same order as inputs */
+  std::vector<std::vector<std::vector<Point3d>>> triangulate(const std::vector<TriangulationInput>& inputs, unsigned numThreads = 0);
+
+  /** Returns true if the cache holds an up to date entry for this handle and inputs */
+  bool contains(const UUID& handle, const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d>>& holes) const;
+
+  /** Drop entries for handles that are not in handles (eg: deleted surfaces) */
+  void retain(const std::set<UUID>& handles);
+
+  void clear();
+
+  std::size_t size() const;
+
+  /** Number of triangulate requests served from the cache / computed since construction or resetStatistics */
+  std::size_t hits() const;
+  std::size_t misses() const;
+  void resetStatistics();
+
+  /** Checksum of the triangulation inputs */
+  static std::size_t checksum(const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d>>& holes);
+
+ private:
+  struct Entry
+  {
+    std::size_t checksum;
+    std::vector<std::vector<Point3d>> triangles;
+  };
+
+  bool lookup(const UUID& handle, std::size_t checksum, std::vector<std::vector<Point3d>>& triangles) const;
+  void store(const UUID& handle, std::size_t checksum, const std::vector<std::vector<Point3d>>& triangles);
+
+  mutable std::shared_mutex m_mutex;
+  std::unordered_map<UUID, Entry, boost::hash<boost::uuids::uuid>> m_entries;
+  std::atomic<std::size_t> m_hits{0};
+  std::atomic<std::size_t> m_misses{0};
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_GEOMETRY_TRIANGULATIONCACHE_HPP
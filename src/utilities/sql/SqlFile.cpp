@@ -30,6 +30,16 @@ SqlFile::SqlFile(const openstudio::path& t_path, const openstudio::EpwFile& t_ep
   }
 }
 
+SqlFile SqlFile::openReadOnly(const openstudio::path& path, const bool inMemoryIndexes) {
+  SqlFile result;
+  try {
+    result.m_impl = std::make_shared<detail::SqlFile_Impl>(path, inMemoryIndexes, true);
+  } catch (const std::exception& e) {
+    LOG(Error, "Could not open SqlFile in read-only mode for path '" << openstudio::toString(path) << "' error:" << e.what());
+  }
+  return result;
+}
+
 void SqlFile::createIndexes() {
   if (m_impl) {
     m_impl->createIndexes();
@@ -50,6 +60,14 @@ bool SqlFile::connectionOpen() const {
   return result;
 }
 
+bool SqlFile::isReadOnly() const {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->isReadOnly();
+  }
+  return result;
+}
+
 openstudio::path SqlFile::path() const {
   openstudio::path result;
   if (m_impl) {
@@ -198,6 +216,30 @@ boost::optional<double> SqlFile::peakEnergyDemandByMonth(const openstudio::EndUs
   }
 }
 
+Matrix SqlFile::endUseValues() const {
+  if (m_impl) {
+    return m_impl->endUseValues();
+  } else {
+    return {};
+  }
+}
+
+std::vector<Matrix> SqlFile::energyConsumptionByMonth() const {
+  if (m_impl) {
+    return m_impl->energyConsumptionByMonth();
+  } else {
+    return {};
+  }
+}
+
+std::vector<Matrix> SqlFile::peakEnergyDemandByMonth() const {
+  if (m_impl) {
+    return m_impl->peakEnergyDemandByMonth();
+  } else {
+    return {};
+  }
+}
+
 boost::optional<double> SqlFile::electricityHeating() const {
   if (m_impl) {
     return m_impl->electricityHeating();
@@ -2495,4 +2537,22 @@ boost::optional<double> SqlFile::assemblyVisibleTransmittance(const std::string&
   return result;
 }
 
+boost::optional<double> SqlFile::tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                                  const std::string& rowName, const std::string& columnName, const std::string& units) const {
+  boost::optional<double> result;
+  if (m_impl) {
+    result = m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<double> SqlFile::tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                                  const std::string& rowName, const std::string& columnName) const {
+  boost::optional<double> result;
+  if (m_impl) {
+    result = m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName);
+  }
+  return result;
+}
+
 }  // namespace openstudio
@@ -60,6 +60,11 @@ class UTILITIES_API SqlFile
   SqlFile(const openstudio::path& t_path, const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime,
           const openstudio::Calendar& t_calendar, const bool createIndexes = true);
 
+  /// opens an existing sql file in read-only mode: the file is never written to nor locked for writing, so it can be read from a read-only
+  /// location and by several processes at once. The file is memory mapped and read through a larger page cache.
+  /// Indexes cannot be added to the file, if inMemoryIndexes is true the database is copied to memory and the indexes are created on that copy
+  static SqlFile openReadOnly(const openstudio::path& path, const bool inMemoryIndexes = false);
+
   // virtual destructor
   virtual ~SqlFile() = default;
 
@@ -76,6 +81,9 @@ class UTILITIES_API SqlFile
   /// returns whether or not connection is open
   bool connectionOpen() const;
 
+  /// returns whether the file was opened with openReadOnly
+  bool isReadOnly() const;
+
   /// get the path
   openstudio::path path() const;
 
@@ -100,6 +108,16 @@ class UTILITIES_API SqlFile
   // return an Assembly Visible Transmittance value for matching subSurfaceName (RowName)
   boost::optional<double> assemblyVisibleTransmittance(const std::string& subSurfaceName) const;
 
+  // return the first Value of the TabularDataWithStrings view matching all arguments, same as
+  // "SELECT Value FROM TabularDataWithStrings WHERE ReportName=? AND ReportForString=? AND TableName=? AND RowName=? AND ColumnName=? AND Units=?"
+  // The view is read once on first use and indexed in memory, so subsequent lookups do not query the database
+  boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                           const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+  // same as above, for any Units
+  boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                           const std::string& rowName, const std::string& columnName) const;
+
   /// close the file
   bool close();
 
@@ -163,6 +181,19 @@ class UTILITIES_API SqlFile
   boost::optional<double> peakEnergyDemandByMonth(const openstudio::EndUseFuelType& t_fuelType, const openstudio::EndUseCategoryType& t_categoryType,
                                                   const openstudio::MonthOfYear& t_monthOfYear) const;
 
+  /// Returns the whole End Uses table of the AnnualBuildingUtilityPerformanceSummary report, read in a single query.
+  /// Element (i, j) is the value for EndUseFuelType(i) and EndUseCategoryType(j), in the units of EndUses::getUnitsForFuelType.
+  /// Cells that are not reported are NaN.
+  Matrix endUseValues() const;
+
+  /// Returns the energy consumption of all fuel types, categories and months, read in a single query.
+  /// Element [m](i, j) is the value for month m + 1, EndUseFuelType(i) and EndUseCategoryType(j), in J. Cells that are not reported are NaN.
+  std::vector<Matrix> energyConsumptionByMonth() const;
+
+  /// Returns the energy demand of all fuel types, categories and months, read in a single query.
+  /// Element [m](i, j) is the value for month m + 1, EndUseFuelType(i) and EndUseCategoryType(j), in W. Cells that are not reported are NaN.
+  std::vector<Matrix> peakEnergyDemandByMonth() const;
+
   /// Returns the electric energy used for heating in gigajoules.
   /// Requires EnergyPlus simulation output to calculate.
   boost::optional<double> electricityHeating() const;
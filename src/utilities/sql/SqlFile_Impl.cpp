@@ -18,6 +18,12 @@
 
 #include <sqlite3.h>
 
+#include <boost/functional/hash.hpp>
+
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -37,18 +43,21 @@ namespace detail {
     return {reinterpret_cast<const char*>(column)};
   }
 
-  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
+  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes, const bool readOnly)
     : m_path(path),
       m_connectionOpen(false),
       m_supportedVersion(false),
       m_hasYear(true),
       m_hasIlluminanceMapYear(true),
-      m_illuminanceMapHasOnly2RefPts(false) {
+      m_illuminanceMapHasOnly2RefPts(false),
+      m_readOnly(readOnly),
+      m_inMemoryIndexes(readOnly && createIndexes) {
     if (openstudio::filesystem::exists(m_path)) {
       m_path = openstudio::filesystem::canonical(m_path);
     }
     reopen();
-    if (createIndexes) {
+    // In read-only mode, the indexes are created by init on the in-memory copy
+    if (createIndexes && !m_readOnly) {
       this->createIndexes();
     }
   }
@@ -230,6 +239,10 @@ namespace detail {
   }
 
   void SqlFile_Impl::removeIndexes() {
+    if (m_readOnly) {
+      LOG(Warn, "Cannot remove indexes from '" << toString(m_path) << "', it was opened in read-only mode");
+      return;
+    }
     if (m_connectionOpen) {
       try {
         execAndThrowOnError("DROP INDEX IF EXISTS rddMTR;");
@@ -270,6 +283,10 @@ namespace detail {
   }
 
   void SqlFile_Impl::createIndexes() {
+    if (m_readOnly && !m_inMemoryIndexes) {
+      LOG(Warn, "Cannot create indexes in '" << toString(m_path) << "', it was opened in read-only mode");
+      return;
+    }
     if (m_connectionOpen) {
       try {
         execAndThrowOnError("CREATE INDEX IF NOT EXISTS rddMTR ON ReportDataDictionary (IsMeter);");
@@ -314,6 +331,7 @@ namespace detail {
   }
 
   void SqlFile_Impl::execAndThrowOnError(const std::string& t_stmt) {
+    clearTabularDataCache();
     char* err = nullptr;
     if (sqlite3_exec(m_db, t_stmt.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
       std::string errstr;
@@ -406,6 +424,10 @@ namespace detail {
     return m_connectionOpen;
   }
 
+  bool SqlFile_Impl::isReadOnly() const {
+    return m_readOnly;
+  }
+
   int SqlFile_Impl::getNextIndex(const std::string& t_tableName, const std::string& t_columnName) {
     // Interestingly, you CANNOT bind any database identifier (such as the table name / column name) but only litteral values...
     // boost::optional<int> maxindex = execAndReturnFirstInt("SELECT MAX( ? ) FROM ?", t_columnName, t_tableName);
@@ -424,6 +446,7 @@ namespace detail {
   }
 
   bool SqlFile_Impl::close() {
+    clearTabularDataCache();
     if (m_connectionOpen) {
       sqlite3_close(m_db);
       m_connectionOpen = false;
@@ -447,7 +470,8 @@ namespace detail {
     m_sqliteFilename = toString(m_path.make_preferred().native());
     std::string fileName = m_sqliteFilename;
 
-    int code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+    const int flags = m_readOnly ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE);
+    int code = sqlite3_open_v2(fileName.c_str(), &m_db, flags, nullptr);
 
     m_connectionOpen = (code == 0);
     if (m_connectionOpen) {  // create index on dictionaryIndex for large table reportvariabledata
@@ -462,6 +486,10 @@ namespace detail {
       // set locking mode to exclusive
       //code = sqlite3_exec(m_db, "PRAGMA locking_mode=EXCLUSIVE", NULL, NULL, NULL);
 
+      if (m_readOnly) {
+        initReadOnly();
+      }
+
       // retrieve DataDictionaryTable
       retrieveDataDictionary();
     } else {
@@ -469,6 +497,40 @@ namespace detail {
     }
   }
 
+  void SqlFile_Impl::initReadOnly() {
+    if (m_inMemoryIndexes) {
+      // Indexes cannot be added to the file: copy the database to memory, and add them to the copy
+      sqlite3* memoryDb = nullptr;
+      int code = sqlite3_open_v2(":memory:", &memoryDb, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr);
+      if (code == SQLITE_OK) {
+        sqlite3_backup* backup = sqlite3_backup_init(memoryDb, "main", m_db, "main");
+        if (backup) {
+          sqlite3_backup_step(backup, -1);
+          sqlite3_backup_finish(backup);
+        }
+        code = sqlite3_errcode(memoryDb);
+      }
+
+      if (code == SQLITE_OK) {
+        sqlite3_close(m_db);
+        m_db = memoryDb;
+        createIndexes();
+      } else {
+        LOG(Warn, "Could not copy '" << toString(m_path) << "' to memory, it will be read without indexes: " << sqlite3_errmsg(memoryDb));
+        sqlite3_close(memoryDb);
+      }
+    }
+
+    // Map the file in memory (no-op for the in-memory copy) and use a larger page cache, so concurrent readers share the OS page cache
+    const auto fileSize = openstudio::filesystem::file_size(m_path);
+    execAndThrowOnError("PRAGMA mmap_size=" + std::to_string(fileSize) + ";");
+    execAndThrowOnError("PRAGMA cache_size=-65536;");  // 64 MiB
+    execAndThrowOnError("PRAGMA temp_store=MEMORY;");
+
+    // Any statement that would write to the database now fails
+    execAndThrowOnError("PRAGMA query_only=ON;");
+  }
+
   bool SqlFile_Impl::isSupportedVersion() const {
     return m_supportedVersion;
   }
@@ -500,18 +562,111 @@ namespace detail {
     // in the sql file
     std::string queryRowName = boost::to_upper_copy(subSurfaceName);
 
-    std::string s = R"(SELECT Value FROM TabularDataWithStrings
-                          WHERE ReportName='EnvelopeSummary'
-                          AND ReportForString='Entire Facility'
-                          AND TableName='Exterior Fenestration'
-                          AND RowName=?
-                          AND ColumnName=?)";
-
-    result = execAndReturnFirstDouble(s, queryRowName, columnName);
+    result = tabularDataValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", queryRowName, columnName);
 
     return result;
   }
 
+  struct SqlFile_Impl::TabularDataCache
+  {
+    struct Key
+    {
+      std::string reportName;
+      std::string reportForString;
+      std::string tableName;
+      std::string rowName;
+      std::string columnName;
+
+      bool operator==(const Key& other) const = default;
+    };
+
+    struct KeyHash
+    {
+      size_t operator()(const Key& key) const {
+        size_t seed = 0;
+        boost::hash_combine(seed, key.reportName);
+        boost::hash_combine(seed, key.reportForString);
+        boost::hash_combine(seed, key.tableName);
+        boost::hash_combine(seed, key.rowName);
+        boost::hash_combine(seed, key.columnName);
+        return seed;
+      }
+    };
+
+    struct Entry
+    {
+      std::string units;
+      double value;
+    };
+
+    // Entries for a given key are in TabularDataIndex order, so the first match is the row the equivalent query returns
+    std::unordered_map<Key, std::vector<Entry>, KeyHash> entries;
+  };
+
+  const SqlFile_Impl::TabularDataCache& SqlFile_Impl::tabularDataCache() const {
+    if (m_tabularDataCache) {
+      return *m_tabularDataCache;
+    }
+
+    m_tabularDataCache = std::make_unique<TabularDataCache>();
+
+    if (m_db) {
+      // Join TabularData to Strings once for the whole table, rather than once per accessor through the TabularDataWithStrings view
+      const std::string stmt = "SELECT ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value "
+                               "FROM TabularDataWithStrings ORDER BY TabularDataIndex";
+
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      if (sqlite3_prepare_v2(m_db, stmt.c_str(), -1, &sqlStmtPtr, nullptr) == SQLITE_OK) {
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+          TabularDataCache::Key key{columnText(sqlite3_column_text(sqlStmtPtr, 0)), columnText(sqlite3_column_text(sqlStmtPtr, 1)),
+                                    columnText(sqlite3_column_text(sqlStmtPtr, 2)), columnText(sqlite3_column_text(sqlStmtPtr, 3)),
+                                    columnText(sqlite3_column_text(sqlStmtPtr, 4))};
+          // sqlite3_column_double performs the same conversion of the TEXT Value as execAndReturnFirstDouble
+          m_tabularDataCache->entries[std::move(key)].push_back(
+            TabularDataCache::Entry{columnText(sqlite3_column_text(sqlStmtPtr, 5)), sqlite3_column_double(sqlStmtPtr, 6)});
+        }
+      } else {
+        LOG(Warn, "Could not read the TabularDataWithStrings view: " << sqlite3_errmsg(m_db));
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    return *m_tabularDataCache;
+  }
+
+  void SqlFile_Impl::clearTabularDataCache() const {
+    m_tabularDataCache.reset();
+    m_endUseValues.reset();
+    m_energyConsumptionByMonth.reset();
+    m_peakEnergyDemandByMonth.reset();
+  }
+
+  boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                         const std::string& tableName, const std::string& rowName, const std::string& columnName,
+                                                         const std::string& units) const {
+    const auto& entries = tabularDataCache().entries;
+    auto it = entries.find(TabularDataCache::Key{reportName, reportForString, tableName, rowName, columnName});
+    if (it != entries.end()) {
+      for (const auto& entry : it->second) {
+        if (entry.units == units) {
+          return entry.value;
+        }
+      }
+    }
+    return boost::none;
+  }
+
+  boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                         const std::string& tableName, const std::string& rowName,
+                                                         const std::string& columnName) const {
+    const auto& entries = tabularDataCache().entries;
+    auto it = entries.find(TabularDataCache::Key{reportName, reportForString, tableName, rowName, columnName});
+    if (it != entries.end() && !it->second.empty()) {
+      return it->second.front().value;
+    }
+    return boost::none;
+  }
+
   bool SqlFile_Impl::isValidConnection() {
     std::string energyPlusVersion = this->energyPlusVersion();
     if (energyPlusVersion.empty()) {
@@ -880,42 +1035,162 @@ namespace detail {
   boost::optional<double> SqlFile_Impl::energyConsumptionByMonth(const openstudio::EndUseFuelType& t_fuelType,
                                                                  const openstudio::EndUseCategoryType& t_categoryType,
                                                                  const openstudio::MonthOfYear& t_monthOfYear) const {
+    const int month = t_monthOfYear.value();
+    if (month < MonthOfYear::Jan || month > MonthOfYear::Dec) {
+      return boost::none;
+    }
+    if (!m_energyConsumptionByMonth) {
+      m_energyConsumptionByMonth = buildingEnergyPerformanceByMonth(false);
+    }
+    const double value = (*m_energyConsumptionByMonth)[month - 1](t_fuelType.value(), t_categoryType.value());
+    if (std::isnan(value)) {
+      return boost::none;
+    }
+    return value;
+  }
+
+  boost::optional<double> SqlFile_Impl::peakEnergyDemandByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                                const openstudio::EndUseCategoryType& t_categoryType,
+                                                                const openstudio::MonthOfYear& t_monthOfYear) const {
+    const int month = t_monthOfYear.value();
+    if (month < MonthOfYear::Jan || month > MonthOfYear::Dec) {
+      return boost::none;
+    }
+    if (!m_peakEnergyDemandByMonth) {
+      m_peakEnergyDemandByMonth = buildingEnergyPerformanceByMonth(true);
+    }
+    const double value = (*m_peakEnergyDemandByMonth)[month - 1](t_fuelType.value(), t_categoryType.value());
+    if (std::isnan(value)) {
+      return boost::none;
+    }
+    return value;
+  }
+
+  std::vector<Matrix> SqlFile_Impl::energyConsumptionByMonth() const {
+    if (!m_energyConsumptionByMonth) {
+      m_energyConsumptionByMonth = buildingEnergyPerformanceByMonth(false);
+    }
+    return *m_energyConsumptionByMonth;
+  }
+
+  std::vector<Matrix> SqlFile_Impl::peakEnergyDemandByMonth() const {
+    if (!m_peakEnergyDemandByMonth) {
+      m_peakEnergyDemandByMonth = buildingEnergyPerformanceByMonth(true);
+    }
+    return *m_peakEnergyDemandByMonth;
+  }
+
+  std::vector<Matrix> SqlFile_Impl::buildingEnergyPerformanceByMonth(bool peakDemand) const {
+    const std::vector<EndUseFuelType> fuelTypes = EndUses::fuelTypes();
+    const std::vector<EndUseCategoryType> categories = EndUses::categories();
+
+    std::vector<Matrix> result(12, Matrix(fuelTypes.size(), categories.size(), std::numeric_limits<double>::quiet_NaN()));
+
+    if (!m_db) {
+      return result;
+    }
+
     // For backward compatibilty, we had to preserve enum valueNames (first param in enum, ((valueName)(valueDescription))
-    // You need to be careful about what you are passing here... valueName or valueDescription
-    const std::string reportName = "BUILDING ENERGY PERFORMANCE - " + boost::algorithm::to_upper_copy(t_fuelType.valueDescription());
     // So this gets tricky, but we have ((Gas)(Natural Gas)). We didn't want to change to ((NaturalGas)(Natural Gas))
-    // So here we take valueDescription ('Natural Gas', then remove the spaces to be NaturalGas)
-    const std::string columnName = boost::algorithm::to_upper_copy(t_categoryType.valueName()) + ":"
-                                   + boost::algorithm::to_upper_copy(boost::algorithm::erase_all_copy(t_fuelType.valueDescription(), " "));
-    const std::string rowName = t_monthOfYear.valueDescription();
+    // So the column names use the valueDescription ('Natural Gas', then remove the spaces to be NaturalGas)
+    std::map<std::string, int> reportNameToFuelType;
+    std::map<std::string, std::pair<int, int>> columnNameToCell;
+    for (const EndUseFuelType& fuelType : fuelTypes) {
+      reportNameToFuelType[std::string("BUILDING ENERGY PERFORMANCE - ") + boost::algorithm::to_upper_copy(fuelType.valueDescription())
+                           + (peakDemand ? " PEAK DEMAND" : "")] = fuelType.value();
+      for (const EndUseCategoryType& category : categories) {
+        const std::string columnName = boost::algorithm::to_upper_copy(category.valueName()) + ":"
+                                       + boost::algorithm::to_upper_copy(boost::algorithm::erase_all_copy(fuelType.valueDescription(), " "))
+                                       + (peakDemand ? " {AT MAX/MIN}" : "");
+        columnNameToCell[columnName] = std::make_pair(fuelType.value(), category.value());
+      }
+    }
+    std::map<std::string, int> rowNameToMonth;
+    for (int month = MonthOfYear::Jan; month <= MonthOfYear::Dec; ++month) {
+      rowNameToMonth[MonthOfYear(month).valueDescription()] = month;
+    }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName=?
+    const std::string stmt = R"(SELECT ReportName, RowName, ColumnName, Value FROM TabularDataWithStrings
+                                  WHERE ReportName LIKE 'BUILDING ENERGY PERFORMANCE - %'
                                   AND ReportForString='Meter'
-                                  AND RowName=?
-                                  AND ColumnName=?
-                                  AND Units='J')";
+                                  AND Units=?
+                                  ORDER BY TabularDataIndex)";
+    const std::string units = peakDemand ? "W" : "J";
+
+    sqlite3_stmt* sqlStmtPtr = nullptr;
+    if (sqlite3_prepare_v2(m_db, stmt.c_str(), -1, &sqlStmtPtr, nullptr) == SQLITE_OK) {
+      sqlite3_bind_text(sqlStmtPtr, 1, units.c_str(), static_cast<int>(units.size()), SQLITE_TRANSIENT);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        auto fuelIt = reportNameToFuelType.find(columnText(sqlite3_column_text(sqlStmtPtr, 0)));
+        auto monthIt = rowNameToMonth.find(columnText(sqlite3_column_text(sqlStmtPtr, 1)));
+        auto cellIt = columnNameToCell.find(columnText(sqlite3_column_text(sqlStmtPtr, 2)));
+        if ((fuelIt == reportNameToFuelType.end()) || (monthIt == rowNameToMonth.end()) || (cellIt == columnNameToCell.end())
+            || (cellIt->second.first != fuelIt->second)) {
+          continue;
+        }
+        // Keep the first match, like execAndReturnFirstDouble would
+        double& value = result[monthIt->second - 1](cellIt->second.first, cellIt->second.second);
+        if (std::isnan(value)) {
+          value = sqlite3_column_double(sqlStmtPtr, 3);
+        }
+      }
+    } else {
+      LOG(Warn, "Could not read the BUILDING ENERGY PERFORMANCE reports: " << sqlite3_errmsg(m_db));
+    }
+    sqlite3_finalize(sqlStmtPtr);
 
-    return execAndReturnFirstDouble(s, reportName, rowName, columnName);
+    return result;
   }
 
-  boost::optional<double> SqlFile_Impl::peakEnergyDemandByMonth(const openstudio::EndUseFuelType& t_fuelType,
-                                                                const openstudio::EndUseCategoryType& t_categoryType,
-                                                                const openstudio::MonthOfYear& t_monthOfYear) const {
-    const std::string reportName = "BUILDING ENERGY PERFORMANCE - " + boost::algorithm::to_upper_copy(t_fuelType.valueDescription()) + " PEAK DEMAND";
-    const std::string columnName = boost::algorithm::to_upper_copy(t_categoryType.valueName()) + ":"
-                                   + boost::algorithm::to_upper_copy(boost::algorithm::erase_all_copy(t_fuelType.valueDescription(), " "))
-                                   + " {AT MAX/MIN}";
-    const std::string rowName = t_monthOfYear.valueDescription();
+  Matrix SqlFile_Impl::endUseValues() const {
+    if (m_endUseValues) {
+      return *m_endUseValues;
+    }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName=?
-                                  AND ReportForString='Meter'
-                                  AND RowName=?
-                                  AND ColumnName=?
-                                  AND Units='W')";
+    const std::vector<EndUseFuelType> fuelTypes = EndUses::fuelTypes();
+    const std::vector<EndUseCategoryType> categories = EndUses::categories();
+
+    m_endUseValues = Matrix(fuelTypes.size(), categories.size(), std::numeric_limits<double>::quiet_NaN());
+
+    if (!m_db) {
+      return *m_endUseValues;
+    }
+
+    std::map<std::string, std::pair<int, std::string>> columnNameToFuelTypeAndUnits;
+    for (const EndUseFuelType& fuelType : fuelTypes) {
+      columnNameToFuelTypeAndUnits[fuelType.valueDescription()] = std::make_pair(fuelType.value(), EndUses::getUnitsForFuelType(fuelType));
+    }
+    std::map<std::string, int> rowNameToCategory;
+    for (const EndUseCategoryType& category : categories) {
+      rowNameToCategory[category.valueDescription()] = category.value();
+    }
+
+    const std::string stmt = R"(SELECT RowName, ColumnName, Units, Value FROM TabularDataWithStrings
+                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
+                                  AND ReportForString='Entire Facility'
+                                  AND TableName='End Uses'
+                                  ORDER BY TabularDataIndex)";
+
+    sqlite3_stmt* sqlStmtPtr = nullptr;
+    if (sqlite3_prepare_v2(m_db, stmt.c_str(), -1, &sqlStmtPtr, nullptr) == SQLITE_OK) {
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        auto categoryIt = rowNameToCategory.find(columnText(sqlite3_column_text(sqlStmtPtr, 0)));
+        auto fuelTypeIt = columnNameToFuelTypeAndUnits.find(columnText(sqlite3_column_text(sqlStmtPtr, 1)));
+        if ((categoryIt == rowNameToCategory.end()) || (fuelTypeIt == columnNameToFuelTypeAndUnits.end())
+            || (fuelTypeIt->second.second != columnText(sqlite3_column_text(sqlStmtPtr, 2)))) {
+          continue;
+        }
+        double& value = (*m_endUseValues)(fuelTypeIt->second.first, categoryIt->second);
+        if (std::isnan(value)) {
+          value = sqlite3_column_double(sqlStmtPtr, 3);
+        }
+      }
+    } else {
+      LOG(Warn, "Could not read the End Uses table: " << sqlite3_errmsg(m_db));
+    }
+    sqlite3_finalize(sqlStmtPtr);
 
-    return execAndReturnFirstDouble(s, reportName, rowName, columnName);
+    return *m_endUseValues;
   }
 
   /// hours simulated
@@ -948,14 +1223,8 @@ namespace detail {
       LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
     }
 
-    std::string s = R"(SELECT Value FROM TabularDataWithStrings
-                           WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                           AND ReportForString='Entire Facility'
-                           AND TableName='Site and Source Energy'
-                           AND RowName='Net Site Energy'
-                           AND ColumnName='Total Energy'
-                           AND Units='GJ')";
-    boost::optional<double> d = execAndReturnFirstDouble(s);
+    boost::optional<double> d = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy",
+                                                 "Net Site Energy", "Total Energy", "GJ");
 
     if (!d) {
       LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -978,14 +1247,8 @@ namespace detail {
       LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
     }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Net Source Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-    return execAndReturnFirstDouble(s);
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Source Energy",
+                            "Total Energy", "GJ");
   }
 
   boost::optional<double> SqlFile_Impl::totalSiteEnergy() const {
@@ -996,14 +1259,8 @@ namespace detail {
       LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
     }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Total Site Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-    return execAndReturnFirstDouble(s);
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy",
+                            "Total Energy", "GJ");
   }
 
   boost::optional<double> SqlFile_Impl::totalSourceEnergy() const {
@@ -1014,25 +1271,24 @@ namespace detail {
       LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
     }
 
-    const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Total Source Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-    return execAndReturnFirstDouble(s);
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Source Energy",
+                            "Total Energy", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::annualTotalCost(const FuelType& fuel) const {
+    // Either a 'Cost' row in '~~$~~' or a 'Cost (~~$~~)' row, depending on the EnergyPlus version
+    auto annualCostValue = [this](const std::string& columnName) -> OptionalDouble {
+      OptionalDouble result = tabularDataValue("Economics Results Summary Report", "Entire Facility", "Annual Cost", "Cost", columnName, "~~$~~");
+      if (result) {
+        return result;
+      }
+      return tabularDataValue("Economics Results Summary Report", "Entire Facility", "Annual Cost", "Cost (~~$~~)", columnName);
+    };
+
     if (fuel == FuelType::Electricity) {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'Economics Results Summary Report') and "
-                                      "(ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electricity') and "
-                                      "(((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+      return annualCostValue("Electricity");
     } else if (fuel == FuelType::Gas) {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'Economics Results Summary Report') and "
-                                      "(ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Natural Gas') and "
-                                      "(((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+      return annualCostValue("Natural Gas");
     } else {
       // E+ lumps all other fuel types under "Other," so we are forced to use the meters table instead.
       // This is fragile if there are custom submeters, but this is the only option
@@ -1053,9 +1309,8 @@ namespace detail {
 
   OptionalDouble SqlFile_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const {
     // Get the total building area
-    boost::optional<double> totalBuildingArea = execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Total Building Area') and (Units = 'm2')");
+    boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area",
+                                                                 "Total Building Area", "Area", "m2");
 
     // Get the annual energy cost
     boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1071,9 +1326,8 @@ namespace detail {
 
   OptionalDouble SqlFile_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const {
     // Get the total building area
-    boost::optional<double> totalBuildingArea = execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Net Conditioned Building Area') and (Units = 'm2')");
+    boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area",
+                                                                 "Net Conditioned Building Area", "Area", "m2");
 
     // Get the annual energy cost
     boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1261,1013 +1515,687 @@ namespace detail {
   boost::optional<EndUses> SqlFile_Impl::endUses() const {
     EndUses result;
 
+    const Matrix values = endUseValues();
+    bool found = false;
     for (EndUseFuelType fuelType : result.fuelTypes()) {
-      std::string units = result.getUnitsForFuelType(fuelType);
       for (EndUseCategoryType category : result.categories()) {
+        const double value = values(fuelType.value(), category.value());
+        // Fuel types that this version of EnergyPlus does not report
+        if (std::isnan(value)) {
+          continue;
+        }
+        found = true;
 
-        std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
-                            "(ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='"
-                            + fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-        boost::optional<double> value = execAndReturnFirstDouble(query);
-        OS_ASSERT(value);
-
-        if (*value != 0.0) {
-          result.addEndUse(*value, fuelType, category);
+        if (value != 0.0) {
+          result.addEndUse(value, fuelType, category);
         }
       }
     }
 
+    if (!found) {
+      return boost::none;
+    }
+
     return result;
   }
 
   OptionalDouble SqlFile_Impl::electricityHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Electricity", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Natural Gas", "GJ");
   }
   OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Natural Gas", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Natural Gas", "GJ");
   }
 
   /* Gasoline */
   OptionalDouble SqlFile_Impl::gasolineHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Gasoline", "GJ");
   }
   OptionalDouble SqlFile_Impl::gasolineExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolinePumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Gasoline", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::gasolineTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Gasoline') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Gasoline", "GJ");
   }
 
   /* Diesel */
   OptionalDouble SqlFile_Impl::dieselHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Diesel", "GJ");
   }
   OptionalDouble SqlFile_Impl::dieselExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Diesel", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::dieselTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Diesel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Diesel", "GJ");
   }
 
   /* Coal */
   OptionalDouble SqlFile_Impl::coalHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Coal", "GJ");
   }
   OptionalDouble SqlFile_Impl::coalExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Coal", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::coalTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Coal') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Coal", "GJ");
   }
 
   /* Fuel Oil No 1 */
   OptionalDouble SqlFile_Impl::fuelOilNo1Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Fuel Oil No 1", "GJ");
   }
   OptionalDouble SqlFile_Impl::fuelOilNo1ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Fuel Oil No 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo1TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 1') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Fuel Oil No 1", "GJ");
   }
 
   /* Fuel Oil No 2 */
   OptionalDouble SqlFile_Impl::fuelOilNo2Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Fuel Oil No 2", "GJ");
   }
   OptionalDouble SqlFile_Impl::fuelOilNo2ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Fuel Oil No 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::fuelOilNo2TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Fuel Oil No 2') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Fuel Oil No 2", "GJ");
   }
 
   /* Propane */
   OptionalDouble SqlFile_Impl::propaneHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Propane", "GJ");
   }
   OptionalDouble SqlFile_Impl::propaneExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propanePumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Propane", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::propaneTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Propane') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Propane", "GJ");
   }
 
   /* Other Fuel 1 */
   OptionalDouble SqlFile_Impl::otherFuel1Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Other Fuel 1", "GJ");
   }
   OptionalDouble SqlFile_Impl::otherFuel1ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Other Fuel 1", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel1TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 1') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Other Fuel 1", "GJ");
   }
 
   /* Other Fuel 2 */
   OptionalDouble SqlFile_Impl::otherFuel2Heating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Cooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2InteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2ExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2InteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Other Fuel 2", "GJ");
   }
   OptionalDouble SqlFile_Impl::otherFuel2ExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Fans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Pumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2HeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Humidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2HeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2WaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Refrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2Generators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuel2TotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Other Fuel 2') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Other Fuel 2", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Cooling", "GJ");
   }
 
   OptionalDouble addTwoOptionalDoubles(OptionalDouble val1_, OptionalDouble val2_) {
@@ -2344,285 +2272,211 @@ namespace detail {
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Heating Water", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Heating Water", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Interior Lights') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lights", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lights", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Heating Water", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Heating Water", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Heating Water", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Water') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Heating Water",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Heating') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Heating Steam", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Cooling') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Heating Steam", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Interior Lights') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lights", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lights", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Fans') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Heating Steam", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Pumps') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Heating Steam", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Humidification') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Generators') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Heating Steam", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingSteamTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating Steam') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Heating Steam",
+                            "GJ");
   }
 
   OptionalDouble SqlFile_Impl::waterHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+    return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Water", "m3");
   }
 
   OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time "
-      "Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Heating') AND (Units = 'hr')");
+    return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Heating", "hr");
   }
 
   OptionalDouble SqlFile_Impl::hoursCoolingSetpointNotMet() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time "
-      "Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Cooling') AND (Units = 'hr')");
+    return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Cooling", "hr");
   }
 
   std::vector<std::string> SqlFile_Impl::availableEnvPeriods() const {
@@ -21,6 +21,7 @@
 
 #include <boost/optional.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -44,7 +45,9 @@ namespace detail {
     /// or if file is not valid
     /// createIndexes will create useful indexes when opening an sqlite file but for faster opening
     /// pass in false if those indexes are not needed
-    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true);
+    /// if readOnly is true, the file is opened with SQLITE_OPEN_READONLY and is never written to. The indexes are then created on an
+    /// in-memory copy of the database, see SqlFile::openReadOnly
+    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true, const bool readOnly = false);
 
     /// createIndexes will create useful indexes when creating an sqlite file but for faster creation
     /// pass in false if those indexes are not needed
@@ -63,6 +66,9 @@ namespace detail {
     /// returns whether or not connection is open
     bool connectionOpen() const;
 
+    /// returns whether the file was opened in read-only mode
+    bool isReadOnly() const;
+
     /// get the path
     openstudio::path path() const;
 
@@ -124,6 +130,15 @@ namespace detail {
                                                     const openstudio::EndUseCategoryType& t_categoryType,
                                                     const openstudio::MonthOfYear& t_monthOfYear) const;
 
+    /// Returns the End Uses table of the AnnualBuildingUtilityPerformanceSummary report, read in a single query, see SqlFile::endUseValues
+    Matrix endUseValues() const;
+
+    /// Returns the monthly energy consumption of all fuel types and categories, read in a single query, see SqlFile::energyConsumptionByMonth
+    std::vector<Matrix> energyConsumptionByMonth() const;
+
+    /// Returns the monthly energy demand of all fuel types and categories, read in a single query, see SqlFile::peakEnergyDemandByMonth
+    std::vector<Matrix> peakEnergyDemandByMonth() const;
+
     /// Returns the total energy cost over the analysis period in dollars according to the discounting convention.
     /// Requires EnergyPlus simulation output and LifeCycleCost_Parameters input object to calculate.
     boost::optional<double> economicsEnergyCost() const;
@@ -1247,6 +1262,8 @@ namespace detail {
       constexpr auto SQLITE_ERROR = 1;
       auto code = SQLITE_ERROR;
       if (m_db) {
+        // The statement may modify the tabular data
+        clearTabularDataCache();
         PreparedStatement stmt(statement, m_db, false, args...);
         code = stmt.execute();
       }
@@ -1293,9 +1310,22 @@ namespace detail {
     // return an Assembly Visible Transmittance value for matching subSurfaceName (RowName)
     boost::optional<double> assemblyVisibleTransmittance(const std::string& subSurfaceName) const;
 
+    // return the first Value of the TabularDataWithStrings view matching all arguments, same as
+    // "SELECT Value FROM TabularDataWithStrings WHERE ReportName=? AND ReportForString=? AND TableName=? AND RowName=? AND ColumnName=? AND Units=?"
+    // The view is read once on first use and indexed in memory, so subsequent lookups do not query the database
+    boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                             const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+    // same as above, for any Units
+    boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                             const std::string& rowName, const std::string& columnName) const;
+
    private:
     void init();
 
+    // memory maps the file, enlarges the page cache and forbids writes. Copies the database to memory first if m_inMemoryIndexes
+    void initReadOnly();
+
     void retrieveDataDictionary();
 
     // executes **MULTIPLE** statement and throws if it failed, used for create/drop tables.
@@ -1309,10 +1339,19 @@ namespace detail {
       if (!m_connectionOpen) {
         throw std::runtime_error("Error executing SQL statement as database connection is not open.");
       }
+      clearTabularDataCache();
       PreparedStatement stmt(bindingStatement, m_db, false, args...);
       stmt.execAndThrowOnError();
     }
 
+    // In-memory index of the TabularDataWithStrings view, used by tabularDataValue
+    struct TabularDataCache;
+    const TabularDataCache& tabularDataCache() const;
+    void clearTabularDataCache() const;
+
+    // One matrix per month of the BUILDING ENERGY PERFORMANCE reports, for energy (J) or peak demand (W)
+    std::vector<Matrix> buildingEnergyPerformanceByMonth(bool peakDemand) const;
+
     void addSimulation(const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime, const openstudio::Calendar& t_calendar);
     int getNextIndex(const std::string& t_tableName, const std::string& t_columnName);
 
@@ -1350,6 +1389,17 @@ namespace detail {
 
     bool m_illuminanceMapHasOnly2RefPts;
 
+    bool m_readOnly = false;
+
+    // Only used in read-only mode, where indexes cannot be added to the file
+    bool m_inMemoryIndexes = false;
+
+    // Loaded on first use, cleared when the file is closed or modified
+    mutable std::unique_ptr<TabularDataCache> m_tabularDataCache;
+    mutable boost::optional<Matrix> m_endUseValues;
+    mutable boost::optional<std::vector<Matrix>> m_energyConsumptionByMonth;
+    mutable boost::optional<std::vector<Matrix>> m_peakEnergyDemandByMonth;
+
     REGISTER_LOGGER("openstudio.energyplus.SqlFile");
   };
 
@@ -27,7 +27,9 @@
 
 #include <algorithm>
 #include <iostream>
+#include <boost/algorithm/string.hpp>
 #include <boost/regex.hpp>
+#include <cmath>
 #include <resources.hxx>
 #include <stdexcept>
 
@@ -81,6 +83,43 @@ TEST_F(SqlFileFixture, FuelTypes) {
   EXPECT_NEAR(725.33, *(sqlFile3.districtHeatingTotalEndUses()), 2);
 }
 
+TEST_F(SqlFileFixture, TabularDataValue) {
+  // The in-memory index returns the same values as querying the TabularDataWithStrings view
+  auto query = [](const openstudio::SqlFile& sql, const std::string& tableName, const std::string& rowName, const std::string& columnName,
+                  const std::string& units) {
+    return sql.execAndReturnFirstDouble(
+      "SELECT Value FROM TabularDataWithStrings WHERE ReportName='AnnualBuildingUtilityPerformanceSummary' AND ReportForString='Entire Facility' "
+      "AND TableName=? AND RowName=? AND ColumnName=? AND Units=?",
+      tableName, rowName, columnName, units);
+  };
+
+  for (const auto& sql : {sqlFile, sqlFile3}) {
+    for (const std::string rowName : {"Net Site Energy", "Total Site Energy", "Net Source Energy", "Total Source Energy"}) {
+      auto expected = query(sql, "Site and Source Energy", rowName, "Total Energy", "GJ");
+      ASSERT_TRUE(expected) << rowName;
+      auto value = sql.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", rowName,
+                                        "Total Energy", "GJ");
+      ASSERT_TRUE(value) << rowName;
+      EXPECT_DOUBLE_EQ(*expected, *value) << rowName;
+    }
+
+    auto expected = query(sql, "End Uses", "Exterior Equipment", "Electricity", "GJ");
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(sql.electricityExteriorEquipment());
+    EXPECT_DOUBLE_EQ(*expected, *sql.electricityExteriorEquipment());
+
+    // Any units
+    auto value = sql.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity");
+    ASSERT_TRUE(value);
+    EXPECT_DOUBLE_EQ(*expected, *value);
+
+    // No match
+    EXPECT_FALSE(sql.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity",
+                                      "kBtu"));
+    EXPECT_FALSE(sql.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Not A Row", "Electricity"));
+  }
+}
+
 TEST_F(SqlFileFixture, EnvPeriods) {
   std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
   ASSERT_FALSE(availableEnvPeriods.empty());
@@ -209,6 +248,44 @@ TEST_F(SqlFileFixture, BadStatement) {
   }
 }
 
+TEST_F(SqlFileFixture, ReadOnly) {
+  openstudio::path p = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileReadOnly.sql");
+  openstudio::filesystem::copy_file(resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql"), p,
+                                    openstudio::filesystem::copy_options::overwrite_existing);
+  const auto fileSize = openstudio::filesystem::file_size(p);
+  const auto lastWriteTime = openstudio::filesystem::last_write_time(p);
+
+  {
+    // Several readers at once, with and without in-memory indexes
+    openstudio::SqlFile sql1 = openstudio::SqlFile::openReadOnly(p);
+    openstudio::SqlFile sql2 = openstudio::SqlFile::openReadOnly(p, true);
+    for (auto sql : {sql1, sql2}) {
+      ASSERT_TRUE(sql.connectionOpen());
+      EXPECT_TRUE(sql.isReadOnly());
+
+      ASSERT_TRUE(sql.netSiteEnergy());
+      EXPECT_DOUBLE_EQ(*sqlFile.netSiteEnergy(), *sql.netSiteEnergy());
+      EXPECT_EQ(sqlFile.availableEnvPeriods(), sql.availableEnvPeriods());
+      EXPECT_EQ(sqlFile.availableTimeSeries().size(), sql.availableTimeSeries().size());
+
+      // Writes are refused
+      sql.execute("CREATE TABLE ReadOnlyTest (Value INTEGER);");
+      auto count = sql.execAndReturnFirstInt("SELECT COUNT(*) FROM sqlite_master WHERE name='ReadOnlyTest'");
+      ASSERT_TRUE(count);
+      EXPECT_EQ(0, *count);
+    }
+
+    auto index = sql2.execAndReturnFirstString("SELECT name FROM sqlite_master WHERE type='index' AND name='rdDI'");
+    EXPECT_TRUE(index);
+  }
+
+  EXPECT_FALSE(openstudio::SqlFile::openReadOnly(openstudio::tempDir() / openstudio::toPath("DoesNotExist.sql")).connectionOpen());
+
+  // The file was not touched
+  EXPECT_EQ(fileSize, openstudio::filesystem::file_size(p));
+  EXPECT_EQ(lastWriteTime, openstudio::filesystem::last_write_time(p));
+}
+
 TEST_F(SqlFileFixture, CreateSqlFile) {
   openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTest.sql");
   if (openstudio::filesystem::exists(outfile)) {
@@ -804,6 +881,61 @@ TEST_F(SqlFileFixture, EndUseFuelTypes_test) {
   }
 }
 
+TEST_F(SqlFileFixture, EndUseValues) {
+  // The bulk queries return the same values as querying each cell
+  const openstudio::Matrix endUseValues = sqlFile3.endUseValues();
+  const std::vector<openstudio::Matrix> consumption = sqlFile3.energyConsumptionByMonth();
+  const std::vector<openstudio::Matrix> demand = sqlFile3.peakEnergyDemandByMonth();
+  ASSERT_EQ(12, consumption.size());
+  ASSERT_EQ(12, demand.size());
+
+  for (const openstudio::EndUseFuelType& fuelType : openstudio::EndUses::fuelTypes()) {
+    for (const openstudio::EndUseCategoryType& category : openstudio::EndUses::categories()) {
+      auto expected = sqlFile3.execAndReturnFirstDouble(
+        "SELECT Value FROM TabularDataWithStrings WHERE ReportName='AnnualBuildingUtilityPerformanceSummary' AND ReportForString='Entire Facility' "
+        "AND TableName='End Uses' AND RowName=? AND ColumnName=? AND Units=?",
+        category.valueDescription(), fuelType.valueDescription(), openstudio::EndUses::getUnitsForFuelType(fuelType));
+      const double value = endUseValues(fuelType.value(), category.value());
+      if (expected) {
+        EXPECT_DOUBLE_EQ(*expected, value) << fuelType.valueName() << ", " << category.valueName();
+      } else {
+        EXPECT_TRUE(std::isnan(value)) << fuelType.valueName() << ", " << category.valueName();
+      }
+
+      const std::string columnName = boost::algorithm::to_upper_copy(category.valueName()) + ":"
+                                     + boost::algorithm::to_upper_copy(boost::algorithm::erase_all_copy(fuelType.valueDescription(), " "));
+      for (int month = 1; month <= 12; ++month) {
+        const std::string rowName = openstudio::MonthOfYear(month).valueDescription();
+        expected = sqlFile3.execAndReturnFirstDouble(
+          "SELECT Value FROM TabularDataWithStrings WHERE ReportName=? AND ReportForString='Meter' AND RowName=? AND ColumnName=? AND Units='J'",
+          "BUILDING ENERGY PERFORMANCE - " + boost::algorithm::to_upper_copy(fuelType.valueDescription()), rowName, columnName);
+        auto cell = sqlFile3.energyConsumptionByMonth(fuelType, category, openstudio::MonthOfYear(month));
+        ASSERT_EQ(expected.has_value(), cell.has_value()) << fuelType.valueName() << ", " << category.valueName() << ", " << rowName;
+        if (expected) {
+          EXPECT_DOUBLE_EQ(*expected, consumption[month - 1](fuelType.value(), category.value()));
+          EXPECT_DOUBLE_EQ(*expected, *cell);
+        }
+
+        expected = sqlFile3.execAndReturnFirstDouble(
+          "SELECT Value FROM TabularDataWithStrings WHERE ReportName=? AND ReportForString='Meter' AND RowName=? AND ColumnName=? AND Units='W'",
+          "BUILDING ENERGY PERFORMANCE - " + boost::algorithm::to_upper_copy(fuelType.valueDescription()) + " PEAK DEMAND", rowName,
+          columnName + " {AT MAX/MIN}");
+        cell = sqlFile3.peakEnergyDemandByMonth(fuelType, category, openstudio::MonthOfYear(month));
+        ASSERT_EQ(expected.has_value(), cell.has_value()) << fuelType.valueName() << ", " << category.valueName() << ", " << rowName;
+        if (expected) {
+          EXPECT_DOUBLE_EQ(*expected, demand[month - 1](fuelType.value(), category.value()));
+          EXPECT_DOUBLE_EQ(*expected, *cell);
+        }
+      }
+    }
+  }
+
+  auto endUses = sqlFile3.endUses();
+  ASSERT_TRUE(endUses);
+  EXPECT_DOUBLE_EQ(endUseValues(openstudio::EndUseFuelType::Electricity, openstudio::EndUseCategoryType::ExteriorEquipment),
+                   endUses->getEndUse(openstudio::EndUseFuelType::Electricity, openstudio::EndUseCategoryType::ExteriorEquipment));
+}
+
 TEST_F(SqlFileFixture, 4298_YearField) {
   // Test for #4298 - Issue just an Info message if there is no 'Year' field in the SQL
   // but you have zero timeseries a reporting frequency lower than 'Runperiod'
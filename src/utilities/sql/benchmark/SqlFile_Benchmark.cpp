@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../SqlFile.hpp"
+#include "../../data/EndUses.hpp"
+#include "../../core/Filesystem.hpp"
+
+#include <resources.hxx>
+
+#include <OpenStudio.hxx>
+
+#include <string>
+
+using namespace openstudio;
+
+// Every (fuel type, category) of the End Uses table, as read by SqlFile::endUses
+static double queryEndUses(const SqlFile& sqlFile) {
+  double total = 0.0;
+  for (const EndUseFuelType& fuelType : EndUses::fuelTypes()) {
+    const std::string units = EndUses::getUnitsForFuelType(fuelType);
+    for (const EndUseCategoryType& category : EndUses::categories()) {
+      boost::optional<double> value = sqlFile.execAndReturnFirstDouble(
+        "SELECT Value FROM TabularDataWithStrings WHERE ReportName='AnnualBuildingUtilityPerformanceSummary' AND ReportForString='Entire Facility' "
+        "AND TableName='End Uses' AND RowName=? AND ColumnName=? AND Units=?",
+        category.valueDescription(), fuelType.valueDescription(), units);
+      total += value.value_or(0.0);
+    }
+  }
+  return total;
+}
+
+static double lookupEndUses(const SqlFile& sqlFile) {
+  double total = 0.0;
+  for (const EndUseFuelType& fuelType : EndUses::fuelTypes()) {
+    const std::string units = EndUses::getUnitsForFuelType(fuelType);
+    for (const EndUseCategoryType& category : EndUses::categories()) {
+      boost::optional<double> value = sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses",
+                                                               category.valueDescription(), fuelType.valueDescription(), units);
+      total += value.value_or(0.0);
+    }
+  }
+  return total;
+}
+
+// state.range(0): 0 to reuse an open SqlFile, 1 to open the file in each iteration (includes loading the tabular data index)
+static void BM_SqlFile_EndUses_Query(benchmark::State& state, const std::string& testCase) {
+  const path sqlPath = resourcesPath() / toPath(testCase);
+  const bool reopen = (state.range(0) != 0);
+
+  boost::optional<SqlFile> sqlFile = SqlFile(sqlPath, false);
+  for (auto _ : state) {
+    if (reopen) {
+      sqlFile.reset();
+      sqlFile = SqlFile(sqlPath, false);
+    }
+    benchmark::DoNotOptimize(queryEndUses(*sqlFile));
+  }
+}
+
+static void BM_SqlFile_EndUses_TabularDataValue(benchmark::State& state, const std::string& testCase) {
+  const path sqlPath = resourcesPath() / toPath(testCase);
+  const bool reopen = (state.range(0) != 0);
+
+  boost::optional<SqlFile> sqlFile = SqlFile(sqlPath, false);
+  for (auto _ : state) {
+    if (reopen) {
+      sqlFile.reset();
+      sqlFile = SqlFile(sqlPath, false);
+    }
+    benchmark::DoNotOptimize(lookupEndUses(*sqlFile));
+  }
+}
+
+BENCHMARK_CAPTURE(BM_SqlFile_EndUses_Query, 5ZoneAirCooled, std::string("energyplus/5ZoneAirCooled/eplusout.sql"))
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(0)
+  ->Arg(1);
+BENCHMARK_CAPTURE(BM_SqlFile_EndUses_TabularDataValue, 5ZoneAirCooled, std::string("energyplus/5ZoneAirCooled/eplusout.sql"))
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(0)
+  ->Arg(1);
+BENCHMARK_CAPTURE(BM_SqlFile_EndUses_Query, Office_With_Many_HVAC_Types, std::string("energyplus/Office_With_Many_HVAC_Types/eplusout.sql"))
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(0)
+  ->Arg(1);
+BENCHMARK_CAPTURE(BM_SqlFile_EndUses_TabularDataValue, Office_With_Many_HVAC_Types,
+                  std::string("energyplus/Office_With_Many_HVAC_Types/eplusout.sql"))
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(0)
+  ->Arg(1);
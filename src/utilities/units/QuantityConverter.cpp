@@ -21,6 +21,11 @@
 
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <utility>
+
 namespace openstudio {
 
 boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity& q, UnitSystem sys) const {
@@ -470,6 +475,59 @@ boost::optional<double> convert(double original, const std::string& originalUnit
   return boost::none;
 }
 
+void UnitConversionPlan::apply(const double* original, double* result, std::size_t n) const {
+  // Local copies so the compiler knows they do not alias the arrays, and can vectorize the loop
+  const double f = factor;
+  const double o = offset;
+  for (std::size_t i = 0; i < n; ++i) {
+    result[i] = f * original[i] + o;
+  }
+}
+
+std::vector<double> UnitConversionPlan::apply(const std::vector<double>& original) const {
+  std::vector<double> result(original.size());
+  apply(original.data(), result.data(), original.size());
+  return result;
+}
+
+boost::optional<UnitConversionPlan> unitConversionPlan(const std::string& originalUnits, const std::string& finalUnits) {
+  // Converting goes through UnitFactory, which is not thread safe, so plans are also computed under the lock
+  static std::mutex mutex;
+  static std::map<std::pair<std::string, std::string>, boost::optional<UnitConversionPlan>> plans;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto [it, inserted] = plans.try_emplace(std::make_pair(originalUnits, finalUnits));
+  if (!inserted) {
+    return it->second;
+  }
+
+  // Every conversion is affine, so two points give the plan, and a third one checks it
+  boost::optional<double> offset = convert(0.0, originalUnits, finalUnits);
+  boost::optional<double> factorPlusOffset = convert(1.0, originalUnits, finalUnits);
+  boost::optional<double> check = convert(1000.0, originalUnits, finalUnits);
+  if (!offset || !factorPlusOffset || !check) {
+    return boost::none;
+  }
+  UnitConversionPlan plan;
+  plan.factor = *factorPlusOffset - *offset;
+  plan.offset = *offset;
+  if (std::abs(plan.apply(1000.0) - *check) > 1.0e-9 * std::max(1.0, std::abs(*check))) {
+    LOG_FREE(Error, "openstudio.units.QuantityConverter",
+             "Conversion from '" << originalUnits << "' to '" << finalUnits << "' cannot be reduced to a factor and an offset");
+    return boost::none;
+  }
+  it->second = plan;
+  return plan;
+}
+
+boost::optional<std::vector<double>> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits) {
+  boost::optional<UnitConversionPlan> plan = unitConversionPlan(originalUnits, finalUnits);
+  if (!plan) {
+    return boost::none;
+  }
+  return plan->apply(original);
+}
+
 boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys) {
   return QuantityConverter::instance().convert(original, sys);
 }
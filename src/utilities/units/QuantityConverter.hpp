@@ -11,8 +11,10 @@
 #include "../core/Logger.hpp"
 
 #include "Unit.hpp"
+#include <cstddef>
 #include <string>
 #include <map>
+#include <vector>
 
 namespace openstudio {
 
@@ -113,6 +115,33 @@ UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, const
  *  OSQuantityVector. \relates QuantityConverterSingleton \relates OSQuantityVector */
 UTILITIES_API OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits);
 
+/** The conversion of values from one unit string to another, reduced to result = factor * value + offset. Plans are
+ *  obtained from unitConversionPlan, applying one does not allocate or parse anything. \relates QuantityConverterSingleton */
+struct UTILITIES_API UnitConversionPlan
+{
+  double factor = 1.0;
+  double offset = 0.0;
+
+  double apply(double value) const {
+    return factor * value + offset;
+  }
+
+  /** Converts the n values starting at original into result, which may be the same array */
+  void apply(const double* original, double* result, std::size_t n) const;
+
+  std::vector<double> apply(const std::vector<double>& original) const;
+};
+
+/** Returns the plan converting values from originalUnits to finalUnits, or none if convert(double, originalUnits, finalUnits)
+ *  fails. The plan is computed from that function the first time a pair of unit strings is asked for, and then cached for the
+ *  rest of the process, so that later calls cost a lookup. Safe to call from several threads. \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<UnitConversionPlan> unitConversionPlan(const std::string& originalUnits, const std::string& finalUnits);
+
+/** Non-member function converting a whole vector of values with a cached UnitConversionPlan. Results can differ from
+ *  convert(double, originalUnits, finalUnits) in the last bits. \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<std::vector<double>> convert(const std::vector<double>& original, const std::string& originalUnits,
+                                                           const std::string& finalUnits);
+
 }  // namespace openstudio
 
 #endif  // UTILITIES_UNITS_QUANTITYCONVERTER_HPP
@@ -8,6 +8,9 @@
 // hide shared_ptrs, expose helper functions
 %ignore QuantityConverterSingleton;
 %ignore QuantityConverter;
+%ignore openstudio::UnitConversionPlan::apply(const double*, double*, std::size_t) const;
 %include <utilities/units/QuantityConverter.hpp>
 
+%template(OptionalUnitConversionPlan) boost::optional<openstudio::UnitConversionPlan>;
+
 #endif // UTILITIES_UNITS_QUANTITYCONVERTER_I
@@ -0,0 +1,69 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../QuantityConverter.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+
+static std::vector<double> testValues(size_t n) {
+  std::vector<double> values(n);
+  for (size_t i = 0; i < n; ++i) {
+    values[i] = 0.5 * static_cast<double>(i);
+  }
+  return values;
+}
+
+// One call to convert per value
+static void BM_Convert_PerValue(benchmark::State& state, const std::string& originalUnits, const std::string& finalUnits) {
+  const std::vector<double> values = testValues(static_cast<size_t>(state.range(0)));
+  std::vector<double> result(values.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      result[i] = convert(values[i], originalUnits, finalUnits).get();
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// One lookup of the cached plan per value
+static void BM_UnitConversionPlan_PerValue(benchmark::State& state, const std::string& originalUnits, const std::string& finalUnits) {
+  const std::vector<double> values = testValues(static_cast<size_t>(state.range(0)));
+  std::vector<double> result(values.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      result[i] = unitConversionPlan(originalUnits, finalUnits)->apply(values[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// One lookup for the whole array
+static void BM_UnitConversionPlan_Batch(benchmark::State& state, const std::string& originalUnits, const std::string& finalUnits) {
+  const std::vector<double> values = testValues(static_cast<size_t>(state.range(0)));
+  std::vector<double> result(values.size());
+  for (auto _ : state) {
+    unitConversionPlan(originalUnits, finalUnits)->apply(values.data(), result.data(), values.size());
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_CAPTURE(BM_Convert_PerValue, W_to_Btu_h, std::string("W"), std::string("Btu/h"))->Arg(1000);
+BENCHMARK_CAPTURE(BM_UnitConversionPlan_PerValue, W_to_Btu_h, std::string("W"), std::string("Btu/h"))->Arg(1000);
+BENCHMARK_CAPTURE(BM_UnitConversionPlan_Batch, W_to_Btu_h, std::string("W"), std::string("Btu/h"))->Arg(1000)->Arg(1000000);
+
+BENCHMARK_CAPTURE(BM_Convert_PerValue, m2_to_ft2, std::string("m^2"), std::string("ft^2"))->Arg(1000);
+BENCHMARK_CAPTURE(BM_UnitConversionPlan_PerValue, m2_to_ft2, std::string("m^2"), std::string("ft^2"))->Arg(1000);
+BENCHMARK_CAPTURE(BM_UnitConversionPlan_Batch, m2_to_ft2, std::string("m^2"), std::string("ft^2"))->Arg(1000)->Arg(1000000);
+
+BENCHMARK_CAPTURE(BM_Convert_PerValue, C_to_F, std::string("C"), std::string("F"))->Arg(1000);
+BENCHMARK_CAPTURE(BM_UnitConversionPlan_Batch, C_to_F, std::string("C"), std::string("F"))->Arg(1000)->Arg(1000000);
@@ -242,3 +242,39 @@ TEST_F(UnitsFixture, QuantityConverter_Profiling_OSQuantityVector) {
   OSQuantityVector result = convert(testOSQuantityVector, UnitSystem(UnitSystem::Wh));
   EXPECT_EQ(8760u, result.size());
 }
+
+TEST_F(UnitsFixture, QuantityConverter_UnitConversionPlan) {
+  const std::vector<std::pair<std::string, std::string>> unitPairs{
+    {"m", "ft"}, {"m^2", "ft^2"}, {"W", "Btu/h"}, {"F", "C"}, {"C", "F"}, {"ft^2", "m^2"}, {"1/s", "1/h"}, {"m^3/s", "cfm"}, {"kg", "kg"},
+  };
+  const std::vector<double> values{-40.0, 0.0, 1.0, 12.5, 1.0e6};
+
+  for (const auto& [originalUnits, finalUnits] : unitPairs) {
+    boost::optional<UnitConversionPlan> plan = unitConversionPlan(originalUnits, finalUnits);
+    ASSERT_TRUE(plan) << originalUnits << " to " << finalUnits;
+
+    boost::optional<std::vector<double>> converted = convert(values, originalUnits, finalUnits);
+    ASSERT_TRUE(converted);
+    ASSERT_EQ(values.size(), converted->size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      boost::optional<double> expected = convert(values[i], originalUnits, finalUnits);
+      ASSERT_TRUE(expected);
+      EXPECT_NEAR(*expected, plan->apply(values[i]), 1.0e-12 * std::max(1.0, std::abs(*expected))) << originalUnits << " to " << finalUnits;
+      EXPECT_DOUBLE_EQ(plan->apply(values[i]), (*converted)[i]);
+    }
+  }
+
+  EXPECT_NEAR(-40.0, unitConversionPlan("F", "C")->apply(-40.0), 1.0e-9);
+
+  // In place
+  std::vector<double> inPlace = values;
+  unitConversionPlan("m", "ft")->apply(inPlace.data(), inPlace.data(), inPlace.size());
+  EXPECT_NEAR(12.5 / 0.3048, inPlace[3], 1.0e-9);
+
+  // Incompatible and unknown units fail, also once cached
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_FALSE(unitConversionPlan("m", "kg"));
+    EXPECT_FALSE(unitConversionPlan("not a unit", "m"));
+    EXPECT_FALSE(convert(values, "m", "kg"));
+  }
+}
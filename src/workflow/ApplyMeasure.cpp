@@ -113,15 +113,28 @@ void OSWorkflow::applyMeasures(MeasureType measureType, bool energyplus_output_r
     if (m_add_timings && m_detailed_timings) {
       m_timers->newTimer(fmt::format("Measure::{}", measureDirName), 2);
     }
+    workflow::util::Telemetry::Scope telemetryScope(
+      m_telemetry.get(), fmt::format("Measure::{}{}", measureDirName, energyplus_output_requests ? "::energyPlusOutputRequests" : ""), "measure");
+    auto recordModelSizes = [this, &telemetryScope](const std::string& suffix) {
+      if (m_telemetry) {
+        telemetryScope.setArg("model_objects_" + suffix, model.numObjects());
+        if (workspace_) {
+          telemetryScope.setArg("workspace_objects_" + suffix, workspace_->numObjects());
+        }
+      }
+    };
+    recordModelSizes("before");
+
     openstudio::filesystem::path curDirPath = boost::filesystem::current_path();
 
-    auto ensureBlock = [this, &curDirPath](bool stepHasThrown) {
+    auto ensureBlock = [this, &curDirPath, &recordModelSizes](bool stepHasThrown) {
       if (m_add_timings && m_detailed_timings) {
         m_timers->tockCurrentTimer();
         if (stepHasThrown) {
           m_timers->tockCurrentTimer();
         }
       }
+      recordModelSizes("after");
       boost::filesystem::current_path(curDirPath);
     };
 
@@ -24,6 +24,7 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/data/Variant.hpp"
 #include "../utilities/filetypes/WorkflowStep.hpp"
+#include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/Workspace.hpp"
 #include "../energyplus/ForwardTranslator.hpp"
 
@@ -31,10 +32,12 @@
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
+#include <fmt/ranges.h>
 #include <json/json.h>
 
 #include <array>
 #include <chrono>
+#include <future>
 #include <limits>
 #include <string_view>
 #include <stdexcept>
@@ -78,7 +81,10 @@ OSWorkflow::OSWorkflow(const WorkflowRunOptions& t_workflowRunOptions, ScriptEng
     m_post_process_only(t_workflowRunOptions.post_process_only),
     m_show_stdout(t_workflowRunOptions.show_stdout),
     m_add_timings(t_workflowRunOptions.add_timings),
-    m_style_stdout(t_workflowRunOptions.style_stdout) {
+    m_style_stdout(t_workflowRunOptions.style_stdout),
+    m_add_telemetry(t_workflowRunOptions.telemetry || t_workflowRunOptions.trace),
+    m_trace(t_workflowRunOptions.trace),
+    m_stateCallback(t_workflowRunOptions.state_callback) {
 
   runner.setRegisterMsgAlsoLogs(true);
 
@@ -86,6 +92,13 @@ OSWorkflow::OSWorkflow(const WorkflowRunOptions& t_workflowRunOptions, ScriptEng
     m_timers = std::make_unique<workflow::util::TimerCollection>();
   }
 
+  if (!t_workflowRunOptions.run_dir.empty()) {
+    workflowJSON.setRunDir(t_workflowRunOptions.run_dir);
+  }
+  if (!t_workflowRunOptions.out_path.empty()) {
+    workflowJSON.setOutPath(t_workflowRunOptions.out_path);
+  }
+
   if (t_workflowRunOptions.runOptions.debug() || (workflowJSON.runOptions() && workflowJSON.runOptions()->debug())) {
     LOG(Debug, fmt::format("Original workflowJSON={}\n", workflowJSON.string()));
     t_workflowRunOptions.debug_print();
@@ -189,18 +202,42 @@ void OSWorkflow::applyArguments(measure::OSArgumentMap& argumentMap, const std::
   }
 }
 
-void OSWorkflow::saveOSMToRootDirIfDebug() {
-  if (!workflowJSON.runOptions() || !workflowJSON.runOptions()->debug()) {
+void OSWorkflow::saveOSMInBackground() {
+  std::vector<openstudio::path> savePaths;
+  if (!workflowJSON.runOptions()->fast()) {
+    savePaths.push_back(workflowJSON.absoluteRunDir() / "in.osm");
+  }
+  if (workflowJSON.runOptions()->debug()) {
+    LOG(Info, "Saving OSM to Root Directory");
+    savePaths.push_back(workflowJSON.absoluteRootDir() / "in.osm");
+  }
+  if (savePaths.empty()) {
     return;
   }
 
-  LOG(Info, "Saving OSM to Root Directory");
-  auto savePath = workflowJSON.absoluteRootDir() / "in.osm";
-  detailedTimeBlock("Saving OSM", [this, &savePath]() {
-    // TODO: workflow gem was actually serializating via model.to_s for speed...
-    model.save(savePath, true);
+  // The snapshot is a copy of the objects, so the model can keep being used (translated...) while the snapshot is written
+  boost::optional<IdfFile> snapshot;
+  detailedTimeBlock("Snapshotting Final OSM", [this, &snapshot]() { snapshot = model.toIdfFile(); });
+
+  // The snapshot is serialized once, the other paths get a copy of the file
+  ++m_osmSerializations;
+  m_osmSerializationsAvoided += static_cast<unsigned>(savePaths.size() - 1);
+
+  m_osmWrite = std::async(std::launch::async, [snapshot = std::move(*snapshot), savePaths = std::move(savePaths)]() mutable {
+    if (!snapshot.save(savePaths.front(), true)) {
+      throw std::runtime_error(fmt::format("Could not save OSM to {}", savePaths.front()));
+    }
+    for (size_t i = 1; i < savePaths.size(); ++i) {
+      openstudio::filesystem::copy_file(savePaths.front(), savePaths[i], openstudio::filesystem::copy_options::overwrite_existing);
+    }
+    LOG(Info, "Saved OSM as " << fmt::format("{}", fmt::join(savePaths, ", ")));
   });
-  LOG(Info, "Saved OSM as " << savePath);
+}
+
+void OSWorkflow::waitForOSMWrite() {
+  if (m_osmWrite.valid()) {
+    detailedTimeBlock("Waiting for OSM to be saved", [this]() { m_osmWrite.get(); });
+  }
 }
 
 void OSWorkflow::saveIDFToRootDirIfDebug() {
@@ -237,6 +274,18 @@ void standardFormatterWithStringSeverity(boost::log::record_view const& rec, boo
        << rec[boost::log::expressions::smessage];
 }
 
+const std::array<std::pair<std::string_view, OSWorkflow::JobInfo>, 9> OSWorkflow::known_jobs{{
+  {"Initialization", {&OSWorkflow::runInitialization, true}},
+  {"OpenStudioMeasures", {&OSWorkflow::runOpenStudioMeasures, true}},
+  {"Translator", {&OSWorkflow::runTranslator, true}},
+  {"EnergyPlusMeasures", {&OSWorkflow::runEnergyPlusMeasures, true}},
+  {"PreProcess", {&OSWorkflow::runPreProcess, true}},
+  {"EnergyPlus", {&OSWorkflow::runEnergyPlus, true}},
+  {"ReportingMeasures", {&OSWorkflow::runReportingMeasures, true}},
+  {"PostProcess", {&OSWorkflow::runPostProcess, true}},
+  {"Cleanup", {&OSWorkflow::runCleanup, true}},
+}};
+
 bool OSWorkflow::run() {
 
   // If the user passed something like `openstudio --loglevel Trace run --debug -w workflow.osw`, we retain the Trace
@@ -286,6 +335,10 @@ bool OSWorkflow::run() {
     LOG(Debug, "Removing existing run directory: " << runDirPath);
   }
 
+  if (m_add_telemetry) {
+    m_telemetry = std::make_unique<workflow::util::Telemetry>();
+  }
+
   // Communicate that the workflow has been started
   LOG(Debug, "Registering that the workflow has started with the adapter");
   {
@@ -330,12 +383,6 @@ bool OSWorkflow::run() {
     }
   };
 
-  struct JobInfo
-  {
-    memJobFunPtr jobFun;
-    bool selected = true;
-  };
-
   struct JobMap
   {
     std::array<std::pair<std::string_view, JobInfo>, 9> data;
@@ -370,21 +417,37 @@ bool OSWorkflow::run() {
     }
   };
 
-  // Can't use a regular map, it's not retaining order
-  static constexpr std::array<std::pair<std::string_view, JobInfo>, 9> known_jobs{{
-    {"Initialization", {&OSWorkflow::runInitialization, true}},
-    {"OpenStudioMeasures", {&OSWorkflow::runOpenStudioMeasures, true}},
-    {"Translator", {&OSWorkflow::runTranslator, true}},
-    {"EnergyPlusMeasures", {&OSWorkflow::runEnergyPlusMeasures, true}},
-    {"PreProcess", {&OSWorkflow::runPreProcess, true}},
-    {"EnergyPlus", {&OSWorkflow::runEnergyPlus, true}},
-    {"ReportingMeasures", {&OSWorkflow::runReportingMeasures, true}},
-    {"PostProcess", {&OSWorkflow::runPostProcess, true}},
-    {"Cleanup", {&OSWorkflow::runCleanup, true}},
-  }};
-
   JobMap jobMap{{known_jobs}};
 
+  // Lets the caller know (and possibly wait) when the workflow enters and leaves a state, cf WorkflowRunOptions::state_callback
+  class StateScope
+  {
+   public:
+    StateScope(const std::function<void(std::string_view, bool)>& callback, std::string_view state) : m_callback(callback), m_state(state) {
+      if (m_callback) {
+        m_callback(m_state, true);
+      }
+    }
+    // The state is left while unwinding too, a callback that throws must not terminate the program
+    ~StateScope() {
+      if (m_callback) {
+        try {
+          m_callback(m_state, false);
+        } catch (std::exception& e) {
+          LOG(Error, fmt::format("Failed to notify that state '{}' was left with message: '{}'", m_state, e.what()));
+        } catch (...) {
+          LOG(Error, fmt::format("Failed to notify that state '{}' was left", m_state));
+        }
+      }
+    }
+    StateScope(const StateScope&) = delete;
+    StateScope& operator=(const StateScope&) = delete;
+
+   private:
+    const std::function<void(std::string_view, bool)>& m_callback;
+    std::string_view m_state;
+  };
+
   if (m_no_simulation) {
     jobMap.at("Initialization").selected = true;
     jobMap.at("OpenStudioMeasures").selected = true;
@@ -420,6 +483,8 @@ bool OSWorkflow::run() {
     LOG(Debug, fmt::format("{} - selected = {}\n", jobName, jobInfo.selected));
     if (jobInfo.selected) {
       try {
+        const StateScope stateScope(m_stateCallback, jobName);
+        const workflow::util::Telemetry::Scope telemetryScope(m_telemetry.get(), std::string{jobName}, "state");
         timeJob(jobInfo.jobFun, std::string{jobName});
       } catch (std::exception& e) {
         if (m_add_timings) {
@@ -438,6 +503,15 @@ bool OSWorkflow::run() {
     }
   }
 
+  // The in.osm is zipped with the results, and the workflow may have stopped before the state that waits for it
+  try {
+    waitForOSMWrite();
+  } catch (std::exception& e) {
+    lastFatalError = fmt::format("Found error while saving the OSM with message: '{}'", e.what());
+    LOG(Error, lastFatalError);
+    state = State::Errored;
+  }
+
   // TODO: Is this really necessary? Seems like it's done before already (in RunPreProcess)
   if (workspace_) {
     // Save final IDF
@@ -472,6 +546,10 @@ bool OSWorkflow::run() {
     }
   }
 
+  if (m_telemetry) {
+    communicateTelemetry();
+  }
+
   if (!workflowJSON.runOptions()->fast()) {
     // Save workflow
     if (m_add_timings) {
@@ -503,12 +581,21 @@ bool OSWorkflow::run() {
 
   if (m_add_timings) {
     fmt::print("\nTiming:\n\n{}\n", m_timers->timeReport());
-    // TODO: create profile.json in the run folder
+    fmt::print("OSM serializations: {} ({} avoided by copying the serialized snapshot)\n", m_osmSerializations, m_osmSerializationsAvoided);
   }
 
   return (state == State::Finished);
 }
 
+std::vector<std::string> OSWorkflow::stateNames() {
+  std::vector<std::string> result;
+  result.reserve(known_jobs.size());
+  for (const auto& [jobName, jobInfo] : known_jobs) {
+    result.emplace_back(jobName);
+  }
+  return result;
+}
+
 Json::Value outputAttributesToJSON(const std::map<std::string, std::map<std::string, openstudio::Variant>>& output_attributes,
                                    bool sanitize = false) {
   Json::Value root(Json::objectValue);
@@ -647,6 +734,28 @@ void OSWorkflow::runExtractInputsAndOutputs() const {
   }
 }
 
+void OSWorkflow::communicateTelemetry() {
+  Json::Value telemetry = m_telemetry->toJSON();
+  telemetry["osm_serializations"] = m_osmSerializations;
+  telemetry["osm_serializations_avoided"] = m_osmSerializationsAvoided;
+  workflowJSON.setTelemetry(telemetry);
+
+  Json::StreamWriterBuilder wbuilder;
+  wbuilder["indentation"] = "  ";
+
+  auto writeJSON = [&wbuilder](const Json::Value& root, const openstudio::path& jsonPath) {
+    openstudio::filesystem::ofstream file(jsonPath);
+    OS_ASSERT(file.is_open());
+    file << Json::writeString(wbuilder, root);
+    file.close();
+  };
+
+  writeJSON(telemetry, workflowJSON.absoluteRunDir() / "telemetry.json");
+  if (m_trace) {
+    writeJSON(m_telemetry->toChromeTrace(), workflowJSON.absoluteRunDir() / "trace.json");
+  }
+}
+
 void OSWorkflow::communicateResults() const {
   if (!workflowJSON.runOptions()->skipZipResults()) {
     if (m_add_timings) {
@@ -6,6 +6,7 @@
 #ifndef WORKFLOW_OSWORKFLOW_HPP
 #define WORKFLOW_OSWORKFLOW_HPP
 
+#include "Telemetry.hpp"
 #include "Timer.hpp"
 
 #include "../measure/OSRunner.hpp"
@@ -15,9 +16,15 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/filetypes/RunOptions.hpp"
 
+#include <array>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #define USE_RUBY_ENGINE 1
 #define USE_PYTHON_ENGINE 1
@@ -40,6 +47,9 @@ class OSWorkflow
 
   bool run();
 
+  /** The names of the states a workflow goes through, in order. */
+  static std::vector<std::string> stateNames();
+
  private:
   REGISTER_LOGGER("openstudio.workflow.OSWorkflow");
 #if USE_RUBY_ENGINE
@@ -58,6 +68,14 @@ class OSWorkflow
   // TODO: use a unique_ptr or an Instance?
   std::unique_ptr<workflow::util::TimerCollection> m_timers = nullptr;
 
+  std::future<void> m_osmWrite;
+  // Number of times the model was serialized to an OSM, and number of serializations avoided by reusing one
+  unsigned m_osmSerializations = 0;
+  unsigned m_osmSerializationsAvoided = 0;
+
+  // Only set when the telemetry is requested, cf WorkflowRunOptions::telemetry
+  std::unique_ptr<workflow::util::Telemetry> m_telemetry = nullptr;
+
   // TODO: should problably store as json directly...
   // { measureName : { arg_name: arg_value }}
   std::map<std::string, std::map<std::string, openstudio::Variant>> output_attributes;
@@ -70,6 +88,10 @@ class OSWorkflow
   bool m_add_timings = false;
   bool m_detailed_timings = true;
   bool m_style_stdout = false;
+  bool m_add_telemetry = false;
+  bool m_trace = false;
+
+  std::function<void(std::string_view, bool)> m_stateCallback;
 
   /** @name Jobs */
   //@{
@@ -95,6 +117,15 @@ class OSWorkflow
 
   using memJobFunPtr = void (OSWorkflow::*)();
 
+  struct JobInfo
+  {
+    memJobFunPtr jobFun;
+    bool selected = true;
+  };
+
+  // The states, in the order they are run. Can't use a regular map, it's not retaining order
+  static const std::array<std::pair<std::string_view, JobInfo>, 9> known_jobs;
+
   // void timeJob(memJobFunPtr, std::string message);
 
   template <class F, class... Args>
@@ -126,7 +157,11 @@ class OSWorkflow
   void updateLastWeatherFileFromModel();
   void applyMeasures(MeasureType measureType, bool energyplus_output_requests = false);
   static void applyArguments(measure::OSArgumentMap& argumentMap, const std::string& argumentName, const openstudio::Variant& argumentValue);
-  void saveOSMToRootDirIfDebug();
+  // Snapshots the model and writes it to run/in.osm (and to the root dir if debug) on a background thread, so that it overlaps with the
+  // translation. The snapshot is serialized once and copied to the other paths
+  void saveOSMInBackground();
+  // Waits for saveOSMInBackground to be done, rethrows if it failed
+  void waitForOSMWrite();
   void saveIDFToRootDirIfDebug();
 
   // write output_attributes to the measure_attributes.json
@@ -138,6 +173,9 @@ class OSWorkflow
 
   // Zip and write data_point_out.osw
   void communicateResults() const;
+
+  // Write telemetry.json (and trace.json if requested) to the run directory and store the telemetry in the WorkflowJSON
+  void communicateTelemetry();
 };
 
 }  // namespace openstudio
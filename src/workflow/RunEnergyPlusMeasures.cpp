@@ -18,6 +18,9 @@ void OSWorkflow::runEnergyPlusMeasures() {
 
   // Weather file is handled in runInitialization
 
+  // Measures may look for run/in.osm
+  waitForOSMWrite();
+
   LOG(Info, "Beginning to execute EnergyPlus Measures.");
   applyMeasures(MeasureType::EnergyPlusMeasure, false);
   LOG(Info, "Finished applying EnergyPlus Measures.");
@@ -22,18 +22,10 @@ void OSWorkflow::runOpenStudioMeasures() {
   applyMeasures(MeasureType::ModelMeasure, false);
   LOG(Info, "Finished applying OpenStudio Measures.");
 
-  // Save final OSM
-  if (!workflowJSON.runOptions()->fast()) {
-    // Save to run dir
-    auto savePath = workflowJSON.absoluteRunDir() / "in.osm";
-    detailedTimeBlock("Saving Final OSM to Run Dir", [this, &savePath]() {
-      // TODO: workflow gem was actually serializating via model.to_s for speed...
-      model.save(savePath, true);
-    });
-  }
+  // Save final OSM, this doesn't wait for it to be written. The model is handed off to the next states in memory
+  saveOSMInBackground();
 
   communicateMeasureAttributes();
-  saveOSMToRootDirIfDebug();
 }
 
 }  // namespace openstudio
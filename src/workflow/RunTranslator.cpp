@@ -20,9 +20,30 @@
 #include "../utilities/filetypes/ForwardTranslatorOptions.hpp"
 
 #include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/Assert.hpp"
+
+#include <json/json.h>
 
 namespace openstudio {
 
+namespace {
+
+  Json::Value translationProfileToJSON(const std::vector<energyplus::TranslationProfileEntry>& profile) {
+    Json::Value root(Json::arrayValue);
+    for (const auto& entry : profile) {
+      Json::Value entryJSON(Json::objectValue);
+      entryJSON["idd_object_type"] = entry.iddObjectType.valueDescription();
+      entryJSON["count"] = entry.count;
+      entryJSON["total_time"] = entry.totalTime;
+      entryJSON["self_time"] = entry.selfTime;
+      entryJSON["idf_objects_created"] = entry.objectsCreated;
+      root.append(entryJSON);
+    }
+    return root;
+  }
+
+}  // namespace
+
 void OSWorkflow::runTranslator() {
 
   state = State::Translator;
@@ -47,14 +68,26 @@ void OSWorkflow::runTranslator() {
 
   // Translate the OSM to an IDF
   LOG(Info, "Beginning the translation to IDF")
-  detailedTimeBlock("Translating to EnergyPlus IDF", [this]() {
-    openstudio::energyplus::ForwardTranslator ft;
+  openstudio::energyplus::ForwardTranslator ft;
+  detailedTimeBlock("Translating to EnergyPlus IDF", [this, &ft]() {
     ft.setForwardTranslatorOptions(workflowJSON.runOptions()->forwardTranslatorOptions());
     workspace_ = ft.translateModel(model);
   });
 
   LOG(Info, "Successfully translated to IDF");
 
+  if (m_add_timings) {
+    // Per object type breakdown of the translation time, sorted by decreasing self time
+    Json::StreamWriterBuilder wbuilder;
+    wbuilder["indentation"] = "  ";
+    const std::string result = Json::writeString(wbuilder, translationProfileToJSON(ft.translationProfile()));
+
+    openstudio::filesystem::ofstream file(runDir / "translation_profile.json");
+    OS_ASSERT(file.is_open());
+    file << result;
+    file.close();
+  }
+
   saveIDFToRootDirIfDebug();
 }
 
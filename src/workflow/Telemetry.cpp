@@ -0,0 +1,267 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "Telemetry.hpp"
+
+#include "../utilities/time/DateTime.hpp"
+
+#include <fstream>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#  include <psapi.h>
+#else
+#  include <sys/resource.h>
+#endif
+
+namespace openstudio::workflow::util {
+
+namespace {
+
+#if defined(_WIN32)
+  double toSeconds(const FILETIME& ft) {
+    ULARGE_INTEGER value;
+    value.LowPart = ft.dwLowDateTime;
+    value.HighPart = ft.dwHighDateTime;
+    // FILETIME is in 100-nanosecond intervals
+    return static_cast<double>(value.QuadPart) / 1.0e7;
+  }
+#else
+  double toSeconds(const timeval& tv) {
+    return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1.0e6;
+  }
+
+  std::uint64_t maxRssToBytes(long maxRss) {
+#  if defined(__APPLE__)
+    // Already in bytes on macOS
+    return static_cast<std::uint64_t>(maxRss);
+#  else
+    // In kilobytes on Linux
+    return static_cast<std::uint64_t>(maxRss) * 1024;
+#  endif
+  }
+#endif
+
+  double secondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<double>(end - start).count();
+  }
+
+  long long microsecondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+  }
+
+  Json::UInt64 delta(std::uint64_t start, std::uint64_t end) {
+    return (end > start) ? (end - start) : 0;
+  }
+
+}  // namespace
+
+ResourceUsage ResourceUsage::current() {
+  ResourceUsage result;
+
+#if defined(_WIN32)
+  HANDLE process = GetCurrentProcess();
+
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  if (GetProcessTimes(process, &creationTime, &exitTime, &kernelTime, &userTime)) {
+    result.userCpu = toSeconds(userTime);
+    result.systemCpu = toSeconds(kernelTime);
+  }
+
+  PROCESS_MEMORY_COUNTERS memoryCounters;
+  if (GetProcessMemoryInfo(process, &memoryCounters, sizeof(memoryCounters))) {
+    result.peakRss = memoryCounters.PeakWorkingSetSize;
+  }
+
+  IO_COUNTERS ioCounters;
+  if (GetProcessIoCounters(process, &ioCounters)) {
+    result.ioReadBytes = ioCounters.ReadTransferCount;
+    result.ioWriteBytes = ioCounters.WriteTransferCount;
+  }
+#else
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    result.userCpu = toSeconds(usage.ru_utime);
+    result.systemCpu = toSeconds(usage.ru_stime);
+    result.peakRss = maxRssToBytes(usage.ru_maxrss);
+  }
+
+  rusage childrenUsage{};
+  if (getrusage(RUSAGE_CHILDREN, &childrenUsage) == 0) {
+    result.childrenUserCpu = toSeconds(childrenUsage.ru_utime);
+    result.childrenSystemCpu = toSeconds(childrenUsage.ru_stime);
+    result.childrenPeakRss = maxRssToBytes(childrenUsage.ru_maxrss);
+  }
+
+#  if defined(__linux__)
+  std::ifstream ifs("/proc/self/io");
+  std::string key;
+  std::uint64_t value = 0;
+  while (ifs >> key >> value) {
+    if (key == "rchar:") {
+      result.ioReadBytes = value;
+    } else if (key == "wchar:") {
+      result.ioWriteBytes = value;
+    }
+  }
+#  endif
+#endif
+
+  return result;
+}
+
+Telemetry::Telemetry() : m_startedAt(DateTime::nowUTC().toISO8601()) {}
+
+size_t Telemetry::begin(std::string name, std::string category) {
+  Span span;
+  span.name = std::move(name);
+  span.category = std::move(category);
+  span.depth = static_cast<unsigned>(m_openSpans.size());
+  span.startUsage = ResourceUsage::current();
+  span.start = ClockType::now();
+  m_spans.push_back(std::move(span));
+  m_openSpans.push_back(m_spans.size() - 1);
+  return m_spans.size() - 1;
+}
+
+void Telemetry::end(size_t index) {
+  if (index >= m_spans.size() || !m_spans[index].open) {
+    return;
+  }
+  const auto now = ClockType::now();
+  const ResourceUsage usage = ResourceUsage::current();
+  while (!m_openSpans.empty()) {
+    const size_t openIndex = m_openSpans.back();
+    m_openSpans.pop_back();
+    Span& span = m_spans[openIndex];
+    span.end = now;
+    span.endUsage = usage;
+    span.open = false;
+    if (openIndex == index) {
+      break;
+    }
+  }
+}
+
+void Telemetry::setArg(size_t index, const std::string& key, Json::Value value) {
+  if (index < m_spans.size()) {
+    m_spans[index].args[key] = std::move(value);
+  }
+}
+
+Json::Value Telemetry::toJSON() const {
+  const auto now = ClockType::now();
+  const ResourceUsage nowUsage = ResourceUsage::current();
+
+  Json::Value root(Json::objectValue);
+  root["started_at"] = m_startedAt;
+  root["elapsed"] = secondsBetween(m_start, now);
+  root["peak_rss"] = Json::UInt64(nowUsage.peakRss);
+  root["children_peak_rss"] = Json::UInt64(nowUsage.childrenPeakRss);
+
+  Json::Value spans(Json::arrayValue);
+  for (const Span& span : m_spans) {
+    const auto& end = span.open ? now : span.end;
+    const ResourceUsage& endUsage = span.open ? nowUsage : span.endUsage;
+
+    Json::Value value(Json::objectValue);
+    value["name"] = span.name;
+    value["category"] = span.category;
+    value["depth"] = span.depth;
+    value["start"] = secondsBetween(m_start, span.start);
+    value["elapsed"] = secondsBetween(span.start, end);
+    value["user_cpu"] = endUsage.userCpu - span.startUsage.userCpu;
+    value["system_cpu"] = endUsage.systemCpu - span.startUsage.systemCpu;
+    value["children_user_cpu"] = endUsage.childrenUserCpu - span.startUsage.childrenUserCpu;
+    value["children_system_cpu"] = endUsage.childrenSystemCpu - span.startUsage.childrenSystemCpu;
+    value["peak_rss"] = Json::UInt64(endUsage.peakRss);
+    value["peak_rss_increase"] = delta(span.startUsage.peakRss, endUsage.peakRss);
+    value["io_read_bytes"] = delta(span.startUsage.ioReadBytes, endUsage.ioReadBytes);
+    value["io_write_bytes"] = delta(span.startUsage.ioWriteBytes, endUsage.ioWriteBytes);
+    if (!span.args.empty()) {
+      value["args"] = span.args;
+    }
+    spans.append(std::move(value));
+  }
+  root["spans"] = std::move(spans);
+
+  return root;
+}
+
+Json::Value Telemetry::toChromeTrace() const {
+  const Json::Value telemetry = toJSON();
+
+  Json::Value events(Json::arrayValue);
+
+  Json::Value processName(Json::objectValue);
+  processName["name"] = "process_name";
+  processName["ph"] = "M";
+  processName["pid"] = 1;
+  processName["tid"] = 1;
+  processName["args"]["name"] = "openstudio run";
+  events.append(std::move(processName));
+
+  const auto& spans = telemetry["spans"];
+  for (Json::ArrayIndex i = 0; i < spans.size(); ++i) {
+    const Json::Value& span = spans[i];
+    const Span& rawSpan = m_spans[i];
+    const auto end = rawSpan.open ? ClockType::now() : rawSpan.end;
+
+    // Complete event, timestamps are in microseconds
+    Json::Value event(Json::objectValue);
+    event["name"] = span["name"];
+    event["cat"] = span["category"];
+    event["ph"] = "X";
+    event["ts"] = Json::Int64(microsecondsBetween(m_start, rawSpan.start));
+    event["dur"] = Json::Int64(microsecondsBetween(rawSpan.start, end));
+    event["pid"] = 1;
+    event["tid"] = 1;
+    Json::Value& args = event["args"];
+    for (const char* key : {"user_cpu", "system_cpu", "children_user_cpu", "children_system_cpu", "peak_rss", "io_read_bytes", "io_write_bytes"}) {
+      args[key] = span[key];
+    }
+    for (const auto& key : span["args"].getMemberNames()) {
+      args[key] = span["args"][key];
+    }
+    events.append(std::move(event));
+
+    // Counter event so the peak memory shows up as a track
+    Json::Value counter(Json::objectValue);
+    counter["name"] = "peak_rss";
+    counter["ph"] = "C";
+    counter["ts"] = Json::Int64(microsecondsBetween(m_start, end));
+    counter["pid"] = 1;
+    counter["args"]["bytes"] = span["peak_rss"];
+    events.append(std::move(counter));
+  }
+
+  Json::Value root(Json::objectValue);
+  root["traceEvents"] = std::move(events);
+  root["displayTimeUnit"] = "ms";
+  return root;
+}
+
+Telemetry::Scope::Scope(Telemetry* telemetry, std::string name, std::string category) : m_telemetry(telemetry) {
+  if (m_telemetry) {
+    m_index = m_telemetry->begin(std::move(name), std::move(category));
+  }
+}
+
+Telemetry::Scope::~Scope() {
+  if (m_telemetry) {
+    m_telemetry->end(m_index);
+  }
+}
+
+void Telemetry::Scope::setArg(const std::string& key, Json::Value value) {
+  if (m_telemetry) {
+    m_telemetry->setArg(m_index, key, std::move(value));
+  }
+}
+
+}  // namespace openstudio::workflow::util
@@ -0,0 +1,101 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef WORKFLOW_UTIL_TELEMETRY_HPP
+#define WORKFLOW_UTIL_TELEMETRY_HPP
+
+#include <json/json.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace openstudio::workflow::util {
+
+// Snapshot of the resources used by the current process so far
+struct ResourceUsage
+{
+  // CPU time in seconds
+  double userCpu = 0.0;
+  double systemCpu = 0.0;
+  // CPU time of the child processes that were waited for (ExpandObjects, EnergyPlus...), always 0 on Windows
+  double childrenUserCpu = 0.0;
+  double childrenSystemCpu = 0.0;
+  // Peak resident set size in bytes
+  std::uint64_t peakRss = 0;
+  // Peak resident set size of the largest child process waited for, always 0 on Windows
+  std::uint64_t childrenPeakRss = 0;
+  // Bytes read and written by the process (including from the page cache, and on Linux by the child processes waited for), always 0 when
+  // the platform does not report it (macOS)
+  std::uint64_t ioReadBytes = 0;
+  std::uint64_t ioWriteBytes = 0;
+
+  static ResourceUsage current();
+};
+
+// Records nested spans (states, measures...) with their wall time and resource usage, so a run can be profiled after the fact
+class Telemetry
+{
+ public:
+  Telemetry();
+
+  // Opens a span nested in the innermost open span, returns its index
+  size_t begin(std::string name, std::string category);
+
+  // Closes the span at index, and any span still open inside of it
+  void end(size_t index);
+
+  // Attaches a value to the span at index (eg: the number of model objects before and after a measure)
+  void setArg(size_t index, const std::string& key, Json::Value value);
+
+  // Spans in the order they were opened, with their depth, times in seconds since the Telemetry was created
+  Json::Value toJSON() const;
+
+  // Chrome trace event format, can be loaded in chrome://tracing or https://ui.perfetto.dev
+  Json::Value toChromeTrace() const;
+
+  // Opens a span on construction and closes it on destruction, so it is closed when an exception is thrown
+  class Scope
+  {
+   public:
+    Scope(Telemetry* telemetry, std::string name, std::string category);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    // No-op if the Telemetry passed to the constructor was null
+    void setArg(const std::string& key, Json::Value value);
+
+   private:
+    Telemetry* m_telemetry;
+    size_t m_index = 0;
+  };
+
+ private:
+  using ClockType = std::chrono::steady_clock;
+
+  struct Span
+  {
+    std::string name;
+    std::string category;
+    unsigned depth = 0;
+    ClockType::time_point start;
+    ClockType::time_point end;
+    ResourceUsage startUsage;
+    ResourceUsage endUsage;
+    Json::Value args{Json::objectValue};
+    bool open = true;
+  };
+
+  ClockType::time_point m_start = ClockType::now();
+  std::string m_startedAt;
+  std::vector<Span> m_spans;
+  std::vector<size_t> m_openSpans;
+};
+
+}  // namespace openstudio::workflow::util
+
+#endif  // WORKFLOW_UTIL_TELEMETRY_HPP
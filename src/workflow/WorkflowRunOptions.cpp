@@ -12,11 +12,18 @@ namespace openstudio {
 void WorkflowRunOptions::debug_print() const {
   fmt::print("\nWorkflowRunOptions:\n");
   fmt::print("osw_path={}\n", this->osw_path.string());
+  fmt::print("run_dir={}\n", this->run_dir.string());
+  fmt::print("out_path={}\n", this->out_path.string());
   fmt::print("no_simulation={}\n", this->no_simulation);
   fmt::print("show_stdout={}\n", this->show_stdout);
   fmt::print("add_timings={}\n", this->add_timings);
   fmt::print("style_stdout={}\n", this->style_stdout);
+  fmt::print("telemetry={}\n", this->telemetry);
+  fmt::print("trace={}\n", this->trace);
   fmt::print("socket_port={}\n", this->socket_port);
+  for (const auto& [state, limit] : this->state_limits) {
+    fmt::print("state_limits[{}]={}\n", state, limit);
+  }
 
   fmt::print("\nrunOptions={}\n", this->runOptions.string());
 
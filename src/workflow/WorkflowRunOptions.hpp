@@ -9,6 +9,11 @@
 #include "../utilities/core/Filesystem.hpp"
 #include "../utilities/filetypes/RunOptions.hpp"
 
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
 namespace openstudio {
 
 struct WorkflowRunOptions
@@ -26,11 +31,26 @@ struct WorkflowRunOptions
   bool add_timings = false;
   bool style_stdout = false;
 
+  // Record the resource usage of each state and measure to run/telemetry.json and out.osw, trace also writes run/trace.json
+  bool telemetry = false;
+  bool trace = false;
+
   // TODO: Remove
   unsigned socket_port = 0;
 
   openstudio::path osw_path = "./workflow.osw";
 
+  // When not empty, these override the run_directory and out_name of the OSW (used by run_batch to isolate OSWs that share a directory)
+  openstudio::path run_dir;
+  openstudio::path out_path;
+
+  // Maximum number of workflows in a given state at the same time (eg: {"EnergyPlus": 4}), enforced by run_batch across its workers
+  std::map<std::string, unsigned> state_limits;
+
+  // Called with (state, true) before the workflow enters a state and with (state, false) once it leaves it. It may block, which is how
+  // run_batch holds a worker until its workflow is allowed to enter a state that has a limit
+  std::function<void(std::string_view state, bool entering)> state_callback;
+
   RunOptions runOptions;
   /*
     bool m_debug = false;
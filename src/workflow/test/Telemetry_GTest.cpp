@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../Telemetry.hpp"
+
+#include <json/json.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class WorkflowFixture : public testing::Test
+{
+};
+
+using openstudio::workflow::util::ResourceUsage;
+using openstudio::workflow::util::Telemetry;
+
+TEST_F(WorkflowFixture, Telemetry_ResourceUsage) {
+  const ResourceUsage start = ResourceUsage::current();
+
+  // Burn a bit of CPU and memory
+  std::vector<double> values(1'000'000, 1.0);
+  volatile double sum = std::accumulate(values.begin(), values.end(), 0.0);
+  EXPECT_DOUBLE_EQ(1'000'000.0, sum);
+
+  const ResourceUsage end = ResourceUsage::current();
+  EXPECT_GE(end.userCpu + end.systemCpu, start.userCpu + start.systemCpu);
+  EXPECT_GT(end.peakRss, 0U);
+  EXPECT_GE(end.peakRss, start.peakRss);
+}
+
+TEST_F(WorkflowFixture, Telemetry_Spans) {
+  Telemetry telemetry;
+  {
+    Telemetry::Scope state(&telemetry, "OpenStudioMeasures", "state");
+    {
+      Telemetry::Scope measure(&telemetry, "Measure::first", "measure");
+      measure.setArg("model_objects_before", 1);
+      measure.setArg("model_objects_after", 3);
+    }
+    // A measure that throws, its span is closed when unwinding
+    try {
+      Telemetry::Scope measure(&telemetry, "Measure::second", "measure");
+      throw std::runtime_error("failed");
+    } catch (const std::runtime_error&) {
+    }
+  }
+  // A span left open is closed with the span it is nested in
+  const size_t outer = telemetry.begin("Translator", "state");
+  telemetry.begin("Inner", "block");
+  telemetry.end(outer);
+
+  // No-op without a Telemetry
+  {
+    Telemetry::Scope scope(nullptr, "Nothing", "state");
+    scope.setArg("key", 1);
+  }
+
+  const Json::Value root = telemetry.toJSON();
+  EXPECT_TRUE(root.isMember("started_at"));
+  EXPECT_GE(root["elapsed"].asDouble(), 0.0);
+
+  const Json::Value& spans = root["spans"];
+  ASSERT_EQ(5U, spans.size());
+  const std::vector<std::string> names = {"OpenStudioMeasures", "Measure::first", "Measure::second", "Translator", "Inner"};
+  const std::vector<unsigned> depths = {0, 1, 1, 0, 1};
+  for (Json::ArrayIndex i = 0; i < spans.size(); ++i) {
+    EXPECT_EQ(names[i], spans[i]["name"].asString());
+    EXPECT_EQ(depths[i], spans[i]["depth"].asUInt());
+    EXPECT_GE(spans[i]["elapsed"].asDouble(), 0.0);
+    EXPECT_GE(spans[i]["user_cpu"].asDouble(), 0.0);
+    EXPECT_TRUE(spans[i].isMember("peak_rss"));
+    EXPECT_TRUE(spans[i].isMember("io_read_bytes"));
+  }
+  EXPECT_EQ("measure", spans[1]["category"].asString());
+  EXPECT_EQ(1, spans[1]["args"]["model_objects_before"].asInt());
+  EXPECT_EQ(3, spans[1]["args"]["model_objects_after"].asInt());
+  EXPECT_FALSE(spans[2].isMember("args"));
+  // Children end before their parent
+  EXPECT_LE(spans[1]["start"].asDouble() + spans[1]["elapsed"].asDouble(), spans[0]["start"].asDouble() + spans[0]["elapsed"].asDouble());
+
+  const Json::Value trace = telemetry.toChromeTrace();
+  EXPECT_EQ("ms", trace["displayTimeUnit"].asString());
+  const Json::Value& events = trace["traceEvents"];
+  unsigned numComplete = 0;
+  for (const auto& event : events) {
+    if (event["ph"].asString() == "X") {
+      EXPECT_EQ(names[numComplete], event["name"].asString());
+      EXPECT_GE(event["dur"].asInt64(), 0);
+      ++numComplete;
+    }
+  }
+  EXPECT_EQ(5U, numComplete);
+}